@@ -0,0 +1,31 @@
+# Benchmarks are build together with the tests, but are not run by ctest,
+# run hikogui_benchmarks manually to measure performance.
+add_executable(hikogui_benchmarks)
+target_link_libraries(hikogui_benchmarks PRIVATE gtest_main hikogui)
+target_include_directories(hikogui_benchmarks PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+set_target_properties(hikogui_benchmarks PROPERTIES DEBUG_POSTFIX "-deb")
+set_target_properties(hikogui_benchmarks PROPERTIES RELEASE_POSTFIX "-rel")
+set_target_properties(hikogui_benchmarks PROPERTIES RELWITHDEBINFO_POSTFIX "-rdi")
+
+target_sources(hikogui_benchmarks PRIVATE
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/benchmark.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/char_converter_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/compiled_jsonpath_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/datum_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/deflate_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/inflate_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_document_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_reader_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/dispatch/function_timer_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_sdf_cache_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/graphic_path/bezier_curve_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/log_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/trace_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/text/text_shaper_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_text_properties_benchmarks.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_normalization_benchmarks.cpp
+)
+
+show_build_target_properties(hikogui_benchmarks)
@@ -61,18 +61,28 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_16.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_32.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_8.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/char_maps/utf_simd.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/base_n.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/bit_reader.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/bit_writer.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/BON8_view.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/compiled_jsonpath.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/datum.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/deflate.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/gzip.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/huffman.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/indent.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/inflate.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_document.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_reader.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/JSON_writer.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/jsonpath.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/codec.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/pickle.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/png_unfilter.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/SHA2.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/codec/zlib.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/color/color.hpp
@@ -92,6 +102,7 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/subsystem.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/thread.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/thread_intf.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/thread_pool.hpp
     $<$<PLATFORM_ID:Windows>:${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/thread_win32_impl.hpp>
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/unfair_mutex.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/concurrency/unfair_mutex_intf.hpp
@@ -150,6 +161,8 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_atlas_info.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_id.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_metrics.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_sdf_cache.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/glyph_sdf_tile.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/hikogui_icon.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/font/font_font.hpp
@@ -350,9 +363,12 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/counters.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/delayed_format.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/format_check.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/latency_histogram.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/log.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/log_sink.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/telemetry.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/trace.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/telemetry/trace_recorder.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/text/text.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/text/semantic_text_style.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/text/text_cursor.hpp
@@ -382,9 +398,14 @@ target_sources(hikogui INTERFACE FILE_SET hikogui_include_files TYPE HEADERS BAS
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_grapheme_cluster_breaks.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_lexical_classes.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_line_break_classes.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_line_break_transitions.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_nfc_quick_checks.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_scripts.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_sentence_break_properties.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_sentence_break_transitions.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_text_properties.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_word_break_properties.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/ucd_word_break_transitions.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_bidi.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_break_opportunity.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/hikogui/unicode/unicode_description.hpp
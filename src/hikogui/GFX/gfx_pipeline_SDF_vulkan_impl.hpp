@@ -297,48 +297,22 @@ hi_inline void gfx_pipeline_SDF::device_shared::prepare_atlas_for_rendering()
 
 /** Prepare the atlas for drawing a text.
  *
- *  +---------------------+
- *  |     draw border     |
- *  |  +---------------+  |
- *  |  | render border |  |
- *  |  |  +---------+  |  |
- *  |  |  |  glyph  |  |  |
- *  |  |  | bounding|  |  |
- *  |  |  |   box   |  |  |
- *  |  |  +---------+  |  |
- *  |  |               |  |
- *  |  +---------------+  |
- *  |                     |
- *  O---------------------+
+ * A glyph that was pre-rasterized or cached by the font_book is uploaded directly,
+ * otherwise the glyph is rasterized here, see `font_book::take_glyph_sdf_tile()`.
  */
 hi_inline void gfx_pipeline_SDF::device_shared::add_glyph_to_atlas(hi::font const &font, glyph_id glyph, glyph_atlas_info& info) noexcept
 {
-    hilet glyph_metrics = font.get_metrics(glyph);
-    hilet glyph_path = font.get_path(glyph);
-    hilet glyph_bounding_box = glyph_metrics.bounding_rectangle;
+    hilet tile = font_book::global().take_glyph_sdf_tile(font, glyph);
 
-    hilet draw_scale = scale2{drawfontSize, drawfontSize};
-    hilet draw_bounding_box = draw_scale * glyph_bounding_box;
-
-    // We will draw the font at a fixed size into the texture. And we need a border for the texture to
-    // allow proper bi-linear interpolation on the edges.
-
-    // Determine the size of the image in the atlas.
-    // This is the bounding box sized to the fixed font size and a border
-    hilet draw_offset = point2{drawBorder, drawBorder} - get<0>(draw_bounding_box);
-    hilet draw_extent = draw_bounding_box.size() + 2.0f * drawBorder;
-    hilet image_size = ceil(draw_extent);
-
-    // Transform the path to the scale of the fixed font size and drawing the bounding box inside the image.
-    hilet draw_path = (translate2{draw_offset} * draw_scale) * glyph_path;
+    hilet image_size = extent2{narrow_cast<float>(tile.image.width()), narrow_cast<float>(tile.image.height())};
 
     // Draw glyphs into staging buffer of the atlas and upload it to the correct position in the atlas.
     hilet lock = std::scoped_lock(gfx_system_mutex);
     prepareStagingPixmapForDrawing();
-    info = allocate_rect(image_size, image_size / draw_bounding_box.size());
+    info = allocate_rect(image_size, tile.border_scale);
     auto pixmap =
         stagingTexture.pixmap.subimage(0, 0, ceil_cast<size_t>(info.size.width()), ceil_cast<size_t>(info.size.height()));
-    fill(pixmap, draw_path);
+    copy(tile.image, pixmap);
     uploadStagingPixmapToAtlas(info);
 }
 
@@ -117,8 +117,8 @@ public:
         constexpr static int stagingImageHeight = 64;
 
         constexpr static float atlasTextureCoordinateMultiplier = 1.0f / atlasImageWidth;
-        constexpr static float drawfontSize = 28.0f;
-        constexpr static float drawBorder = sdf_r8::max_distance;
+        constexpr static float drawfontSize = glyph_sdf_tile::font_size;
+        constexpr static float drawBorder = glyph_sdf_tile::border;
         constexpr static float scaledDrawBorder = drawBorder / drawfontSize;
 
         gfx_device const& device;
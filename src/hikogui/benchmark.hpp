@@ -0,0 +1,55 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <print>
+#include <string_view>
+#include <cstddef>
+
+namespace hi { inline namespace v1 {
+
+/** Run a function repeatedly and measure how often it can be called per second.
+ *
+ * The function is called at least once, and then repeatedly until
+ * @a min_duration has passed.
+ *
+ * @param f The function to benchmark.
+ * @param min_duration The minimum duration to run the benchmark.
+ * @return The number of calls to @a f per second.
+ */
+template<typename F>
+[[nodiscard]] double benchmark_rate(F&& f, std::chrono::duration<double> min_duration = std::chrono::milliseconds(500))
+{
+    using clock_type = std::chrono::steady_clock;
+
+    // Warm up caches and lazily initialized tables.
+    f();
+
+    auto count = std::size_t{0};
+    auto const start = clock_type::now();
+    auto duration = std::chrono::duration<double>{};
+    do {
+        f();
+        ++count;
+        duration = clock_type::now() - start;
+    } while (duration < min_duration);
+
+    return static_cast<double>(count) / duration.count();
+}
+
+/** Print the result of a benchmark.
+ *
+ * @param name The name of the benchmark.
+ * @param value The measured value.
+ * @param unit The unit of the measured value, for example "MB/s".
+ */
+inline void benchmark_report(std::string_view name, double value, std::string_view unit)
+{
+    std::println("[ BENCHMARK] {:<48} {:>12.2f} {}", name, value, unit);
+}
+
+}} // namespace hi::v1
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "utf_simd.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <string>
@@ -15,6 +16,9 @@
 #include <bit>
 #include <compare>
 #include <array>
+#include <iterator>
+#include <optional>
+#include <ranges>
 #if defined(HI_HAS_SSE2)
 #include <emmintrin.h>
 #endif
@@ -118,6 +122,12 @@ public:
         using std::begin;
         using std::end;
 
+        if (not std::is_constant_evaluated()) {
+            if (auto r = _convert_utf<OutRange>(cbegin(src), cend(src))) {
+                return *std::move(r);
+            }
+        }
+
         hilet[size, valid] = _size(cbegin(src), cend(src));
 
         auto r = OutRange{};
@@ -157,6 +167,12 @@ public:
     {
         using std::begin;
 
+        if (not std::is_constant_evaluated()) {
+            if (auto r = _convert_utf<OutRange>(first, last)) {
+                return *std::move(r);
+            }
+        }
+
         hilet[size, valid] = _size(first, last);
         auto r = OutRange{};
         if (size == 0) {
@@ -279,6 +295,53 @@ private:
         }
     }
 
+    /** Convert valid text between UTF-8, and UTF-16 or UTF-32, using the algorithms in utf_simd.hpp.
+     *
+     * @return The converted text, or empty if the text is invalid, or the conversion
+     *         or the range types are not supported by the vectorized algorithms.
+     */
+    template<typename OutRange, typename It, typename EndIt>
+    [[nodiscard]] std::optional<OutRange> _convert_utf(It first, EndIt last) const noexcept
+    {
+        constexpr bool is_decode = From == "utf-8" and (To == "utf-16" or To == "utf-32");
+        constexpr bool is_encode = (From == "utf-16" or From == "utf-32") and To == "utf-8";
+
+        if constexpr (
+            (is_decode or is_encode) and std::contiguous_iterator<It> and std::same_as<It, EndIt> and
+            sizeof(std::iter_value_t<It>) == sizeof(from_char_type) and std::ranges::contiguous_range<OutRange> and
+            sizeof(std::ranges::range_value_t<OutRange>) == sizeof(to_char_type)) {
+            hilet src = reinterpret_cast<from_char_type const *>(std::to_address(first));
+            hilet src_last = src + std::distance(first, last);
+
+            auto r = OutRange{};
+            if constexpr (is_decode) {
+                if (not detail::utf8_validate(src, src_last)) {
+                    return std::nullopt;
+                }
+
+                r.resize(detail::utf8_decode_size<to_char_type>(src, src_last));
+                hilet dst = reinterpret_cast<to_char_type *>(std::ranges::data(r));
+                hilet dst_last = detail::utf8_decode(src, src_last, dst, dst + r.size());
+                hi_axiom(dst_last == dst + r.size());
+
+            } else {
+                hilet size = detail::utf_encode_utf8_size(src, src_last);
+                if (not size) {
+                    return std::nullopt;
+                }
+
+                r.resize(*size);
+                hilet dst = reinterpret_cast<to_char_type *>(std::ranges::data(r));
+                hilet dst_last = detail::utf_encode_utf8(src, src_last, dst, dst + r.size());
+                hi_axiom(dst_last == dst + r.size());
+            }
+            return r;
+
+        } else {
+            return std::nullopt;
+        }
+    }
+
     template<typename It, typename EndIt>
     [[nodiscard]] constexpr std::pair<size_t, bool> _size(It it, EndIt last) const noexcept
     {
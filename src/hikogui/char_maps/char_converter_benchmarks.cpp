@@ -0,0 +1,125 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "char_maps.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Sample text in different scripts.
+ */
+std::vector<std::pair<std::string_view, std::u32string_view>> const corpora = {
+    {"english", U"The quick brown fox jumps over the lazy dog, while the cat sleeps on the warm windowsill. "},
+    {"french", U"Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter en canoë au delà des îles. "},
+    {"russian", U"Съешь же ещё этих мягких французских булок, да выпей чаю в тёплой комнате. "},
+    {"japanese", U"いろはにほへと ちりぬるを わかよたれそ つねならむ うゐのおくやま けふこえて。"},
+    {"emoji", U"Party 🎉 with cake 🎂 and balloons 🎈, then sleep 😴. "},
+};
+
+/** Repeat a sample text to about 1M code-points.
+ */
+[[nodiscard]] std::u32string make_text(std::u32string_view sample)
+{
+    auto r = std::u32string{};
+    while (r.size() < 1024 * 1024) {
+        r += sample;
+    }
+    return r;
+}
+
+/** Convert one code-point at a time, the way char_converter converts invalid text.
+ */
+template<fixed_string From, fixed_string To, typename OutRange, typename InRange>
+[[nodiscard]] OutRange convert_per_code_point(InRange const& src)
+{
+    auto size = 0_uz;
+    for (auto it = src.begin(); it != src.end();) {
+        hilet [code_point, valid] = char_map<From>{}.read(it, src.end());
+        size += char_map<To>{}.size(code_point).first;
+    }
+
+    auto r = OutRange{};
+    r.resize(size);
+    auto dst = r.begin();
+    for (auto it = src.begin(); it != src.end();) {
+        hilet [code_point, valid] = char_map<From>{}.read(it, src.end());
+        char_map<To>{}.write(code_point, dst);
+    }
+    return r;
+}
+
+template<fixed_string From, fixed_string To, typename InRange>
+void benchmark_convert(std::string_view name, InRange const& src, std::size_t num_bytes)
+{
+    using out_type = char_converter<From, To>::to_string_type;
+
+    hilet expected = convert_per_code_point<From, To, out_type>(src);
+
+    hilet rate = benchmark_rate([&] {
+        hilet r = char_converter<From, To>{}.template convert<out_type>(src);
+        ASSERT_EQ(r.size(), expected.size());
+    });
+
+    hilet reference_rate = benchmark_rate([&] {
+        hilet r = convert_per_code_point<From, To, out_type>(src);
+        ASSERT_EQ(r.size(), expected.size());
+    });
+
+    ASSERT_EQ((char_converter<From, To>{}.template convert<out_type>(src)), expected);
+
+    benchmark_report(
+        std::format("{} -> {} {}", std::string_view{From}, std::string_view{To}, name), rate * num_bytes / 1'000'000'000, "GB/s");
+    benchmark_report(
+        std::format("{} -> {} {} per code-point", std::string_view{From}, std::string_view{To}, name),
+        reference_rate * num_bytes / 1'000'000'000,
+        "GB/s");
+}
+
+} // namespace
+
+TEST(char_converter_benchmarks, validate_utf8)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = hi::to_string(make_text(sample));
+
+        auto valid = false;
+        hilet rate = benchmark_rate([&] {
+            valid = is_valid_utf8(text);
+        });
+        ASSERT_TRUE(valid);
+
+        benchmark_report(std::format("validate utf-8 {}", name), rate * text.size() / 1'000'000'000, "GB/s");
+    }
+}
+
+TEST(char_converter_benchmarks, decode_utf8)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = hi::to_string(make_text(sample));
+
+        benchmark_convert<"utf-8", "utf-32">(name, text, text.size());
+        benchmark_convert<"utf-8", "utf-16">(name, text, text.size());
+    }
+}
+
+TEST(char_converter_benchmarks, encode_utf8)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = make_text(sample);
+        hilet text16 = hi::to_u16string(text);
+        hilet num_bytes = hi::to_string(text).size();
+
+        benchmark_convert<"utf-32", "utf-8">(name, text, num_bytes);
+        benchmark_convert<"utf-16", "utf-8">(name, text16, num_bytes);
+    }
+}
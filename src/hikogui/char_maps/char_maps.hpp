@@ -12,6 +12,7 @@
 #include "utf_8.hpp" // export
 #include "utf_16.hpp" // export
 #include "utf_32.hpp" // export
+#include "utf_simd.hpp" // export
 
 hi_export_module(hikogui.char_maps);
 
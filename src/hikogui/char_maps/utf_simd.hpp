@@ -0,0 +1,962 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file char_maps/utf_simd.hpp Vectorized validation and conversion of UTF-8, UTF-16 and UTF-32.
+ *
+ * These functions are the fast path of `char_converter` for valid text.
+ * Invalid text is converted by the `char_map` specializations one code-point at
+ * a time, which replaces invalid code-units.
+ *
+ * Each algorithm has a generic implementation which is used as the fallback on
+ * CPUs without SSSE3, and as the reference in the tests.
+ *
+ * UTF-8 is validated using the lookup algorithm from "Validating UTF-8 In Less
+ * Than One Instruction Per Byte" by John Keiser and Daniel Lemire.
+ * @ingroup char_maps
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+hi_export_module(hikogui.char_maps.utf_simd);
+
+hi_warning_push();
+// C26490: Don't use reinterpret_cast.
+// Needed for SIMD intrinsics.
+hi_warning_ignore_msvc(26490);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** Validate UTF-8.
+ *
+ * Overlong encodings, surrogates, code-points beyond U+10FFFF and truncated
+ * sequences are invalid.
+ */
+[[nodiscard]] constexpr bool utf8_validate_generic(char const *first, char const *last) noexcept
+{
+    while (first != last) {
+        hilet cu = char_cast<uint8_t>(*first++);
+        if (cu < 0x80) {
+            continue;
+        }
+
+        auto num_cont = 0_uz;
+        auto code_point = char32_t{};
+        auto lowest = char32_t{};
+        if ((cu & 0xe0) == 0xc0) {
+            num_cont = 1;
+            code_point = cu & 0x1f;
+            lowest = 0x80;
+        } else if ((cu & 0xf0) == 0xe0) {
+            num_cont = 2;
+            code_point = cu & 0x0f;
+            lowest = 0x800;
+        } else if ((cu & 0xf8) == 0xf0) {
+            num_cont = 3;
+            code_point = cu & 0x07;
+            lowest = 0x1'0000;
+        } else {
+            return false;
+        }
+
+        if (std::cmp_less(last - first, num_cont)) {
+            return false;
+        }
+
+        for (auto i = 0_uz; i != num_cont; ++i) {
+            hilet cont = char_cast<uint8_t>(*first++);
+            if ((cont & 0xc0) != 0x80) {
+                return false;
+            }
+            code_point = (code_point << 6) | (cont & 0x3f);
+        }
+
+        if (code_point < lowest or code_point > 0x10'ffff or (code_point >= 0xd800 and code_point < 0xe000)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** The number of UTF-32 code-units needed to hold valid UTF-8.
+ */
+[[nodiscard]] constexpr std::size_t utf8_utf32_size_generic(char const *first, char const *last) noexcept
+{
+    auto r = 0_uz;
+    for (; first != last; ++first) {
+        r += static_cast<std::size_t>((char_cast<uint8_t>(*first) & 0xc0) != 0x80);
+    }
+    return r;
+}
+
+/** The number of UTF-16 code-units needed to hold valid UTF-8.
+ */
+[[nodiscard]] constexpr std::size_t utf8_utf16_size_generic(char const *first, char const *last) noexcept
+{
+    auto r = 0_uz;
+    for (; first != last; ++first) {
+        hilet cu = char_cast<uint8_t>(*first);
+        // A code-point of 4 code-units is encoded as a surrogate pair.
+        r += static_cast<std::size_t>((cu & 0xc0) != 0x80) + static_cast<std::size_t>(cu >= 0xf0);
+    }
+    return r;
+}
+
+/** The number of UTF-8 code-units needed to hold UTF-16.
+ *
+ * @return The number of code-units, or empty when the text contains unpaired surrogates.
+ */
+[[nodiscard]] constexpr std::optional<std::size_t> utf16_utf8_size_generic(char16_t const *first, char16_t const *last) noexcept
+{
+    auto r = 0_uz;
+    while (first != last) {
+        hilet cu = *first++;
+        if (cu < 0x80) {
+            r += 1;
+        } else if (cu < 0x800) {
+            r += 2;
+        } else if ((cu & 0xfc00) == 0xd800) {
+            if (first == last or (*first & 0xfc00) != 0xdc00) {
+                return std::nullopt;
+            }
+            ++first;
+            r += 4;
+        } else if ((cu & 0xfc00) == 0xdc00) {
+            return std::nullopt;
+        } else {
+            r += 3;
+        }
+    }
+    return r;
+}
+
+/** The number of UTF-8 code-units needed to hold UTF-32.
+ *
+ * @return The number of code-units, or empty when the text contains surrogates or values beyond U+10FFFF.
+ */
+[[nodiscard]] constexpr std::optional<std::size_t> utf32_utf8_size_generic(char32_t const *first, char32_t const *last) noexcept
+{
+    auto r = 0_uz;
+    for (; first != last; ++first) {
+        hilet cu = *first;
+        if (cu < 0x80) {
+            r += 1;
+        } else if (cu < 0x800) {
+            r += 2;
+        } else if (cu >= 0xd800 and cu < 0xe000) {
+            return std::nullopt;
+        } else if (cu < 0x1'0000) {
+            r += 3;
+        } else if (cu <= 0x10'ffff) {
+            r += 4;
+        } else {
+            return std::nullopt;
+        }
+    }
+    return r;
+}
+
+/** Decode valid UTF-8 to UTF-16 or UTF-32.
+ *
+ * @param first The first code-unit of valid UTF-8.
+ * @param last One beyond the last code-unit of valid UTF-8.
+ * @param dst The buffer to write the code-units to.
+ * @return One beyond the last code-unit that was written.
+ */
+template<typename CharT>
+constexpr CharT *utf8_decode_generic(char const *first, char const *last, CharT *dst) noexcept
+{
+    while (first != last) {
+        hilet cu = char_cast<uint8_t>(*first++);
+        if (cu < 0x80) {
+            *dst++ = char_cast<CharT>(cu);
+            continue;
+        }
+
+        auto code_point = char32_t{};
+        if (cu < 0xe0) {
+            code_point = (cu & 0x1f) << 6;
+            code_point |= char_cast<uint8_t>(*first++) & 0x3f;
+        } else if (cu < 0xf0) {
+            code_point = (cu & 0x0f) << 12;
+            code_point |= (char_cast<uint8_t>(*first++) & 0x3f) << 6;
+            code_point |= char_cast<uint8_t>(*first++) & 0x3f;
+        } else {
+            code_point = (cu & 0x07) << 18;
+            code_point |= (char_cast<uint8_t>(*first++) & 0x3f) << 12;
+            code_point |= (char_cast<uint8_t>(*first++) & 0x3f) << 6;
+            code_point |= char_cast<uint8_t>(*first++) & 0x3f;
+        }
+
+        if (sizeof(CharT) == 2 and code_point >= 0x1'0000) {
+            code_point -= 0x1'0000;
+            *dst++ = char_cast<CharT>(0xd800 + (code_point >> 10));
+            *dst++ = char_cast<CharT>(0xdc00 + (code_point & 0x3ff));
+        } else {
+            *dst++ = char_cast<CharT>(code_point);
+        }
+    }
+    return dst;
+}
+
+/** Encode valid UTF-16 or UTF-32 to UTF-8.
+ *
+ * @param first The first code-unit of valid UTF-16 or UTF-32.
+ * @param last One beyond the last code-unit.
+ * @param dst The buffer to write the UTF-8 code-units to.
+ * @return One beyond the last code-unit that was written.
+ */
+template<typename CharT>
+constexpr char *utf_encode_utf8_generic(CharT const *first, CharT const *last, char *dst) noexcept
+{
+    while (first != last) {
+        auto code_point = char_cast<char32_t>(*first++);
+        if (sizeof(CharT) == 2 and (code_point & 0xfc00) == 0xd800) {
+            code_point = (((code_point & 0x3ff) << 10) | (char_cast<char32_t>(*first++) & 0x3ff)) + 0x1'0000;
+        }
+
+        if (code_point < 0x80) {
+            *dst++ = char_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            *dst++ = char_cast<char>(0xc0 | (code_point >> 6));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        } else if (code_point < 0x1'0000) {
+            *dst++ = char_cast<char>(0xe0 | (code_point >> 12));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        } else {
+            *dst++ = char_cast<char>(0xf0 | (code_point >> 18));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        }
+    }
+    return dst;
+}
+
+#if defined(HI_HAS_X86)
+
+/** The lookup tables for validating UTF-8.
+ *
+ * Each table is indexed by a nibble of the previous or current code-unit, and
+ * returns the errors that are possible with that nibble. An error exists when a
+ * bit is set in all three tables.
+ *
+ *  - [0] The high nibble of the previous code-unit.
+ *  - [1] The low nibble of the previous code-unit.
+ *  - [2] The high nibble of the current code-unit.
+ */
+constexpr auto utf8_validate_tables = [] {
+    constexpr uint8_t too_short = 1 << 0;
+    constexpr uint8_t too_long = 1 << 1;
+    constexpr uint8_t overlong_3 = 1 << 2;
+    constexpr uint8_t too_large = 1 << 3;
+    constexpr uint8_t surrogate = 1 << 4;
+    constexpr uint8_t overlong_2 = 1 << 5;
+    constexpr uint8_t too_large_1000 = 1 << 6;
+    constexpr uint8_t overlong_4 = 1 << 6;
+    constexpr uint8_t two_conts = 1 << 7;
+    constexpr uint8_t carry = too_short | too_long | two_conts;
+
+    return std::array<std::array<uint8_t, 16>, 3>{
+        {{// 0_______ <ASCII>
+          too_long,
+          too_long,
+          too_long,
+          too_long,
+          too_long,
+          too_long,
+          too_long,
+          too_long,
+          // 10______ <continuation>
+          two_conts,
+          two_conts,
+          two_conts,
+          two_conts,
+          // 1100____ <2 byte lead>
+          too_short | overlong_2,
+          // 1101____ <2 byte lead>
+          too_short,
+          // 1110____ <3 byte lead>
+          too_short | overlong_3 | surrogate,
+          // 1111____ <4+ byte lead>
+          too_short | too_large | too_large_1000 | overlong_4},
+         {// ____0000
+          carry | overlong_3 | overlong_2 | overlong_4,
+          // ____0001
+          carry | overlong_2,
+          // ____001_
+          carry,
+          carry,
+          // ____0100
+          carry | too_large,
+          // ____0101 and higher
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000,
+          // ____1101
+          carry | too_large | too_large_1000 | surrogate,
+          carry | too_large | too_large_1000,
+          carry | too_large | too_large_1000},
+         {// 0_______ <ASCII>
+          too_short,
+          too_short,
+          too_short,
+          too_short,
+          too_short,
+          too_short,
+          too_short,
+          too_short,
+          // 1000____
+          too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+          // 1001____
+          too_long | overlong_2 | two_conts | overlong_3 | too_large,
+          // 101_____
+          too_long | overlong_2 | two_conts | surrogate | too_large,
+          too_long | overlong_2 | two_conts | surrogate | too_large,
+          // 11______
+          too_short,
+          too_short,
+          too_short,
+          too_short}}};
+}();
+
+/** Shuffle control to move the selected 16-bit lanes to the front of a register.
+ *
+ * Indexed by a mask with a bit set for each lane to keep.
+ */
+constexpr auto utf_compress_epi16_table = [] {
+    auto r = std::array<std::array<uint8_t, 16>, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 8; ++i) {
+            if (to_bool(mask & (1_uz << i))) {
+                r[mask][j++] = narrow_cast<uint8_t>(i * 2);
+                r[mask][j++] = narrow_cast<uint8_t>(i * 2 + 1);
+            }
+        }
+        for (; j != 16; ++j) {
+            r[mask][j] = 0x80;
+        }
+    }
+    return r;
+}();
+
+struct utf8_encode_shuffle_type {
+    std::array<uint8_t, 16> shuffle = {};
+    std::size_t size = 0;
+};
+
+/** Shuffle control to pack four UTF-8 sequences of 1 to 3 code-units stored in 32-bit lanes.
+ *
+ * Indexed by a mask with bit 0-3 set for each 1 code-unit sequence, and
+ * bit 4-7 set for each sequence of 1 or 2 code-units.
+ */
+constexpr auto utf8_encode_shuffle_table = [] {
+    auto r = std::array<utf8_encode_shuffle_type, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 4; ++i) {
+            hilet size = 3_uz - static_cast<std::size_t>(to_bool(mask & (1_uz << i))) -
+                static_cast<std::size_t>(to_bool(mask & (0x10_uz << i)));
+            for (auto k = 0_uz; k != size; ++k) {
+                r[mask].shuffle[j++] = narrow_cast<uint8_t>(i * 4 + k);
+            }
+        }
+        r[mask].size = j;
+        for (; j != 16; ++j) {
+            r[mask].shuffle[j] = 0x80;
+        }
+    }
+    return r;
+}();
+
+/** Sum the 32-bit lanes of a register.
+ */
+hi_target("sse2") [[nodiscard]] hi_force_inline std::size_t utf_sum_epi32_sse2(__m128i x) noexcept
+{
+    alignas(16) std::array<uint32_t, 4> tmp;
+    _mm_store_si128(reinterpret_cast<__m128i *>(tmp.data()), x);
+    return std::size_t{tmp[0]} + std::size_t{tmp[1]} + std::size_t{tmp[2]} + std::size_t{tmp[3]};
+}
+
+/** Check a chunk of 16 UTF-8 code-units.
+ *
+ * @param input The chunk of code-units.
+ * @param[in,out] prev_input The previous chunk.
+ * @param[in,out] prev_incomplete Non-zero when the previous chunk ended in an incomplete sequence.
+ * @param[in,out] error Non-zero when an error was found.
+ */
+hi_target("sse2,ssse3") hi_force_inline void
+utf8_validate_chunk_ssse3(__m128i input, __m128i& prev_input, __m128i& prev_incomplete, __m128i& error) noexcept
+{
+    if (_mm_movemask_epi8(input) == 0) {
+        // A chunk of ASCII only needs the previous chunk to be complete.
+        error = _mm_or_si128(error, prev_incomplete);
+        prev_incomplete = _mm_setzero_si128();
+        prev_input = input;
+        return;
+    }
+
+    hilet nibble_mask = _mm_set1_epi8(0x0f);
+    hilet byte_1_high_table = _mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[0].data()));
+    hilet byte_1_low_table = _mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[1].data()));
+    hilet byte_2_high_table = _mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[2].data()));
+
+    hilet prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    hilet byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask));
+    hilet byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble_mask));
+    hilet byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask));
+    hilet special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // The third and fourth code-unit of a sequence must be continuations, only
+    // those have bit 7 set after the saturated subtraction.
+    hilet prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    hilet prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    hilet is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+    hilet is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+    hilet must_be_2_3_continuation =
+        _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+    error = _mm_or_si128(error, _mm_xor_si128(must_be_2_3_continuation, special_cases));
+
+    // A lead code-unit in the last three code-units needs continuations in the next chunk.
+    hilet incomplete_max = _mm_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+    prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+    prev_input = input;
+}
+
+hi_target("sse2,ssse3") [[nodiscard]] hi_inline bool utf8_validate_ssse3(char const *first, char const *last) noexcept
+{
+    auto prev_input = _mm_setzero_si128();
+    auto prev_incomplete = _mm_setzero_si128();
+    auto error = _mm_setzero_si128();
+
+    for (; last - first >= 16; first += 16) {
+        hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        utf8_validate_chunk_ssse3(input, prev_input, prev_incomplete, error);
+    }
+
+    // The tail is padded with ASCII nul characters, a truncated sequence is then detected as too short.
+    alignas(16) std::array<char, 16> tail = {};
+    std::copy(first, last, tail.data());
+    utf8_validate_chunk_ssse3(_mm_load_si128(reinterpret_cast<__m128i const *>(tail.data())), prev_input, prev_incomplete, error);
+
+    error = _mm_or_si128(error, prev_incomplete);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xffff;
+}
+
+/** Check a chunk of 32 UTF-8 code-units.
+ *
+ * @see utf8_validate_chunk_ssse3
+ */
+hi_target("sse2,ssse3,avx,avx2") hi_force_inline void
+utf8_validate_chunk_avx2(__m256i input, __m256i& prev_input, __m256i& prev_incomplete, __m256i& error) noexcept
+{
+    if (_mm256_movemask_epi8(input) == 0) {
+        error = _mm256_or_si256(error, prev_incomplete);
+        prev_incomplete = _mm256_setzero_si256();
+        prev_input = input;
+        return;
+    }
+
+    hilet nibble_mask = _mm256_set1_epi8(0x0f);
+    hilet byte_1_high_table =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[0].data())));
+    hilet byte_1_low_table =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[1].data())));
+    hilet byte_2_high_table =
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(utf8_validate_tables[2].data())));
+
+    // The byte-shifts work on each 128-bit lane, so first make a register
+    // with the high lane of the previous chunk and the low lane of the input.
+    hilet prev_input_lane = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    hilet prev1 = _mm256_alignr_epi8(input, prev_input_lane, 15);
+    hilet byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask));
+    hilet byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble_mask));
+    hilet byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask));
+    hilet special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    hilet prev2 = _mm256_alignr_epi8(input, prev_input_lane, 14);
+    hilet prev3 = _mm256_alignr_epi8(input, prev_input_lane, 13);
+    hilet is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+    hilet is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+    hilet must_be_2_3_continuation =
+        _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
+    error = _mm256_or_si256(error, _mm256_xor_si256(must_be_2_3_continuation, special_cases));
+
+    hilet incomplete_max = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        static_cast<char>(0xf0 - 1), static_cast<char>(0xe0 - 1), static_cast<char>(0xc0 - 1));
+    prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+    prev_input = input;
+}
+
+hi_target("sse2,ssse3,avx,avx2") [[nodiscard]] hi_inline bool utf8_validate_avx2(char const *first, char const *last) noexcept
+{
+    auto prev_input = _mm256_setzero_si256();
+    auto prev_incomplete = _mm256_setzero_si256();
+    auto error = _mm256_setzero_si256();
+
+    for (; last - first >= 32; first += 32) {
+        hilet input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(first));
+        utf8_validate_chunk_avx2(input, prev_input, prev_incomplete, error);
+    }
+
+    alignas(32) std::array<char, 32> tail = {};
+    std::copy(first, last, tail.data());
+    utf8_validate_chunk_avx2(_mm256_load_si256(reinterpret_cast<__m256i const *>(tail.data())), prev_input, prev_incomplete, error);
+
+    error = _mm256_or_si256(error, prev_incomplete);
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+/** The number of UTF-32 and UTF-16 code-units needed to hold valid UTF-8.
+ *
+ * @return The number of UTF-32 code-units, and the number of UTF-16 code-units.
+ */
+hi_target("sse2") [[nodiscard]] hi_inline std::pair<std::size_t, std::size_t>
+utf8_utf32_utf16_size_sse2(char const *first, char const *last) noexcept
+{
+    auto num_bytes = 0_uz;
+    auto num_cont = 0_uz;
+    auto num_four = 0_uz;
+    while (last - first >= 16) {
+        // Count in 8-bit lanes, at most 255 chunks at a time.
+        auto cont_acc = _mm_setzero_si128();
+        auto four_acc = _mm_setzero_si128();
+        for (auto i = 0; i != 255 and last - first >= 16; ++i, first += 16, num_bytes += 16) {
+            hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            // Continuation code-units are 0x80-0xbf, which are less than 0xc0 as signed values.
+            hilet is_cont = _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(0xc0)));
+            hilet is_four = _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8(static_cast<char>(0xf0))), chunk);
+            cont_acc = _mm_sub_epi8(cont_acc, is_cont);
+            four_acc = _mm_sub_epi8(four_acc, is_four);
+        }
+        num_cont += utf_sum_epi32_sse2(_mm_sad_epu8(cont_acc, _mm_setzero_si128()));
+        num_four += utf_sum_epi32_sse2(_mm_sad_epu8(four_acc, _mm_setzero_si128()));
+    }
+
+    hilet utf32_size = num_bytes - num_cont;
+    return {utf32_size + utf8_utf32_size_generic(first, last), utf32_size + num_four + utf8_utf16_size_generic(first, last)};
+}
+
+hi_target("sse2") [[nodiscard]] hi_inline std::optional<std::size_t>
+utf16_utf8_size_sse2(char16_t const *first, char16_t const *last) noexcept
+{
+    auto r = 0_uz;
+    while (last - first >= 8) {
+        // Count in 16-bit lanes, at most 8192 chunks at a time.
+        auto acc = _mm_setzero_si128();
+        for (auto i = 0; i != 8192 and last - first >= 8; ++i) {
+            hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            hilet is_surrogate = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xf800))), _mm_set1_epi16(static_cast<short>(0xd800)));
+            if (_mm_movemask_epi8(is_surrogate) != 0) {
+                // Handle the chunk one code-point at a time, including a surrogate pair crossing the end of the chunk.
+                auto stop = first + 8;
+                if ((stop[-1] & 0xfc00) == 0xd800 and stop != last) {
+                    ++stop;
+                }
+                hilet size = utf16_utf8_size_generic(first, stop);
+                if (not size) {
+                    return std::nullopt;
+                }
+                r += *size;
+                first = stop;
+                continue;
+            }
+
+            // Each comparison is -1 for true, which is subtracted to count.
+            hilet is_1 = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xff80))), _mm_setzero_si128());
+            hilet is_1_2 = _mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xf800))), _mm_setzero_si128());
+            acc = _mm_add_epi16(acc, _mm_set1_epi16(3));
+            acc = _mm_add_epi16(acc, is_1);
+            acc = _mm_add_epi16(acc, is_1_2);
+            first += 8;
+        }
+        r += utf_sum_epi32_sse2(_mm_madd_epi16(acc, _mm_set1_epi16(1)));
+    }
+
+    hilet tail_size = utf16_utf8_size_generic(first, last);
+    if (not tail_size) {
+        return std::nullopt;
+    }
+    return r + *tail_size;
+}
+
+hi_target("sse2") [[nodiscard]] hi_inline std::optional<std::size_t>
+utf32_utf8_size_sse2(char32_t const *first, char32_t const *last) noexcept
+{
+    auto r = 0_uz;
+    auto invalid = _mm_setzero_si128();
+    while (last - first >= 4) {
+        // Count in 32-bit lanes, at most 2^24 chunks at a time.
+        auto acc = _mm_setzero_si128();
+        for (auto i = 0; i != 0x100'0000 and last - first >= 4; ++i, first += 4) {
+            hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            hilet is_surrogate = _mm_cmpeq_epi32(_mm_and_si128(chunk, _mm_set1_epi32(0xffff'f800)), _mm_set1_epi32(0xd800));
+            // Values of 0x8000'0000 and above are negative.
+            hilet is_too_large =
+                _mm_or_si128(_mm_cmpgt_epi32(chunk, _mm_set1_epi32(0x10'ffff)), _mm_cmplt_epi32(chunk, _mm_setzero_si128()));
+            invalid = _mm_or_si128(invalid, _mm_or_si128(is_surrogate, is_too_large));
+
+            // Each comparison is -1 for true, which is subtracted to count.
+            acc = _mm_add_epi32(acc, _mm_set1_epi32(1));
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(chunk, _mm_set1_epi32(0x7f)));
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(chunk, _mm_set1_epi32(0x7ff)));
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(chunk, _mm_set1_epi32(0xffff)));
+        }
+        r += utf_sum_epi32_sse2(acc);
+    }
+
+    if (_mm_movemask_epi8(invalid) != 0) {
+        return std::nullopt;
+    }
+
+    hilet tail_size = utf32_utf8_size_generic(first, last);
+    if (not tail_size) {
+        return std::nullopt;
+    }
+    return r + *tail_size;
+}
+
+/** Store eight 16-bit values as UTF-16 or UTF-32 code-units.
+ */
+template<typename CharT>
+hi_target("sse2") hi_force_inline void utf_store_epi16_sse2(CharT *dst, __m128i x) noexcept
+{
+    if constexpr (sizeof(CharT) == 2) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), x);
+    } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi16(x, _mm_setzero_si128()));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 4), _mm_unpackhi_epi16(x, _mm_setzero_si128()));
+    }
+}
+
+/** Decode valid UTF-8 to UTF-16 or UTF-32.
+ *
+ * A chunk of 16 code-units without 4 code-unit sequences is decoded by
+ * calculating the code-point at the last code-unit of each sequence, then
+ * compressing the lanes with the code-points. Only sequences that end in the
+ * first 15 code-units are decoded, since it is unknown if the 16th code-unit
+ * is the end of a sequence.
+ *
+ * @param first The first code-unit of valid UTF-8.
+ * @param last One beyond the last code-unit of valid UTF-8.
+ * @param dst The buffer to write the code-units to.
+ * @param dst_last One beyond the end of the buffer, the buffer must be large enough.
+ * @return One beyond the last code-unit that was written.
+ */
+template<typename CharT>
+hi_target("sse2,ssse3") hi_inline CharT *utf8_decode_ssse3(char const *first, char const *last, CharT *dst, CharT *dst_last) noexcept
+{
+    // The stores write a full register beyond the code-units that were decoded.
+    while (last - first >= 16 and dst_last - dst >= 16) {
+        hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        if (_mm_movemask_epi8(chunk) == 0) {
+            utf_store_epi16_sse2(dst, _mm_unpacklo_epi8(chunk, _mm_setzero_si128()));
+            utf_store_epi16_sse2(dst + 8, _mm_unpackhi_epi8(chunk, _mm_setzero_si128()));
+            first += 16;
+            dst += 16;
+            continue;
+        }
+
+        hilet is_four = _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8(static_cast<char>(0xf0))), chunk);
+        if (hilet four_mask = _mm_movemask_epi8(is_four)) {
+            // Decode up to and including the 4 code-unit sequence one code-point at a time.
+            auto stop = first + std::countr_zero(truncate<uint16_t>(four_mask));
+            while (first <= stop) {
+                hilet cu = char_cast<uint8_t>(*first);
+                hilet size = cu < 0x80 ? 1 : cu < 0xe0 ? 2 : cu < 0xf0 ? 3 : 4;
+                dst = utf8_decode_generic(first, first + size, dst);
+                first += size;
+            }
+            continue;
+        }
+
+        // Continuation code-units are 0x80-0xbf, which are less than 0xc0 as signed values.
+        hilet is_cont = _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(0xc0)));
+        hilet prev1_is_cont = _mm_slli_si128(is_cont, 1);
+        hilet prev1 = _mm_slli_si128(chunk, 1);
+        hilet prev2 = _mm_slli_si128(chunk, 2);
+
+        // The bits of the code-point, at the position of the last code-unit of a sequence.
+        //  - low: 7 bits of ASCII, or 6 bits of a continuation.
+        //  - mid: 5 bits of a 2 code-unit lead, or 6 bits of a continuation.
+        //  - high: 4 bits of a 3 code-unit lead.
+        hilet low = _mm_and_si128(chunk, _mm_sub_epi8(_mm_set1_epi8(0x7f), _mm_and_si128(is_cont, _mm_set1_epi8(0x40))));
+        hilet mid = _mm_and_si128(
+            _mm_and_si128(prev1, _mm_add_epi8(_mm_set1_epi8(0x1f), _mm_and_si128(prev1_is_cont, _mm_set1_epi8(0x20)))), is_cont);
+        hilet high = _mm_and_si128(_mm_and_si128(prev2, _mm_set1_epi8(0x0f)), _mm_and_si128(is_cont, prev1_is_cont));
+
+        hilet zero = _mm_setzero_si128();
+        hilet code_points_lo = _mm_or_si128(
+            _mm_unpacklo_epi8(low, zero),
+            _mm_or_si128(_mm_slli_epi16(_mm_unpacklo_epi8(mid, zero), 6), _mm_slli_epi16(_mm_unpacklo_epi8(high, zero), 12)));
+        hilet code_points_hi = _mm_or_si128(
+            _mm_unpackhi_epi8(low, zero),
+            _mm_or_si128(_mm_slli_epi16(_mm_unpackhi_epi8(mid, zero), 6), _mm_slli_epi16(_mm_unpackhi_epi8(high, zero), 12)));
+
+        // A code-unit is the last of a sequence if the next code-unit is not a continuation.
+        hilet cont_mask = truncate<uint16_t>(_mm_movemask_epi8(is_cont));
+        hilet end_mask = truncate<uint16_t>(~(cont_mask >> 1) & 0x7fff);
+        hilet end_mask_lo = end_mask & 0xff;
+        hilet end_mask_hi = end_mask >> 8;
+
+        hilet shuffle_lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(utf_compress_epi16_table[end_mask_lo].data()));
+        hilet shuffle_hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(utf_compress_epi16_table[end_mask_hi].data()));
+        utf_store_epi16_sse2(dst, _mm_shuffle_epi8(code_points_lo, shuffle_lo));
+        dst += std::popcount(truncate<uint8_t>(end_mask_lo));
+        utf_store_epi16_sse2(dst, _mm_shuffle_epi8(code_points_hi, shuffle_hi));
+        dst += std::popcount(truncate<uint8_t>(end_mask_hi));
+
+        first += std::bit_width(end_mask);
+    }
+
+    return utf8_decode_generic(first, last, dst);
+}
+
+/** Encode four code-points below U+10000 to UTF-8.
+ *
+ * @param code_points Four code-points in 32-bit lanes.
+ * @param dst The buffer to write to, 16 bytes are written.
+ * @return One beyond the last code-unit of the encoded code-points.
+ */
+hi_target("sse2,ssse3") hi_force_inline char *utf8_encode_x4_ssse3(__m128i code_points, char *dst) noexcept
+{
+    hilet cont_bits = _mm_set1_epi32(0x80);
+    hilet cont_mask = _mm_set1_epi32(0x3f);
+
+    hilet code_points_6 = _mm_srli_epi32(code_points, 6);
+    hilet code_points_12 = _mm_srli_epi32(code_points, 12);
+    hilet last_byte = _mm_or_si128(_mm_and_si128(code_points, cont_mask), cont_bits);
+    hilet mid_byte = _mm_or_si128(_mm_and_si128(code_points_6, cont_mask), cont_bits);
+
+    // The UTF-8 sequences in little-endian order in each lane.
+    hilet two = _mm_or_si128(_mm_or_si128(code_points_6, _mm_set1_epi32(0xc0)), _mm_slli_epi32(last_byte, 8));
+    hilet three = _mm_or_si128(
+        _mm_or_si128(code_points_12, _mm_set1_epi32(0xe0)), _mm_or_si128(_mm_slli_epi32(mid_byte, 8), _mm_slli_epi32(last_byte, 16)));
+
+    hilet is_1 = _mm_cmplt_epi32(code_points, _mm_set1_epi32(0x80));
+    hilet is_1_2 = _mm_cmplt_epi32(code_points, _mm_set1_epi32(0x800));
+    hilet sequences = _mm_or_si128(
+        _mm_and_si128(is_1, code_points),
+        _mm_andnot_si128(is_1, _mm_or_si128(_mm_and_si128(is_1_2, two), _mm_andnot_si128(is_1_2, three))));
+
+    hilet index = _mm_movemask_ps(_mm_castsi128_ps(is_1)) | (_mm_movemask_ps(_mm_castsi128_ps(is_1_2)) << 4);
+    hilet& entry = utf8_encode_shuffle_table[index];
+    hilet shuffle = _mm_loadu_si128(reinterpret_cast<__m128i const *>(entry.shuffle.data()));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(sequences, shuffle));
+    return dst + entry.size;
+}
+
+/** Encode valid UTF-16 or UTF-32 to UTF-8.
+ *
+ * Chunks of eight code-units are encoded four at a time. Chunks with code-points
+ * beyond U+FFFF are encoded one code-point at a time.
+ *
+ * @param first The first code-unit of valid UTF-16 or UTF-32.
+ * @param last One beyond the last code-unit.
+ * @param dst The buffer to write the UTF-8 code-units to.
+ * @param dst_last One beyond the end of the buffer, the buffer must be large enough.
+ * @return One beyond the last code-unit that was written.
+ */
+template<typename CharT>
+hi_target("sse2,ssse3") hi_inline char *utf_encode_utf8_ssse3(CharT const *first, CharT const *last, char *dst, char *dst_last) noexcept
+{
+    hilet zero = _mm_setzero_si128();
+
+    // Eight code-points encode to at most 24 code-units, and the last store writes 16 bytes.
+    while (last - first >= 8 and dst_last - dst >= 32) {
+        auto code_points_lo = zero;
+        auto code_points_hi = zero;
+        auto is_large = false;
+        if constexpr (sizeof(CharT) == 2) {
+            hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xff80))), zero)) ==
+                0xffff) {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(chunk, chunk));
+                first += 8;
+                dst += 8;
+                continue;
+            }
+
+            hilet is_surrogate = _mm_cmpeq_epi16(
+                _mm_and_si128(chunk, _mm_set1_epi16(static_cast<short>(0xf800))), _mm_set1_epi16(static_cast<short>(0xd800)));
+            is_large = _mm_movemask_epi8(is_surrogate) != 0;
+            code_points_lo = _mm_unpacklo_epi16(chunk, zero);
+            code_points_hi = _mm_unpackhi_epi16(chunk, zero);
+
+        } else {
+            code_points_lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+            code_points_hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first + 4));
+            hilet code_points = _mm_or_si128(code_points_lo, code_points_hi);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(code_points, _mm_set1_epi32(0xffff'ff80)), zero)) == 0xffff) {
+                hilet chunk = _mm_packs_epi32(code_points_lo, code_points_hi);
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(chunk, chunk));
+                first += 8;
+                dst += 8;
+                continue;
+            }
+
+            is_large = _mm_movemask_epi8(_mm_cmpgt_epi32(code_points, _mm_set1_epi32(0xffff))) != 0;
+        }
+
+        if (is_large) {
+            // Encode a code-point at a time, a surrogate pair may cross the end of the chunk.
+            hilet stop = first + 8;
+            while (first < stop) {
+                hilet size = (sizeof(CharT) == 2 and (*first & 0xfc00) == 0xd800) ? 2 : 1;
+                dst = utf_encode_utf8_generic(first, first + size, dst);
+                first += size;
+            }
+            continue;
+        }
+
+        dst = utf8_encode_x4_ssse3(code_points_lo, dst);
+        dst = utf8_encode_x4_ssse3(code_points_hi, dst);
+        first += 8;
+    }
+
+    return utf_encode_utf8_generic(first, last, dst);
+}
+
+#endif
+
+/** Validate UTF-8.
+ *
+ * @see utf8_validate_generic
+ */
+[[nodiscard]] hi_inline bool utf8_validate(char const *first, char const *last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_avx2()) {
+        return utf8_validate_avx2(first, last);
+    }
+    if (has_ssse3()) {
+        return utf8_validate_ssse3(first, last);
+    }
+#endif
+    return utf8_validate_generic(first, last);
+}
+
+/** The number of UTF-32 or UTF-16 code-units needed to hold valid UTF-8.
+ */
+template<typename CharT>
+[[nodiscard]] hi_inline std::size_t utf8_decode_size(char const *first, char const *last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        hilet [utf32_size, utf16_size] = utf8_utf32_utf16_size_sse2(first, last);
+        return sizeof(CharT) == 2 ? utf16_size : utf32_size;
+    }
+#endif
+    if constexpr (sizeof(CharT) == 2) {
+        return utf8_utf16_size_generic(first, last);
+    } else {
+        return utf8_utf32_size_generic(first, last);
+    }
+}
+
+/** Decode valid UTF-8 to UTF-16 or UTF-32.
+ *
+ * @see utf8_decode_generic
+ */
+template<typename CharT>
+hi_inline CharT *utf8_decode(char const *first, char const *last, CharT *dst, CharT *dst_last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_ssse3()) {
+        return utf8_decode_ssse3(first, last, dst, dst_last);
+    }
+#endif
+    return utf8_decode_generic(first, last, dst);
+}
+
+/** The number of UTF-8 code-units needed to hold UTF-16.
+ *
+ * @see utf16_utf8_size_generic
+ */
+[[nodiscard]] hi_inline std::optional<std::size_t> utf_encode_utf8_size(char16_t const *first, char16_t const *last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        return utf16_utf8_size_sse2(first, last);
+    }
+#endif
+    return utf16_utf8_size_generic(first, last);
+}
+
+/** The number of UTF-8 code-units needed to hold UTF-32.
+ *
+ * @see utf32_utf8_size_generic
+ */
+[[nodiscard]] hi_inline std::optional<std::size_t> utf_encode_utf8_size(char32_t const *first, char32_t const *last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        return utf32_utf8_size_sse2(first, last);
+    }
+#endif
+    return utf32_utf8_size_generic(first, last);
+}
+
+/** Encode valid UTF-16 or UTF-32 to UTF-8.
+ *
+ * @see utf_encode_utf8_generic
+ */
+template<typename CharT>
+hi_inline char *utf_encode_utf8(CharT const *first, CharT const *last, char *dst, char *dst_last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_ssse3()) {
+        return utf_encode_utf8_ssse3(first, last, dst, dst_last);
+    }
+#endif
+    return utf_encode_utf8_generic(first, last, dst);
+}
+
+} // namespace detail
+
+/** Check if a string is valid UTF-8.
+ *
+ * Overlong encodings, surrogates, code-points beyond U+10FFFF and truncated
+ * sequences are invalid.
+ *
+ * @ingroup char_maps
+ * @param str The string to check.
+ * @return true if the string is valid UTF-8.
+ */
+[[nodiscard]] hi_inline bool is_valid_utf8(std::string_view str) noexcept
+{
+    return detail::utf8_validate(str.data(), str.data() + str.size());
+}
+
+}} // namespace hi::v1
+
+hi_warning_pop();
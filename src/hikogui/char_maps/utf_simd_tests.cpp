@@ -0,0 +1,146 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utf_simd.hpp"
+#include "char_maps.hpp"
+#include "random_char.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] std::u32string random_text(std::mt19937& engine)
+{
+    auto r = std::u32string{};
+    hilet size = engine() % 200;
+    for (auto i = 0_uz; i != size; ++i) {
+        r += random_char();
+    }
+    return r;
+}
+
+[[nodiscard]] std::string encode_utf8(std::u32string_view text)
+{
+    auto r = std::string(text.size() * 4, '\0');
+    hilet last = detail::utf_encode_utf8_generic(text.data(), text.data() + text.size(), r.data());
+    r.resize(last - r.data());
+    return r;
+}
+
+[[nodiscard]] std::u16string encode_utf16(std::u32string_view text)
+{
+    auto r = std::u16string{};
+    for (hilet c : text) {
+        if (c >= 0x1'0000) {
+            r += char_cast<char16_t>(0xd800 + ((c - 0x1'0000) >> 10));
+            r += char_cast<char16_t>(0xdc00 + ((c - 0x1'0000) & 0x3ff));
+        } else {
+            r += char_cast<char16_t>(c);
+        }
+    }
+    return r;
+}
+
+/** Check all implementations of UTF-8 validation against the generic implementation.
+ */
+void check_validate(std::string_view str)
+{
+    hilet first = str.data();
+    hilet last = str.data() + str.size();
+    hilet expected = detail::utf8_validate_generic(first, last);
+
+    ASSERT_EQ(detail::utf8_validate(first, last), expected);
+#if defined(HI_HAS_X86)
+    if (has_ssse3()) {
+        ASSERT_EQ(detail::utf8_validate_ssse3(first, last), expected);
+    }
+    if (has_avx2()) {
+        ASSERT_EQ(detail::utf8_validate_avx2(first, last), expected);
+    }
+#endif
+}
+
+} // namespace
+
+TEST(utf_simd, validate)
+{
+    ASSERT_TRUE(is_valid_utf8(""));
+    ASSERT_TRUE(is_valid_utf8("hello world"));
+    ASSERT_TRUE(is_valid_utf8("\xc2\x80\xdf\xbf\xe0\xa0\x80\xef\xbf\xbf\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"));
+
+    // Overlong encodings.
+    ASSERT_FALSE(is_valid_utf8("\xc0\x80"));
+    ASSERT_FALSE(is_valid_utf8("\xc1\xbf"));
+    ASSERT_FALSE(is_valid_utf8("\xe0\x9f\xbf"));
+    ASSERT_FALSE(is_valid_utf8("\xf0\x8f\xbf\xbf"));
+    // Surrogates.
+    ASSERT_FALSE(is_valid_utf8("\xed\xa0\x80"));
+    ASSERT_FALSE(is_valid_utf8("\xed\xbf\xbf"));
+    // Beyond U+10FFFF.
+    ASSERT_FALSE(is_valid_utf8("\xf4\x90\x80\x80"));
+    ASSERT_FALSE(is_valid_utf8("\xf5\x80\x80\x80"));
+    ASSERT_FALSE(is_valid_utf8("\xff"));
+    // Unexpected continuations and truncated sequences.
+    ASSERT_FALSE(is_valid_utf8("\x80"));
+    ASSERT_FALSE(is_valid_utf8("a\xc2\x80\x80"));
+    ASSERT_FALSE(is_valid_utf8("\xe0\xa0"));
+    ASSERT_FALSE(is_valid_utf8("0123456789abcdefghijklmnopqrstu\xe0\xa0"));
+    ASSERT_FALSE(is_valid_utf8("0123456789abcdefghijklmnopqrstu\xe0\xa0 0123456789abcdefghijklmnopqrstuvwxyz"));
+}
+
+TEST(utf_simd, validate_compare_to_generic)
+{
+    auto engine = std::mt19937{42};
+
+    for (auto i = 0; i != 10'000; ++i) {
+        auto str = encode_utf8(random_text(engine));
+        check_validate(str);
+
+        // Corrupt a few code-units.
+        if (not str.empty()) {
+            for (auto j = engine() % 3; j != 0; --j) {
+                str[engine() % str.size()] = char_cast<char>(engine() & 0xff);
+            }
+            check_validate(str);
+        }
+    }
+}
+
+TEST(utf_simd, convert_utf8)
+{
+    auto engine = std::mt19937{42};
+
+    for (auto i = 0; i != 10'000; ++i) {
+        hilet text = random_text(engine);
+        hilet text8 = encode_utf8(text);
+        hilet text16 = encode_utf16(text);
+
+        ASSERT_EQ((char_converter<"utf-8", "utf-32">{}(text8)), text);
+        ASSERT_EQ((char_converter<"utf-8", "utf-16">{}(text8)), text16);
+        ASSERT_EQ((char_converter<"utf-32", "utf-8">{}(text)), text8);
+        ASSERT_EQ((char_converter<"utf-16", "utf-8">{}(text16)), text8);
+    }
+}
+
+TEST(utf_simd, convert_invalid)
+{
+    // Invalid text is converted one code-point at a time, with the same result as before.
+    auto text8 = std::string(40, 'a');
+    text8[20] = '\xe9';
+    auto expected = std::u32string(40, U'a');
+    expected[20] = U'é';
+    ASSERT_EQ((char_converter<"utf-8", "utf-32">{}(text8)), expected);
+
+    auto text16 = std::u16string(40, u'a');
+    text16[20] = char16_t{0xd800};
+    auto expected8 = std::string(20, 'a') + "\xef\xbf\xbd" + std::string(19, 'a');
+    ASSERT_EQ((char_converter<"utf-16", "utf-8">{}(text16)), expected8);
+}
@@ -10,6 +10,12 @@
 #include "../macros.hpp"
 #include <cstddef>
 #include <string>
+#include <algorithm>
+#include <bit>
+
+#if defined(HI_HAS_X86)
+#include <emmintrin.h>
+#endif
 
 hi_export_module(hikogui.codec.BON8);
 
@@ -17,6 +23,9 @@ hi_warning_push();
 // C26429: Symbol '' is never tested for nullness, it can be marked as not_null (f.23)
 // False positive reported: https://developercommunity.visualstudio.com/t/C26429-false-positive-on-reference-to-po/10262151
 hi_warning_ignore_msvc(26429);
+// C26490: Don't use reinterpret_cast.
+// Needed for SIMD intrinsics and for viewing strings in the byte buffer.
+hi_warning_ignore_msvc(26490);
 
 hi_export namespace hi::inline v1 {
 namespace detail {
@@ -51,6 +60,91 @@ constexpr auto BON8_code_float_one = uint8_t{0xfd};
 constexpr auto BON8_code_eoc = uint8_t{0xfe};
 constexpr auto BON8_code_eot = uint8_t{0xff};
 
+/** Find the first code-unit which is not ASCII.
+ */
+[[nodiscard]] constexpr cbyteptr BON8_find_non_ascii_generic(cbyteptr first, cbyteptr last) noexcept
+{
+    return std::find_if(first, last, [](std::byte c) {
+        return to_bool(c & std::byte{0x80});
+    });
+}
+
+/** Find the first code-unit which is not a single byte integer.
+ */
+[[nodiscard]] constexpr cbyteptr BON8_find_non_small_integer_generic(cbyteptr first, cbyteptr last) noexcept
+{
+    return std::find_if(first, last, [](std::byte c) {
+        return static_cast<uint8_t>(c) < BON8_code_positive_s or static_cast<uint8_t>(c) > BON8_code_negative_e;
+    });
+}
+
+#if defined(HI_HAS_X86)
+hi_target("sse2") [[nodiscard]] hi_inline cbyteptr BON8_find_non_ascii_sse2(cbyteptr first, cbyteptr last) noexcept
+{
+    for (; last - first >= 16; first += 16) {
+        hilet chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(first));
+        if (hilet mask = _mm_movemask_epi8(chunk)) {
+            return first + std::countr_zero(static_cast<unsigned int>(mask));
+        }
+    }
+    return BON8_find_non_ascii_generic(first, last);
+}
+
+hi_target("sse2") [[nodiscard]] hi_inline cbyteptr BON8_find_non_small_integer_sse2(cbyteptr first, cbyteptr last) noexcept
+{
+    // A code-unit is a single byte integer when: code-unit - 0x90 <= 0x31, unsigned.
+    hilet offset = _mm_set1_epi8(static_cast<char>(BON8_code_positive_s));
+    hilet range = _mm_set1_epi8(static_cast<char>(BON8_code_negative_e - BON8_code_positive_s));
+
+    for (; last - first >= 16; first += 16) {
+        hilet chunk = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(first)), offset);
+        hilet is_integer = _mm_cmpeq_epi8(_mm_min_epu8(chunk, range), chunk);
+        hilet mask = static_cast<unsigned int>(_mm_movemask_epi8(is_integer));
+        if (mask != 0xffff) {
+            return first + std::countr_one(mask);
+        }
+    }
+    return BON8_find_non_small_integer_generic(first, last);
+}
+#endif
+
+/** Find the first code-unit which is not ASCII.
+ *
+ * ASCII code-units are the most common part of strings in a BON8 message.
+ */
+[[nodiscard]] hi_inline cbyteptr BON8_find_non_ascii(cbyteptr first, cbyteptr last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        return BON8_find_non_ascii_sse2(first, last);
+    }
+#endif
+    return BON8_find_non_ascii_generic(first, last);
+}
+
+/** Find the end of a group of single byte integers.
+ *
+ * Arrays of small integers are encoded as a single code-unit per integer.
+ */
+[[nodiscard]] hi_inline cbyteptr BON8_find_non_small_integer(cbyteptr first, cbyteptr last) noexcept
+{
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        return BON8_find_non_small_integer_sse2(first, last);
+    }
+#endif
+    return BON8_find_non_small_integer_generic(first, last);
+}
+
+/** Decode a single byte integer.
+ */
+[[nodiscard]] constexpr int decode_BON8_small_integer(std::byte code) noexcept
+{
+    hilet c = static_cast<uint8_t>(code);
+    hi_axiom(c >= BON8_code_positive_s and c <= BON8_code_negative_e);
+    return c <= BON8_code_positive_e ? c - BON8_code_positive_s : ~(c - BON8_code_negative_s);
+}
+
 /** Decode BON8 message from buffer.
  * @param ptr [in,out] Pointer to start of byte-buffer. After the call
  *            ptr will point one beyond the message.
@@ -311,12 +405,12 @@ public:
             open_string = false;
 
         } else {
+#ifndef NDEBUG
             int multi_byte = 0;
 
             for (hilet _c : value) {
                 hilet c = truncate<uint8_t>(_c);
 
-#ifndef NDEBUG
                 if (multi_byte == 0) {
                     if (c >= 0xc2 and c <= 0xdf) {
                         multi_byte = 1;
@@ -332,12 +426,12 @@ public:
                     hi_assert(c >= 0x80 and c <= 0xbf);
                     --multi_byte;
                 }
-#endif
-
-                output += static_cast<std::byte>(c);
             }
             hi_assert(multi_byte == 0);
+#endif
 
+            // The UTF-8 code-units are copied unchanged.
+            output.append(reinterpret_cast<std::byte const *>(value.data()), value.size());
             open_string = true;
         }
     }
@@ -467,6 +561,39 @@ void hi_inline BON8_encoder::add(datum const& value)
     return (c1 < 0x80 or c1 > 0xbf) ? -count : count;
 }
 
+/** Find the end of a string.
+ *
+ * A string is a run of ASCII and UTF-8 multi-byte characters. The run of ASCII
+ * characters is scanned with SIMD instructions.
+ *
+ * @param ptr The pointer to the first byte of the string.
+ * @param last The pointer beyond the buffer.
+ * @return The pointer to the first byte that is not part of the string; an
+ *         end-of-text or the start of the next value. Or @a last when the
+ *         string is not terminated.
+ */
+[[nodiscard]] hi_inline cbyteptr BON8_find_string_end(cbyteptr ptr, cbyteptr last)
+{
+    while (true) {
+        ptr = BON8_find_non_ascii(ptr, last);
+        if (ptr == last) {
+            return ptr;
+        }
+
+        hilet c = static_cast<uint8_t>(*ptr);
+        if (c < 0xc2 or c > 0xf7) {
+            return ptr;
+        }
+
+        hilet count = BON8_multibyte_count(ptr, last);
+        if (count < 0) {
+            // A multi-byte integer.
+            return ptr;
+        }
+        ptr += count;
+    }
+}
+
 /** Decode a 4, or 8 byte signed integer.
  *
  * @param[in,out] ptr The pointer to the first byte of the integer.
@@ -529,14 +656,22 @@ void hi_inline BON8_encoder::add(datum const& value)
     hi_assert_not_null(ptr);
     hi_assert_not_null(last);
 
-    auto r = datum::make_vector();
-    auto& vector = get<datum::vector_type>(r);
+    // The vector is built before it is moved into the datum; a mutable reference into
+    // a datum would stop the datum from being shared with its copies.
+    auto vector = datum::vector_type{};
 
     while (ptr != last) {
         if (*ptr == static_cast<std::byte>(BON8_code_eoc)) {
             ++ptr;
-            return r;
+            return datum{std::move(vector)};
+        }
 
+        // Decode a group of single byte integers at once.
+        hilet group_last = BON8_find_non_small_integer(ptr, last);
+        if (group_last != ptr) {
+            for (; ptr != group_last; ++ptr) {
+                vector.emplace_back(decode_BON8_small_integer(*ptr));
+            }
         } else {
             vector.push_back(decode_BON8(ptr, last));
         }
@@ -546,13 +681,12 @@ void hi_inline BON8_encoder::add(datum const& value)
 
 [[nodiscard]] hi_inline datum decode_BON8_array(cbyteptr& ptr, cbyteptr last, std::size_t count)
 {
-    auto r = datum::make_vector();
-    auto& vector = get<datum::vector_type>(r);
+    auto vector = datum::vector_type{};
 
     while (count--) {
         vector.push_back(decode_BON8(ptr, last));
     }
-    return r;
+    return datum{std::move(vector)};
 }
 
 [[nodiscard]] hi_inline datum decode_BON8_object(cbyteptr& ptr, cbyteptr last)
@@ -560,13 +694,12 @@ void hi_inline BON8_encoder::add(datum const& value)
     hi_assert_not_null(ptr);
     hi_assert_not_null(last);
 
-    auto r = datum::make_map();
-    auto& map = get<datum::map_type>(r);
+    auto map = datum::map_type{};
 
     while (ptr != last) {
         if (*ptr == static_cast<std::byte>(BON8_code_eoc)) {
             ++ptr;
-            return r;
+            return datum{std::move(map)};
 
         } else {
             auto key = decode_BON8(ptr, last);
@@ -581,8 +714,7 @@ void hi_inline BON8_encoder::add(datum const& value)
 
 [[nodiscard]] hi_inline datum decode_BON8_object(cbyteptr& ptr, cbyteptr last, std::size_t count)
 {
-    auto r = datum::make_map();
-    auto& map = get<datum::map_type>(r);
+    auto map = datum::map_type{};
 
     while (count--) {
         auto key = decode_BON8(ptr, last);
@@ -591,7 +723,7 @@ void hi_inline BON8_encoder::add(datum const& value)
         auto value = decode_BON8(ptr, last);
         map.emplace(std::move(key), std::move(value));
     }
-    return r;
+    return datum{std::move(map)};
 }
 
 [[nodiscard]] hi_inline long long decode_BON8_UTF8_like_int(cbyteptr& ptr, cbyteptr last, int count) noexcept
@@ -666,110 +798,94 @@ void hi_inline BON8_encoder::add(datum const& value)
     hi_assert_not_null(ptr);
     hi_assert_not_null(last);
 
-    std::string str;
-
-    while (ptr != last) {
-        hilet c = static_cast<uint8_t>(*ptr);
+    hilet string_last = BON8_find_string_end(ptr, last);
+    if (string_last == last) {
+        throw parse_error("Unexpected end-of-buffer");
 
-        if (c == BON8_code_eot) {
-            // End of string found, return the current string.
+    } else if (string_last != ptr) {
+        // A string is terminated by end-of-text, or by the start of a non-string type.
+        auto str = std::string{reinterpret_cast<char const *>(ptr), narrow_cast<std::size_t>(string_last - ptr)};
+        ptr = string_last;
+        if (*ptr == static_cast<std::byte>(BON8_code_eot)) {
             ++ptr;
-            return datum{str};
-
-        } else if (c <= 0x7f) {
-            // ASCII character.
-            str += static_cast<char>(*(ptr++));
-            continue;
-
-        } else if (c >= 0xc2 && c <= 0xf7) {
-            hilet count = BON8_multibyte_count(ptr, last);
-            if (count > 0) {
-                // Multibyte UTF-8 code-point, The count includes the first code-unit.
-                for (int i = 0; i != count; ++i) {
-                    str += static_cast<char>(*(ptr++));
-                }
-                continue;
+        }
+        return datum{std::move(str)};
+    }
 
-            } else if (not str.empty()) {
-                // Multibyte integer found, but first return the current string.
-                return datum{str};
+    hilet c = static_cast<uint8_t>(*ptr);
 
-            } else {
-                // Multibyte integer, the first code-unit includes part of the integer.
-                return datum{decode_BON8_UTF8_like_int(ptr, last, -count)};
-            }
+    if (c == BON8_code_eot) {
+        // An empty string.
+        ++ptr;
+        return datum{std::string{}};
 
-        } else if (not str.empty()) {
-            // This must be a non-string type, but first return the current string.
-            return datum{str};
+    } else if (c >= 0xc2 && c <= 0xf7) {
+        // Multibyte integer, the first code-unit includes part of the integer.
+        return datum{decode_BON8_UTF8_like_int(ptr, last, -BON8_multibyte_count(ptr, last))};
 
-        } else {
-            // This is one of the non-string types.
-            ++ptr;
-            switch (c) {
-            case BON8_code_null:
-                return datum{nullptr};
-            case BON8_code_bool_false:
-                return datum{false};
-            case BON8_code_bool_true:
-                return datum{true};
-            case BON8_code_float_min_one:
-                return datum{-1.0f};
-            case BON8_code_float_zero:
-                return datum{0.0f};
-            case BON8_code_float_one:
-                return datum{1.0f};
-            case BON8_code_int32:
-                return decode_BON8_int(ptr, last, 4);
-            case BON8_code_int64:
-                return decode_BON8_int(ptr, last, 8);
-            case BON8_code_binary32:
-                return decode_BON8_float(ptr, last, 4);
-            case BON8_code_binary64:
-                return decode_BON8_float(ptr, last, 8);
-            case BON8_code_array_count0:
-                return datum::make_vector();
-            case BON8_code_array_count1:
-                return decode_BON8_array(ptr, last, 1);
-            case BON8_code_array_count2:
-                return decode_BON8_array(ptr, last, 2);
-            case BON8_code_array_count3:
-                return decode_BON8_array(ptr, last, 3);
-            case BON8_code_array_count4:
-                return decode_BON8_array(ptr, last, 4);
-            case BON8_code_array:
-                return decode_BON8_array(ptr, last);
-            case BON8_code_object_count0:
-                return datum::make_map();
-            case BON8_code_object_count1:
-                return decode_BON8_object(ptr, last, 1);
-            case BON8_code_object_count2:
-                return decode_BON8_object(ptr, last, 2);
-            case BON8_code_object_count3:
-                return decode_BON8_object(ptr, last, 3);
-            case BON8_code_object_count4:
-                return decode_BON8_object(ptr, last, 4);
-            case BON8_code_object:
-                return decode_BON8_object(ptr, last);
-            case BON8_code_eoc:
-                throw parse_error("Unexpected end-of-container");
-            case BON8_code_eot:
-                throw parse_error("Unexpected end-of-text");
-            default:
-                // Everything below this, are non-string types.
-                if (c >= BON8_code_positive_s and c <= BON8_code_positive_e) {
-                    return datum{c - BON8_code_positive_s};
-
-                } else if (c >= BON8_code_negative_s and c <= BON8_code_negative_e) {
-                    return datum{~truncate<int>(c - BON8_code_negative_s)};
+    } else {
+        // This is one of the non-string types.
+        ++ptr;
+        switch (c) {
+        case BON8_code_null:
+            return datum{nullptr};
+        case BON8_code_bool_false:
+            return datum{false};
+        case BON8_code_bool_true:
+            return datum{true};
+        case BON8_code_float_min_one:
+            return datum{-1.0f};
+        case BON8_code_float_zero:
+            return datum{0.0f};
+        case BON8_code_float_one:
+            return datum{1.0f};
+        case BON8_code_int32:
+            return decode_BON8_int(ptr, last, 4);
+        case BON8_code_int64:
+            return decode_BON8_int(ptr, last, 8);
+        case BON8_code_binary32:
+            return decode_BON8_float(ptr, last, 4);
+        case BON8_code_binary64:
+            return decode_BON8_float(ptr, last, 8);
+        case BON8_code_array_count0:
+            return datum::make_vector();
+        case BON8_code_array_count1:
+            return decode_BON8_array(ptr, last, 1);
+        case BON8_code_array_count2:
+            return decode_BON8_array(ptr, last, 2);
+        case BON8_code_array_count3:
+            return decode_BON8_array(ptr, last, 3);
+        case BON8_code_array_count4:
+            return decode_BON8_array(ptr, last, 4);
+        case BON8_code_array:
+            return decode_BON8_array(ptr, last);
+        case BON8_code_object_count0:
+            return datum::make_map();
+        case BON8_code_object_count1:
+            return decode_BON8_object(ptr, last, 1);
+        case BON8_code_object_count2:
+            return decode_BON8_object(ptr, last, 2);
+        case BON8_code_object_count3:
+            return decode_BON8_object(ptr, last, 3);
+        case BON8_code_object_count4:
+            return decode_BON8_object(ptr, last, 4);
+        case BON8_code_object:
+            return decode_BON8_object(ptr, last);
+        case BON8_code_eoc:
+            throw parse_error("Unexpected end-of-container");
+        default:
+            // Everything below this, are non-string types.
+            if (c >= BON8_code_positive_s and c <= BON8_code_positive_e) {
+                return datum{c - BON8_code_positive_s};
 
-                } else {
-                    hi_no_default();
-                }
+            } else if (c >= BON8_code_negative_s and c <= BON8_code_negative_e) {
+                return datum{~truncate<int>(c - BON8_code_negative_s)};
+
+            } else {
+                hi_no_default();
             }
         }
     }
-    throw parse_error("Unexpected end-of-buffer");
 }
 
 } // namespace detail
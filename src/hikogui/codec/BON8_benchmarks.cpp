@@ -0,0 +1,131 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "BON8.hpp"
+#include "BON8_view.hpp"
+#include "JSON.hpp"
+#include "JSON_document.hpp"
+#include "JSON_writer.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a snapshot of state with 10k records.
+ */
+[[nodiscard]] datum make_records()
+{
+    auto r = datum::vector_type{};
+    for (auto i = 0; i != 10'000; ++i) {
+        auto record = datum::make_map();
+        record["id"] = i;
+        record["name"] = std::format("item {}", i);
+        record["price"] = (i % 100) + (i % 7) * 0.125;
+        record["active"] = i % 2 == 0;
+        record["parent"] = nullptr;
+        record["tags"] = datum::make_vector("red", "green", "blue");
+        record["size"] = datum::make_map("width", i % 640, "height", i % 480);
+        record["history"] = datum::make_vector(i % 10, i % 20, i % 30, i % 40, 1, 2, 3, 4, 5, 6, 7, 8);
+        r.push_back(std::move(record));
+    }
+    return datum{std::move(r)};
+}
+
+[[nodiscard]] std::string format_compact_JSON(datum const& value)
+{
+    auto r = std::string{};
+    auto writer = JSON_writer{[&r](std::string_view block) {
+        r += block;
+    }};
+    writer.value(value);
+    writer.flush();
+    return r;
+}
+
+} // namespace
+
+TEST(BON8_benchmarks, encode)
+{
+    hilet records = make_records();
+
+    auto size = 0_uz;
+    hilet BON8_rate = benchmark_rate([&] {
+        size = encode_BON8(records).size();
+    });
+    hilet BON8_size = size;
+
+    hilet JSON_rate = benchmark_rate([&] {
+        size = format_compact_JSON(records).size();
+    });
+    hilet JSON_size = size;
+
+    benchmark_report("BON8 message size", static_cast<double>(BON8_size) / 1'000.0, "kB");
+    benchmark_report("JSON text size", static_cast<double>(JSON_size) / 1'000.0, "kB");
+    benchmark_report("encode_BON8 10k records", BON8_rate, "encodes/s");
+    benchmark_report("JSON_writer 10k records", JSON_rate, "encodes/s");
+}
+
+TEST(BON8_benchmarks, decode)
+{
+    hilet records = make_records();
+    hilet message = encode_BON8(records);
+    hilet text = format_compact_JSON(records);
+
+    ASSERT_EQ(decode_BON8(message), records);
+    ASSERT_EQ(static_cast<datum>(BON8_view{message}), records);
+
+    hilet decode_BON8_rate = benchmark_rate([&] {
+        hilet r = decode_BON8(message);
+    });
+
+    hilet parse_JSON_rate = benchmark_rate([&] {
+        hilet r = parse_JSON(text);
+    });
+
+    hilet JSON_document_rate = benchmark_rate([&] {
+        hilet r = static_cast<datum>(JSON_document{text});
+    });
+
+    benchmark_report("decode_BON8 10k records", decode_BON8_rate, "decodes/s");
+    benchmark_report("parse_JSON 10k records", parse_JSON_rate, "decodes/s");
+    benchmark_report("JSON_document to datum 10k records", JSON_document_rate, "decodes/s");
+}
+
+TEST(BON8_benchmarks, read)
+{
+    hilet records = make_records();
+    hilet message = encode_BON8(records);
+    hilet text = format_compact_JSON(records);
+
+    // Read a few fields of each record, without decoding the rest.
+    auto sum = 0ll;
+    hilet view_rate = benchmark_rate([&] {
+        sum = 0;
+        for (hilet& record : BON8_view{message}.as_array()) {
+            sum += record.find("id")->as_integer();
+            sum += ssize(record.find("name")->as_string());
+        }
+    });
+    hilet view_sum = sum;
+
+    hilet document_rate = benchmark_rate([&] {
+        sum = 0;
+        hilet document = JSON_document{text};
+        for (hilet& record : document.root().as_array()) {
+            sum += record.find("id")->as_integer();
+            sum += ssize(record.find("name")->as_string());
+        }
+    });
+    ASSERT_EQ(sum, view_sum);
+
+    benchmark_report("BON8_view read 10k records", view_rate, "reads/s");
+    benchmark_report("JSON_document read 10k records", document_rate, "reads/s");
+}
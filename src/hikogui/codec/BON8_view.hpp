@@ -0,0 +1,630 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/BON8_view.hpp A read-only view of a BON8 message.
+ */
+
+#pragma once
+
+#include "BON8.hpp"
+#include "datum.hpp"
+#include "../container/container.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+hi_export_module(hikogui.codec.BON8_view);
+
+hi_warning_push();
+// C26490: Don't use reinterpret_cast.
+// Needed for viewing strings in the byte buffer.
+hi_warning_ignore_msvc(26490);
+
+hi_export namespace hi::inline v1 {
+
+/** The type of a value in a BON8 message.
+ */
+enum class BON8_type : uint8_t { null, boolean, integer, real, string, array, object };
+
+struct BON8_member;
+
+/** A read-only view of a value in a BON8 message.
+ *
+ * The view points into the buffer of the message; a value is only decoded
+ * when it is read, and reading does not allocate. Strings are views into the
+ * buffer, since BON8 strings are UTF-8 without escape sequences. Arrays and
+ * objects are walked lazily by iterators, skipping over the values that are
+ * not read.
+ *
+ * A malformed message is detected while walking it, by throwing a parse_error.
+ * The buffer must outlive the view and the strings read from it.
+ */
+class BON8_view {
+public:
+    class array_iterator;
+    class object_iterator;
+    class array_range;
+    class object_range;
+
+    constexpr BON8_view() noexcept = default;
+    constexpr BON8_view(BON8_view const&) noexcept = default;
+    constexpr BON8_view(BON8_view&&) noexcept = default;
+    constexpr BON8_view& operator=(BON8_view const&) noexcept = default;
+    constexpr BON8_view& operator=(BON8_view&&) noexcept = default;
+
+    /** View the BON8 message at the start of a buffer.
+     *
+     * @param buffer A buffer to a BON8 encoded message.
+     * @throws parse_error When the message does not start with a valid value.
+     */
+    explicit BON8_view(bstring_view buffer) : BON8_view(buffer.data(), buffer.data() + buffer.size()) {}
+
+    /** View the value at the start of a buffer.
+     *
+     * @param first The pointer to the first byte of the value.
+     * @param last The pointer beyond the buffer.
+     * @throws parse_error When the buffer does not start with a valid value.
+     */
+    BON8_view(cbyteptr first, cbyteptr last) : _first(first), _last(last)
+    {
+        hi_check(_first != _last, "Unexpected end-of-buffer");
+
+        hilet c = static_cast<uint8_t>(*_first);
+        if (c <= 0x7f or c == detail::BON8_code_eot) {
+            _type = BON8_type::string;
+
+        } else if (c >= 0xc2 and c <= 0xf7) {
+            _type = detail::BON8_multibyte_count(_first, _last) > 0 ? BON8_type::string : BON8_type::integer;
+
+        } else if (c >= detail::BON8_code_positive_s and c <= detail::BON8_code_negative_e) {
+            _type = BON8_type::integer;
+
+        } else if (c <= detail::BON8_code_array) {
+            _type = BON8_type::array;
+
+        } else if (c <= detail::BON8_code_object) {
+            _type = BON8_type::object;
+
+        } else {
+            switch (c) {
+            case detail::BON8_code_int32:
+                _type = BON8_type::integer;
+                hi_check(_last - _first >= 5, "Incomplete signed integer at end of buffer");
+                break;
+            case detail::BON8_code_int64:
+                _type = BON8_type::integer;
+                hi_check(_last - _first >= 9, "Incomplete signed integer at end of buffer");
+                break;
+            case detail::BON8_code_binary32:
+                _type = BON8_type::real;
+                hi_check(_last - _first >= 5, "Incomplete floating point number at end of buffer");
+                break;
+            case detail::BON8_code_binary64:
+                _type = BON8_type::real;
+                hi_check(_last - _first >= 9, "Incomplete floating point number at end of buffer");
+                break;
+            case detail::BON8_code_float_min_one:
+            case detail::BON8_code_float_zero:
+            case detail::BON8_code_float_one:
+                _type = BON8_type::real;
+                break;
+            case detail::BON8_code_bool_false:
+            case detail::BON8_code_bool_true:
+                _type = BON8_type::boolean;
+                break;
+            case detail::BON8_code_null:
+                _type = BON8_type::null;
+                break;
+            case detail::BON8_code_eoc:
+                throw parse_error("Unexpected end-of-container");
+            default:
+                hi_no_default();
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr BON8_type type() const noexcept
+    {
+        return _type;
+    }
+
+    [[nodiscard]] constexpr bool is_null() const noexcept
+    {
+        return _type == BON8_type::null;
+    }
+
+    [[nodiscard]] constexpr bool is_bool() const noexcept
+    {
+        return _type == BON8_type::boolean;
+    }
+
+    [[nodiscard]] constexpr bool is_integer() const noexcept
+    {
+        return _type == BON8_type::integer;
+    }
+
+    [[nodiscard]] constexpr bool is_real() const noexcept
+    {
+        return _type == BON8_type::real;
+    }
+
+    [[nodiscard]] constexpr bool is_string() const noexcept
+    {
+        return _type == BON8_type::string;
+    }
+
+    [[nodiscard]] constexpr bool is_array() const noexcept
+    {
+        return _type == BON8_type::array;
+    }
+
+    [[nodiscard]] constexpr bool is_object() const noexcept
+    {
+        return _type == BON8_type::object;
+    }
+
+    /** The number of characters, elements or members.
+     *
+     * The elements of an array or the members of an object without a count
+     * are counted by walking over them.
+     *
+     * @return The size of a string, array or object, zero for other types.
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        switch (_type) {
+        case BON8_type::string:
+            return as_string().size();
+        case BON8_type::array:
+            return skip_items(_first + 1, _last, item_count()).second;
+        case BON8_type::object:
+            return skip_items(_first + 1, _last, item_count()).second / 2;
+        default:
+            return 0;
+        }
+    }
+
+    [[nodiscard]] bool as_bool() const noexcept
+    {
+        hi_axiom(is_bool());
+        return static_cast<uint8_t>(*_first) == detail::BON8_code_bool_true;
+    }
+
+    [[nodiscard]] long long as_integer() const noexcept
+    {
+        hi_axiom(is_integer());
+
+        hilet c = static_cast<uint8_t>(*_first);
+        if (c >= detail::BON8_code_positive_s and c <= detail::BON8_code_negative_e) {
+            return detail::decode_BON8_small_integer(*_first);
+
+        } else if (c == detail::BON8_code_int32) {
+            return load_be<int32_t>(_first + 1);
+
+        } else if (c == detail::BON8_code_int64) {
+            return load_be<int64_t>(_first + 1);
+
+        } else {
+            auto ptr = _first;
+            return detail::decode_BON8_UTF8_like_int(ptr, _last, -detail::BON8_multibyte_count(_first, _last));
+        }
+    }
+
+    /** Get the value as a floating point number.
+     *
+     * @pre The value must be a real or an integer.
+     */
+    [[nodiscard]] double as_real() const noexcept
+    {
+        hi_axiom(is_real() or is_integer());
+
+        switch (static_cast<uint8_t>(*_first)) {
+        case detail::BON8_code_float_min_one:
+            return -1.0;
+        case detail::BON8_code_float_zero:
+            return 0.0;
+        case detail::BON8_code_float_one:
+            return 1.0;
+        case detail::BON8_code_binary32:
+            return std::bit_cast<float>(load_be<uint32_t>(_first + 1));
+        case detail::BON8_code_binary64:
+            return std::bit_cast<double>(load_be<uint64_t>(_first + 1));
+        default:
+            return static_cast<double>(as_integer());
+        }
+    }
+
+    /** Get the value as a string.
+     *
+     * @return A view of the UTF-8 string in the buffer.
+     * @throws parse_error When the string is not terminated.
+     */
+    [[nodiscard]] std::string_view as_string() const
+    {
+        hi_axiom(is_string());
+        return scan_string(_first, _last).first;
+    }
+
+    /** Get the elements of an array.
+     *
+     * @return A range of views of the elements, walked in order.
+     */
+    [[nodiscard]] array_range as_array() const;
+
+    /** Get the members of an object.
+     *
+     * @return A range of members, walked in the order of the message.
+     */
+    [[nodiscard]] object_range as_object() const;
+
+    /** Find a member of an object.
+     *
+     * @param key The key of the member.
+     * @return A view of the value of the member, or empty if the value
+     *         is not an object or does not have the member.
+     */
+    [[nodiscard]] std::optional<BON8_view> find(std::string_view key) const;
+
+    /** Convert to a datum.
+     *
+     * This decodes the value, including all the values it contains.
+     */
+    [[nodiscard]] explicit operator datum() const;
+
+private:
+    cbyteptr _first = nullptr;
+    cbyteptr _last = nullptr;
+    BON8_type _type = BON8_type::null;
+
+    /** The number of items in an array or object.
+     *
+     * @return The number of elements of an array, or twice the number of
+     *         members of an object. Or -1 when the items are terminated by
+     *         an end-of-container.
+     */
+    [[nodiscard]] std::ptrdiff_t item_count() const noexcept
+    {
+        hilet c = static_cast<uint8_t>(*_first);
+        if (c == detail::BON8_code_array or c == detail::BON8_code_object) {
+            return -1;
+        } else if (c < detail::BON8_code_array) {
+            return c - detail::BON8_code_array_count0;
+        } else {
+            return (c - detail::BON8_code_object_count0) * 2;
+        }
+    }
+
+    /** The pointer beyond the value.
+     */
+    [[nodiscard]] cbyteptr value_last() const
+    {
+        switch (_type) {
+        case BON8_type::string:
+            return scan_string(_first, _last).second;
+        case BON8_type::array:
+        case BON8_type::object:
+            return skip_items(_first + 1, _last, item_count()).first;
+        default:
+            break;
+        }
+
+        switch (static_cast<uint8_t>(*_first)) {
+        case detail::BON8_code_int32:
+        case detail::BON8_code_binary32:
+            return _first + 5;
+        case detail::BON8_code_int64:
+        case detail::BON8_code_binary64:
+            return _first + 9;
+        default:
+            if (is_integer() and static_cast<uint8_t>(*_first) >= 0xc2) {
+                return _first - detail::BON8_multibyte_count(_first, _last);
+            }
+            return _first + 1;
+        }
+    }
+
+    /** Scan a string.
+     *
+     * @param ptr The pointer to the first byte of the string.
+     * @param last The pointer beyond the buffer.
+     * @return The string, and the pointer beyond the string including its end-of-text.
+     */
+    [[nodiscard]] static std::pair<std::string_view, cbyteptr> scan_string(cbyteptr ptr, cbyteptr last)
+    {
+        hilet string_last = detail::BON8_find_string_end(ptr, last);
+        hi_check(string_last != last, "Incomplete string at end of buffer");
+
+        hilet str = std::string_view{reinterpret_cast<char const *>(ptr), narrow_cast<std::size_t>(string_last - ptr)};
+        if (*string_last == static_cast<std::byte>(detail::BON8_code_eot)) {
+            return {str, string_last + 1};
+        } else {
+            return {str, string_last};
+        }
+    }
+
+    /** Skip over the items of an array or object.
+     *
+     * @param ptr The pointer to the first item.
+     * @param last The pointer beyond the buffer.
+     * @param count The number of items, or -1 when terminated by an end-of-container.
+     * @return The pointer beyond the items, including the end-of-container;
+     *         and the number of items.
+     */
+    [[nodiscard]] static std::pair<cbyteptr, std::size_t> skip_items(cbyteptr ptr, cbyteptr last, std::ptrdiff_t count)
+    {
+        auto num_items = 0_uz;
+        while (count != 0) {
+            hi_check(ptr != last, "Incomplete container at end of buffer");
+            if (count < 0 and *ptr == static_cast<std::byte>(detail::BON8_code_eoc)) {
+                return {ptr + 1, num_items};
+            }
+
+            // Skip over a group of single byte integers at once.
+            auto group_size = detail::BON8_find_non_small_integer(ptr, last) - ptr;
+            if (count > 0) {
+                group_size = std::min(group_size, count);
+                count -= group_size;
+            }
+
+            if (group_size != 0) {
+                ptr += group_size;
+                num_items += narrow_cast<std::size_t>(group_size);
+            } else {
+                ptr = BON8_view{ptr, last}.value_last();
+                ++num_items;
+                if (count > 0) {
+                    --count;
+                }
+            }
+        }
+        return {ptr, num_items};
+    }
+};
+
+/** A member of an object in a BON8 message.
+ */
+struct BON8_member {
+    std::string_view key;
+    BON8_view value;
+};
+
+/** An iterator over the elements of an array in a BON8 message.
+ */
+class BON8_view::array_iterator {
+public:
+    using value_type = BON8_view;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr array_iterator() noexcept = default;
+
+    array_iterator(cbyteptr ptr, cbyteptr last, std::ptrdiff_t count) : _last(last), _count(count)
+    {
+        seek(ptr);
+    }
+
+    [[nodiscard]] constexpr BON8_view const& operator*() const noexcept
+    {
+        return _value;
+    }
+
+    [[nodiscard]] constexpr BON8_view const *operator->() const noexcept
+    {
+        return &_value;
+    }
+
+    array_iterator& operator++()
+    {
+        if (_count > 0) {
+            --_count;
+        }
+        seek(_value.value_last());
+        return *this;
+    }
+
+    void operator++(int)
+    {
+        ++*this;
+    }
+
+    [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept
+    {
+        return _count == 0;
+    }
+
+private:
+    BON8_view _value = {};
+    cbyteptr _last = nullptr;
+    std::ptrdiff_t _count = 0;
+
+    void seek(cbyteptr ptr)
+    {
+        if (_count < 0) {
+            hi_check(ptr != _last, "Incomplete array at end of buffer");
+            if (*ptr == static_cast<std::byte>(detail::BON8_code_eoc)) {
+                _count = 0;
+            }
+        }
+
+        if (_count != 0) {
+            _value = BON8_view{ptr, _last};
+        }
+    }
+};
+
+/** An iterator over the members of an object in a BON8 message.
+ */
+class BON8_view::object_iterator {
+public:
+    using value_type = BON8_member;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr object_iterator() noexcept = default;
+
+    object_iterator(cbyteptr ptr, cbyteptr last, std::ptrdiff_t count) : _last(last), _count(count)
+    {
+        seek(ptr);
+    }
+
+    [[nodiscard]] constexpr BON8_member const& operator*() const noexcept
+    {
+        return _member;
+    }
+
+    [[nodiscard]] constexpr BON8_member const *operator->() const noexcept
+    {
+        return &_member;
+    }
+
+    object_iterator& operator++()
+    {
+        if (_count > 0) {
+            _count -= 2;
+        }
+        seek(_member.value.value_last());
+        return *this;
+    }
+
+    void operator++(int)
+    {
+        ++*this;
+    }
+
+    [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept
+    {
+        return _count == 0;
+    }
+
+private:
+    BON8_member _member = {};
+    cbyteptr _last = nullptr;
+    std::ptrdiff_t _count = 0;
+
+    void seek(cbyteptr ptr)
+    {
+        if (_count < 0) {
+            hi_check(ptr != _last, "Incomplete object at end of buffer");
+            if (*ptr == static_cast<std::byte>(detail::BON8_code_eoc)) {
+                _count = 0;
+            }
+        }
+
+        if (_count != 0) {
+            hi_check(BON8_view(ptr, _last).is_string(), "Key in object is not a string");
+            hilet [key, value_first] = BON8_view::scan_string(ptr, _last);
+            _member = BON8_member{key, BON8_view{value_first, _last}};
+        }
+    }
+};
+
+/** The elements of an array in a BON8 message.
+ */
+class BON8_view::array_range {
+public:
+    constexpr array_range() noexcept = default;
+
+    constexpr explicit array_range(array_iterator first) noexcept : _first(first) {}
+
+    [[nodiscard]] constexpr array_iterator begin() const noexcept
+    {
+        return _first;
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    array_iterator _first = {};
+};
+
+/** The members of an object in a BON8 message.
+ */
+class BON8_view::object_range {
+public:
+    constexpr object_range() noexcept = default;
+
+    constexpr explicit object_range(object_iterator first) noexcept : _first(first) {}
+
+    [[nodiscard]] constexpr object_iterator begin() const noexcept
+    {
+        return _first;
+    }
+
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    object_iterator _first = {};
+};
+
+[[nodiscard]] hi_inline BON8_view::array_range BON8_view::as_array() const
+{
+    hi_axiom(is_array());
+    return array_range{array_iterator{_first + 1, _last, item_count()}};
+}
+
+[[nodiscard]] hi_inline BON8_view::object_range BON8_view::as_object() const
+{
+    hi_axiom(is_object());
+    return object_range{object_iterator{_first + 1, _last, item_count()}};
+}
+
+[[nodiscard]] hi_inline std::optional<BON8_view> BON8_view::find(std::string_view key) const
+{
+    if (is_object()) {
+        for (hilet& member : as_object()) {
+            if (member.key == key) {
+                return member.value;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+[[nodiscard]] hi_inline BON8_view::operator datum() const
+{
+    switch (_type) {
+    case BON8_type::null:
+        return datum{nullptr};
+    case BON8_type::boolean:
+        return datum{as_bool()};
+    case BON8_type::integer:
+        return datum{as_integer()};
+    case BON8_type::real:
+        return datum{as_real()};
+    case BON8_type::string:
+        return datum{std::string{as_string()}};
+    case BON8_type::array:
+        {
+            auto vector = datum::vector_type{};
+            for (hilet& item : as_array()) {
+                vector.push_back(static_cast<datum>(item));
+            }
+            return datum{std::move(vector)};
+        }
+    case BON8_type::object:
+        {
+            auto map = datum::map_type{};
+            for (hilet& member : as_object()) {
+                map.emplace(datum{std::string{member.key}}, static_cast<datum>(member.value));
+            }
+            return datum{std::move(map)};
+        }
+    }
+    hi_no_default();
+}
+
+} // namespace hi::inline v1
+
+hi_warning_pop();
@@ -0,0 +1,154 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "BON8_view.hpp"
+#include "BON8.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <format>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] datum make_message()
+{
+    auto r = datum::make_map();
+    r["name"] = "BON8 view";
+    r["empty"] = "";
+    r["unicode"] = "na\xc3\xafve \xe2\x82\xac 100 \xf0\x9f\x98\x80 and a long ASCII tail to scan";
+    r["null"] = nullptr;
+    r["yes"] = true;
+    r["no"] = false;
+    r["reals"] = datum::make_vector(-1.0, 0.0, 1.0, 0.5, 3.14159265358979);
+    r["small"] = datum::make_vector(1, 2, 3);
+    r["keys"] = datum::make_vector("a", "b", "c", "d", "e", "f");
+
+    auto integers = datum::make_vector();
+    for (auto i = -20; i != 60; ++i) {
+        integers.push_back(i);
+    }
+    for (auto i : {3879LL, -1930LL, 528167LL, -264074LL, 67637031LL, -33818506LL, 2147483647LL, -2147483649LL}) {
+        integers.push_back(i);
+    }
+    r["integers"] = integers;
+
+    auto items = datum::make_vector();
+    for (auto i = 0; i != 10; ++i) {
+        auto item = datum::make_map();
+        item["id"] = i * 1000;
+        item["label"] = std::format("item {}", i);
+        item["tags"] = datum::make_vector("x", i, datum::make_map("nested", i));
+        items.push_back(item);
+    }
+    r["items"] = items;
+    return r;
+}
+
+} // namespace
+
+TEST(BON8_view, scalars)
+{
+    for (auto i : {0LL, 39LL, 40LL, 3879LL, 3880LL, 528167LL, 528168LL, 67637031LL, 67637032LL, 2147483647LL, 2147483648LL}) {
+        hilet message = encode_BON8(datum{i});
+        ASSERT_TRUE(BON8_view{message}.is_integer()) << i;
+        ASSERT_EQ(BON8_view{message}.as_integer(), i);
+
+        hilet negative_message = encode_BON8(datum{-i - 1});
+        ASSERT_TRUE(BON8_view{negative_message}.is_integer()) << -i - 1;
+        ASSERT_EQ(BON8_view{negative_message}.as_integer(), -i - 1);
+    }
+
+    for (auto f : {-1.0, 0.0, 1.0, 0.25, 1.0e100}) {
+        hilet message = encode_BON8(datum{f});
+        ASSERT_TRUE(BON8_view{message}.is_real()) << f;
+        ASSERT_EQ(BON8_view{message}.as_real(), f);
+    }
+
+    ASSERT_TRUE(BON8_view{encode_BON8(datum{nullptr})}.is_null());
+    ASSERT_TRUE(BON8_view{encode_BON8(datum{true})}.as_bool());
+    ASSERT_FALSE(BON8_view{encode_BON8(datum{false})}.as_bool());
+    ASSERT_EQ(BON8_view{encode_BON8(datum{""})}.as_string(), "");
+    ASSERT_EQ(BON8_view{encode_BON8(datum{"hello"})}.as_string(), "hello");
+}
+
+TEST(BON8_view, decode)
+{
+    hilet expected = make_message();
+    hilet message = encode_BON8(expected);
+
+    ASSERT_EQ(decode_BON8(message), expected);
+    ASSERT_EQ(static_cast<datum>(BON8_view{message}), expected);
+}
+
+TEST(BON8_view, walk)
+{
+    hilet message = encode_BON8(make_message());
+    hilet view = BON8_view{message};
+    ASSERT_TRUE(view.is_object());
+    ASSERT_EQ(view.size(), 11);
+
+    // Strings are not copied.
+    hilet name = view.find("name")->as_string();
+    ASSERT_EQ(name, "BON8 view");
+    ASSERT_GE(reinterpret_cast<std::byte const *>(name.data()), message.data());
+    ASSERT_LT(reinterpret_cast<std::byte const *>(name.data()), message.data() + message.size());
+
+    ASSERT_EQ(view.find("unicode")->as_string(), get<std::string>(make_message()["unicode"]));
+    ASSERT_EQ(view.find("empty")->as_string(), "");
+    ASSERT_FALSE(view.find("nothing"));
+
+    hilet integers = *view.find("integers");
+    ASSERT_EQ(integers.size(), 88);
+    auto i = -20LL;
+    for (hilet& item : integers.as_array()) {
+        if (i == 60) {
+            ASSERT_EQ(item.as_integer(), 3879);
+            break;
+        }
+        ASSERT_EQ(item.as_integer(), i++);
+    }
+
+    auto num_items = 0;
+    for (hilet& item : view.find("items")->as_array()) {
+        ASSERT_EQ(item.find("id")->as_integer(), num_items * 1000);
+        hilet tags = *item.find("tags");
+        ASSERT_EQ(tags.size(), 3);
+        ASSERT_EQ(static_cast<datum>(tags), datum::make_vector("x", num_items, datum::make_map("nested", num_items)));
+        ++num_items;
+    }
+    ASSERT_EQ(num_items, 10);
+
+    auto keys = std::vector<std::string>{};
+    for (hilet& member : view.as_object()) {
+        keys.emplace_back(member.key);
+    }
+    ASSERT_EQ(keys.size(), 11);
+    ASSERT_EQ(keys.front(), "empty");
+    ASSERT_EQ(keys.back(), "yes");
+}
+
+TEST(BON8_view, malformed)
+{
+    auto message = encode_BON8(make_message());
+
+    // An object without its end-of-container.
+    message.pop_back();
+    hilet view = BON8_view{message};
+    ASSERT_THROW(std::ignore = view.size(), parse_error);
+    ASSERT_THROW(std::ignore = decode_BON8(message), parse_error);
+
+    // A string at the end of the buffer without end-of-text.
+    hilet text = to_bstring("abc");
+    ASSERT_THROW(std::ignore = BON8_view{text}.as_string(), parse_error);
+    ASSERT_THROW(std::ignore = decode_BON8(text), parse_error);
+
+    ASSERT_THROW(std::ignore = BON8_view{bstring_view{}}, parse_error);
+    ASSERT_THROW(std::ignore = BON8_view{to_bstring(0x8c, 0x00)}, parse_error);
+}
@@ -69,7 +69,8 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
 template<std::input_iterator It, std::sentinel_for<It> ItEnd>
 [[nodiscard]] constexpr std::optional<datum> json_parse_object(It& it, ItEnd last, std::string_view path)
 {
-    auto r = datum::make_map();
+    // The map is built before it is moved into the datum, so that the datum can be shared with its copies.
+    auto r = datum::map_type{};
 
     // Required '{'
     if (*it == '{') {
@@ -101,7 +102,7 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
             }
 
             if (auto result = json_parse_value(it, last, path)) {
-                r[name] = std::move(*result);
+                r.insert_or_assign(datum{std::move(name)}, std::move(*result));
 
             } else {
                 throw parse_error(
@@ -121,7 +122,7 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
         }
     }
 
-    return r;
+    return datum{std::move(r)};
 }
 
 template<std::input_iterator It, std::sentinel_for<It> ItEnd>
@@ -0,0 +1,887 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/JSON_document.hpp A read-only JSON document.
+ */
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "datum.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <memory>
+#include <memory_resource>
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <format>
+#include <cstdint>
+#include <cstddef>
+#include <concepts>
+
+hi_export_module(hikogui.codec.JSON_document);
+
+hi_export namespace hi::inline v1 {
+
+/** The type of a value in a JSON document.
+ */
+enum class JSON_type : uint8_t { null, boolean, integer, real, string, array, object };
+
+struct JSON_member;
+
+/** A read-only value in a JSON document.
+ *
+ * A value is 16 bytes. Strings, arrays and objects point into the text
+ * being parsed or into the arena of the JSON_document that owns the value.
+ */
+class JSON_value {
+public:
+    constexpr JSON_value() noexcept = default;
+    constexpr JSON_value(JSON_value const&) noexcept = default;
+    constexpr JSON_value(JSON_value&&) noexcept = default;
+    constexpr JSON_value& operator=(JSON_value const&) noexcept = default;
+    constexpr JSON_value& operator=(JSON_value&&) noexcept = default;
+
+    constexpr JSON_value(std::nullptr_t) noexcept : _type(JSON_type::null) {}
+    constexpr JSON_value(bool value) noexcept : _type(JSON_type::boolean), _boolean(value) {}
+    constexpr JSON_value(long long value) noexcept : _type(JSON_type::integer), _integer(value) {}
+    constexpr JSON_value(double value) noexcept : _type(JSON_type::real), _real(value) {}
+
+    constexpr JSON_value(std::string_view value) noexcept :
+        _type(JSON_type::string), _size(narrow_cast<uint32_t>(value.size())), _string(value.data())
+    {
+    }
+
+    constexpr JSON_value(std::span<JSON_value const> value) noexcept :
+        _type(JSON_type::array), _size(narrow_cast<uint32_t>(value.size())), _array(value.data())
+    {
+    }
+
+    constexpr JSON_value(std::span<JSON_member const> value) noexcept :
+        _type(JSON_type::object), _size(narrow_cast<uint32_t>(value.size())), _object(value.data())
+    {
+    }
+
+    [[nodiscard]] constexpr JSON_type type() const noexcept
+    {
+        return _type;
+    }
+
+    [[nodiscard]] constexpr bool is_null() const noexcept
+    {
+        return _type == JSON_type::null;
+    }
+
+    [[nodiscard]] constexpr bool is_bool() const noexcept
+    {
+        return _type == JSON_type::boolean;
+    }
+
+    [[nodiscard]] constexpr bool is_integer() const noexcept
+    {
+        return _type == JSON_type::integer;
+    }
+
+    [[nodiscard]] constexpr bool is_real() const noexcept
+    {
+        return _type == JSON_type::real;
+    }
+
+    [[nodiscard]] constexpr bool is_string() const noexcept
+    {
+        return _type == JSON_type::string;
+    }
+
+    [[nodiscard]] constexpr bool is_array() const noexcept
+    {
+        return _type == JSON_type::array;
+    }
+
+    [[nodiscard]] constexpr bool is_object() const noexcept
+    {
+        return _type == JSON_type::object;
+    }
+
+    /** The number of characters, elements or members.
+     *
+     * @return The size of a string, array or object, zero for other types.
+     */
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool as_bool() const noexcept
+    {
+        hi_axiom(is_bool());
+        return _boolean;
+    }
+
+    [[nodiscard]] constexpr long long as_integer() const noexcept
+    {
+        hi_axiom(is_integer());
+        return _integer;
+    }
+
+    /** Get the value as a floating point number.
+     *
+     * @pre The value must be a real or an integer.
+     */
+    [[nodiscard]] constexpr double as_real() const noexcept
+    {
+        hi_axiom(is_real() or is_integer());
+        return is_real() ? _real : static_cast<double>(_integer);
+    }
+
+    [[nodiscard]] constexpr std::string_view as_string() const noexcept
+    {
+        hi_axiom(is_string());
+        return {_string, _size};
+    }
+
+    [[nodiscard]] constexpr std::span<JSON_value const> as_array() const noexcept
+    {
+        hi_axiom(is_array());
+        return {_array, _size};
+    }
+
+    /** Get the members of an object.
+     *
+     * @return The members, sorted by key. Keys are unique.
+     */
+    [[nodiscard]] constexpr std::span<JSON_member const> as_object() const noexcept;
+
+    /** Get an element of an array.
+     *
+     * @pre The value must be an array, and @a index must be less than `size()`.
+     */
+    [[nodiscard]] constexpr JSON_value const& operator[](size_t index) const noexcept
+    {
+        hi_axiom(is_array());
+        hi_axiom_bounds(index, _size);
+        return _array[index];
+    }
+
+    /** Find a member of an object.
+     *
+     * @param key The key of the member.
+     * @return A pointer to the value of the member, or nullptr if the value
+     *         is not an object or does not have the member.
+     */
+    [[nodiscard]] constexpr JSON_value const *find(std::string_view key) const noexcept;
+
+    /** Convert to a datum.
+     *
+     * This makes a deep copy of the value and the strings it points to.
+     */
+    [[nodiscard]] explicit operator datum() const;
+
+private:
+    JSON_type _type = JSON_type::null;
+    uint32_t _size = 0;
+    union {
+        bool _boolean;
+        long long _integer = 0;
+        double _real;
+        char const *_string;
+        JSON_value const *_array;
+        JSON_member const *_object;
+    };
+};
+
+/** A member of a JSON object.
+ */
+struct JSON_member {
+    std::string_view key;
+    JSON_value value;
+};
+
+constexpr std::span<JSON_member const> JSON_value::as_object() const noexcept
+{
+    hi_axiom(is_object());
+    return {_object, _size};
+}
+
+constexpr JSON_value const *JSON_value::find(std::string_view key) const noexcept
+{
+    if (not is_object()) {
+        return nullptr;
+    }
+
+    hilet members = as_object();
+    hilet it = std::lower_bound(members.begin(), members.end(), key, [](hilet& item, hilet& key) {
+        return item.key < key;
+    });
+
+    if (it != members.end() and it->key == key) {
+        return std::addressof(it->value);
+    } else {
+        return nullptr;
+    }
+}
+
+hi_inline JSON_value::operator datum() const
+{
+    switch (_type) {
+    case JSON_type::null:
+        return datum{nullptr};
+    case JSON_type::boolean:
+        return datum{_boolean};
+    case JSON_type::integer:
+        return datum{_integer};
+    case JSON_type::real:
+        return datum{_real};
+    case JSON_type::string:
+        return datum{as_string()};
+
+    case JSON_type::array:
+        {
+            auto r = datum::vector_type{};
+            r.reserve(_size);
+            for (hilet& item : as_array()) {
+                r.push_back(static_cast<datum>(item));
+            }
+            return datum{std::move(r)};
+        }
+
+    case JSON_type::object:
+        {
+            // The members are sorted by key, in the same order as the keys in the map.
+            auto r = datum::map_type{};
+            for (hilet& [key, value] : as_object()) {
+                r.emplace_hint(r.end(), datum{key}, static_cast<datum>(value));
+            }
+            return datum{std::move(r)};
+        }
+    }
+    hi_no_default();
+}
+
+namespace detail {
+
+/** Scans the tokens of JSON text.
+ *
+ * The scanner is shared by the parser of JSON_document and by the streaming
+ * JSON_reader. Each of the scan functions expects the complete token to be
+ * available between `_it` and `_last`.
+ */
+class JSON_scanner {
+protected:
+    char const *_first;
+    char const *_it;
+    char const *_last;
+    std::string_view _path;
+
+    /** The line number of `_first`, counting from zero.
+     *
+     * This is non-zero when text in front of `_first` has been discarded.
+     */
+    size_t _line_nr = 0;
+
+    /** The column of `_first`, counting from zero.
+     */
+    size_t _column_nr = 0;
+
+    JSON_scanner(std::string_view text, std::string_view path) noexcept :
+        _first(text.data()), _it(text.data()), _last(text.data() + text.size()), _path(path)
+    {
+    }
+
+    [[nodiscard]] std::string location() const noexcept
+    {
+        if (_it == _last) {
+            return std::format("{}:eof", _path);
+        }
+
+        auto line_nr = _line_nr;
+        auto column_nr = _column_nr;
+        for (auto it = _first; it != _it; ++it) {
+            if (*it == '\n') {
+                ++line_nr;
+                column_nr = 0;
+            } else {
+                ++column_nr;
+            }
+        }
+        return std::format("{}:{}:{}", _path, line_nr + 1, column_nr + 1);
+    }
+
+    [[nodiscard]] std::string found() const noexcept
+    {
+        if (_it == _last) {
+            return "end-of-file";
+        } else {
+            return std::format("'{}'", *_it);
+        }
+    }
+
+    [[nodiscard]] constexpr static bool is_identifier_char(char c) noexcept
+    {
+        return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z') or (c >= '0' and c <= '9') or c == '_';
+    }
+
+    /** Check if a character may be part of a literal or number.
+     */
+    [[nodiscard]] constexpr static bool is_token_char(char c) noexcept
+    {
+        return is_identifier_char(c) or c == '-' or c == '+' or c == '.';
+    }
+
+    [[nodiscard]] JSON_value scan_literal(std::string_view literal, JSON_value value)
+    {
+        if (static_cast<size_t>(_last - _it) >= literal.size() and std::string_view{_it, literal.size()} == literal) {
+            _it += literal.size();
+            if (_it == _last or not is_identifier_char(*_it)) {
+                return value;
+            }
+        }
+        throw parse_error(std::format("{}: Unknown identifier, expecting true, false or null", location()));
+    }
+
+    [[nodiscard]] JSON_value scan_number()
+    {
+        hilet first = _it;
+        auto is_real = false;
+
+        if (*_it == '-') {
+            ++_it;
+        }
+        hilet digits_first = _it;
+        while (_it != _last and *_it >= '0' and *_it <= '9') {
+            ++_it;
+        }
+        if (_it == digits_first) {
+            throw parse_error(std::format("{}: Expecting a digit after '-', found {}", location(), found()));
+        }
+
+        if (_it != _last and *_it == '.') {
+            is_real = true;
+            ++_it;
+            while (_it != _last and *_it >= '0' and *_it <= '9') {
+                ++_it;
+            }
+        }
+
+        if (_it != _last and (*_it == 'e' or *_it == 'E')) {
+            is_real = true;
+            ++_it;
+            if (_it != _last and (*_it == '+' or *_it == '-')) {
+                ++_it;
+            }
+            hilet exponent_first = _it;
+            while (_it != _last and *_it >= '0' and *_it <= '9') {
+                ++_it;
+            }
+            if (_it == exponent_first) {
+                throw parse_error(std::format("{}: Incomplete exponent, found {}", location(), found()));
+            }
+        }
+
+        if (not is_real) {
+            auto value = 0LL;
+            hilet [ptr, ec] = std::from_chars(first, _it, value);
+            if (ec == std::errc{} and ptr == _it) {
+                return JSON_value{value};
+            }
+            // An integer that does not fit in a long long is parsed as a real.
+        }
+
+        auto value = 0.0;
+        hilet [ptr, ec] = std::from_chars(first, _it, value);
+        if (ptr != _it) {
+            throw parse_error(std::format("{}: Invalid number", location()));
+        }
+        return JSON_value{value};
+    }
+
+    /** Find the closing quote of a string.
+     *
+     * @param it An iterator inside the string, not inside an escape sequence.
+     * @return An iterator to the closing quote, or `_last` when the string
+     *         is incomplete. When the text ends in the middle of an escape
+     *         sequence, an iterator to the backslash.
+     */
+    [[nodiscard]] char const *find_string_end(char const *it) const noexcept
+    {
+        while (it != _last and *it != '"') {
+            if (*it == '\\') {
+                if (it + 1 == _last) {
+                    return it;
+                }
+                ++it;
+            }
+            ++it;
+        }
+        return it;
+    }
+
+    /** Decode a string with escape sequences.
+     *
+     * The decoded string is never longer than the text of the string.
+     *
+     * @pre `_it` points inside the string, and the closing quote is before `_last`.
+     * @post `_it` points beyond the closing quote.
+     * @param dst The buffer to write the decoded string into.
+     * @return The end of the decoded string in the buffer.
+     */
+    [[nodiscard]] char *unescape_string(char *dst)
+    {
+        while (*_it != '"') {
+            if (*_it != '\\') {
+                *dst++ = *_it++;
+                continue;
+            }
+
+            ++_it;
+            switch (*_it++) {
+            case '"':
+                *dst++ = '"';
+                break;
+            case '\\':
+                *dst++ = '\\';
+                break;
+            case '/':
+                *dst++ = '/';
+                break;
+            case 'b':
+                *dst++ = '\b';
+                break;
+            case 'f':
+                *dst++ = '\f';
+                break;
+            case 'n':
+                *dst++ = '\n';
+                break;
+            case 'r':
+                *dst++ = '\r';
+                break;
+            case 't':
+                *dst++ = '\t';
+                break;
+            case 'u':
+                dst = unescape_unicode(dst);
+                break;
+            default:
+                --_it;
+                throw parse_error(std::format("{}: Unknown escape sequence, found {}", location(), found()));
+            }
+        }
+        ++_it;
+        return dst;
+    }
+
+    [[nodiscard]] uint32_t scan_hex4()
+    {
+        if (_last - _it < 4) {
+            _it = _last;
+            throw parse_error(std::format("{}: Incomplete \\u escape sequence", location()));
+        }
+
+        auto r = uint32_t{0};
+        for (auto i = 0; i != 4; ++i) {
+            hilet c = *_it;
+            r <<= 4;
+            if (c >= '0' and c <= '9') {
+                r |= c - '0';
+            } else if (c >= 'a' and c <= 'f') {
+                r |= c - 'a' + 10;
+            } else if (c >= 'A' and c <= 'F') {
+                r |= c - 'A' + 10;
+            } else {
+                throw parse_error(std::format("{}: Expecting a hexadecimal digit in \\u escape sequence, found {}", location(), found()));
+            }
+            ++_it;
+        }
+        return r;
+    }
+
+    /** Decode the hexadecimal part of a \\u escape sequence, and write the code-point as UTF-8.
+     */
+    [[nodiscard]] char *unescape_unicode(char *dst)
+    {
+        auto code_point = char32_t{scan_hex4()};
+
+        if (code_point >= 0xd800 and code_point <= 0xdbff) {
+            // A high surrogate must be followed by an escaped low surrogate.
+            if (_last - _it < 2 or _it[0] != '\\' or _it[1] != 'u') {
+                throw parse_error(std::format("{}: Expecting a low surrogate after a high surrogate", location()));
+            }
+            _it += 2;
+
+            hilet low_surrogate = scan_hex4();
+            if (low_surrogate < 0xdc00 or low_surrogate > 0xdfff) {
+                throw parse_error(std::format("{}: Expecting a low surrogate after a high surrogate", location()));
+            }
+            code_point = 0x1'0000 + ((code_point - 0xd800) << 10) + (low_surrogate - 0xdc00);
+
+        } else if (code_point >= 0xdc00 and code_point <= 0xdfff) {
+            throw parse_error(std::format("{}: Unexpected low surrogate", location()));
+        }
+
+        if (code_point < 0x80) {
+            *dst++ = char_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            *dst++ = char_cast<char>(0xc0 | (code_point >> 6));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        } else if (code_point < 0x1'0000) {
+            *dst++ = char_cast<char>(0xe0 | (code_point >> 12));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        } else {
+            *dst++ = char_cast<char>(0xf0 | (code_point >> 18));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 12) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | ((code_point >> 6) & 0x3f));
+            *dst++ = char_cast<char>(0x80 | (code_point & 0x3f));
+        }
+        return dst;
+    }
+};
+
+/** Parses JSON text into values allocated on an arena.
+ *
+ * Strings without escape sequences point directly into the text. Arrays and
+ * objects are first collected on a stack, and copied into the arena as a
+ * single allocation when the closing bracket is found.
+ */
+class JSON_document_parser : JSON_scanner {
+public:
+    /** The maximum nesting of arrays and objects.
+     */
+    constexpr static size_t max_depth = 512;
+
+    JSON_document_parser(std::string_view text, std::string_view path, std::pmr::memory_resource& arena) noexcept :
+        JSON_scanner(text, path), _arena(arena)
+    {
+    }
+
+    /** Parse a complete JSON document.
+     *
+     * @return The root value.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] JSON_value parse()
+    {
+        skip_white_space();
+        if (_it == _last) {
+            throw parse_error(std::format("{}: Missing JSON value", location()));
+        }
+
+        auto r = parse_value(0);
+
+        skip_white_space();
+        if (_it != _last) {
+            throw parse_error(std::format("{}: Unexpected text after JSON root value", location()));
+        }
+        return r;
+    }
+
+private:
+    std::pmr::memory_resource& _arena;
+
+    /** Values of the arrays that are being parsed.
+     */
+    std::vector<JSON_value> _values;
+
+    /** Members of the objects that are being parsed.
+     */
+    std::vector<JSON_member> _members;
+
+    /** Skip white-space and line comments.
+     */
+    void skip_white_space() noexcept
+    {
+        while (_it != _last) {
+            hilet c = *_it;
+            if (c == ' ' or c == '\n' or c == '\r' or c == '\t') {
+                ++_it;
+
+            } else if (c == '/' and _it + 1 != _last and _it[1] == '/') {
+                _it = std::find(_it + 2, _last, '\n');
+
+            } else {
+                return;
+            }
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<T const> copy_to_arena(std::vector<T>& stack, size_t first)
+    {
+        hilet size = stack.size() - first;
+        if (size == 0) {
+            return {};
+        }
+
+        auto *ptr = static_cast<T *>(_arena.allocate(size * sizeof(T), alignof(T)));
+        std::uninitialized_copy(stack.begin() + first, stack.end(), ptr);
+        stack.resize(first);
+        return {ptr, size};
+    }
+
+    [[nodiscard]] JSON_value parse_value(size_t depth)
+    {
+        hi_axiom(_it != _last);
+
+        switch (*_it) {
+        case '"':
+            return JSON_value{parse_string()};
+        case '[':
+            return parse_array(depth + 1);
+        case '{':
+            return parse_object(depth + 1);
+        case 't':
+            return scan_literal("true", JSON_value{true});
+        case 'f':
+            return scan_literal("false", JSON_value{false});
+        case 'n':
+            return scan_literal("null", JSON_value{nullptr});
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            return scan_number();
+        default:
+            throw parse_error(std::format("{}: Expecting a JSON value, found {}", location(), found()));
+        }
+    }
+
+    /** Parse a string.
+     *
+     * @return A string pointing into the text, or into the arena when the
+     *         string contains escape sequences.
+     */
+    [[nodiscard]] std::string_view parse_string()
+    {
+        hi_axiom(_it != _last and *_it == '"');
+        ++_it;
+
+        hilet first = _it;
+        while (_it != _last and *_it != '"' and *_it != '\\') {
+            ++_it;
+        }
+
+        if (_it == _last) {
+            throw parse_error(std::format("{}: Incomplete string", location()));
+        } else if (*_it == '"') {
+            return {first, static_cast<size_t>(_it++ - first)};
+        }
+
+        hilet end = find_string_end(_it);
+        if (end == _last or *end != '"') {
+            _it = _last;
+            throw parse_error(std::format("{}: Incomplete string", location()));
+        }
+
+        hilet capacity = static_cast<size_t>(end - first);
+        auto *buffer = static_cast<char *>(_arena.allocate(capacity, alignof(char)));
+        auto *dst = unescape_string(std::copy(first, _it, buffer));
+
+        hi_axiom(dst <= buffer + capacity);
+        return {buffer, static_cast<size_t>(dst - buffer)};
+    }
+
+    [[nodiscard]] JSON_value parse_array(size_t depth)
+    {
+        hi_axiom(_it != _last and *_it == '[');
+        if (depth > max_depth) {
+            throw parse_error(std::format("{}: JSON arrays and objects are nested too deep", location()));
+        }
+        ++_it;
+
+        hilet first = _values.size();
+        while (true) {
+            skip_white_space();
+            if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a JSON value or ']', found {}", location(), found()));
+            } else if (*_it == ']') {
+                ++_it;
+                break;
+            }
+
+            _values.push_back(parse_value(depth));
+
+            skip_white_space();
+            if (_it != _last and *_it == ',') {
+                ++_it;
+            } else if (_it != _last and *_it == ']') {
+                ++_it;
+                break;
+            } else {
+                throw parse_error(std::format("{}: Expecting ',' or ']', found {}", location(), found()));
+            }
+        }
+
+        return JSON_value{copy_to_arena(_values, first)};
+    }
+
+    [[nodiscard]] JSON_value parse_object(size_t depth)
+    {
+        hi_axiom(_it != _last and *_it == '{');
+        if (depth > max_depth) {
+            throw parse_error(std::format("{}: JSON arrays and objects are nested too deep", location()));
+        }
+        ++_it;
+
+        hilet first = _members.size();
+        while (true) {
+            skip_white_space();
+            if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a key or '}}', found {}", location(), found()));
+            } else if (*_it == '}') {
+                ++_it;
+                break;
+            } else if (*_it != '"') {
+                throw parse_error(std::format("{}: Unexpected token {}, expected a key or close-brace", location(), found()));
+            }
+
+            hilet key = parse_string();
+
+            skip_white_space();
+            if (_it != _last and *_it == ':') {
+                ++_it;
+            } else {
+                throw parse_error(std::format("{}: Expecting ':', found {}", location(), found()));
+            }
+
+            skip_white_space();
+            if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a JSON value, found {}", location(), found()));
+            }
+            _members.emplace_back(key, parse_value(depth));
+
+            skip_white_space();
+            if (_it != _last and *_it == ',') {
+                ++_it;
+            } else if (_it != _last and *_it == '}') {
+                ++_it;
+                break;
+            } else {
+                throw parse_error(std::format("{}: Expecting ',' or '}}', found {}", location(), found()));
+            }
+        }
+
+        // Sort the members by key, when a key is repeated the last member is kept.
+        hilet members_first = _members.begin() + first;
+        hilet key_less = [](hilet& lhs, hilet& rhs) {
+            return lhs.key < rhs.key;
+        };
+        if (_members.end() - members_first <= 16) {
+            // Objects are mostly small, an insertion sort does not need to allocate.
+            for (auto it = members_first; it != _members.end(); ++it) {
+                std::rotate(std::upper_bound(members_first, it, *it, key_less), it, it + 1);
+            }
+        } else {
+            std::stable_sort(members_first, _members.end(), key_less);
+        }
+
+        auto dst = members_first;
+        for (auto it = members_first; it != _members.end(); ++it) {
+            if (it + 1 == _members.end() or it->key != (it + 1)->key) {
+                *dst++ = *it;
+            }
+        }
+        _members.erase(dst, _members.end());
+
+        return JSON_value{copy_to_arena(_members, first)};
+    }
+};
+
+} // namespace detail
+
+/** A read-only JSON document.
+ *
+ * The document is parsed directly from the text into values allocated on an
+ * arena. Strings without escape sequences are not copied, they point into the
+ * text; therefore the text must outlive the document. When the document is
+ * loaded from a file, the document keeps the file mapped.
+ *
+ * Objects are stored as an array of members sorted by key, so that members
+ * are found with a binary search.
+ */
+class JSON_document {
+public:
+    ~JSON_document() = default;
+    JSON_document(JSON_document const&) = delete;
+    JSON_document(JSON_document&&) noexcept = default;
+    JSON_document& operator=(JSON_document const&) = delete;
+    JSON_document& operator=(JSON_document&&) noexcept = default;
+
+    /** Parse a JSON document from text.
+     *
+     * @param text The JSON text, which must outlive the document.
+     * @param path The path used in error messages.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    explicit JSON_document(std::string_view text, std::string_view path = std::string_view{"<none>"}) :
+        _arena(std::make_unique<std::pmr::monotonic_buffer_resource>(initial_arena_size(text)))
+    {
+        _root = detail::JSON_document_parser{text, path, *_arena}.parse();
+    }
+
+    /** Parse a JSON document from a null-terminated string.
+     *
+     * @param text The JSON text, which must outlive the document.
+     * @param path The path used in error messages.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    explicit JSON_document(char const *text, std::string_view path = std::string_view{"<none>"}) :
+        JSON_document(std::string_view{text}, path)
+    {
+    }
+
+    /** The text of a temporary string would not outlive the document.
+     */
+    JSON_document(std::string&& text, std::string_view path = std::string_view{"<none>"}) = delete;
+
+    /** Parse a JSON document from a file.
+     *
+     * @param path The path to the JSON file.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    template<std::same_as<std::filesystem::path> Path>
+    explicit JSON_document(Path const& path) : _file(path)
+    {
+        hilet text = as_string_view(_file);
+        _arena = std::make_unique<std::pmr::monotonic_buffer_resource>(initial_arena_size(text));
+        _root = detail::JSON_document_parser{text, path.string(), *_arena}.parse();
+    }
+
+    [[nodiscard]] JSON_value const& root() const noexcept
+    {
+        return _root;
+    }
+
+    /** Convert the document to a datum.
+     */
+    [[nodiscard]] explicit operator datum() const
+    {
+        return static_cast<datum>(_root);
+    }
+
+private:
+    file_view _file;
+    std::unique_ptr<std::pmr::monotonic_buffer_resource> _arena;
+    JSON_value _root;
+
+    /** Estimate the arena size from the size of the text, so that most documents need a single allocation.
+     */
+    [[nodiscard]] static size_t initial_arena_size(std::string_view text) noexcept
+    {
+        return std::max(text.size(), 4096_uz);
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,71 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_document.hpp"
+#include "JSON.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a JSON document of about 4 MB, with an array of records.
+ */
+[[nodiscard]] std::string make_document()
+{
+    auto r = std::string{"[\n"};
+    for (auto i = 0; r.size() < 4 * 1024 * 1024; ++i) {
+        r += std::format(
+            "    {{\n"
+            "        \"id\": {},\n"
+            "        \"name\": \"item {}\",\n"
+            "        \"price\": {}.{},\n"
+            "        \"active\": {},\n"
+            "        \"parent\": null,\n"
+            "        \"tags\": [\"red\", \"green\", \"blue\"],\n"
+            "        \"size\": {{\"width\": {}, \"height\": {}}}\n"
+            "    }},\n",
+            i,
+            i,
+            i % 100,
+            i % 7,
+            i % 2 == 0 ? "true" : "false",
+            i % 640,
+            i % 480);
+    }
+    r += "]\n";
+    return r;
+}
+
+} // namespace
+
+TEST(JSON_document_benchmarks, parse)
+{
+    hilet text = make_document();
+    hilet mb = static_cast<double>(text.size()) / 1'000'000.0;
+
+    hilet expected = parse_JSON(text);
+    ASSERT_EQ(static_cast<datum>(JSON_document{text}), expected);
+
+    hilet parse_JSON_rate = benchmark_rate([&] {
+        hilet r = parse_JSON(text);
+    });
+
+    hilet document_rate = benchmark_rate([&] {
+        hilet r = JSON_document{text};
+    });
+
+    hilet document_datum_rate = benchmark_rate([&] {
+        hilet r = static_cast<datum>(JSON_document{text});
+    });
+
+    benchmark_report("parse_JSON 4 MB", parse_JSON_rate * mb, "MB/s");
+    benchmark_report("JSON_document 4 MB", document_rate * mb, "MB/s");
+    benchmark_report("JSON_document to datum 4 MB", document_datum_rate * mb, "MB/s");
+}
@@ -0,0 +1,126 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_document.hpp"
+#include "JSON.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace hi;
+
+TEST(JSON_document, parse_values)
+{
+    hilet doc = JSON_document{R"({"a": 42, "b": -1.5e2, "c": "foo", "d": true, "e": false, "f": null, "g": [1, 2, 3]})"};
+    hilet& root = doc.root();
+
+    ASSERT_TRUE(root.is_object());
+    ASSERT_EQ(root.size(), 7);
+    ASSERT_EQ(root.find("a")->as_integer(), 42);
+    ASSERT_EQ(root.find("b")->as_real(), -150.0);
+    ASSERT_EQ(root.find("c")->as_string(), "foo");
+    ASSERT_TRUE(root.find("d")->as_bool());
+    ASSERT_FALSE(root.find("e")->as_bool());
+    ASSERT_TRUE(root.find("f")->is_null());
+    ASSERT_EQ(root.find("g")->size(), 3);
+    ASSERT_EQ((*root.find("g"))[2].as_integer(), 3);
+    ASSERT_EQ(root.find("h"), nullptr);
+}
+
+TEST(JSON_document, zero_copy_string)
+{
+    hilet text = std::string{R"(["foo", "b\"ar"])"};
+    hilet doc = JSON_document{text};
+    hilet& root = doc.root();
+
+    // A string without escape sequences points into the text.
+    hilet foo = root[0].as_string();
+    ASSERT_EQ(foo, "foo");
+    ASSERT_GE(foo.data(), text.data());
+    ASSERT_LT(foo.data(), text.data() + text.size());
+
+    // A string with escape sequences is unescaped into the arena.
+    ASSERT_EQ(root[1].as_string(), "b\"ar");
+}
+
+TEST(JSON_document, escapes)
+{
+    hilet doc = JSON_document{R"(["\\\/\b\f\n\r\t", "\u0041\u00e9\u20AC\ud83d\ude00"])"};
+    ASSERT_EQ(doc.root()[0].as_string(), "\\/\b\f\n\r\t");
+    ASSERT_EQ(doc.root()[1].as_string(), "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+
+    ASSERT_THROW(JSON_document{R"(["\x"])"}, parse_error);
+    ASSERT_THROW(JSON_document{R"(["\u12"])"}, parse_error);
+    ASSERT_THROW(JSON_document{R"(["\ud83d"])"}, parse_error);
+    ASSERT_THROW(JSON_document{R"(["\ude00"])"}, parse_error);
+    ASSERT_THROW(JSON_document{R"(["foo)"}, parse_error);
+    ASSERT_THROW(JSON_document{R"(["foo\)"}, parse_error);
+}
+
+TEST(JSON_document, sorted_members)
+{
+    hilet doc = JSON_document{R"({"b": 1, "c": 2, "a": 3, "b": 4})"};
+    hilet members = doc.root().as_object();
+
+    // Members are sorted, the last of a repeated key is kept.
+    ASSERT_EQ(members.size(), 3);
+    ASSERT_EQ(members[0].key, "a");
+    ASSERT_EQ(members[1].key, "b");
+    ASSERT_EQ(members[1].value.as_integer(), 4);
+    ASSERT_EQ(members[2].key, "c");
+}
+
+TEST(JSON_document, comments_and_trailing_commas)
+{
+    hilet doc = JSON_document{"// A configuration file.\n{\n    \"foo\": [42, 43,], // The foo.\n    \"bar\": {\"baz\": 1,},\n}\n"};
+
+    auto expected = datum::make_map();
+    expected["foo"] = datum::make_vector(42, 43);
+    expected["bar"] = datum::make_map();
+    expected["bar"]["baz"] = 1;
+    ASSERT_EQ(static_cast<datum>(doc), expected);
+}
+
+TEST(JSON_document, numbers)
+{
+    hilet doc = JSON_document{"[0, -0, 9223372036854775807, 9223372036854775808, 1.0, 1e3, 2E-1]"};
+    hilet& root = doc.root();
+
+    ASSERT_EQ(root[0].as_integer(), 0);
+    ASSERT_EQ(root[1].as_integer(), 0);
+    ASSERT_EQ(root[2].as_integer(), 9223372036854775807LL);
+    // An integer that does not fit in a long long becomes a real.
+    ASSERT_TRUE(root[3].is_real());
+    ASSERT_EQ(root[4].as_real(), 1.0);
+    ASSERT_EQ(root[5].as_real(), 1000.0);
+    ASSERT_EQ(root[6].as_real(), 0.2);
+
+    ASSERT_THROW(JSON_document{"[-]"}, parse_error);
+    ASSERT_THROW(JSON_document{"[1e]"}, parse_error);
+}
+
+TEST(JSON_document, errors)
+{
+    ASSERT_THROW(JSON_document{""}, parse_error);
+    ASSERT_THROW(JSON_document{"{} {}"}, parse_error);
+    ASSERT_THROW(JSON_document{"[1 2]"}, parse_error);
+    ASSERT_THROW(JSON_document{"[1,"}, parse_error);
+    ASSERT_THROW(JSON_document{"{\"foo\" 1}"}, parse_error);
+    ASSERT_THROW(JSON_document{"{foo: 1}"}, parse_error);
+    ASSERT_THROW(JSON_document{"[truex]"}, parse_error);
+
+    hilet deeply_nested = std::string(1000, '[');
+    ASSERT_THROW(JSON_document{deeply_nested}, parse_error);
+}
+
+TEST(JSON_document, to_datum)
+{
+    hilet text = std::string_view{
+        R"({"foo": {"bar": 42, "baz": [1.5, "qux", true, null, {}, []]}, "quux": -7, "corge": false})"};
+
+    ASSERT_EQ(static_cast<datum>(JSON_document{text}), parse_JSON(text));
+}
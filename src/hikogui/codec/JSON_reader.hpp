@@ -0,0 +1,766 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/JSON_reader.hpp A streaming JSON reader.
+ */
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../coroutine/coroutine.hpp"
+#include "JSON_document.hpp"
+#include "jsonpath.hpp"
+#include "datum.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <functional>
+#include <algorithm>
+#include <iterator>
+#include <variant>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.JSON_reader);
+
+hi_export namespace hi::inline v1 {
+
+/** An event returned by the JSON_reader.
+ */
+enum class JSON_event : uint8_t {
+    /** There are no more values in the text.
+     */
+    end_of_document,
+
+    begin_object,
+    end_object,
+    begin_array,
+    end_array,
+
+    /** The key of a member of an object, the value follows as the next event.
+     */
+    key,
+
+    string,
+    integer,
+    real,
+    boolean,
+    null
+};
+
+/** A pull-parser for JSON text.
+ *
+ * The reader returns the values in the text as a sequence of events. The text
+ * is read in blocks into a buffer of fixed size, which only grows when a single
+ * token does not fit. The memory used does not depend on the size of the
+ * document, only on the size of the largest token and on the nesting depth.
+ *
+ * The text may contain multiple root values, for example a JSON-lines log
+ * file with a JSON object on each line.
+ *
+ * Like parse_JSON(), line comments and trailing commas are allowed.
+ */
+class JSON_reader : detail::JSON_scanner {
+public:
+    /** The maximum nesting of arrays and objects.
+     */
+    constexpr static size_t max_depth = 512;
+
+    constexpr static size_t default_buffer_size = 65536;
+
+    /** A function which reads text into a buffer.
+     *
+     * The function returns the number of characters read, zero when the end of
+     * the text has been reached.
+     */
+    using read_function_type = std::function<size_t(std::span<char>)>;
+
+    ~JSON_reader() = default;
+    JSON_reader(JSON_reader const&) = delete;
+    JSON_reader(JSON_reader&&) = delete;
+    JSON_reader& operator=(JSON_reader const&) = delete;
+    JSON_reader& operator=(JSON_reader&&) = delete;
+
+    /** Read JSON text from memory.
+     *
+     * The text is not copied, and must outlive the reader.
+     *
+     * @param text The JSON text.
+     * @param path The path used in error messages.
+     */
+    explicit JSON_reader(std::string_view text, std::string_view path = std::string_view{"<none>"}) :
+        JSON_scanner(text, {}), _path_name(path), _eof(true)
+    {
+        _path = _path_name;
+    }
+
+    /** Read JSON text from a null-terminated string.
+     *
+     * The text is not copied, and must outlive the reader.
+     *
+     * @param text The JSON text.
+     * @param path The path used in error messages.
+     */
+    explicit JSON_reader(char const *text, std::string_view path = std::string_view{"<none>"}) :
+        JSON_reader(std::string_view{text}, path)
+    {
+    }
+
+    /** The text of a temporary string would not outlive the reader.
+     */
+    JSON_reader(std::string&& text, std::string_view path = std::string_view{"<none>"}) = delete;
+
+    /** Read JSON text in blocks.
+     *
+     * @param read_function The function that reads the next block of text.
+     * @param path The path used in error messages.
+     * @param buffer_size The initial size of the buffer.
+     */
+    explicit JSON_reader(
+        read_function_type read_function,
+        std::string_view path = std::string_view{"<none>"},
+        size_t buffer_size = default_buffer_size) :
+        JSON_scanner({}, {}), _path_name(path), _read_function(std::move(read_function)), _buffer(buffer_size)
+    {
+        hi_axiom(buffer_size > 0);
+        hi_axiom(_read_function);
+        _path = _path_name;
+        _first = _it = _last = _buffer.data();
+    }
+
+    /** Read JSON text from a file, in blocks.
+     *
+     * @param file The file to read from, which must outlive the reader.
+     * @param path The path used in error messages.
+     * @param buffer_size The initial size of the buffer.
+     */
+    explicit JSON_reader(file& file, std::string_view path = std::string_view{"<none>"}, size_t buffer_size = default_buffer_size) :
+        JSON_reader(
+            [&file](std::span<char> buffer) {
+                return file.read(buffer.data(), buffer.size());
+            },
+            path,
+            buffer_size)
+    {
+    }
+
+    /** Read the next event.
+     *
+     * @return The event.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    JSON_event next()
+    {
+        skip_white_space();
+
+        if (_state == state_type::next_element or _state == state_type::next_member) {
+            if (_it != _last and *_it == ',') {
+                ++_it;
+                ++_levels.back().index;
+                _state = _state == state_type::next_element ? state_type::element : state_type::member;
+                skip_white_space();
+
+            } else if (_state == state_type::next_element and (_it == _last or *_it != ']')) {
+                throw parse_error(std::format("{}: Expecting ',' or ']', found {}", location(), found()));
+
+            } else if (_state == state_type::next_member and (_it == _last or *_it != '}')) {
+                throw parse_error(std::format("{}: Expecting ',' or '}}', found {}", location(), found()));
+            }
+        }
+
+        switch (_state) {
+        case state_type::root:
+            if (_it == _last) {
+                return _event = JSON_event::end_of_document;
+            }
+            return parse_value();
+
+        case state_type::element:
+        case state_type::next_element:
+            if (_it != _last and *_it == ']') {
+                ++_it;
+                return end_container(JSON_event::end_array);
+
+            } else if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a JSON value or ']', found {}", location(), found()));
+            }
+            return parse_value();
+
+        case state_type::member:
+        case state_type::next_member:
+            if (_it != _last and *_it == '}') {
+                ++_it;
+                return end_container(JSON_event::end_object);
+
+            } else if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a key or '}}', found {}", location(), found()));
+
+            } else if (*_it != '"') {
+                throw parse_error(std::format("{}: Unexpected token {}, expected a key or close-brace", location(), found()));
+            }
+
+            parse_string();
+            _levels.back().key = _string;
+            _state = state_type::member_value;
+            return _event = JSON_event::key;
+
+        case state_type::member_value:
+            if (_it != _last and *_it == ':') {
+                ++_it;
+            } else {
+                throw parse_error(std::format("{}: Expecting ':', found {}", location(), found()));
+            }
+
+            skip_white_space();
+            if (_it == _last) {
+                throw parse_error(std::format("{}: Expecting a JSON value, found {}", location(), found()));
+            }
+            return parse_value();
+        }
+        hi_no_default();
+    }
+
+    /** The current event.
+     */
+    [[nodiscard]] JSON_event event() const noexcept
+    {
+        return _event;
+    }
+
+    /** The number of arrays and objects that enclose the current position.
+     */
+    [[nodiscard]] size_t depth() const noexcept
+    {
+        return _levels.size();
+    }
+
+    /** The text of a key or string.
+     *
+     * @pre The current event is a key or string.
+     * @return The unescaped text, which is valid until the next call to the reader.
+     */
+    [[nodiscard]] std::string_view string() const noexcept
+    {
+        hi_axiom(_event == JSON_event::key or _event == JSON_event::string);
+        return _string;
+    }
+
+    /** The value of an integer.
+     *
+     * @pre The current event is an integer.
+     */
+    [[nodiscard]] long long integer() const noexcept
+    {
+        hi_axiom(_event == JSON_event::integer);
+        return _value.as_integer();
+    }
+
+    /** The value of a number.
+     *
+     * @pre The current event is a real or an integer.
+     */
+    [[nodiscard]] double real() const noexcept
+    {
+        hi_axiom(_event == JSON_event::real or _event == JSON_event::integer);
+        return _value.as_real();
+    }
+
+    /** The value of a boolean.
+     *
+     * @pre The current event is a boolean.
+     */
+    [[nodiscard]] bool boolean() const noexcept
+    {
+        hi_axiom(_event == JSON_event::boolean);
+        return _value.as_bool();
+    }
+
+    /** Skip the rest of the current array or object.
+     *
+     * When the current event is the start of an array or object, the reader
+     * skips to the matching end event. The skipped text is only checked for
+     * balanced brackets, the values inside are not decoded or validated.
+     * For other events this function does nothing.
+     *
+     * @throws parse_error When the text is not valid JSON.
+     */
+    void skip()
+    {
+        if (_event != JSON_event::begin_array and _event != JSON_event::begin_object) {
+            return;
+        }
+
+        auto nesting = 1_uz;
+        while (true) {
+            skip_white_space();
+            if (_it == _last) {
+                throw parse_error(std::format("{}: Incomplete array or object", location()));
+            }
+
+            hilet c = *_it;
+            if (c == '"') {
+                _it = load_string() + 1;
+
+            } else if (c == '[' or c == '{') {
+                ++nesting;
+                ++_it;
+
+            } else if (c == ']' or c == '}') {
+                ++_it;
+                if (--nesting == 0) {
+                    end_container(c == ']' ? JSON_event::end_array : JSON_event::end_object);
+                    return;
+                }
+
+            } else {
+                ++_it;
+            }
+        }
+    }
+
+    /** Read the current value as a datum.
+     *
+     * When the current event is the start of an array or object, the reader
+     * reads up to and including the matching end event.
+     *
+     * @pre The current event is the start of a value.
+     * @return The value.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] datum read_datum()
+    {
+        switch (_event) {
+        case JSON_event::null:
+            return datum{nullptr};
+        case JSON_event::boolean:
+            return datum{boolean()};
+        case JSON_event::integer:
+            return datum{integer()};
+        case JSON_event::real:
+            return datum{real()};
+        case JSON_event::string:
+            return datum{string()};
+
+        case JSON_event::begin_array:
+            {
+                auto r = datum::vector_type{};
+                while (next() != JSON_event::end_array) {
+                    r.push_back(read_datum());
+                }
+                return datum{std::move(r)};
+            }
+
+        case JSON_event::begin_object:
+            {
+                auto r = datum::map_type{};
+                while (next() != JSON_event::end_object) {
+                    hi_axiom(_event == JSON_event::key);
+                    auto key = datum{string()};
+                    next();
+                    r.insert_or_assign(std::move(key), read_datum());
+                }
+                return datum{std::move(r)};
+            }
+
+        default:
+            hi_no_default();
+        }
+    }
+
+    /** Read up to the next value that matches a path.
+     *
+     * Arrays and objects that can not contain a matching value are skipped,
+     * see skip(). When a matching value is an array or object the caller may
+     * read it, for example with read_datum(); otherwise the search continues
+     * inside the value.
+     *
+     * The path is matched against the keys and indices of the enclosing
+     * arrays and objects while streaming. Therefore negative indices and
+     * slices with negative bounds or steps, which depend on the size of an
+     * array, never match.
+     *
+     * @param path The path to match.
+     * @return true when the current event is the start of a matching value,
+     *         false at the end of the document.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] bool next_match(jsonpath const& path)
+    {
+        while (true) {
+            switch (next()) {
+            case JSON_event::end_of_document:
+                return false;
+
+            case JSON_event::key:
+            case JSON_event::end_array:
+            case JSON_event::end_object:
+                break;
+
+            case JSON_event::begin_array:
+            case JSON_event::begin_object:
+                if (match(path.begin(), path.end(), 0, _levels.size() - 1, false)) {
+                    return true;
+                } else if (not match(path.begin(), path.end(), 0, _levels.size() - 1, true)) {
+                    skip();
+                }
+                break;
+
+            default:
+                if (match(path.begin(), path.end(), 0, _levels.size(), false)) {
+                    return true;
+                }
+            }
+        }
+    }
+
+    /** Find all values that match a path.
+     *
+     * @param path The path to match.
+     * @return A generator yielding each matching value.
+     * @throws parse_error When the text is not valid JSON.
+     */
+    [[nodiscard]] generator<datum> find(jsonpath path)
+    {
+        while (next_match(path)) {
+            co_yield read_datum();
+        }
+    }
+
+private:
+    enum class state_type : uint8_t {
+        /** Expecting a root value or the end of the text.
+         */
+        root,
+
+        /** Expecting a value or ']'.
+         */
+        element,
+
+        /** Expecting ',' or ']'.
+         */
+        next_element,
+
+        /** Expecting a key or '}'.
+         */
+        member,
+
+        /** Expecting ':' followed by a value.
+         */
+        member_value,
+
+        /** Expecting ',' or '}'.
+         */
+        next_member
+    };
+
+    /** An array or object that encloses the current position.
+     */
+    struct level_type {
+        bool is_object;
+
+        /** The index of the current element or member.
+         */
+        size_t index;
+
+        /** The key of the current member.
+         */
+        std::string key;
+    };
+
+    std::string _path_name;
+    read_function_type _read_function;
+    std::vector<char> _buffer;
+    bool _eof = false;
+
+    std::vector<level_type> _levels;
+    state_type _state = state_type::root;
+    JSON_event _event = JSON_event::end_of_document;
+
+    /** The value of a number or literal.
+     */
+    JSON_value _value;
+
+    /** The text of a key or string.
+     */
+    std::string_view _string;
+
+    /** The buffer for strings that contain escape sequences.
+     */
+    std::string _string_buffer;
+
+    /** Read more text into the buffer.
+     *
+     * The text from `_it` is moved to the start of the buffer, the text before
+     * `_it` is discarded. The buffer grows when it is completely filled
+     * with a single token.
+     *
+     * @return false when there is no more text.
+     */
+    [[nodiscard]] bool fill()
+    {
+        if (_eof) {
+            return false;
+        }
+
+        // Keep track of the position of the discarded text, for error messages.
+        hilet num_lines = narrow_cast<size_t>(std::count(_first, _it, '\n'));
+        if (num_lines != 0) {
+            hilet line_start = std::find(std::make_reverse_iterator(_it), std::make_reverse_iterator(_first), '\n').base();
+            _line_nr += num_lines;
+            _column_nr = narrow_cast<size_t>(std::distance(line_start, _it));
+        } else {
+            _column_nr += narrow_cast<size_t>(std::distance(_first, _it));
+        }
+
+        hilet offset = narrow_cast<size_t>(std::distance(_first, _it));
+        hilet keep = narrow_cast<size_t>(std::distance(_it, _last));
+        if (keep == _buffer.size()) {
+            _buffer.resize(_buffer.size() * 2);
+        }
+        std::memmove(_buffer.data(), _buffer.data() + offset, keep);
+
+        hilet size = _read_function(std::span{_buffer.data() + keep, _buffer.size() - keep});
+        hi_axiom(size <= _buffer.size() - keep);
+
+        _first = _it = _buffer.data();
+        _last = _first + keep + size;
+        _eof = size == 0;
+        return not _eof;
+    }
+
+    /** Skip white-space and line comments.
+     */
+    void skip_white_space()
+    {
+        while (_it != _last or fill()) {
+            hilet c = *_it;
+            if (c == ' ' or c == '\n' or c == '\r' or c == '\t') {
+                ++_it;
+
+            } else if (c == '/' and (_it + 1 != _last or fill()) and _it + 1 != _last and _it[1] == '/') {
+                _it = std::find(_it + 2, _last, '\n');
+                while (_it == _last and fill()) {
+                    _it = std::find(_it, _last, '\n');
+                }
+
+            } else {
+                return;
+            }
+        }
+    }
+
+    /** Make sure that the complete number or literal at `_it` is in the buffer.
+     */
+    void load_token()
+    {
+        auto offset = 0_uz;
+        while (true) {
+            hilet end = std::find_if_not(_it + offset, _last, is_token_char);
+            if (end != _last) {
+                return;
+            }
+
+            offset = std::distance(_it, end);
+            if (not fill()) {
+                return;
+            }
+        }
+    }
+
+    /** Make sure that the complete string at `_it` is in the buffer.
+     *
+     * @pre `_it` points to the opening quote.
+     * @return An iterator to the closing quote.
+     */
+    [[nodiscard]] char const *load_string()
+    {
+        hi_axiom(_it != _last and *_it == '"');
+
+        auto offset = 1_uz;
+        while (true) {
+            hilet end = find_string_end(_it + offset);
+            if (end != _last and *end == '"') {
+                return end;
+            }
+
+            offset = std::distance(_it, end);
+            if (not fill()) {
+                _it = _last;
+                throw parse_error(std::format("{}: Incomplete string", location()));
+            }
+        }
+    }
+
+    /** Parse a key or string into `_string`.
+     */
+    void parse_string()
+    {
+        hilet end = load_string();
+        ++_it;
+
+        if (std::find(_it, end, '\\') == end) {
+            _string = std::string_view{_it, end};
+            _it = end + 1;
+
+        } else {
+            // The unescaped string is never longer than the escaped string.
+            _string_buffer.resize(std::distance(_it, end));
+            hilet dst = unescape_string(_string_buffer.data());
+            _string_buffer.resize(std::distance(_string_buffer.data(), dst));
+            _string = _string_buffer;
+        }
+    }
+
+    /** Parse the start of a value.
+     */
+    JSON_event parse_value()
+    {
+        hi_axiom(_it != _last);
+
+        switch (*_it) {
+        case '"':
+            parse_string();
+            value_done();
+            return _event = JSON_event::string;
+
+        case '[':
+            ++_it;
+            return begin_container(false);
+
+        case '{':
+            ++_it;
+            return begin_container(true);
+
+        case 't':
+        case 'f':
+        case 'n':
+            load_token();
+            _value = *_it == 't' ? scan_literal("true", JSON_value{true}) :
+                *_it == 'f'      ? scan_literal("false", JSON_value{false}) :
+                                   scan_literal("null", JSON_value{nullptr});
+            value_done();
+            return _event = _value.is_null() ? JSON_event::null : JSON_event::boolean;
+
+        case '-':
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+            load_token();
+            _value = scan_number();
+            value_done();
+            return _event = _value.is_integer() ? JSON_event::integer : JSON_event::real;
+
+        default:
+            throw parse_error(std::format("{}: Expecting a JSON value, found {}", location(), found()));
+        }
+    }
+
+    JSON_event begin_container(bool is_object)
+    {
+        if (_levels.size() >= max_depth) {
+            throw parse_error(std::format("{}: JSON arrays and objects are nested too deep", location()));
+        }
+
+        _levels.emplace_back(is_object, 0_uz, std::string{});
+        _state = is_object ? state_type::member : state_type::element;
+        return _event = is_object ? JSON_event::begin_object : JSON_event::begin_array;
+    }
+
+    JSON_event end_container(JSON_event event) noexcept
+    {
+        hi_axiom(not _levels.empty());
+        _levels.pop_back();
+        value_done();
+        return _event = event;
+    }
+
+    /** Update the state after a complete value was read.
+     */
+    void value_done() noexcept
+    {
+        if (_levels.empty()) {
+            _state = state_type::root;
+        } else {
+            _state = _levels.back().is_object ? state_type::next_member : state_type::next_element;
+        }
+    }
+
+    /** Match the path of the current value.
+     *
+     * The path of the current value consists of the keys and indices of the
+     * enclosing levels, up to @a depth.
+     *
+     * @param it The current node of the jsonpath.
+     * @param it_end One beyond the last node of the jsonpath.
+     * @param i The level that @a it is matched against.
+     * @param depth The number of levels in the path of the current value.
+     * @param prefix When true, check if a descendant of the current value could match.
+     */
+    [[nodiscard]] bool
+    match(jsonpath::const_iterator it, jsonpath::const_iterator it_end, size_t i, size_t depth, bool prefix) const noexcept
+    {
+        if (it == it_end) {
+            return not prefix and i == depth;
+
+        } else if (std::holds_alternative<jsonpath::root>(*it) or std::holds_alternative<jsonpath::current>(*it)) {
+            return match(it + 1, it_end, i, depth, prefix);
+
+        } else if (std::holds_alternative<jsonpath::descend>(*it)) {
+            if (prefix) {
+                return true;
+            }
+            for (auto j = i; j <= depth; ++j) {
+                if (match(it + 1, it_end, j, depth, prefix)) {
+                    return true;
+                }
+            }
+            return false;
+
+        } else if (i == depth) {
+            // The next node selects a child of the current value.
+            return prefix;
+        }
+
+        hilet& level = _levels[i];
+        if (std::holds_alternative<jsonpath::wildcard>(*it)) {
+            return match(it + 1, it_end, i + 1, depth, prefix);
+
+        } else if (auto names = std::get_if<jsonpath::names>(&*it)) {
+            return level.is_object and std::find(names->begin(), names->end(), level.key) != names->end() and
+                match(it + 1, it_end, i + 1, depth, prefix);
+
+        } else if (auto indices = std::get_if<jsonpath::indices>(&*it)) {
+            hilet index = narrow_cast<ptrdiff_t>(level.index);
+            return not level.is_object and std::find(indices->begin(), indices->end(), index) != indices->end() and
+                match(it + 1, it_end, i + 1, depth, prefix);
+
+        } else if (auto slice = std::get_if<jsonpath::slice>(&*it)) {
+            hilet index = narrow_cast<ptrdiff_t>(level.index);
+            if (level.is_object or slice->first < 0 or slice->step <= 0 or index < slice->first) {
+                return false;
+            } else if (not slice->last_is_empty() and (slice->last < 0 or index >= slice->last)) {
+                return false;
+            } else if ((index - slice->first) % slice->step != 0) {
+                return false;
+            }
+            return match(it + 1, it_end, i + 1, depth, prefix);
+
+        } else {
+            hi_no_default();
+        }
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,106 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_reader.hpp"
+#include "JSON_writer.hpp"
+#include "JSON_document.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <format>
+#include <string>
+#include <string_view>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a JSON-lines log of about 4 MB.
+ */
+[[nodiscard]] std::string make_log()
+{
+    auto r = std::string{};
+    for (auto i = 0; r.size() < 4 * 1024 * 1024; ++i) {
+        r += std::format(
+            "{{\"id\": {}, \"level\": \"{}\", \"message\": \"request {} took {} ms\", \"tags\": [\"web\", \"api\"], "
+            "\"client\": {{\"address\": \"10.0.{}.{}\", \"port\": {}}}}}\n",
+            i,
+            i % 10 == 0 ? "error" : "info",
+            i,
+            i % 250,
+            i % 256,
+            i % 199,
+            1024 + i % 4096);
+    }
+    return r;
+}
+
+/** Read text in blocks of 64 KiB, like reading from a file.
+ */
+[[nodiscard]] JSON_reader::read_function_type make_block_reader(std::string_view text)
+{
+    return [text](std::span<char> buffer) mutable {
+        hilet size = std::min(text.size(), buffer.size());
+        std::copy_n(text.data(), size, buffer.data());
+        text.remove_prefix(size);
+        return size;
+    };
+}
+
+} // namespace
+
+TEST(JSON_reader_benchmarks, read)
+{
+    hilet text = make_log();
+    hilet mb = static_cast<double>(text.size()) / 1'000'000.0;
+
+    auto num_events = 0_uz;
+    hilet events_rate = benchmark_rate([&] {
+        auto reader = JSON_reader{make_block_reader(text)};
+        num_events = 0;
+        while (reader.next() != JSON_event::end_of_document) {
+            ++num_events;
+        }
+    });
+    ASSERT_GT(num_events, 0);
+
+    auto num_matches = 0_uz;
+    hilet path = jsonpath{"$.client.port"};
+    hilet match_rate = benchmark_rate([&] {
+        auto reader = JSON_reader{make_block_reader(text)};
+        num_matches = 0;
+        while (reader.next_match(path)) {
+            ++num_matches;
+        }
+    });
+    ASSERT_GT(num_matches, 0);
+
+    benchmark_report("JSON_reader events 4 MB", events_rate * mb, "MB/s");
+    benchmark_report("JSON_reader next_match 4 MB", match_rate * mb, "MB/s");
+}
+
+TEST(JSON_reader_benchmarks, copy)
+{
+    hilet text = make_log();
+    hilet mb = static_cast<double>(text.size()) / 1'000'000.0;
+
+    // Read each record and write it back, with a buffer of a fixed size.
+    auto size = 0_uz;
+    hilet copy_rate = benchmark_rate([&] {
+        auto reader = JSON_reader{make_block_reader(text)};
+        auto writer = JSON_writer{[&size](std::string_view block) {
+            size += block.size();
+        }};
+
+        size = 0;
+        while (reader.next() != JSON_event::end_of_document) {
+            writer.value(reader.read_datum());
+        }
+    });
+    ASSERT_GT(size, 0);
+
+    benchmark_report("JSON_reader to JSON_writer 4 MB", copy_rate * mb, "MB/s");
+}
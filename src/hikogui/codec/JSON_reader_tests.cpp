@@ -0,0 +1,249 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_reader.hpp"
+#include "JSON_document.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a reader that reads the text in chunks of a few characters.
+ */
+[[nodiscard]] JSON_reader::read_function_type make_chunked_reader(std::string_view text, size_t chunk_size)
+{
+    return [text, chunk_size](std::span<char> buffer) mutable {
+        hilet size = std::min({text.size(), chunk_size, buffer.size()});
+        std::copy_n(text.data(), size, buffer.data());
+        text.remove_prefix(size);
+        return size;
+    };
+}
+
+/** Read all events and their values as text.
+ */
+[[nodiscard]] std::vector<std::string> read_all(JSON_reader& reader)
+{
+    auto r = std::vector<std::string>{};
+    while (true) {
+        switch (reader.next()) {
+        case JSON_event::end_of_document:
+            return r;
+        case JSON_event::begin_object:
+            r.push_back("{");
+            break;
+        case JSON_event::end_object:
+            r.push_back("}");
+            break;
+        case JSON_event::begin_array:
+            r.push_back("[");
+            break;
+        case JSON_event::end_array:
+            r.push_back("]");
+            break;
+        case JSON_event::key:
+            r.push_back(std::format("key:{}", reader.string()));
+            break;
+        case JSON_event::string:
+            r.push_back(std::format("string:{}", reader.string()));
+            break;
+        case JSON_event::integer:
+            r.push_back(std::format("integer:{}", reader.integer()));
+            break;
+        case JSON_event::real:
+            r.push_back(std::format("real:{}", reader.real()));
+            break;
+        case JSON_event::boolean:
+            r.push_back(std::format("boolean:{}", reader.boolean()));
+            break;
+        case JSON_event::null:
+            r.push_back("null");
+            break;
+        }
+    }
+}
+
+} // namespace
+
+TEST(JSON_reader, events)
+{
+    auto reader = JSON_reader{R"({"a": [1, 2.5, "x"], "b": {"c": null, "d": true}, "e": []})"};
+
+    hilet expected = std::vector<std::string>{
+        "{",
+        "key:a",
+        "[",
+        "integer:1",
+        "real:2.5",
+        "string:x",
+        "]",
+        "key:b",
+        "{",
+        "key:c",
+        "null",
+        "key:d",
+        "boolean:true",
+        "}",
+        "key:e",
+        "[",
+        "]",
+        "}"};
+    ASSERT_EQ(read_all(reader), expected);
+    ASSERT_EQ(reader.event(), JSON_event::end_of_document);
+    ASSERT_EQ(reader.depth(), 0);
+}
+
+TEST(JSON_reader, zero_copy_string)
+{
+    hilet text = std::string{R"(["foo", "b\"ar"])"};
+    auto reader = JSON_reader{text};
+
+    ASSERT_EQ(reader.next(), JSON_event::begin_array);
+    ASSERT_EQ(reader.next(), JSON_event::string);
+
+    // A string without escape sequences points into the text.
+    hilet foo = reader.string();
+    ASSERT_EQ(foo, "foo");
+    ASSERT_GE(foo.data(), text.data());
+    ASSERT_LT(foo.data(), text.data() + text.size());
+
+    ASSERT_EQ(reader.next(), JSON_event::string);
+    ASSERT_EQ(reader.string(), "b\"ar");
+}
+
+TEST(JSON_reader, chunked)
+{
+    hilet text = std::string{
+        "// A comment\n"
+        "{\"numbers\": [0, -12, 3.25, 1e3, 12345678901234567890123],\n"
+        " \"strings\": [\"\", \"a long string which does not fit in the buffer\", \"\\u0041\\u00e9\\ud83d\\ude00\"],\n"
+        " \"literals\": [true, false, null,], // trailing comma\n"
+        " \"nested\": {\"a\": {\"b\": [[], {}]}}}\n"};
+
+    auto whole_reader = JSON_reader{text};
+    hilet expected = read_all(whole_reader);
+
+    // Read the text one character at a time, into a buffer that needs to grow.
+    for (auto chunk_size : {1_uz, 3_uz, 7_uz, 4096_uz}) {
+        auto chunked_reader = JSON_reader{make_chunked_reader(text, chunk_size), "<chunked>", 4};
+        ASSERT_EQ(read_all(chunked_reader), expected);
+    }
+}
+
+TEST(JSON_reader, json_lines)
+{
+    auto reader = JSON_reader{"{\"a\": 1}\n{\"a\": 2}\n\n[3]\n"};
+
+    hilet expected = std::vector<std::string>{"{", "key:a", "integer:1", "}", "{", "key:a", "integer:2", "}", "[", "integer:3", "]"};
+    ASSERT_EQ(read_all(reader), expected);
+}
+
+TEST(JSON_reader, errors)
+{
+    auto read_text = [](std::string_view text) {
+        auto reader = JSON_reader{make_chunked_reader(text, 2), "<test>", 4};
+        return read_all(reader);
+    };
+
+    ASSERT_THROW(read_text("[1 2]"), parse_error);
+    ASSERT_THROW(read_text("[1, 2"), parse_error);
+    ASSERT_THROW(read_text("[1, 2}"), parse_error);
+    ASSERT_THROW(read_text("{\"a\" 1}"), parse_error);
+    ASSERT_THROW(read_text("{1: 1}"), parse_error);
+    ASSERT_THROW(read_text("[\"foo]"), parse_error);
+    ASSERT_THROW(read_text("[tru]"), parse_error);
+    ASSERT_THROW(read_text("[-]"), parse_error);
+    ASSERT_THROW(read_text("]"), parse_error);
+    ASSERT_THROW(read_text(std::string(JSON_reader::max_depth + 1, '[')), parse_error);
+
+    // The location is counted over the text that was already discarded from the buffer.
+    try {
+        std::ignore = read_text("[\n  1,\n  2,\n  x]");
+        FAIL();
+    } catch (parse_error const& e) {
+        ASSERT_TRUE(std::string_view{e.what()}.starts_with("<test>:4:3:")) << e.what();
+    }
+}
+
+TEST(JSON_reader, skip)
+{
+    auto reader = JSON_reader{R"([{"a": [1, "]}", {"b": 2}]}, 3])"};
+
+    ASSERT_EQ(reader.next(), JSON_event::begin_array);
+    ASSERT_EQ(reader.next(), JSON_event::begin_object);
+    reader.skip();
+    ASSERT_EQ(reader.event(), JSON_event::end_object);
+    ASSERT_EQ(reader.depth(), 1);
+    ASSERT_EQ(reader.next(), JSON_event::integer);
+    ASSERT_EQ(reader.integer(), 3);
+    ASSERT_EQ(reader.next(), JSON_event::end_array);
+    ASSERT_EQ(reader.next(), JSON_event::end_of_document);
+}
+
+TEST(JSON_reader, read_datum)
+{
+    hilet text = std::string{R"({"a": [1, 2.5, "x", null, true], "b": {"c": {}, "d": []}, "a": "last"})"};
+
+    auto reader = JSON_reader{text};
+    reader.next();
+    ASSERT_EQ(reader.read_datum(), static_cast<datum>(JSON_document{text}));
+    ASSERT_EQ(reader.next(), JSON_event::end_of_document);
+}
+
+TEST(JSON_reader, find)
+{
+    hilet text = std::string{R"({
+        "store": {
+            "book": [
+                {"author": "Nigel Rees", "price": 8.95},
+                {"author": "Evelyn Waugh", "price": 12.99},
+                {"author": "Herman Melville", "price": 8.99},
+                {"author": "J. R. R. Tolkien", "price": 22.99}
+            ],
+            "bicycle": {"color": "red", "price": 19.95}
+        }
+    })"};
+
+    auto find = [&](std::string_view path) {
+        auto reader = JSON_reader{make_chunked_reader(text, 5), "<test>", 16};
+        auto r = std::vector<datum>{};
+        for (auto value : reader.find(jsonpath{path})) {
+            r.push_back(std::move(value));
+        }
+        return r;
+    };
+
+    hilet authors = find("$.store.book[*].author");
+    ASSERT_EQ(authors.size(), 4);
+    ASSERT_EQ(authors[0], datum{"Nigel Rees"});
+    ASSERT_EQ(authors[3], datum{"J. R. R. Tolkien"});
+
+    hilet prices = find("$..price");
+    ASSERT_EQ(prices.size(), 5);
+    ASSERT_EQ(prices[4], datum{19.95});
+
+    hilet slice = find("$.store.book[1:3].price");
+    ASSERT_EQ(slice.size(), 2);
+    ASSERT_EQ(slice[0], datum{12.99});
+    ASSERT_EQ(slice[1], datum{8.99});
+
+    hilet indices = find("$.store.book[0,3].author");
+    ASSERT_EQ(indices.size(), 2);
+    ASSERT_EQ(indices[1], datum{"J. R. R. Tolkien"});
+
+    hilet bicycle = find("$.store.bicycle");
+    ASSERT_EQ(bicycle.size(), 1);
+    ASSERT_EQ(bicycle[0]["color"], datum{"red"});
+
+    // Negative indices depend on the size of the array, which is not known while streaming.
+    ASSERT_TRUE(find("$.store.book[-1]").empty());
+}
@@ -0,0 +1,394 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/JSON_writer.hpp A streaming JSON writer.
+ */
+
+#pragma once
+
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "JSON_document.hpp"
+#include "datum.hpp"
+#include "../telemetry/telemetry.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <utility>
+#include <functional>
+#include <charconv>
+#include <concepts>
+#include <cmath>
+#include <exception>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.JSON_writer);
+
+hi_export namespace hi::inline v1 {
+
+/** A writer which streams JSON text.
+ *
+ * The JSON text is written in compact form into a buffer, and the buffer is
+ * passed to the output in blocks of a fixed size. The memory used does not
+ * depend on the size of the document; the buffer only grows beyond the
+ * block size to hold a single long string. Each root value is followed by a
+ * line-feed, so that a sequence of root values forms a JSON-lines file.
+ *
+ * Objects are written by calling `key()` before each member's value.
+ *
+ * The last, partial, block is written by `flush()` or by the destructor. Call
+ * `flush()` explicitly to be able to handle errors of the output; the destructor
+ * only reports them on the standard error.
+ */
+class JSON_writer {
+public:
+    constexpr static size_t default_block_size = 65536;
+
+    /** A function which writes a block of text.
+     */
+    using write_function_type = std::function<void(std::string_view)>;
+
+    JSON_writer(JSON_writer const&) = delete;
+    JSON_writer(JSON_writer&&) = delete;
+    JSON_writer& operator=(JSON_writer const&) = delete;
+    JSON_writer& operator=(JSON_writer&&) = delete;
+
+    ~JSON_writer()
+    {
+        try {
+            flush();
+        } catch (std::exception const& e) {
+            // A destructor may not throw; call flush() explicitly to handle errors.
+            hi_log_error("Could not write JSON text: \"{}\"", e.what());
+        }
+    }
+
+    /** Write JSON text in blocks.
+     *
+     * @param write_function The function that writes a block of text.
+     * @param block_size The size of each block, except the last.
+     */
+    explicit JSON_writer(write_function_type write_function, size_t block_size = default_block_size) :
+        _write_function(std::move(write_function)), _block_size(block_size)
+    {
+        hi_axiom(block_size > 0);
+        hi_axiom(_write_function);
+        _buffer.reserve(_block_size);
+    }
+
+    /** Write JSON text to a file, in blocks.
+     *
+     * @param file The file to write to, which must outlive the writer.
+     * @param block_size The size of each block, except the last.
+     */
+    explicit JSON_writer(file& file, size_t block_size = default_block_size) :
+        JSON_writer(
+            [&file](std::string_view text) {
+                file.write(text);
+            },
+            block_size)
+    {
+    }
+
+    /** Write the text in the buffer to the output.
+     */
+    void flush()
+    {
+        if (not _buffer.empty()) {
+            _write_function(_buffer);
+            _buffer.clear();
+        }
+    }
+
+    void begin_object()
+    {
+        begin_value();
+        _buffer += '{';
+        _levels.push_back(true);
+        _need_comma = false;
+    }
+
+    void end_object()
+    {
+        hi_axiom(not _levels.empty() and _levels.back() and not _has_key);
+        _levels.pop_back();
+        _buffer += '}';
+        end_value();
+    }
+
+    void begin_array()
+    {
+        begin_value();
+        _buffer += '[';
+        _levels.push_back(false);
+        _need_comma = false;
+    }
+
+    void end_array()
+    {
+        hi_axiom(not _levels.empty() and not _levels.back());
+        _levels.pop_back();
+        _buffer += ']';
+        end_value();
+    }
+
+    /** Write the key of the next member of an object.
+     *
+     * @pre The writer is inside an object, and the previous key was followed by a value.
+     */
+    void key(std::string_view key)
+    {
+        hi_axiom(not _levels.empty() and _levels.back() and not _has_key);
+        if (std::exchange(_need_comma, false)) {
+            _buffer += ',';
+        }
+        append_string(key);
+        _buffer += ':';
+        _has_key = true;
+    }
+
+    void value(std::nullptr_t)
+    {
+        begin_value();
+        _buffer += "null";
+        end_value();
+    }
+
+    void value(bool value)
+    {
+        begin_value();
+        _buffer += value ? "true" : "false";
+        end_value();
+    }
+
+    template<std::integral T>
+    void value(T value)
+    {
+        begin_value();
+        auto buffer = std::array<char, 24>{};
+        hilet [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        hi_axiom(ec == std::errc{});
+        _buffer.append(buffer.data(), last);
+        end_value();
+    }
+
+    /** Write a floating point number.
+     *
+     * The number is written with the shortest text that reads back as the
+     * same number. JSON can not represent NaN and infinity, these are
+     * written as null.
+     */
+    template<std::floating_point T>
+    void value(T value)
+    {
+        if (not std::isfinite(value)) {
+            return this->value(nullptr);
+        }
+
+        begin_value();
+        auto buffer = std::array<char, 32>{};
+        hilet [last, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+        hi_axiom(ec == std::errc{});
+        _buffer.append(buffer.data(), last);
+
+        // Make sure the number is read back as a real instead of an integer.
+        if (std::find_if(buffer.data(), last, [](char c) { return c == '.' or c == 'e'; }) == last) {
+            _buffer += ".0";
+        }
+        end_value();
+    }
+
+    void value(std::string_view value)
+    {
+        begin_value();
+        append_string(value);
+        end_value();
+    }
+
+    void value(char const *value)
+    {
+        this->value(std::string_view{value});
+    }
+
+    void value(std::string const& value)
+    {
+        this->value(std::string_view{value});
+    }
+
+    /** Write a datum.
+     *
+     * Keys of maps that are not strings are converted to strings.
+     */
+    void value(datum const& value)
+    {
+        if (holds_alternative<std::nullptr_t>(value)) {
+            this->value(nullptr);
+        } else if (hilet *b = get_if<bool>(value)) {
+            this->value(*b);
+        } else if (hilet *i = get_if<long long>(value)) {
+            this->value(*i);
+        } else if (hilet *f = get_if<double>(value)) {
+            this->value(*f);
+        } else if (hilet *s = get_if<std::string>(value)) {
+            this->value(*s);
+
+        } else if (hilet *v = get_if<datum::vector_type>(value)) {
+            begin_array();
+            for (hilet& item : *v) {
+                this->value(item);
+            }
+            end_array();
+
+        } else if (hilet *m = get_if<datum::map_type>(value)) {
+            begin_object();
+            for (hilet& [key, item] : *m) {
+                if (hilet *key_string = get_if<std::string>(key)) {
+                    this->key(*key_string);
+                } else {
+                    this->key(static_cast<std::string>(key));
+                }
+                this->value(item);
+            }
+            end_object();
+
+        } else {
+            hi_no_default();
+        }
+    }
+
+    /** Write a value of a JSON_document.
+     */
+    void value(JSON_value const& value)
+    {
+        switch (value.type()) {
+        case JSON_type::null:
+            return this->value(nullptr);
+        case JSON_type::boolean:
+            return this->value(value.as_bool());
+        case JSON_type::integer:
+            return this->value(value.as_integer());
+        case JSON_type::real:
+            return this->value(value.as_real());
+        case JSON_type::string:
+            return this->value(value.as_string());
+
+        case JSON_type::array:
+            begin_array();
+            for (hilet& item : value.as_array()) {
+                this->value(item);
+            }
+            return end_array();
+
+        case JSON_type::object:
+            begin_object();
+            for (hilet& [key, item] : value.as_object()) {
+                this->key(key);
+                this->value(item);
+            }
+            return end_object();
+        }
+        hi_no_default();
+    }
+
+private:
+    write_function_type _write_function;
+    size_t _block_size;
+    std::string _buffer;
+
+    /** For each enclosing array or object, true if it is an object.
+     */
+    std::vector<bool> _levels;
+
+    /** A comma is needed before the next element or member.
+     */
+    bool _need_comma = false;
+
+    /** A key was written, and the value of the member is next.
+     */
+    bool _has_key = false;
+
+    void begin_value()
+    {
+        if (_levels.empty()) {
+            return;
+
+        } else if (_levels.back()) {
+            hi_axiom(_has_key);
+            _has_key = false;
+
+        } else if (std::exchange(_need_comma, false)) {
+            _buffer += ',';
+        }
+    }
+
+    void end_value()
+    {
+        if (_levels.empty()) {
+            _buffer += '\n';
+        } else {
+            _need_comma = true;
+        }
+
+        if (_buffer.size() >= _block_size) {
+            write_blocks();
+        }
+    }
+
+    /** Write the complete blocks in the buffer to the output.
+     */
+    void write_blocks()
+    {
+        hilet size = _buffer.size() - _buffer.size() % _block_size;
+        for (auto offset = 0_uz; offset != size; offset += _block_size) {
+            _write_function(std::string_view{_buffer}.substr(offset, _block_size));
+        }
+        _buffer.erase(0, size);
+    }
+
+    void append_string(std::string_view str)
+    {
+        constexpr auto hex_digits = std::string_view{"0123456789abcdef"};
+
+        _buffer += '"';
+        for (hilet c : str) {
+            switch (c) {
+            case '"':
+                _buffer += "\\\"";
+                break;
+            case '\\':
+                _buffer += "\\\\";
+                break;
+            case '\b':
+                _buffer += "\\b";
+                break;
+            case '\f':
+                _buffer += "\\f";
+                break;
+            case '\n':
+                _buffer += "\\n";
+                break;
+            case '\r':
+                _buffer += "\\r";
+                break;
+            case '\t':
+                _buffer += "\\t";
+                break;
+            default:
+                if (char_cast<uint8_t>(c) < 0x20) {
+                    _buffer += "\\u00";
+                    _buffer += hex_digits[char_cast<uint8_t>(c) >> 4];
+                    _buffer += hex_digits[char_cast<uint8_t>(c) & 0xf];
+                } else {
+                    _buffer += c;
+                }
+            }
+        }
+        _buffer += '"';
+    }
+};
+
+} // namespace hi::inline v1
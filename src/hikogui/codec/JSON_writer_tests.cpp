@@ -0,0 +1,158 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "JSON_writer.hpp"
+#include "JSON_reader.hpp"
+#include "JSON_document.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(JSON_writer, structure)
+{
+    auto result = std::string{};
+    {
+        auto writer = JSON_writer{[&result](std::string_view text) {
+            result += text;
+        }};
+
+        writer.begin_object();
+        writer.key("a");
+        writer.begin_array();
+        writer.value(1);
+        writer.value("x");
+        writer.value(nullptr);
+        writer.value(true);
+        writer.begin_array();
+        writer.end_array();
+        writer.end_array();
+        writer.key("b");
+        writer.begin_object();
+        writer.end_object();
+        writer.end_object();
+
+        writer.value(42);
+    }
+
+    ASSERT_EQ(result, "{\"a\":[1,\"x\",null,true,[]],\"b\":{}}\n42\n");
+}
+
+TEST(JSON_writer, strings)
+{
+    auto result = std::string{};
+    auto writer = JSON_writer{[&result](std::string_view text) {
+        result += text;
+    }};
+
+    writer.value("\"\\/\b\f\n\r\t\x01\x1f \xc3\xa9");
+    writer.flush();
+
+    ASSERT_EQ(result, "\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001f \xc3\xa9\"\n");
+}
+
+TEST(JSON_writer, numbers)
+{
+    auto result = std::string{};
+    auto writer = JSON_writer{[&result](std::string_view text) {
+        result += text;
+    }};
+
+    writer.begin_array();
+    writer.value(-12);
+    writer.value(1.0);
+    writer.value(0.1);
+    writer.value(1e100);
+    writer.value(std::numeric_limits<double>::quiet_NaN());
+    writer.value(std::numeric_limits<double>::infinity());
+    writer.end_array();
+    writer.flush();
+
+    ASSERT_EQ(result, "[-12,1.0,0.1,1e+100,null,null]\n");
+}
+
+TEST(JSON_writer, blocks)
+{
+    auto blocks = std::vector<std::string>{};
+    auto writer = JSON_writer{
+        [&blocks](std::string_view text) {
+            blocks.emplace_back(text);
+        },
+        8};
+
+    writer.begin_array();
+    for (auto i = 0; i != 100; ++i) {
+        writer.value(i);
+    }
+    writer.end_array();
+    writer.flush();
+
+    auto result = std::string{};
+    for (auto i = 0_uz; i != blocks.size(); ++i) {
+        if (i + 1 != blocks.size()) {
+            ASSERT_EQ(blocks[i].size(), 8);
+        } else {
+            ASSERT_LE(blocks[i].size(), 8);
+        }
+        result += blocks[i];
+    }
+
+    auto reader = JSON_reader{result};
+    reader.next();
+    hilet value = reader.read_datum();
+    ASSERT_EQ(value.size(), 100);
+    ASSERT_EQ(value[99], datum{99});
+}
+
+TEST(JSON_writer, write_error)
+{
+    auto const failing_write = [](std::string_view) {
+        throw std::runtime_error("write error");
+    };
+
+    {
+        auto writer = JSON_writer{failing_write};
+        writer.value(1);
+        ASSERT_THROW(writer.flush(), std::runtime_error);
+    }
+
+    // The destructor does not throw when the last block can not be written.
+    ASSERT_NO_THROW([&] {
+        auto writer = JSON_writer{failing_write};
+        writer.value(1);
+    }());
+}
+
+TEST(JSON_writer, round_trip)
+{
+    hilet text = std::string{R"({"a": [1, 2.5, "x\ny", null, true, false], "b": {"c": {}, "d": [], "e": -0.125}})"};
+    hilet document = JSON_document{text};
+
+    auto from_value = std::string{};
+    {
+        auto writer = JSON_writer{[&from_value](std::string_view text) {
+            from_value += text;
+        }};
+        writer.value(document.root());
+    }
+
+    auto from_datum = std::string{};
+    {
+        auto writer = JSON_writer{[&from_datum](std::string_view text) {
+            from_datum += text;
+        }};
+        writer.value(static_cast<datum>(document));
+    }
+
+    ASSERT_EQ(from_value, from_datum);
+    ASSERT_EQ(static_cast<datum>(JSON_document{from_value}), static_cast<datum>(document));
+}
@@ -0,0 +1,186 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.codec.bit_reader);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Read bits LSB-first from a span of bytes through a 64 bit bit-buffer.
+ *
+ * The bit-buffer is refilled 8 bytes at a time using an unaligned load, so
+ * that a decoder can extract many small codes with only shifts and masks.
+ *
+ * Reading beyond the end of the byte span will fill the bit-buffer with
+ * zero bits, the caller should use `overrun()` to check if any of those
+ * padding bits were consumed.
+ */
+hi_export class bit_reader {
+public:
+    /** The minimum number of bits available after `refill()`.
+     */
+    constexpr static std::size_t refill_bits = 56;
+
+    constexpr bit_reader() noexcept = default;
+    constexpr bit_reader(bit_reader const&) noexcept = default;
+    constexpr bit_reader(bit_reader&&) noexcept = default;
+    constexpr bit_reader& operator=(bit_reader const&) noexcept = default;
+    constexpr bit_reader& operator=(bit_reader&&) noexcept = default;
+
+    /** Create a bit-reader.
+     *
+     * @param bytes The bytes to read the bits from.
+     * @param byte_offset The offset in @a bytes of the first bit to read.
+     */
+    constexpr bit_reader(std::span<std::byte const> bytes, std::size_t byte_offset = 0) noexcept : _bytes(bytes)
+    {
+        seek(byte_offset);
+    }
+
+    /** The bit-offset of the next bit to be read.
+     */
+    [[nodiscard]] constexpr std::size_t bit_offset() const noexcept
+    {
+        return (_offset + _nr_padding_bits / 8) * 8 - _nr_bits;
+    }
+
+    /** The byte-offset of the next byte to be read.
+     *
+     * @pre The bit-reader must be aligned to a byte using `align()`.
+     */
+    [[nodiscard]] constexpr std::size_t byte_offset() const noexcept
+    {
+        hi_axiom(_nr_bits % 8 == 0);
+        return bit_offset() / 8;
+    }
+
+    /** The number of bits left to read in the byte span.
+     */
+    [[nodiscard]] constexpr std::size_t remaining_bits() const noexcept
+    {
+        hilet total_bits = _bytes.size() * 8;
+        hilet offset = bit_offset();
+        return offset < total_bits ? total_bits - offset : 0;
+    }
+
+    /** Check if bits were read beyond the end of the byte span.
+     */
+    [[nodiscard]] constexpr bool overrun() const noexcept
+    {
+        // The padding bits are always at the top of the bit-buffer.
+        return _nr_bits < _nr_padding_bits;
+    }
+
+    /** Reset the reader to a byte-offset.
+     *
+     * This will empty the bit-buffer.
+     *
+     * @param byte_offset The offset in the byte span of the next byte to read.
+     */
+    constexpr void seek(std::size_t byte_offset) noexcept
+    {
+        _offset = byte_offset;
+        _bits = 0;
+        _nr_bits = 0;
+        _nr_padding_bits = 0;
+    }
+
+    /** Make sure that at least `refill_bits` bits are in the bit-buffer.
+     */
+    hi_force_inline void refill() noexcept
+    {
+        if (_offset + sizeof(uint64_t) <= _bytes.size()) [[likely]] {
+            _bits |= load_le<uint64_t>(_bytes.data() + _offset) << _nr_bits;
+            _offset += (63 - _nr_bits) >> 3;
+            _nr_bits |= refill_bits;
+        } else {
+            refill_slow();
+        }
+    }
+
+    /** Get bits from the bit-buffer without consuming them.
+     *
+     * @pre At least @a n bits should be available, see `refill()`.
+     * @param n The number of bits to peek at, between 0 and 32.
+     * @return The bits, the first bit in the stream is the LSB.
+     */
+    [[nodiscard]] hi_force_inline std::size_t peek(std::size_t n) const noexcept
+    {
+        hi_axiom(n <= 32);
+        hi_axiom(n <= _nr_bits);
+        return narrow_cast<std::size_t>(_bits & ((uint64_t{1} << n) - 1));
+    }
+
+    /** Consume bits from the bit-buffer.
+     *
+     * @pre At least @a n bits should be available, see `refill()`.
+     * @param n The number of bits to consume.
+     */
+    hi_force_inline void skip(std::size_t n) noexcept
+    {
+        hi_axiom(n <= _nr_bits);
+        _bits >>= n;
+        _nr_bits -= n;
+    }
+
+    /** Get and consume bits from the bit-buffer.
+     *
+     * @pre At least @a n bits should be available, see `refill()`.
+     * @param n The number of bits to read, between 0 and 32.
+     * @return The bits, the first bit in the stream is the LSB.
+     */
+    [[nodiscard]] hi_force_inline std::size_t get(std::size_t n) noexcept
+    {
+        hilet r = peek(n);
+        skip(n);
+        return r;
+    }
+
+    /** Skip bits until the next bit is on a byte-boundary.
+     */
+    void align() noexcept
+    {
+        skip(_nr_bits % 8);
+    }
+
+private:
+    std::span<std::byte const> _bytes = {};
+
+    /** Offset of the next byte to load into the bit-buffer.
+     */
+    std::size_t _offset = 0;
+
+    /** The bit-buffer, the next bit to read is in the LSB.
+     */
+    uint64_t _bits = 0;
+
+    /** The number of valid bits in the bit-buffer.
+     */
+    std::size_t _nr_bits = 0;
+
+    /** The number of zero bits added beyond the end of the byte span.
+     */
+    std::size_t _nr_padding_bits = 0;
+
+    hi_no_inline void refill_slow() noexcept
+    {
+        while (_nr_bits < refill_bits) {
+            if (_offset < _bytes.size()) {
+                _bits |= uint64_t{std::to_integer<uint8_t>(_bytes[_offset++])} << _nr_bits;
+            } else {
+                _nr_padding_bits += 8;
+            }
+            _nr_bits += 8;
+        }
+    }
+};
+
+}} // namespace hi::v1
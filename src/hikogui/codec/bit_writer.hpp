@@ -0,0 +1,112 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../container/container.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+
+hi_export_module(hikogui.codec.bit_writer);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** Write bits LSB-first into a byte string through a 64 bit bit-buffer.
+ *
+ * This is the counterpart of `bit_reader`.
+ */
+hi_export class bit_writer {
+public:
+    constexpr bit_writer() noexcept = default;
+    bit_writer(bit_writer const&) = default;
+    bit_writer(bit_writer&&) noexcept = default;
+    bit_writer& operator=(bit_writer const&) = default;
+    bit_writer& operator=(bit_writer&&) noexcept = default;
+
+    /** Create a bit-writer which appends to existing bytes.
+     *
+     * @param bytes The bytes to append to.
+     */
+    explicit bit_writer(bstring bytes) noexcept : _bytes(std::move(bytes)) {}
+
+    /** The number of bits written.
+     */
+    [[nodiscard]] std::size_t bit_offset() const noexcept
+    {
+        return _bytes.size() * 8 + _nr_bits;
+    }
+
+    /** Write bits.
+     *
+     * @param value The bits to write, the LSB is written first.
+     * @param nr_bits The number of bits to write, between 0 and 32.
+     */
+    hi_force_inline void put(std::size_t value, std::size_t nr_bits)
+    {
+        hi_axiom(nr_bits <= 32);
+        hi_axiom(nr_bits == 32 or value < (1_uz << nr_bits));
+
+        _bits |= static_cast<uint64_t>(value) << _nr_bits;
+        _nr_bits += nr_bits;
+
+        if (_nr_bits >= 32) {
+            auto buffer = std::array<std::byte, 4>{};
+            store_le(static_cast<uint32_t>(_bits), buffer.data());
+            _bytes.append(buffer.data(), buffer.size());
+            _bits >>= 32;
+            _nr_bits -= 32;
+        }
+    }
+
+    /** Write zero bits until the next bit is on a byte-boundary.
+     */
+    void align()
+    {
+        while (_nr_bits > 0) {
+            _bytes.push_back(static_cast<std::byte>(_bits & 0xff));
+            _bits >>= 8;
+            _nr_bits = _nr_bits > 8 ? _nr_bits - 8 : 0;
+        }
+        _bits = 0;
+    }
+
+    /** Write bytes.
+     *
+     * @pre The bit-writer must be aligned to a byte using `align()`.
+     * @param bytes The bytes to write.
+     */
+    void put_bytes(std::span<std::byte const> bytes)
+    {
+        hi_axiom(_nr_bits == 0);
+        _bytes.append(bytes.data(), bytes.size());
+    }
+
+    /** Take the written bytes out of the bit-writer.
+     *
+     * The bit-writer is aligned before the bytes are taken.
+     */
+    [[nodiscard]] bstring take()
+    {
+        align();
+        return std::exchange(_bytes, bstring{});
+    }
+
+private:
+    bstring _bytes = {};
+
+    /** The bit-buffer, the next bit is written above the `_nr_bits` valid bits.
+     */
+    uint64_t _bits = 0;
+
+    /** The number of valid bits in the bit-buffer.
+     */
+    std::size_t _nr_bits = 0;
+};
+
+}} // namespace hi::v1
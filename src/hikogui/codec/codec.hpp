@@ -2,16 +2,25 @@
 #pragma once
 
 #include "base_n.hpp" // export
+#include "bit_reader.hpp" // export
+#include "bit_writer.hpp" // export
 #include "BON8.hpp" // export
+#include "BON8_view.hpp" // export
+#include "compiled_jsonpath.hpp" // export
 #include "datum.hpp" // export
+#include "deflate.hpp" // export
 #include "gzip.hpp" // export
 #include "huffman.hpp" // export
 #include "indent.hpp" // export
 #include "inflate.hpp" // export
 #include "JSON.hpp" // export
+#include "JSON_document.hpp" // export
+#include "JSON_reader.hpp" // export
+#include "JSON_writer.hpp" // export
 #include "jsonpath.hpp" // export
 #include "pickle.hpp" // export
 #include "png.hpp" // export
+#include "png_unfilter.hpp" // export
 #include "SHA2.hpp" // export
 #include "zlib.hpp" // export
 
@@ -0,0 +1,610 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/compiled_jsonpath.hpp A json-path compiled for repeated evaluation.
+ */
+
+#pragma once
+
+#include "jsonpath.hpp"
+#include "datum.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <variant>
+#include <limits>
+#include <algorithm>
+#include <memory>
+
+hi_export_module(hikogui.codec.compiled_jsonpath);
+
+hi_export namespace hi { inline namespace v1 {
+
+hi_export class compiled_jsonpath_set;
+
+/** A json-path compiled into a program to search a datum.
+ *
+ * `datum::find()` interprets the nodes of a json-path on every call. A
+ * compiled json-path resolves the nodes once into a flat list of
+ * instructions: names are converted to keys with a precalculated hash,
+ * single names and indices get their own instruction, the root and current
+ * nodes are removed, and `..` followed by a single name is fused into a
+ * single instruction.
+ *
+ * A compiled json-path only searches a `datum const`, which means values
+ * are not unshared from their copies while searching.
+ */
+hi_export class compiled_jsonpath {
+public:
+    /** Compile a json-path.
+     *
+     * When @a use_key_index is true, a search for `..name` uses an index of all
+     * the descendants of the datum by their key. The index is created on the
+     * first search and kept with the value of the datum, so that repeated
+     * searches of the same datum, or of copies of it, are fast. The index is
+     * discarded when the datum is modified.
+     *
+     * @param path The json-path to compile.
+     * @param use_key_index Use an index to search for descendants by name.
+     */
+    explicit compiled_jsonpath(jsonpath const& path, bool use_key_index = false) noexcept :
+        compiled_jsonpath(path, use_key_index, true)
+    {
+    }
+
+    /** Compile a json-path.
+     *
+     * @param path The json-path to compile.
+     * @param use_key_index Use an index to search for descendants by name.
+     */
+    explicit compiled_jsonpath(std::string_view path, bool use_key_index = false) :
+        compiled_jsonpath(jsonpath{path}, use_key_index)
+    {
+    }
+
+    explicit compiled_jsonpath(char const *path, bool use_key_index = false) :
+        compiled_jsonpath(std::string_view{path}, use_key_index)
+    {
+    }
+
+    /** Find all values in a datum.
+     *
+     * @param root The datum to search.
+     * @return Pointers to the values found, in the same order as `datum::find()`.
+     */
+    [[nodiscard]] std::vector<datum const *> find(datum const& root) const noexcept
+    {
+        auto r = std::vector<datum const *>{};
+        run(root, 0, [&r](datum const& value) {
+            r.push_back(std::addressof(value));
+            return false;
+        });
+        return r;
+    }
+
+    /** Find the first value in a datum.
+     *
+     * The search stops at the first value found.
+     *
+     * @param root The datum to search.
+     * @return A pointer to the first value found, or nullptr.
+     */
+    [[nodiscard]] datum const *find_one(datum const& root) const noexcept
+    {
+        datum const *r = nullptr;
+        run(root, 0, [&r](datum const& value) {
+            r = std::addressof(value);
+            return true;
+        });
+        return r;
+    }
+
+private:
+    friend class compiled_jsonpath_set;
+
+    enum class opcode : uint8_t {
+        /** The current value is found.
+         */
+        match,
+
+        /** Continue with the member with the name.
+         */
+        name,
+
+        /** Continue with each member with one of the names.
+         */
+        names,
+
+        /** Continue with the element at the index.
+         */
+        index,
+
+        /** Continue with each element at one of the indices.
+         */
+        indices,
+
+        /** Continue with each element in the slice.
+         */
+        slice,
+
+        /** Continue with each element or member.
+         */
+        wildcard,
+
+        /** Continue with the current value, and repeat with each element or member.
+         */
+        descend,
+
+        /** Continue with each member with the name of the current value and all its descendants.
+         */
+        descend_name,
+    };
+
+    struct instruction {
+        opcode op;
+
+        /** The size of the operand.
+         */
+        uint32_t size;
+
+        /** The index of the operand in the keys, indices or slices.
+         */
+        uint32_t first;
+
+        constexpr instruction(opcode op, size_t first = 0, size_t size = 0) noexcept :
+            op(op), size(narrow_cast<uint32_t>(size)), first(narrow_cast<uint32_t>(first))
+        {
+        }
+    };
+
+    struct key_type {
+        datum key;
+        size_t hash;
+    };
+
+    std::vector<instruction> _program;
+    std::vector<key_type> _keys;
+    std::vector<ptrdiff_t> _indices;
+    std::vector<jsonpath::slice> _slices;
+    bool _use_key_index = false;
+
+    /** Compile a json-path.
+     *
+     * @param path The json-path to compile.
+     * @param use_key_index Use an index to search for descendants by name.
+     * @param fuse_descend Compile `..` followed by a single name into a single instruction.
+     */
+    compiled_jsonpath(jsonpath const& path, bool use_key_index, bool fuse_descend) noexcept : _use_key_index(use_key_index)
+    {
+        for (auto it = path.cbegin(); it != path.cend(); ++it) {
+            if (std::holds_alternative<jsonpath::root>(*it) or std::holds_alternative<jsonpath::current>(*it)) {
+                // Searching always starts at the datum that is passed.
+                continue;
+
+            } else if (std::holds_alternative<jsonpath::wildcard>(*it)) {
+                _program.emplace_back(opcode::wildcard);
+
+            } else if (std::holds_alternative<jsonpath::descend>(*it)) {
+                auto next = it + 1;
+                if (fuse_descend and next != path.cend()) {
+                    if (hilet *names = std::get_if<jsonpath::names>(&*next); names != nullptr and names->size() == 1) {
+                        _program.emplace_back(opcode::descend_name, add_names(*names), 1);
+                        it = next;
+                        continue;
+                    }
+                }
+                _program.emplace_back(opcode::descend);
+
+            } else if (hilet *names = std::get_if<jsonpath::names>(&*it)) {
+                _program.emplace_back(names->size() == 1 ? opcode::name : opcode::names, add_names(*names), names->size());
+
+            } else if (hilet *indices = std::get_if<jsonpath::indices>(&*it)) {
+                hilet first = _indices.size();
+                _indices.insert(_indices.end(), indices->begin(), indices->end());
+                _program.emplace_back(indices->size() == 1 ? opcode::index : opcode::indices, first, indices->size());
+
+            } else if (hilet *slice = std::get_if<jsonpath::slice>(&*it)) {
+                _program.emplace_back(opcode::slice, _slices.size(), 1);
+                _slices.push_back(*slice);
+
+            } else {
+                hi_no_default();
+            }
+        }
+        _program.emplace_back(opcode::match);
+    }
+
+    /** Check if two instructions do the same.
+     */
+    [[nodiscard]] static bool
+    same_instruction(compiled_jsonpath const& lhs, size_t lhs_pc, compiled_jsonpath const& rhs, size_t rhs_pc) noexcept
+    {
+        hilet& lhs_instruction = lhs._program[lhs_pc];
+        hilet& rhs_instruction = rhs._program[rhs_pc];
+        if (lhs_instruction.op != rhs_instruction.op or lhs_instruction.size != rhs_instruction.size) {
+            return false;
+        }
+
+        switch (lhs_instruction.op) {
+        case opcode::match:
+        case opcode::wildcard:
+        case opcode::descend:
+            return true;
+
+        case opcode::name:
+        case opcode::names:
+        case opcode::descend_name:
+            return std::ranges::equal(lhs.keys(lhs_instruction), rhs.keys(rhs_instruction), [](hilet& a, hilet& b) {
+                return a.key == b.key;
+            });
+
+        case opcode::index:
+        case opcode::indices:
+            return std::ranges::equal(lhs.indices(lhs_instruction), rhs.indices(rhs_instruction));
+
+        case opcode::slice:
+            {
+                hilet& a = lhs._slices[lhs_instruction.first];
+                hilet& b = rhs._slices[rhs_instruction.first];
+                return a.first == b.first and a.last == b.last and a.step == b.step;
+            }
+        }
+        hi_no_default();
+    }
+
+
+    [[nodiscard]] size_t add_names(jsonpath::names const& names) noexcept
+    {
+        hilet first = _keys.size();
+        for (hilet& name : names) {
+            _keys.emplace_back(datum{name}, datum::key_hash(name));
+        }
+        return first;
+    }
+
+    [[nodiscard]] std::span<key_type const> keys(instruction const& instruction) const noexcept
+    {
+        return std::span{_keys}.subspan(instruction.first, instruction.size);
+    }
+
+    [[nodiscard]] std::span<ptrdiff_t const> indices(instruction const& instruction) const noexcept
+    {
+        return std::span{_indices}.subspan(instruction.first, instruction.size);
+    }
+
+    [[nodiscard]] static datum const *find_member(datum const& value, key_type const& key) noexcept
+    {
+        if (value._tag == datum::tag_type::map) {
+            if (hilet *item = value.find_member(key.key, key.hash)) {
+                return std::addressof(item->second);
+            }
+        }
+        return nullptr;
+    }
+
+    [[nodiscard]] static datum const *find_element(datum const& value, ptrdiff_t index) noexcept
+    {
+        if (value._tag == datum::tag_type::vector) {
+            hilet& vector = value._value._vector->value;
+            if (index < 0) {
+                index += ssize(vector);
+            }
+            if (index >= 0 and index < ssize(vector)) {
+                return std::addressof(vector[index]);
+            }
+        }
+        return nullptr;
+    }
+
+    /** Call a function for each element or member of a value.
+     *
+     * @return true if the function returned true.
+     */
+    template<typename Func>
+    static bool for_each_child(datum const& value, Func const& func) noexcept
+    {
+        if (value._tag == datum::tag_type::vector) {
+            for (hilet& item : value._value._vector->value) {
+                if (func(item)) {
+                    return true;
+                }
+            }
+        } else if (value._tag == datum::tag_type::map) {
+            for (hilet& item : value._value._map->value) {
+                if (func(item.second)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /** Call a function for each element in a slice of a value.
+     *
+     * @return true if the function returned true.
+     */
+    template<typename Func>
+    static bool for_each_in_slice(datum const& value, jsonpath::slice const& slice, Func const& func) noexcept
+    {
+        if (value._tag == datum::tag_type::vector) {
+            hilet& vector = value._value._vector->value;
+            hilet first = slice.begin(vector.size());
+            hilet last = slice.end(vector.size());
+
+            for (auto index = first; index != last; index += slice.step) {
+                if (index >= 0 and index < vector.size() and func(vector[index])) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /** Run the program from an instruction.
+     *
+     * @param value The current value.
+     * @param pc The index of the instruction to execute.
+     * @param on_match Function called with each value found, returns true to stop the search.
+     * @return true if the search was stopped.
+     */
+    template<typename OnMatch>
+    bool run(datum const& value, size_t pc, OnMatch const& on_match) const noexcept
+    {
+        hilet& instruction = _program[pc];
+        auto next = [&](datum const& child) {
+            return run(child, pc + 1, on_match);
+        };
+
+        switch (instruction.op) {
+        case opcode::match:
+            return on_match(value);
+
+        case opcode::name:
+            if (hilet *child = find_member(value, _keys[instruction.first])) {
+                return next(*child);
+            }
+            return false;
+
+        case opcode::names:
+            for (hilet& key : keys(instruction)) {
+                if (hilet *child = find_member(value, key); child != nullptr and next(*child)) {
+                    return true;
+                }
+            }
+            return false;
+
+        case opcode::index:
+            if (hilet *child = find_element(value, _indices[instruction.first])) {
+                return next(*child);
+            }
+            return false;
+
+        case opcode::indices:
+            for (hilet index : indices(instruction)) {
+                if (hilet *child = find_element(value, index); child != nullptr and next(*child)) {
+                    return true;
+                }
+            }
+            return false;
+
+        case opcode::slice:
+            return for_each_in_slice(value, _slices[instruction.first], next);
+
+        case opcode::wildcard:
+            return for_each_child(value, next);
+
+        case opcode::descend:
+            if (run(value, pc + 1, on_match)) {
+                return true;
+            }
+            return for_each_child(value, [&](datum const& child) {
+                return run(child, pc, on_match);
+            });
+
+        case opcode::descend_name:
+            {
+                hilet& key = _keys[instruction.first];
+                if (_use_key_index) {
+                    if (hilet *index = value.descendants()) {
+                        // The index contains the members of all the descendants, but not of the value itself.
+                        if (hilet *child = find_member(value, key); child != nullptr and next(*child)) {
+                            return true;
+                        }
+                        for (hilet *descendant : index->find(key.key._value._string->value)) {
+                            if (next(*descendant)) {
+                                return true;
+                            }
+                        }
+                        return false;
+                    }
+                }
+
+                if (hilet *child = find_member(value, key); child != nullptr and next(*child)) {
+                    return true;
+                }
+                return for_each_child(value, [&](datum const& child) {
+                    return run(child, pc, on_match);
+                });
+            }
+        }
+        hi_no_default();
+    }
+
+};
+
+/** A set of json-paths compiled to search a datum for all of them at once.
+ *
+ * The programs of the json-paths are merged into a tree, so that the common
+ * start of paths is only run once. For example the paths `$..name` and
+ * `$..color` are found in a single walk through the datum, instead of one walk
+ * for each path.
+ */
+hi_export class compiled_jsonpath_set {
+public:
+    constexpr compiled_jsonpath_set() noexcept = default;
+
+    /** Compile a set of json-paths.
+     *
+     * @param paths The json-paths to compile.
+     */
+    explicit compiled_jsonpath_set(std::span<jsonpath const> paths) noexcept
+    {
+        for (hilet& path : paths) {
+            add(path);
+        }
+    }
+
+    /** The number of json-paths in the set.
+     */
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return _paths.size();
+    }
+
+    /** Add a json-path to the set.
+     *
+     * @param path The json-path to add.
+     * @return The index of the path, used to get its values from the result of `find()`.
+     */
+    size_t add(jsonpath const& path) noexcept
+    {
+        hilet path_index = narrow_cast<uint32_t>(_paths.size());
+        hilet& compiled_path = _paths.emplace_back(compiled_jsonpath{path, false, false});
+
+        auto node_index = 0_uz;
+        for (auto pc = 0_uz; pc != compiled_path._program.size(); ++pc) {
+            hilet& children = _nodes[node_index].children;
+            hilet it = std::ranges::find_if(children, [&](hilet child_index) {
+                hilet& child = _nodes[child_index];
+                return compiled_jsonpath::same_instruction(_paths[child.path], child.pc, compiled_path, pc);
+            });
+
+            if (it != children.end()) {
+                node_index = *it;
+            } else {
+                hilet child_index = narrow_cast<uint32_t>(_nodes.size());
+                _nodes.emplace_back(path_index, narrow_cast<uint32_t>(pc));
+                _nodes[node_index].children.push_back(child_index);
+                node_index = child_index;
+            }
+        }
+
+        // The last instruction is the match.
+        _nodes[node_index].matches.push_back(path_index);
+        return path_index;
+    }
+
+    /** Find the values of all json-paths in a datum.
+     *
+     * @param root The datum to search.
+     * @return For each json-path, the values found, in the same order as `datum::find()`.
+     */
+    [[nodiscard]] std::vector<std::vector<datum const *>> find(datum const& root) const noexcept
+    {
+        auto r = std::vector<std::vector<datum const *>>(_paths.size());
+        run_children(root, _nodes.front(), r);
+        return r;
+    }
+
+private:
+    /** A node in the tree of instructions.
+     */
+    struct node_type {
+        /** The index of a path that contains the instruction.
+         */
+        uint32_t path = 0;
+
+        /** The index of the instruction in the path.
+         */
+        uint32_t pc = 0;
+
+        /** The nodes of the instructions to run next.
+         */
+        std::vector<uint32_t> children = {};
+
+        /** The paths that end at a match instruction.
+         */
+        std::vector<uint32_t> matches = {};
+    };
+
+    std::vector<compiled_jsonpath> _paths;
+
+    /** The tree of instructions, the first node is the root without an instruction.
+     */
+    std::vector<node_type> _nodes = std::vector<node_type>(1);
+
+    void run_children(datum const& value, node_type const& node, std::vector<std::vector<datum const *>>& r) const noexcept
+    {
+        for (hilet child_index : node.children) {
+            run(value, _nodes[child_index], r);
+        }
+    }
+
+    void run(datum const& value, node_type const& node, std::vector<std::vector<datum const *>>& r) const noexcept
+    {
+        using opcode = compiled_jsonpath::opcode;
+
+        hilet& path = _paths[node.path];
+        hilet& instruction = path._program[node.pc];
+        auto next = [&](datum const& child) {
+            run_children(child, node, r);
+            return false;
+        };
+
+        switch (instruction.op) {
+        case opcode::match:
+            for (hilet path_index : node.matches) {
+                r[path_index].push_back(std::addressof(value));
+            }
+            return;
+
+        case opcode::name:
+        case opcode::names:
+            for (hilet& key : path.keys(instruction)) {
+                if (hilet *child = compiled_jsonpath::find_member(value, key)) {
+                    next(*child);
+                }
+            }
+            return;
+
+        case opcode::index:
+        case opcode::indices:
+            for (hilet index : path.indices(instruction)) {
+                if (hilet *child = compiled_jsonpath::find_element(value, index)) {
+                    next(*child);
+                }
+            }
+            return;
+
+        case opcode::slice:
+            compiled_jsonpath::for_each_in_slice(value, path._slices[instruction.first], next);
+            return;
+
+        case opcode::wildcard:
+            compiled_jsonpath::for_each_child(value, next);
+            return;
+
+        case opcode::descend:
+            run_children(value, node, r);
+            compiled_jsonpath::for_each_child(value, [&](datum const& child) {
+                run(child, node, r);
+                return false;
+            });
+            return;
+
+        case opcode::descend_name:
+            // The paths are compiled without fusing `..` with a name, so that
+            // a `..` is shared with all paths.
+            hi_no_default();
+        }
+        hi_no_default();
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,108 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "compiled_jsonpath.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a tree like a theme, with a few sections of nested objects.
+ */
+[[nodiscard]] datum make_tree()
+{
+    auto r = datum::make_map();
+    for (auto i = 0; i != 10; ++i) {
+        auto section = datum::vector_type{};
+        for (auto j = 0; j != 100; ++j) {
+            auto item = datum::make_map();
+            item["name"] = std::format("item {}.{}", i, j);
+            item["color"] = datum::make_vector(i, j, 0, 255);
+            item["size"] = datum::make_map("width", j, "height", i);
+            item["margin"] = j % 7;
+            section.push_back(std::move(item));
+        }
+        r[std::format("section{}", i)] = std::move(section);
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(compiled_jsonpath_benchmarks, find)
+{
+    hilet tree = make_tree();
+
+    for (hilet path_text : {"$.section3[50].size.width", "$.section3[*].name", "$..width"}) {
+        hilet path = jsonpath{path_text};
+        hilet compiled_path = compiled_jsonpath{path};
+        hilet indexed_path = compiled_jsonpath{path, true};
+
+        auto num_found = 0_uz;
+        hilet find_rate = benchmark_rate([&] {
+            num_found = tree.find(path).size();
+        });
+        ASSERT_GT(num_found, 0);
+
+        hilet compiled_rate = benchmark_rate([&] {
+            num_found = compiled_path.find(tree).size();
+        });
+        ASSERT_GT(num_found, 0);
+
+        hilet indexed_rate = benchmark_rate([&] {
+            num_found = indexed_path.find(tree).size();
+        });
+        ASSERT_GT(num_found, 0);
+
+        benchmark_report(std::format("datum::find {}", path_text), find_rate, "finds/s");
+        benchmark_report(std::format("compiled_jsonpath {}", path_text), compiled_rate, "finds/s");
+        benchmark_report(std::format("compiled_jsonpath key-index {}", path_text), indexed_rate, "finds/s");
+    }
+}
+
+TEST(compiled_jsonpath_benchmarks, set)
+{
+    hilet tree = make_tree();
+
+    for (hilet prefix : {"$..", "$.section3[*]."}) {
+        auto paths = std::vector<jsonpath>{};
+        for (hilet name : {"name", "color", "width", "height", "margin", "size"}) {
+            paths.emplace_back(std::format("{}{}", prefix, name));
+        }
+
+        auto compiled_paths = std::vector<compiled_jsonpath>{};
+        for (hilet& path : paths) {
+            compiled_paths.emplace_back(path);
+        }
+        hilet path_set = compiled_jsonpath_set{paths};
+
+        auto num_found = 0_uz;
+        hilet separate_rate = benchmark_rate([&] {
+            num_found = 0;
+            for (hilet& path : compiled_paths) {
+                num_found += path.find(tree).size();
+            }
+        });
+        ASSERT_GT(num_found, 0);
+        hilet separate_found = num_found;
+
+        hilet set_rate = benchmark_rate([&] {
+            num_found = 0;
+            for (hilet& found : path_set.find(tree)) {
+                num_found += found.size();
+            }
+        });
+        ASSERT_EQ(num_found, separate_found);
+
+        benchmark_report(std::format("compiled_jsonpath 6 paths {}X separately", prefix), separate_rate, "finds/s");
+        benchmark_report(std::format("compiled_jsonpath_set 6 paths {}X", prefix), set_rate, "finds/s");
+    }
+}
@@ -0,0 +1,125 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "compiled_jsonpath.hpp"
+#include "JSON.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <utility>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] datum make_bookstore()
+{
+    return parse_JSON(R"({
+        "store": {
+            "book": [
+                {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+                {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+                {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+                {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+            ],
+            "bicycle": {"color": "red", "price": 19.95, "parts": [{"name": "wheel", "price": 5.0}]}
+        }
+    })");
+}
+
+std::vector<std::string> const test_paths = {
+    "$",
+    "$.store.book[*].author",
+    "$..author",
+    "$.store.*",
+    "$.store..price",
+    "$..price",
+    "$..book[2]",
+    "$..book[-1:]",
+    "$..book[:2]",
+    "$..book[0,3].title",
+    "$..book[-1].title",
+    "$.store['book','bicycle']",
+    "$..*",
+    "$..book..price",
+    "$.store.nothing",
+    "$.store.book.author",
+    "$.store.book[10]"};
+
+} // namespace
+
+TEST(compiled_jsonpath, find)
+{
+    hilet bookstore = make_bookstore();
+
+    for (hilet& path : test_paths) {
+        hilet expected = bookstore.find(jsonpath{path});
+        ASSERT_EQ(compiled_jsonpath{path}.find(bookstore), expected) << path;
+        ASSERT_EQ(compiled_jsonpath(path, true).find(bookstore), expected) << path;
+    }
+}
+
+TEST(compiled_jsonpath, find_one)
+{
+    hilet bookstore = make_bookstore();
+
+    hilet *title = compiled_jsonpath{"$.store.book[1].title"}.find_one(bookstore);
+    ASSERT_NE(title, nullptr);
+    ASSERT_EQ(*title, "Sword of Honour");
+
+    hilet *price = compiled_jsonpath{"$..price"}.find_one(bookstore);
+    ASSERT_NE(price, nullptr);
+    ASSERT_EQ(*price, 19.95);
+
+    ASSERT_EQ(compiled_jsonpath{"$.store.nothing"}.find_one(bookstore), nullptr);
+}
+
+TEST(compiled_jsonpath, key_index)
+{
+    // The index is used directly on a parsed document.
+    hilet parsed_bookstore = make_bookstore();
+    hilet path = compiled_jsonpath{"$..price", true};
+    ASSERT_TRUE(parsed_bookstore.is_indexable());
+    ASSERT_EQ(path.find(parsed_bookstore).size(), 6);
+    ASSERT_EQ(path.find(parsed_bookstore), parsed_bookstore.find(jsonpath{"$..price"}));
+
+    // Modifying a copy must not use the index of the shared value.
+    auto bookstore = parsed_bookstore;
+    bookstore["store"]["book"][0]["price"] = 1.0;
+    bookstore["store"]["book"].push_back(datum::make_map("price", 2.0));
+
+    hilet prices = path.find(bookstore);
+    ASSERT_EQ(prices, std::as_const(bookstore).find(jsonpath{"$..price"}));
+    ASSERT_EQ(prices.size(), 7);
+    ASSERT_EQ(*prices[2], 1.0);
+    ASSERT_EQ(*prices.back(), 2.0);
+
+    // A copy of the modified datum can be indexed again.
+    hilet copy = bookstore;
+    hilet copy_prices = path.find(copy);
+    ASSERT_EQ(copy_prices, copy.find(jsonpath{"$..price"}));
+    ASSERT_EQ(*copy_prices[2], 1.0);
+    ASSERT_EQ(*copy_prices.back(), 2.0);
+    ASSERT_EQ(path.find(parsed_bookstore).size(), 6);
+}
+
+TEST(compiled_jsonpath, set)
+{
+    hilet bookstore = make_bookstore();
+
+    auto paths = compiled_jsonpath_set{};
+    for (hilet& path : test_paths) {
+        paths.add(jsonpath{path});
+    }
+    ASSERT_EQ(paths.size(), test_paths.size());
+
+    hilet results = paths.find(bookstore);
+    ASSERT_EQ(results.size(), test_paths.size());
+
+    for (auto i = 0_uz; i != test_paths.size(); ++i) {
+        ASSERT_EQ(results[i], bookstore.find(jsonpath{test_paths[i]})) << test_paths[i];
+    }
+}
@@ -18,6 +18,12 @@
 #include <limits>
 #include <vector>
 #include <map>
+#include <atomic>
+#include <memory>
+#include <string_view>
+#include <functional>
+#include <span>
+#include <unordered_map>
 
 hi_warning_push();
 // C26476: Expression/symbol '...' uses a naked union '...' with multiple type pointers: Use variant instead (type.7.).
@@ -26,9 +32,6 @@ hi_warning_ignore_msvc(26476);
 // C26409: Avoid calling new and delete explicitly, use std::make_unique<T> instead (r.11).
 // This implements `datum` which implements RAII for large objects.
 hi_warning_ignore_msvc(26409);
-// C26492: Don't use const_cast to cast away const or volatile (type.3).
-// Needed until c++23 deducing this.
-hi_warning_ignore_msvc(26492);
 
 hi_export_module(hikogui.codec.datum);
 
@@ -198,6 +201,8 @@ class is_datum_type<bstring> : public std::true_type {};
 hi_export template<typename T>
 constexpr bool is_datum_type_v = is_datum_type<T>::value;
 
+hi_export class compiled_jsonpath;
+
 /** A dynamic data type.
  *
  * This class holds data of different types, useful as the data-type used for variables
@@ -272,12 +277,12 @@ public:
     }
 
     constexpr explicit datum(std::chrono::year_month_day value) noexcept : _tag(tag_type::year_month_day), _value(value) {}
-    explicit datum(std::string value) noexcept : _tag(tag_type::string), _value(new std::string{std::move(value)}) {}
-    explicit datum(std::string_view value) noexcept : _tag(tag_type::string), _value(new std::string{value}) {}
-    explicit datum(char const *value) noexcept : _tag(tag_type::string), _value(new std::string{value}) {}
-    explicit datum(vector_type value) noexcept : _tag(tag_type::vector), _value(new vector_type{std::move(value)}) {}
-    explicit datum(map_type value) noexcept : _tag(tag_type::map), _value(new map_type{std::move(value)}) {}
-    explicit datum(bstring value) noexcept : _tag(tag_type::bstring), _value(new bstring{std::move(value)}) {}
+    explicit datum(std::string value) noexcept : _tag(tag_type::string), _value(new string_box{std::move(value)}) {}
+    explicit datum(std::string_view value) noexcept : _tag(tag_type::string), _value(new string_box{value}) {}
+    explicit datum(char const *value) noexcept : _tag(tag_type::string), _value(new string_box{value}) {}
+    explicit datum(vector_type value) noexcept : _tag(tag_type::vector), _value(new vector_box{std::move(value)}) {}
+    explicit datum(map_type value) noexcept : _tag(tag_type::map), _value(new map_box{std::move(value)}) {}
+    explicit datum(bstring value) noexcept : _tag(tag_type::bstring), _value(new bstring_box{std::move(value)}) {}
 
     template<typename... Args>
     [[nodiscard]] static datum make_vector(Args const&...args) noexcept
@@ -388,7 +393,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::string;
-        _value = new std::string{std::move(value)};
+        _value = new string_box{std::move(value)};
         return *this;
     }
 
@@ -396,7 +401,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::string;
-        _value = new std::string{value};
+        _value = new string_box{value};
         return *this;
     }
 
@@ -404,7 +409,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::string;
-        _value = new std::string{value};
+        _value = new string_box{value};
         return *this;
     }
 
@@ -412,7 +417,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::vector;
-        _value = new vector_type{std::move(value)};
+        _value = new vector_box{std::move(value)};
         return *this;
     }
 
@@ -420,7 +425,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::map;
-        _value = new map_type{std::move(value)};
+        _value = new map_box{std::move(value)};
         return *this;
     }
 
@@ -428,7 +433,7 @@ public:
     {
         delete_pointer();
         _tag = tag_type::bstring;
-        _value = new bstring{std::move(value)};
+        _value = new bstring_box{std::move(value)};
         return *this;
     }
 
@@ -542,11 +547,11 @@ public:
         case tag_type::flow_continue:
             return "continue";
         case tag_type::string:
-            return *_value._string;
+            return _value._string->value;
         case tag_type::vector:
             {
                 auto r = std::string{"["};
-                for (hilet& item : *_value._vector) {
+                for (hilet& item : _value._vector->value) {
                     r += repr(item);
                     r += ',';
                 }
@@ -556,7 +561,7 @@ public:
         case tag_type::map:
             {
                 auto r = std::string{"{"};
-                for (hilet& item : *_value._map) {
+                for (hilet& item : _value._map->value) {
                     r += repr(item.first);
                     r += ':';
                     r += repr(item.second);
@@ -566,7 +571,7 @@ public:
                 return r;
             };
         case tag_type::bstring:
-            return base64::encode(*_value._bstring);
+            return base64::encode(_value._bstring->value);
         default:
             hi_no_default();
         }
@@ -673,11 +678,11 @@ public:
                 return std::hash<uint32_t>{}(r);
             }
         case tag_type::string:
-            return std::hash<std::string>{}(*_value._string);
+            return std::hash<std::string>{}(_value._string->value);
         case tag_type::vector:
             {
                 std::size_t r = 0;
-                for (hilet& v : *_value._vector) {
+                for (hilet& v : _value._vector->value) {
                     r = hash_mix(r, v.hash());
                 }
                 return r;
@@ -685,13 +690,13 @@ public:
         case tag_type::map:
             {
                 std::size_t r = 0;
-                for (hilet& kv : *_value._map) {
+                for (hilet& kv : _value._map->value) {
                     r = hash_mix(r, kv.first.hash(), kv.second.hash());
                 }
                 return r;
             }
         case tag_type::bstring:
-            return std::hash<bstring>{}(*_value._bstring);
+            return std::hash<bstring>{}(_value._bstring->value);
         default:
             hi_no_default();
         }
@@ -868,19 +873,19 @@ public:
         }
     }
 
-    constexpr void push_back(datum const& rhs)
+    void push_back(datum const& rhs)
     {
-        if (auto *v = get_if<vector_type>(*this)) {
-            return v->push_back(rhs);
+        if (_tag == tag_type::vector) {
+            return unshare_box(_value._vector)->value.push_back(rhs);
         } else {
             throw std::domain_error(std::format("Can not evaluate {}.push_back({})", repr(*this), repr(rhs)));
         }
     }
 
-    constexpr void push_back(datum&& rhs)
+    void push_back(datum&& rhs)
     {
-        if (auto *v = get_if<vector_type>(*this)) {
-            return v->push_back(std::move(rhs));
+        if (_tag == tag_type::vector) {
+            return unshare_box(_value._vector)->value.push_back(std::move(rhs));
         } else {
             throw std::domain_error(std::format("Can not evaluate {}.push_back({})", repr(*this), repr(rhs)));
         }
@@ -892,22 +897,23 @@ public:
         push_back(datum{std::forward<Arg>(arg)});
     }
 
-    constexpr void pop_back()
+    void pop_back()
     {
-        if (auto *v = get_if<vector_type>(*this)) {
-            if (v->empty()) {
+        if (_tag == tag_type::vector) {
+            auto& v = unshare_box(_value._vector)->value;
+            if (v.empty()) {
                 throw std::domain_error(std::format("Empty vector {}.pop_back()", repr(*this)));
             }
-            return v->pop_back();
+            return v.pop_back();
         } else {
             throw std::domain_error(std::format("Can not evaluate {}.pop_back()", repr(*this)));
         }
     }
 
-    [[nodiscard]] constexpr bool contains(datum const& rhs) const
+    [[nodiscard]] bool contains(datum const& rhs) const
     {
-        if (auto *m = get_if<map_type>(*this)) {
-            return m->contains(rhs);
+        if (_tag == tag_type::map) {
+            return find_member(rhs) != nullptr;
         } else {
             throw std::domain_error(std::format("Can not evaluate {}.contains({})", repr(*this), repr(rhs)));
         }
@@ -922,16 +928,14 @@ public:
     [[nodiscard]] std::vector<datum *> find(jsonpath const& path) noexcept
     {
         auto r = std::vector<datum *>{};
-        find(path.cbegin(), path.cend(), r);
+        find(*this, path.cbegin(), path.cend(), r);
         return r;
     }
 
     [[nodiscard]] std::vector<datum const *> find(jsonpath const& path) const noexcept
     {
-        auto tmp = std::vector<datum *>{};
-        const_cast<datum *>(this)->find(path.cbegin(), path.cend(), tmp);
         auto r = std::vector<datum const *>{};
-        std::copy(tmp.begin(), tmp.end(), std::back_inserter(r));
+        find(*this, path.cbegin(), path.cend(), r);
         return r;
     }
 
@@ -978,7 +982,7 @@ public:
     [[nodiscard]] datum const *find_one(jsonpath const& path) const noexcept
     {
         hi_axiom(path.is_singular());
-        return const_cast<datum *>(this)->find_one(path.cbegin(), path.cend(), false);
+        return find_one(path.cbegin(), path.cend());
     }
 
     [[nodiscard]] datum const& operator[](datum const& rhs) const
@@ -997,13 +1001,12 @@ public:
             return v[index];
 
         } else if (holds_alternative<map_type>(*this)) {
-            hilet& m = get<map_type>(*this);
-            hilet it = m.find(rhs);
-            if (it == m.end()) {
+            hilet *item = find_member(rhs);
+            if (item == nullptr) {
                 throw std::overflow_error(std::format("Key {} not found in map", repr(rhs)));
             }
 
-            return it->second;
+            return item->second;
 
         } else {
             throw std::domain_error(std::format("Can not evaluate {}[{}]", repr(*this), repr(rhs)));
@@ -1566,11 +1569,11 @@ public:
         case tag_type::flow_continue:
             return "continue";
         case tag_type::string:
-            return std::format("\"{}\"", *rhs._value._string);
+            return std::format("\"{}\"", rhs._value._string->value);
         case tag_type::vector:
             {
                 auto r = std::string{"["};
-                for (hilet& item : *rhs._value._vector) {
+                for (hilet& item : rhs._value._vector->value) {
                     r += repr(item);
                     r += ',';
                 }
@@ -1580,7 +1583,7 @@ public:
         case tag_type::map:
             {
                 auto r = std::string{"{"};
-                for (hilet& item : *rhs._value._map) {
+                for (hilet& item : rhs._value._map->value) {
                     r += repr(item.first);
                     r += ':';
                     r += repr(item.second);
@@ -1590,7 +1593,7 @@ public:
                 return r;
             };
         case tag_type::bstring:
-            return base64::encode(*rhs._value._bstring);
+            return base64::encode(rhs._value._bstring->value);
         default:
             hi_no_default();
         }
@@ -1684,13 +1687,13 @@ public:
         } else if constexpr (std::is_same_v<T, std::chrono::year_month_day>) {
             return rhs._value._year_month_day;
         } else if constexpr (std::is_same_v<T, std::string>) {
-            return *rhs._value._string;
+            return rhs._value._string->value;
         } else if constexpr (std::is_same_v<T, vector_type>) {
-            return *rhs._value._vector;
+            return rhs._value._vector->value;
         } else if constexpr (std::is_same_v<T, map_type>) {
-            return *rhs._value._map;
+            return rhs._value._map->value;
         } else if constexpr (std::is_same_v<T, bstring>) {
-            return *rhs._value._bstring;
+            return rhs._value._bstring->value;
         } else {
             hi_static_no_default();
         }
@@ -1700,6 +1703,11 @@ public:
      *
      * It is undefined behavior if the type does not match the stored value.
      *
+     * A string, vector, map or bstring that is shared with copies of the datum
+     * is copied first. Since the returned reference may be used to modify the
+     * value at any time, the value will no longer be shared by later copies
+     * of the datum.
+     *
      * @tparam T Type to check, must be one of: `bool`, `double`, `long long`, `std::chrono::year_month_day`
      * @param rhs The datum to get the value from.
      * @return A copy of the value in the datum.
@@ -1717,13 +1725,13 @@ public:
         } else if constexpr (std::is_same_v<T, std::chrono::year_month_day>) {
             return rhs._value._year_month_day;
         } else if constexpr (std::is_same_v<T, std::string>) {
-            return *rhs._value._string;
+            return leak_box(rhs._value._string)->value;
         } else if constexpr (std::is_same_v<T, vector_type>) {
-            return *rhs._value._vector;
+            return leak_box(rhs._value._vector)->value;
         } else if constexpr (std::is_same_v<T, map_type>) {
-            return *rhs._value._map;
+            return leak_box(rhs._value._map)->value;
         } else if constexpr (std::is_same_v<T, bstring>) {
-            return *rhs._value._bstring;
+            return leak_box(rhs._value._bstring)->value;
         } else {
             hi_static_no_default();
         }
@@ -1800,7 +1808,7 @@ public:
     template<typename T>
     [[nodiscard]] friend T const *get_if(datum const& rhs, jsonpath const& path) noexcept
     {
-        if (auto *value = const_cast<datum&>(rhs).find_one(path)) {
+        if (auto *value = rhs.find_one(path)) {
             if (holds_alternative<T>(*value)) {
                 return &get<T>(*value);
             } else {
@@ -1811,7 +1819,30 @@ public:
         }
     }
 
+    /** Check if an index may be kept for the value of this datum.
+     *
+     * A vector or map, including its children, may only be modified through a
+     * reference when its count is zero. A reference to a child can only be
+     * obtained after the count of its parent has become zero. Other modifications
+     * go through `unshare_box()` which removes the indices.
+     *
+     * A value that is not indexable is also not shared with copies of the datum.
+     *
+     * @pre The datum must hold a vector or map.
+     */
+    [[nodiscard]] bool is_indexable() const noexcept
+    {
+        hi_axiom(_tag == tag_type::vector or _tag == tag_type::map);
+        if (_tag == tag_type::vector) {
+            return _value._vector->count.load(std::memory_order::relaxed) != 0;
+        } else {
+            return _value._map->count.load(std::memory_order::relaxed) != 0;
+        }
+    }
+
 private:
+    friend class compiled_jsonpath;
+
     enum class tag_type : signed char {
         // scalars are detected by: `std::to_underlying(tag_type) >= 0`
         monostate = 0,
@@ -1830,25 +1861,245 @@ private:
         bstring = -5
     };
 
+    /** A reference counted box holding a string, vector, map or bstring.
+     *
+     * Copies of a datum share the same box, the value is copied when one of
+     * the datums is modified.
+     *
+     * A count of zero means that a mutable reference to the value has been
+     * handed out. Such a box is owned by a single datum and is copied
+     * when the datum is copied.
+     */
+    template<typename T>
+    struct box {
+        std::atomic<size_t> count = 1;
+        T value;
+
+        template<typename... Args>
+        explicit box(Args&&...args) noexcept : value(std::forward<Args>(args)...)
+        {
+        }
+    };
+
+    /** An index of the string keys of a map.
+     *
+     * This is a flat hash table using open addressing with linear probing.
+     * The slots point to the keys and items in the std::map, which are
+     * stable while the map is not modified.
+     */
+    class map_index {
+    public:
+        using item_type = map_type::value_type;
+
+        explicit map_index(map_type const& map) noexcept : _slots(std::bit_ceil(map.size() * 2))
+        {
+            hilet mask = _slots.size() - 1;
+            for (hilet& item : map) {
+                if (item.first._tag == tag_type::string) {
+                    hilet key = std::string_view{item.first._value._string->value};
+                    hilet hash = key_hash(key);
+                    auto i = hash & mask;
+                    while (_slots[i].item != nullptr) {
+                        i = (i + 1) & mask;
+                    }
+                    _slots[i] = {hash, key, std::addressof(item)};
+                }
+            }
+        }
+
+        [[nodiscard]] item_type const *find(std::string_view key, size_t hash) const noexcept
+        {
+            hilet mask = _slots.size() - 1;
+            for (auto i = hash & mask; _slots[i].item != nullptr; i = (i + 1) & mask) {
+                if (_slots[i].hash == hash and _slots[i].key == key) {
+                    return _slots[i].item;
+                }
+            }
+            return nullptr;
+        }
+
+    private:
+        struct slot_type {
+            size_t hash = 0;
+            std::string_view key = {};
+            item_type const *item = nullptr;
+        };
+
+        std::vector<slot_type> _slots;
+    };
+
+    /** An index of the descendants of a vector or map, by the key of the member that holds them.
+     *
+     * For each key, the values are in the same order as found by `datum::find()`
+     * with the path `$..key`.
+     */
+    class key_index {
+    public:
+        template<typename Container>
+        explicit key_index(Container const& container) noexcept
+        {
+            add_children(container);
+        }
+
+        [[nodiscard]] std::span<datum const *const> find(std::string_view key) const noexcept
+        {
+            if (hilet it = _values.find(key); it != _values.end()) {
+                return it->second;
+            } else {
+                return {};
+            }
+        }
+
+    private:
+        std::unordered_map<std::string_view, std::vector<datum const *>> _values;
+
+        void add_members(datum const& node) noexcept
+        {
+            if (node._tag == tag_type::map) {
+                for (hilet& item : node._value._map->value) {
+                    if (item.first._tag == tag_type::string) {
+                        _values[item.first._value._string->value].push_back(std::addressof(item.second));
+                    }
+                }
+            }
+        }
+
+        void add_children(vector_type const& vector) noexcept
+        {
+            for (hilet& item : vector) {
+                add(item);
+            }
+        }
+
+        void add_children(map_type const& map) noexcept
+        {
+            for (hilet& item : map) {
+                add(item.second);
+            }
+        }
+
+        void add(datum const& node) noexcept
+        {
+            add_members(node);
+            if (node._tag == tag_type::vector) {
+                add_children(node._value._vector->value);
+            } else if (node._tag == tag_type::map) {
+                add_children(node._value._map->value);
+            }
+        }
+    };
+
+    /** Get an index, create it when it does not exist yet.
+     *
+     * The index may be created by multiple threads that are reading the same
+     * shared value.
+     */
+    template<typename Index, typename Value>
+    [[nodiscard]] static Index const& get_or_make_index(std::atomic<Index const *>& index, Value const& value) noexcept
+    {
+        if (auto ptr = index.load(std::memory_order::acquire)) {
+            return *ptr;
+        }
+
+        auto *new_index = new Index{value};
+        auto *expected = static_cast<Index const *>(nullptr);
+        if (index.compare_exchange_strong(expected, new_index, std::memory_order::acq_rel)) {
+            return *new_index;
+        } else {
+            // Another thread created the index at the same time.
+            delete new_index;
+            return *expected;
+        }
+    }
+
+    /** A box holding a vector or map, with an index of its descendants.
+     */
+    template<typename T>
+    struct container_box : box<T> {
+        /** The index is created by a `compiled_jsonpath` that searches descendants by key.
+         */
+        mutable std::atomic<key_index const *> descendants = nullptr;
+
+        using box<T>::box;
+
+        ~container_box()
+        {
+            delete descendants.load(std::memory_order::relaxed);
+        }
+
+        [[nodiscard]] key_index const& get_descendants() const noexcept
+        {
+            return get_or_make_index(descendants, this->value);
+        }
+
+        /** Remove the indices, before the value is modified.
+         */
+        void reset_indices() noexcept
+        {
+            delete descendants.exchange(nullptr, std::memory_order::relaxed);
+        }
+    };
+
+    /** A box holding a map, with an index for looking up string keys.
+     */
+    struct map_box : container_box<map_type> {
+        /** The index is created when a key is looked up in a large map.
+         */
+        mutable std::atomic<map_index const *> index = nullptr;
+
+        using container_box<map_type>::container_box;
+
+        ~map_box()
+        {
+            delete index.load(std::memory_order::relaxed);
+        }
+
+        [[nodiscard]] map_index const& get_index() const noexcept
+        {
+            return get_or_make_index(index, value);
+        }
+
+        void reset_indices() noexcept
+        {
+            container_box<map_type>::reset_indices();
+            delete index.exchange(nullptr, std::memory_order::relaxed);
+        }
+    };
+
+    using string_box = box<std::string>;
+    using vector_box = container_box<vector_type>;
+    using bstring_box = box<bstring>;
+
+    /** Maps with at least this number of items use an index to look up string keys.
+     */
+    constexpr static size_t map_index_threshold = 8;
+
+    /** The hash of a string key, as used by the index of a map.
+     */
+    [[nodiscard]] static size_t key_hash(std::string_view key) noexcept
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+
     tag_type _tag = tag_type::monostate;
     union value_type {
         double _double;
         long long _long_long;
         bool _bool;
         std::chrono::year_month_day _year_month_day;
-        std::string *_string;
-        vector_type *_vector;
-        map_type *_map;
-        bstring *_bstring;
+        string_box *_string;
+        vector_box *_vector;
+        map_box *_map;
+        bstring_box *_bstring;
 
         constexpr value_type(numeric_integral auto value) noexcept : _long_long(narrow_cast<long long>(value)) {}
         constexpr value_type(std::floating_point auto value) noexcept : _double(narrow_cast<double>(value)) {}
         constexpr value_type(bool value) noexcept : _bool(value) {}
         constexpr value_type(std::chrono::year_month_day value) noexcept : _year_month_day(value) {}
-        constexpr value_type(std::string *value) noexcept : _string(value) {}
-        constexpr value_type(vector_type *value) noexcept : _vector(value) {}
-        constexpr value_type(map_type *value) noexcept : _map(value) {}
-        constexpr value_type(bstring *value) noexcept : _bstring(value) {}
+        constexpr value_type(string_box *value) noexcept : _string(value) {}
+        constexpr value_type(vector_box *value) noexcept : _vector(value) {}
+        constexpr value_type(map_box *value) noexcept : _map(value) {}
+        constexpr value_type(bstring_box *value) noexcept : _bstring(value) {}
     };
 
     value_type _value;
@@ -1863,21 +2114,75 @@ private:
         return std::to_underlying(_tag) < 0;
     }
 
+    /** Share a box with a copy of a datum.
+     *
+     * @return The shared box, or a copy when the box may not be shared.
+     */
+    template<typename Box>
+    [[nodiscard]] static Box *share_box(Box *box) noexcept
+    {
+        if (box->count.load(std::memory_order::relaxed) == 0) {
+            return new Box{box->value};
+        }
+
+        box->count.fetch_add(1, std::memory_order::relaxed);
+        return box;
+    }
+
+    template<typename Box>
+    static void release_box(Box *box) noexcept
+    {
+        if (box->count.load(std::memory_order::relaxed) == 0 or box->count.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+            delete box;
+        }
+    }
+
+    /** Make sure that a box is owned by a single datum, before it is modified.
+     *
+     * @param[in,out] box The box, which is replaced by a copy when it is shared.
+     * @return The box.
+     */
+    template<typename Box>
+    static Box *unshare_box(Box *& box) noexcept
+    {
+        if (box->count.load(std::memory_order::acquire) > 1) {
+            auto *copy = new Box{box->value};
+            release_box(box);
+            box = copy;
+        }
+
+        if constexpr (not std::is_same_v<Box, string_box> and not std::is_same_v<Box, bstring_box>) {
+            box->reset_indices();
+        }
+        return box;
+    }
+
+    /** Unshare a box, and stop sharing it with future copies.
+     *
+     * This is needed when a mutable reference to the value is handed out.
+     */
+    template<typename Box>
+    static Box *leak_box(Box *& box) noexcept
+    {
+        unshare_box(box)->count.store(0, std::memory_order::relaxed);
+        return box;
+    }
+
     hi_no_inline void copy_pointer(datum const& other) noexcept
     {
         hi_axiom(other.is_pointer());
         switch (other._tag) {
         case tag_type::string:
-            _value._string = new std::string{*other._value._string};
+            _value._string = share_box(other._value._string);
             return;
         case tag_type::vector:
-            _value._vector = new vector_type{*other._value._vector};
+            _value._vector = share_box(other._value._vector);
             return;
         case tag_type::map:
-            _value._map = new map_type{*other._value._map};
+            _value._map = share_box(other._value._map);
             return;
         case tag_type::bstring:
-            _value._bstring = new bstring{*other._value._bstring};
+            _value._bstring = share_box(other._value._bstring);
             return;
         default:
             hi_no_default();
@@ -1889,16 +2194,16 @@ private:
         hi_axiom(is_pointer());
         switch (_tag) {
         case tag_type::string:
-            delete _value._string;
+            release_box(_value._string);
             return;
         case tag_type::vector:
-            delete _value._vector;
+            release_box(_value._vector);
             return;
         case tag_type::map:
-            delete _value._map;
+            release_box(_value._map);
             return;
         case tag_type::bstring:
-            delete _value._bstring;
+            release_box(_value._bstring);
             return;
         default:
             hi_no_default();
@@ -1912,109 +2217,193 @@ private:
         }
     }
 
-    void find_wildcard(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<datum *>& r) noexcept
+    /** Find an item in a map.
+     *
+     * @pre The datum must hold a map.
+     * @param key The key of the item.
+     * @return A pointer to the item, or nullptr if not found.
+     */
+    [[nodiscard]] map_type::value_type const *find_member(datum const& key) const noexcept
     {
-        if (auto vector = get_if<datum::vector_type>(*this)) {
+        if (key._tag == tag_type::string) {
+            return find_member(key, key_hash(key._value._string->value));
+        }
+
+        hi_axiom(_tag == tag_type::map);
+        hilet& map = _value._map->value;
+        hilet it = map.find(key);
+        return it != map.end() ? std::addressof(*it) : nullptr;
+    }
+
+    /** Find an item in a map by a string key.
+     *
+     * @pre The datum must hold a map.
+     * @param key The key of the item, a string.
+     * @param hash The `key_hash()` of the key.
+     * @return A pointer to the item, or nullptr if not found.
+     */
+    [[nodiscard]] map_type::value_type const *find_member(datum const& key, size_t hash) const noexcept
+    {
+        hi_axiom(_tag == tag_type::map);
+        hi_axiom(key._tag == tag_type::string);
+
+        hilet& map = _value._map->value;
+        if (map.size() >= map_index_threshold and is_indexable()) {
+            return _value._map->get_index().find(key._value._string->value, hash);
+        }
+
+        // Comparing strings directly is faster than searching the tree of a small map.
+        hilet& key_string = key._value._string->value;
+        for (hilet& item : map) {
+            if (item.first._tag == tag_type::string and item.first._value._string->value == key_string) {
+                return std::addressof(item);
+            }
+        }
+        return nullptr;
+    }
+
+    /** Get the index of the descendants of this datum.
+     *
+     * @return The index, or nullptr if this datum does not hold a vector or map that
+     *         can be indexed.
+     */
+    [[nodiscard]] key_index const *descendants() const noexcept
+    {
+        if (_tag == tag_type::vector and is_indexable()) {
+            return std::addressof(_value._vector->get_descendants());
+        } else if (_tag == tag_type::map and is_indexable()) {
+            return std::addressof(_value._map->get_descendants());
+        } else {
+            return nullptr;
+        }
+    }
+
+    template<typename Self>
+    static void find_wildcard(Self& self, jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<Self *>& r) noexcept
+    {
+        if (auto vector = get_if<datum::vector_type>(self)) {
             for (auto& item : *vector) {
-                item.find(it + 1, it_end, r);
+                find(item, it + 1, it_end, r);
             }
 
-        } else if (auto map = get_if<datum::map_type>(*this)) {
+        } else if (auto map = get_if<datum::map_type>(self)) {
             for (auto& item : *map) {
-                item.second.find(it + 1, it_end, r);
+                find(item.second, it + 1, it_end, r);
             }
         }
     }
 
-    void find_descend(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<datum *>& r) noexcept
+    template<typename Self>
+    static void find_descend(Self& self, jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<Self *>& r) noexcept
     {
-        this->find(it + 1, it_end, r);
+        find(self, it + 1, it_end, r);
 
-        if (auto vector = get_if<datum::vector_type>(*this)) {
+        if (auto vector = get_if<datum::vector_type>(self)) {
             for (auto& item : *vector) {
-                item.find(it, it_end, r);
+                find(item, it, it_end, r);
             }
 
-        } else if (auto map = get_if<datum::map_type>(*this)) {
+        } else if (auto map = get_if<datum::map_type>(self)) {
             for (auto& item : *map) {
-                item.second.find(it, it_end, r);
+                find(item.second, it, it_end, r);
             }
         }
     }
 
-    void find_indices(
+    template<typename Self>
+    static void find_indices(
+        Self& self,
         jsonpath::indices const& indices,
         jsonpath::const_iterator it,
         jsonpath::const_iterator it_end,
-        std::vector<datum *>& r) noexcept
+        std::vector<Self *>& r) noexcept
     {
-        if (auto vector = get_if<datum::vector_type>(*this)) {
+        if (auto vector = get_if<datum::vector_type>(self)) {
             for (hilet index : indices.filter(ssize(*vector))) {
-                (*vector)[index].find(it + 1, it_end, r);
+                find((*vector)[index], it + 1, it_end, r);
             }
         }
     }
 
-    void find_names(
+    template<typename Self>
+    static void find_names(
+        Self& self,
         jsonpath::names const& names,
         jsonpath::const_iterator it,
         jsonpath::const_iterator it_end,
-        std::vector<datum *>& r) noexcept
+        std::vector<Self *>& r) noexcept
     {
-        if (auto map = get_if<datum::map_type>(*this)) {
+        if constexpr (std::is_const_v<Self>) {
+            if (self._tag == tag_type::map) {
+                for (hilet& name : names) {
+                    if (hilet *item = self.find_member(datum{name})) {
+                        find(item->second, it + 1, it_end, r);
+                    }
+                }
+            }
+
+        } else if (auto map = get_if<datum::map_type>(self)) {
             for (hilet& name : names) {
                 hilet name_ = datum{name};
                 auto jt = map->find(name_);
                 if (jt != map->cend()) {
-                    jt->second.find(it + 1, it_end, r);
+                    find(jt->second, it + 1, it_end, r);
                 }
             }
         }
     }
 
-    void find_slice(
+    template<typename Self>
+    static void find_slice(
+        Self& self,
         jsonpath::slice const& slice,
         jsonpath::const_iterator it,
         jsonpath::const_iterator it_end,
-        std::vector<datum *>& r) noexcept
+        std::vector<Self *>& r) noexcept
     {
-        if (auto vector = get_if<datum::vector_type>(*this)) {
+        if (auto vector = get_if<datum::vector_type>(self)) {
             hilet first = slice.begin(vector->size());
             hilet last = slice.end(vector->size());
 
             for (auto index = first; index != last; index += slice.step) {
                 if (index >= 0 and index < vector->size()) {
-                    (*this)[index].find(it + 1, it_end, r);
+                    find((*vector)[index], it + 1, it_end, r);
                 }
             }
         }
     }
 
-    void find(jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<datum *>& r) noexcept
+    /** Find values by path.
+     *
+     * When @a Self is not const, the values are found through mutable references
+     * and will no longer be shared with copies of the datum.
+     */
+    template<typename Self>
+    static void find(Self& self, jsonpath::const_iterator it, jsonpath::const_iterator it_end, std::vector<Self *>& r) noexcept
     {
         if (it == it_end) {
-            r.push_back(this);
+            r.push_back(std::addressof(self));
 
         } else if (std::holds_alternative<jsonpath::root>(*it)) {
-            find(it + 1, it_end, r);
+            find(self, it + 1, it_end, r);
 
         } else if (std::holds_alternative<jsonpath::current>(*it)) {
-            find(it + 1, it_end, r);
+            find(self, it + 1, it_end, r);
 
         } else if (std::holds_alternative<jsonpath::wildcard>(*it)) {
-            find_wildcard(it, it_end, r);
+            find_wildcard(self, it, it_end, r);
 
         } else if (std::holds_alternative<jsonpath::descend>(*it)) {
-            find_descend(it, it_end, r);
+            find_descend(self, it, it_end, r);
 
         } else if (auto indices = std::get_if<jsonpath::indices>(&*it)) {
-            find_indices(*indices, it, it_end, r);
+            find_indices(self, *indices, it, it_end, r);
 
         } else if (auto names = std::get_if<jsonpath::names>(&*it)) {
-            find_names(*names, it, it_end, r);
+            find_names(self, *names, it, it_end, r);
 
         } else if (auto slice = std::get_if<jsonpath::slice>(&*it)) {
-            find_slice(*slice, it, it_end, r);
+            find_slice(self, *slice, it, it_end, r);
 
         } else {
             hi_no_default();
@@ -2284,6 +2673,40 @@ private:
             hi_no_default();
         }
     }
+
+    [[nodiscard]] datum const *find_one(jsonpath::const_iterator it, jsonpath::const_iterator it_end) const noexcept
+    {
+        if (it == it_end) {
+            return this;
+
+        } else if (std::holds_alternative<jsonpath::root>(*it)) {
+            return find_one(it + 1, it_end);
+
+        } else if (std::holds_alternative<jsonpath::current>(*it)) {
+            return find_one(it + 1, it_end);
+
+        } else if (hilet *indices = std::get_if<jsonpath::indices>(&*it)) {
+            hi_axiom(indices->size() == 1);
+            if (hilet *vector = get_if<vector_type>(*this)) {
+                hilet index = indices->front();
+                return index >= 0 and index < ssize(*vector) ? (*vector)[index].find_one(it + 1, it_end) : nullptr;
+            } else {
+                return nullptr;
+            }
+
+        } else if (hilet *names = std::get_if<jsonpath::names>(&*it)) {
+            hi_axiom(names->size() == 1);
+            if (_tag == tag_type::map) {
+                hilet *item = find_member(datum{names->front()});
+                return item != nullptr ? item->second.find_one(it + 1, it_end) : nullptr;
+            } else {
+                return nullptr;
+            }
+
+        } else {
+            hi_no_default();
+        }
+    }
 };
 
 }} // namespace hi::v1
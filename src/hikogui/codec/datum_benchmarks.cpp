@@ -0,0 +1,118 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "datum.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a list of records, each a map with a few string keys.
+ */
+[[nodiscard]] datum make_records()
+{
+    auto r = datum::vector_type{};
+    for (auto i = 0; i != 10'000; ++i) {
+        auto record = datum::make_map();
+        record["id"] = i;
+        record["name"] = std::format("item {}", i);
+        record["tags"] = datum::make_vector("red", "green", "blue");
+        for (auto j = 0; j != 16; ++j) {
+            record[std::format("field{}", j)] = i * j;
+        }
+        r.push_back(std::move(record));
+    }
+    return datum{std::move(r)};
+}
+
+/** Copy the value of a datum, as was done before values were shared.
+ */
+[[nodiscard]] datum deep_copy(datum const& rhs)
+{
+    if (hilet *vector = get_if<datum::vector_type>(rhs)) {
+        auto r = datum::vector_type{};
+        r.reserve(vector->size());
+        for (hilet& item : *vector) {
+            r.push_back(deep_copy(item));
+        }
+        return datum{std::move(r)};
+
+    } else if (hilet *map = get_if<datum::map_type>(rhs)) {
+        auto r = datum::map_type{};
+        for (hilet& [key, value] : *map) {
+            r.emplace(deep_copy(key), deep_copy(value));
+        }
+        return datum{std::move(r)};
+
+    } else if (hilet *string = get_if<std::string>(rhs)) {
+        return datum{*string};
+
+    } else {
+        return rhs;
+    }
+}
+
+} // namespace
+
+TEST(datum_benchmarks, copy)
+{
+    hilet records = make_records();
+
+    auto size = 0_uz;
+    hilet deep_rate = benchmark_rate([&] {
+        hilet copy = deep_copy(records);
+        size = copy.size();
+    });
+    ASSERT_EQ(size, 10'000);
+
+    hilet shared_rate = benchmark_rate([&] {
+        hilet copy = records;
+        size = copy.size();
+    });
+    ASSERT_EQ(size, 10'000);
+
+    benchmark_report("datum deep copy 10k records", deep_rate, "copies/s");
+    benchmark_report("datum shared copy 10k records", shared_rate, "copies/s");
+}
+
+TEST(datum_benchmarks, lookup)
+{
+    // A large object, like a configuration or a lookup table.
+    auto object = datum::make_map();
+    auto keys = std::vector<datum>{};
+    for (auto i = 0; i != 256; ++i) {
+        keys.emplace_back(std::format("field{}", i));
+        object[keys.back()] = i;
+    }
+    hilet shared_object = object;
+
+    auto sum = 0ll;
+    hilet tree_rate = benchmark_rate([&] {
+        sum = 0;
+        hilet& map = get<datum::map_type>(shared_object);
+        for (hilet& key : keys) {
+            sum += get<long long>(map.find(key)->second);
+        }
+    });
+    hilet tree_sum = sum;
+
+    hilet index_rate = benchmark_rate([&] {
+        sum = 0;
+        for (hilet& key : keys) {
+            sum += get<long long>(shared_object[key]);
+        }
+    });
+    ASSERT_EQ(sum, tree_sum);
+
+    hilet lookups = static_cast<double>(keys.size()) / 1'000'000.0;
+    benchmark_report("datum std::map lookup 256 keys", tree_rate * lookups, "M lookups/s");
+    benchmark_report("datum indexed lookup 256 keys", index_rate * lookups, "M lookups/s");
+}
@@ -4,6 +4,8 @@
 
 #include "datum.hpp"
 #include "JSON.hpp"
+#include "BON8.hpp"
+#include "BON8_view.hpp"
 #include "../macros.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
@@ -282,3 +284,106 @@ TEST(datum, remove2)
     ASSERT_EQ(size(bookstore_copy["store"]["book"]), 3);
     ASSERT_EQ(bookstore_copy["store"]["book"][1]["title"], "Moby Dick");
 }
+
+TEST(datum, copy_on_write)
+{
+    auto a = datum::make_vector(1, 2, 3);
+    auto b = a;
+    ASSERT_EQ(a, b);
+
+    b.push_back(4);
+    ASSERT_EQ(size(a), 3);
+    ASSERT_EQ(size(b), 4);
+
+    auto c = b;
+    c.pop_back();
+    ASSERT_EQ(size(b), 4);
+    ASSERT_EQ(size(c), 3);
+    ASSERT_EQ(a, c);
+
+    // Modify the copy through a path, this should not change the original.
+    auto bookstore_copy = bookstore;
+    *bookstore_copy.find_one(jsonpath("$.store.bicycle.color")) = "blue";
+    ASSERT_EQ(bookstore["store"]["bicycle"]["color"], "red");
+    ASSERT_EQ(bookstore_copy["store"]["bicycle"]["color"], "blue");
+}
+
+TEST(datum, reference_to_shared_value)
+{
+    auto a = datum{"foo"};
+    auto b = a;
+
+    // A reference into a datum only modifies that datum, also when the
+    // reference is used after the datum was copied.
+    auto& a_string = get<std::string>(a);
+    a_string = "bar";
+    auto c = a;
+    a_string = "baz";
+
+    ASSERT_EQ(a, "baz");
+    ASSERT_EQ(b, "foo");
+    ASSERT_EQ(c, "bar");
+}
+
+TEST(datum, large_map)
+{
+    auto m = datum::make_map();
+    for (auto i = 0; i != 100; ++i) {
+        m[std::format("key{}", i)] = i;
+    }
+    m[42] = "integer key";
+
+    hilet c = m;
+    for (auto i = 0; i != 100; ++i) {
+        ASSERT_EQ(c[std::format("key{}", i)], i);
+        ASSERT_TRUE(c.contains(std::format("key{}", i)));
+    }
+    ASSERT_EQ(c[42], "integer key");
+    ASSERT_FALSE(c.contains("key100"));
+    ASSERT_THROW((void)(c["key100"]), std::overflow_error);
+    ASSERT_EQ(*c.find_one(jsonpath("$.key7")), 7);
+
+    // Modifying the map after a lookup should not use a stale index.
+    auto d = c;
+    d["key100"] = 100;
+    d.remove(jsonpath("$.key7"));
+    ASSERT_EQ(d["key100"], 100);
+    ASSERT_FALSE(d.contains("key7"));
+    ASSERT_TRUE(c.contains("key7"));
+    ASSERT_FALSE(c.contains("key100"));
+}
+
+TEST(datum, shared_after_decode)
+{
+    auto text = std::string{"{"};
+    for (auto i = 0; i != 100; ++i) {
+        text += std::format(R"("key{}": [{}, "value{}"], )", i, i, i);
+    }
+    text += R"("last": {"nested": true}})";
+
+    auto check_shared = [](datum const& document) {
+        ASSERT_TRUE(document.is_indexable());
+        ASSERT_TRUE(document["key42"].is_indexable());
+        ASSERT_TRUE(document["last"].is_indexable());
+
+        // A copy shares the value with the decoded document, and can use its index.
+        hilet copy = document;
+        ASSERT_EQ(std::addressof(get<datum::map_type>(copy)), std::addressof(get<datum::map_type>(document)));
+        ASSERT_TRUE(copy.is_indexable());
+        ASSERT_EQ(copy["key42"][0], 42);
+        ASSERT_EQ(copy["key99"][1], "value99");
+        ASSERT_EQ(std::addressof(copy["key42"]), std::addressof(document["key42"]));
+    };
+
+    hilet json_document = parse_JSON(text);
+    check_shared(json_document);
+
+    hilet encoded = encode_BON8(json_document);
+    hilet BON8_document = decode_BON8(encoded);
+    ASSERT_EQ(BON8_document, json_document);
+    check_shared(BON8_document);
+
+    hilet view_document = static_cast<datum>(BON8_view{encoded});
+    ASSERT_EQ(view_document, json_document);
+    check_shared(view_document);
+}
@@ -0,0 +1,638 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../container/container.hpp"
+#include "../macros.hpp"
+#include "huffman.hpp"
+#include "inflate.hpp"
+#include "bit_writer.hpp"
+#include <span>
+#include <array>
+#include <vector>
+#include <bit>
+#include <algorithm>
+
+hi_export_module(hikogui.codec.deflate);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+/** The parameters of the match finder for a compression level.
+ *
+ * These are the same trade-offs as zlib makes for each level.
+ */
+struct deflate_level_parameters {
+    /** Use lazy matching, otherwise use greedy matching.
+     */
+    bool lazy;
+
+    /** Reduce the search by a factor of 4 when the previous match is at least this long.
+     */
+    uint16_t good_length;
+
+    /** Lazy: don't search for a better match when the previous match is at least this long.
+     *  Greedy: don't add the positions inside a match longer than this to the hash-chains.
+     */
+    uint16_t max_lazy;
+
+    /** Stop searching when a match of at least this length is found.
+     */
+    uint16_t nice_length;
+
+    /** The maximum number of hash-chain entries to check.
+     */
+    uint16_t max_chain;
+};
+
+constexpr auto deflate_levels = std::array<deflate_level_parameters, 10>{{
+    {false, 0, 0, 0, 0},
+    {false, 4, 4, 8, 4},
+    {false, 4, 5, 16, 8},
+    {false, 4, 6, 32, 32},
+    {true, 4, 4, 16, 16},
+    {true, 8, 16, 32, 32},
+    {true, 8, 16, 128, 128},
+    {true, 8, 32, 128, 256},
+    {true, 32, 128, 258, 1024},
+    {true, 32, 258, 258, 4096}}};
+
+/** The order in which the code-lengths of the code-length code are written.
+ */
+constexpr auto deflate_code_length_order = std::array<uint8_t, 19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+
+/** The literal/length symbol for each match length.
+ */
+constexpr auto deflate_length_symbols = []() {
+    auto r = std::array<uint16_t, deflate_max_match_length + 1>{};
+    for (auto code = 0_uz; code != deflate_length_codes.size(); ++code) {
+        hilet [base, extra_bits] = deflate_length_codes[code];
+        for (auto length = 0_uz; length != (1_uz << extra_bits) and base + length < r.size(); ++length) {
+            r[base + length] = narrow_cast<uint16_t>(257 + code);
+        }
+    }
+    // 258 has its own code without extra bits, instead of being the last value of code 284.
+    r[258] = 285;
+    return r;
+}();
+
+/** Get the distance symbol for a distance.
+ *
+ * @param distance The distance between 1 and 32768.
+ */
+[[nodiscard]] constexpr std::size_t deflate_distance_symbol(std::size_t distance) noexcept
+{
+    hi_axiom(distance >= 1 and distance <= 32768);
+
+    // Two symbols for each power-of-two, except for the first four.
+    hilet d = distance - 1;
+    if (d < 4) {
+        return d;
+    }
+    hilet msb = narrow_cast<std::size_t>(std::bit_width(d)) - 1;
+    return msb * 2 + ((d >> (msb - 1)) & 1);
+}
+
+/** The code-lengths of the fixed literal/length code.
+ */
+constexpr auto deflate_fixed_literal_lengths = []() {
+    auto r = std::array<uint8_t, 288>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+    }
+    return r;
+}();
+
+/** The code-lengths of the fixed distance code.
+ */
+constexpr auto deflate_fixed_distance_lengths = []() {
+    auto r = std::array<uint8_t, 30>{};
+    for (auto& length : r) {
+        length = 5;
+    }
+    return r;
+}();
+
+hi_inline std::vector<uint16_t> deflate_fixed_literal_codes = huffman_codes_from_lengths(deflate_fixed_literal_lengths);
+hi_inline std::vector<uint16_t> deflate_fixed_distance_codes = huffman_codes_from_lengths(deflate_fixed_distance_lengths);
+
+/** Compress data into a stream of deflate blocks.
+ *
+ * Matches are found with hash-chains over the complete input, which is kept
+ * in memory by the caller. Literals and matches are collected in a symbol
+ * buffer; when it is full a block is written using whichever of the stored,
+ * fixed-huffman or dynamic-huffman encodings is the smallest.
+ */
+class deflate_encoder {
+public:
+    /** Create a deflate encoder.
+     *
+     * @param writer The bit-writer to write the deflate stream to.
+     * @param bytes The data to compress.
+     * @param level The compression level between 0 (stored) and 9 (best compression).
+     */
+    deflate_encoder(bit_writer& writer, std::span<std::byte const> bytes, int level) noexcept :
+        _writer(writer), _bytes(bytes), _parameters(deflate_levels[std::clamp(level, 0, 9)])
+    {
+    }
+
+    /** Compress the data and write the deflate stream.
+     */
+    void encode()
+    {
+        if (_parameters.max_chain == 0) {
+            write_stored(0, _bytes.size(), true);
+            return;
+        }
+
+        _head.assign(hash_size, 0);
+        _prev.assign(window_size, 0);
+        _literals.reserve(block_symbols);
+        _distances.reserve(block_symbols);
+
+        if (_parameters.lazy) {
+            encode_lazy();
+        } else {
+            encode_greedy();
+        }
+        flush_block(true);
+    }
+
+private:
+    constexpr static std::size_t window_size = 0x8000;
+    constexpr static std::size_t window_mask = window_size - 1;
+    constexpr static std::size_t hash_bits = 15;
+    constexpr static std::size_t hash_size = 1_uz << hash_bits;
+    constexpr static std::size_t min_match_length = 3;
+
+    /** The number of symbols in a block.
+     */
+    constexpr static std::size_t block_symbols = 0x4000;
+
+    /** Matches of minimum length further away than this are more expensive than literals.
+     */
+    constexpr static std::size_t too_far = 4096;
+
+    constexpr static std::size_t max_stored_size = 0xffff;
+
+    struct match_type {
+        std::size_t length = 0;
+        std::size_t distance = 0;
+    };
+
+    bit_writer& _writer;
+    std::span<std::byte const> _bytes;
+    deflate_level_parameters _parameters;
+
+    /** The most recent position + 1 for each hash, zero if empty.
+     */
+    std::vector<uint32_t> _head;
+
+    /** The previous position + 1 with the same hash, indexed by position modulo window-size.
+     */
+    std::vector<uint32_t> _prev;
+
+    /** For each symbol in the current block, the literal or length.
+     */
+    std::vector<uint16_t> _literals;
+
+    /** For each symbol in the current block, the distance or zero for a literal.
+     */
+    std::vector<uint16_t> _distances;
+
+    std::array<std::size_t, 286> _literal_frequencies = {};
+    std::array<std::size_t, 30> _distance_frequencies = {};
+
+    /** The offset in the input of the start of the current block.
+     */
+    std::size_t _block_start = 0;
+
+    /** The number of input bytes covered by the symbols in the current block.
+     */
+    std::size_t _block_size = 0;
+
+    [[nodiscard]] std::size_t hash(std::size_t position) const noexcept
+    {
+        hilet p = _bytes.data() + position;
+        hilet value = std::to_integer<uint32_t>(p[0]) | std::to_integer<uint32_t>(p[1]) << 8 | std::to_integer<uint32_t>(p[2]) << 16;
+        return (value * uint32_t{0x9e37'79b1}) >> (32 - hash_bits);
+    }
+
+    /** Add a position to the hash-chains.
+     */
+    hi_force_inline void insert(std::size_t position) noexcept
+    {
+        if (position + min_match_length <= _bytes.size()) {
+            hilet h = hash(position);
+            _prev[position & window_mask] = _head[h];
+            _head[h] = narrow_cast<uint32_t>(position + 1);
+        }
+    }
+
+    /** The number of equal bytes at two positions.
+     */
+    [[nodiscard]] std::size_t match_length(std::size_t a, std::size_t b, std::size_t max_length) const noexcept
+    {
+        hilet pa = _bytes.data() + a;
+        hilet pb = _bytes.data() + b;
+
+        auto length = 0_uz;
+        for (; length + sizeof(uint64_t) <= max_length; length += sizeof(uint64_t)) {
+            if (hilet diff = load_le<uint64_t>(pa + length) ^ load_le<uint64_t>(pb + length)) {
+                return length + std::countr_zero(diff) / 8;
+            }
+        }
+        while (length < max_length and pa[length] == pb[length]) {
+            ++length;
+        }
+        return length;
+    }
+
+    /** Find the longest match for the data at a position.
+     *
+     * The position itself must not yet be inserted in the hash-chains.
+     *
+     * @param position The position in the input to find a match for.
+     * @param prev_length Only return matches longer than this.
+     * @return The longest match, or a length of zero if no match was found.
+     */
+    [[nodiscard]] match_type longest_match(std::size_t position, std::size_t prev_length) const noexcept
+    {
+        hilet max_length = std::min(deflate_max_match_length, _bytes.size() - position);
+        auto best_length = std::max(prev_length, min_match_length - 1);
+        if (best_length >= max_length) {
+            return {};
+        }
+
+        auto chain = prev_length >= _parameters.good_length ? _parameters.max_chain / 4u : _parameters.max_chain;
+        hilet limit = position > window_size ? position - window_size : 0_uz;
+        hilet data = _bytes.data();
+
+        auto r = match_type{};
+        for (auto candidate = _head[hash(position)]; candidate != 0 and chain != 0; --chain) {
+            hilet candidate_position = candidate - 1_uz;
+            if (candidate_position < limit) {
+                break;
+            }
+
+            // Quickly reject candidates which can't be longer than the best match.
+            if (data[candidate_position + best_length] == data[position + best_length] and
+                data[candidate_position] == data[position]) {
+                hilet length = match_length(candidate_position, position, max_length);
+                if (length > best_length) {
+                    best_length = length;
+                    r = {length, position - candidate_position};
+                    if (length >= _parameters.nice_length or length == max_length) {
+                        break;
+                    }
+                }
+            }
+
+            candidate = _prev[candidate_position & window_mask];
+        }
+
+        if (r.length == min_match_length and r.distance > too_far) {
+            return {};
+        }
+        return r;
+    }
+
+    void encode_greedy()
+    {
+        auto position = 0_uz;
+        while (position < _bytes.size()) {
+            hilet match = longest_match(position, 0);
+            if (match.length != 0) {
+                emit_match(match);
+                if (match.length <= _parameters.max_lazy) {
+                    for (hilet end = position + match.length; position != end; ++position) {
+                        insert(position);
+                    }
+                } else {
+                    insert(position);
+                    position += match.length;
+                }
+
+            } else {
+                insert(position);
+                emit_literal(position++);
+            }
+
+            if (_literals.size() == block_symbols) {
+                flush_block(false);
+            }
+        }
+    }
+
+    void encode_lazy()
+    {
+        // A match or literal at the previous position is pending while checking
+        // if there is a better match at the current position.
+        auto prev_available = false;
+        auto prev_match = match_type{};
+
+        auto position = 0_uz;
+        while (true) {
+            auto match = match_type{};
+            if (position < _bytes.size()) {
+                if (prev_match.length < _parameters.max_lazy) {
+                    match = longest_match(position, prev_match.length);
+                }
+                insert(position);
+            }
+
+            if (prev_available and prev_match.length != 0 and match.length <= prev_match.length) {
+                // The match at the previous position is the best, emit it.
+                emit_match(prev_match);
+                hilet end = position - 1 + prev_match.length;
+                while (++position < end) {
+                    insert(position);
+                }
+                prev_available = false;
+                prev_match = {};
+
+            } else {
+                if (prev_available) {
+                    emit_literal(position - 1);
+                }
+                if (position == _bytes.size()) {
+                    break;
+                }
+                prev_available = true;
+                prev_match = match;
+                ++position;
+            }
+
+            if (_literals.size() >= block_symbols) {
+                flush_block(false);
+            }
+        }
+    }
+
+    hi_force_inline void emit_literal(std::size_t position)
+    {
+        hilet literal = std::to_integer<uint8_t>(_bytes[position]);
+        _literals.push_back(literal);
+        _distances.push_back(0);
+        ++_literal_frequencies[literal];
+        ++_block_size;
+    }
+
+    hi_force_inline void emit_match(match_type match)
+    {
+        _literals.push_back(narrow_cast<uint16_t>(match.length));
+        _distances.push_back(narrow_cast<uint16_t>(match.distance));
+        ++_literal_frequencies[deflate_length_symbols[match.length]];
+        ++_distance_frequencies[deflate_distance_symbol(match.distance)];
+        _block_size += match.length;
+    }
+
+    /** Write the data in stored blocks.
+     *
+     * @param offset The offset in the input of the data.
+     * @param size The number of bytes to write.
+     * @param final Set BFINAL on the last block.
+     */
+    void write_stored(std::size_t offset, std::size_t size, bool final)
+    {
+        do {
+            hilet chunk_size = std::min(size, max_stored_size);
+            size -= chunk_size;
+
+            _writer.put(final and size == 0 ? 1 : 0, 1);
+            _writer.put(0, 2);
+            _writer.align();
+            _writer.put(chunk_size, 16);
+            _writer.put(chunk_size ^ 0xffff, 16);
+            _writer.put_bytes(_bytes.subspan(offset, chunk_size));
+            offset += chunk_size;
+        } while (size != 0);
+    }
+
+    /** Write the symbols of the current block.
+     */
+    void write_symbols(
+        std::span<uint8_t const> literal_lengths,
+        std::span<uint16_t const> literal_codes,
+        std::span<uint8_t const> distance_lengths,
+        std::span<uint16_t const> distance_codes)
+    {
+        for (auto i = 0_uz; i != _literals.size(); ++i) {
+            hilet value = _literals[i];
+            hilet distance = _distances[i];
+
+            if (distance == 0) {
+                _writer.put(literal_codes[value], literal_lengths[value]);
+
+            } else {
+                hilet length_symbol = deflate_length_symbols[value];
+                hilet [length_base, length_extra_bits] = deflate_length_codes[length_symbol - 257];
+                _writer.put(literal_codes[length_symbol], literal_lengths[length_symbol]);
+                _writer.put(value - length_base, length_extra_bits);
+
+                hilet distance_symbol = deflate_distance_symbol(distance);
+                hilet [distance_base, distance_extra_bits] = deflate_distance_codes[distance_symbol];
+                _writer.put(distance_codes[distance_symbol], distance_lengths[distance_symbol]);
+                _writer.put(distance - distance_base, distance_extra_bits);
+            }
+        }
+
+        _writer.put(literal_codes[256], literal_lengths[256]);
+    }
+
+    /** Run-length encode the code-lengths of the literal/length and distance codes.
+     *
+     * @param lengths The concatenated code-lengths.
+     * @return A list of code-length symbols and their extra-bits value.
+     */
+    [[nodiscard]] static std::vector<std::pair<uint8_t, uint8_t>> encode_lengths(std::span<uint8_t const> lengths)
+    {
+        auto r = std::vector<std::pair<uint8_t, uint8_t>>{};
+
+        auto i = 0_uz;
+        while (i != lengths.size()) {
+            hilet length = lengths[i];
+            auto run = 1_uz;
+            while (i + run != lengths.size() and lengths[i + run] == length) {
+                ++run;
+            }
+            i += run;
+
+            if (length == 0) {
+                for (; run >= 11; run -= std::min(run, 138_uz)) {
+                    r.emplace_back(18, narrow_cast<uint8_t>(std::min(run, 138_uz) - 11));
+                }
+                if (run >= 3) {
+                    r.emplace_back(17, narrow_cast<uint8_t>(run - 3));
+                    run = 0;
+                }
+
+            } else {
+                r.emplace_back(length, 0);
+                --run;
+                for (; run >= 3; run -= std::min(run, 6_uz)) {
+                    r.emplace_back(16, narrow_cast<uint8_t>(std::min(run, 6_uz) - 3));
+                }
+            }
+
+            for (; run != 0; --run) {
+                r.emplace_back(length, 0);
+            }
+        }
+        return r;
+    }
+
+    /** Make sure at least two symbols are used.
+     *
+     * Some decoders reject incomplete codes, a code with two symbols is always complete.
+     */
+    static void ensure_two_symbols(std::span<std::size_t> frequencies) noexcept
+    {
+        auto nr_used = std::count_if(frequencies.begin(), frequencies.end(), [](hilet f) {
+            return f != 0;
+        });
+        for (; nr_used < 2; ++nr_used) {
+            *std::find(frequencies.begin(), frequencies.end(), 0_uz) = 1;
+        }
+    }
+
+    [[nodiscard]] static std::size_t
+    symbol_bits(std::span<std::size_t const> frequencies, std::span<uint8_t const> lengths) noexcept
+    {
+        auto r = 0_uz;
+        for (auto i = 0_uz; i != frequencies.size(); ++i) {
+            r += frequencies[i] * lengths[i];
+        }
+        return r;
+    }
+
+    /** Write the current block and start a new block.
+     *
+     * @param final This is the last block of the stream.
+     */
+    void flush_block(bool final)
+    {
+        ++_literal_frequencies[256];
+
+        // The size of the extra-bits is the same for fixed and dynamic blocks.
+        auto extra_bits = 0_uz;
+        for (auto i = 0_uz; i != deflate_length_codes.size(); ++i) {
+            extra_bits += _literal_frequencies[257 + i] * deflate_length_codes[i].extra_bits;
+        }
+        for (auto i = 0_uz; i != deflate_distance_codes.size(); ++i) {
+            extra_bits += _distance_frequencies[i] * deflate_distance_codes[i].extra_bits;
+        }
+
+        hilet fixed_bits = 3 + extra_bits + symbol_bits(_literal_frequencies, std::span{deflate_fixed_literal_lengths}.first(286)) +
+            symbol_bits(_distance_frequencies, deflate_fixed_distance_lengths);
+
+        // Build the dynamic codes.
+        auto literal_frequencies = _literal_frequencies;
+        auto distance_frequencies = _distance_frequencies;
+        ensure_two_symbols(literal_frequencies);
+        ensure_two_symbols(distance_frequencies);
+        hilet literal_lengths = huffman_lengths_from_frequencies(literal_frequencies, 15);
+        hilet distance_lengths = huffman_lengths_from_frequencies(distance_frequencies, 15);
+
+        auto nr_literal_lengths = literal_lengths.size();
+        while (literal_lengths[nr_literal_lengths - 1] == 0) {
+            --nr_literal_lengths;
+        }
+        auto nr_distance_lengths = distance_lengths.size();
+        while (distance_lengths[nr_distance_lengths - 1] == 0) {
+            --nr_distance_lengths;
+        }
+
+        auto lengths = std::vector<uint8_t>{};
+        lengths.reserve(nr_literal_lengths + nr_distance_lengths);
+        lengths.insert(lengths.end(), literal_lengths.begin(), literal_lengths.begin() + nr_literal_lengths);
+        lengths.insert(lengths.end(), distance_lengths.begin(), distance_lengths.begin() + nr_distance_lengths);
+        hilet encoded_lengths = encode_lengths(lengths);
+
+        auto code_length_frequencies = std::array<std::size_t, 19>{};
+        for (hilet [symbol, extra] : encoded_lengths) {
+            ++code_length_frequencies[symbol];
+        }
+        ensure_two_symbols(code_length_frequencies);
+        hilet code_length_lengths = huffman_lengths_from_frequencies(code_length_frequencies, 7);
+        hilet code_length_codes = huffman_codes_from_lengths(code_length_lengths);
+
+        auto nr_code_length_lengths = deflate_code_length_order.size();
+        while (nr_code_length_lengths > 4 and code_length_lengths[deflate_code_length_order[nr_code_length_lengths - 1]] == 0) {
+            --nr_code_length_lengths;
+        }
+
+        hilet dynamic_bits = 3 + 5 + 5 + 4 + 3 * nr_code_length_lengths + symbol_bits(code_length_frequencies, code_length_lengths) +
+            2 * code_length_frequencies[16] + 3 * code_length_frequencies[17] + 7 * code_length_frequencies[18] + extra_bits +
+            symbol_bits(literal_frequencies, literal_lengths) + symbol_bits(distance_frequencies, distance_lengths);
+
+        // Stored blocks need a byte-aligned header of 4 bytes for every 65535 bytes.
+        hilet stored_bits = 3 + 7 + (_block_size + 4 * std::max(1_uz, (_block_size + max_stored_size - 1) / max_stored_size)) * 8;
+
+        if (stored_bits <= fixed_bits and stored_bits <= dynamic_bits) {
+            write_stored(_block_start, _block_size, final);
+
+        } else if (fixed_bits <= dynamic_bits) {
+            _writer.put(final ? 1 : 0, 1);
+            _writer.put(1, 2);
+            write_symbols(
+                deflate_fixed_literal_lengths, deflate_fixed_literal_codes, deflate_fixed_distance_lengths, deflate_fixed_distance_codes);
+
+        } else {
+            _writer.put(final ? 1 : 0, 1);
+            _writer.put(2, 2);
+            _writer.put(nr_literal_lengths - 257, 5);
+            _writer.put(nr_distance_lengths - 1, 5);
+            _writer.put(nr_code_length_lengths - 4, 4);
+            for (auto i = 0_uz; i != nr_code_length_lengths; ++i) {
+                _writer.put(code_length_lengths[deflate_code_length_order[i]], 3);
+            }
+
+            constexpr auto repeat_extra_bits = std::array<uint8_t, 3>{2, 3, 7};
+            for (hilet [symbol, extra] : encoded_lengths) {
+                _writer.put(code_length_codes[symbol], code_length_lengths[symbol]);
+                if (symbol >= 16) {
+                    _writer.put(extra, repeat_extra_bits[symbol - 16]);
+                }
+            }
+
+            write_symbols(
+                literal_lengths, huffman_codes_from_lengths(literal_lengths), distance_lengths, huffman_codes_from_lengths(distance_lengths));
+        }
+
+        _block_start += _block_size;
+        _block_size = 0;
+        _literals.clear();
+        _distances.clear();
+        _literal_frequencies = {};
+        _distance_frequencies = {};
+    }
+};
+
+} // namespace detail
+
+/** Compress data using the deflate algorithm.
+ *
+ * The compression levels are the same as zlib's:
+ *  - 0: Stored blocks without compression.
+ *  - 1 to 3: Fast greedy matching.
+ *  - 4 to 9: Lazy matching, searching longer for better matches at higher levels.
+ *
+ * Each block uses stored, fixed-huffman or dynamic-huffman encoding,
+ * whichever is the smallest.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level between 0 and 9.
+ * @return The deflate stream.
+ */
+hi_export [[nodiscard]] hi_inline bstring deflate(std::span<std::byte const> bytes, int level = 6)
+{
+    auto writer = bit_writer{};
+    detail::deflate_encoder{writer, bytes, level}.encode();
+    return writer.take();
+}
+
+}} // namespace hi::v1
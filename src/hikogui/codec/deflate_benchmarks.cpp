@@ -0,0 +1,41 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "inflate.hpp"
+#include "../file/file.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+
+using namespace std;
+using namespace hi;
+
+TEST(deflate_benchmarks, compress)
+{
+    hilet original = file_view{library_source_dir() / "tests" / "data" / "LineBreakTest.txt"};
+    hilet original_bytes = as_bstring_view(original);
+    hilet size = original_bytes.size();
+
+    for (hilet level : {0, 1, 3, 4, 6, 9}) {
+        hilet compressed = deflate(original_bytes, level);
+
+        hilet compress_rate = benchmark_rate([&] {
+            [[maybe_unused]] auto tmp = deflate(original_bytes, level);
+        });
+
+        hilet decompress_rate = benchmark_rate([&] {
+            auto offset = 0_uz;
+            auto decompressed = inflate(compressed, offset, size);
+            ASSERT_EQ(decompressed.size(), size);
+        });
+
+        benchmark_report(std::format("level {} ratio", level), static_cast<double>(size) / compressed.size(), ":1");
+        benchmark_report(std::format("level {} deflate", level), compress_rate * size / 1'000'000.0, "MB/s");
+        benchmark_report(std::format("level {} inflate", level), decompress_rate * size / 1'000'000.0, "MB/s");
+    }
+}
@@ -0,0 +1,146 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "deflate.hpp"
+#include "inflate.hpp"
+#include "gzip.hpp"
+#include "zlib.hpp"
+#include "../file/file.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <random>
+#include <string_view>
+
+using namespace std;
+using namespace hi;
+
+namespace deflate_tests {
+
+static void test_round_trip(bstring_view original)
+{
+    for (auto level = 0; level <= 9; ++level) {
+        hilet compressed = deflate(original, level);
+
+        auto offset = 0_uz;
+        hilet decompressed = inflate(compressed, offset, original.size() + 1);
+        ASSERT_EQ(offset, compressed.size()) << "level " << level;
+        ASSERT_TRUE(decompressed == original) << "level " << level;
+    }
+}
+
+[[nodiscard]] static bstring random_bytes(std::size_t size)
+{
+    auto engine = std::mt19937{42};
+    auto r = bstring{};
+    for (auto i = 0_uz; i != size; ++i) {
+        r.push_back(static_cast<std::byte>(engine() & 0xff));
+    }
+    return r;
+}
+
+} // namespace deflate_tests
+
+TEST(deflate, round_trip_empty)
+{
+    deflate_tests::test_round_trip(bstring_view{});
+}
+
+TEST(deflate, round_trip_single)
+{
+    deflate_tests::test_round_trip(to_bstring("a"));
+}
+
+TEST(deflate, round_trip_files)
+{
+    for (auto i = 1; i <= 8; ++i) {
+        hilet original = file_view{library_source_dir() / "tests" / "data" / std::format("gzip_test{}.bin", i)};
+        deflate_tests::test_round_trip(as_bstring_view(original));
+    }
+}
+
+TEST(deflate, round_trip_large)
+{
+    // Larger than the window and the symbol buffer, so that matches cross blocks.
+    hilet original = file_view{library_source_dir() / "tests" / "data" / "WordBreakTest.txt"};
+    deflate_tests::test_round_trip(as_bstring_view(original));
+}
+
+TEST(deflate, round_trip_runs)
+{
+    auto original = bstring{};
+    for (auto i = 0_uz; i != 100'000; ++i) {
+        original.push_back(static_cast<std::byte>((i / 1000) % 3));
+    }
+    deflate_tests::test_round_trip(original);
+
+    // Long runs compress into overlapping matches of maximum length.
+    hilet compressed = deflate(original, 6);
+    ASSERT_LT(compressed.size(), 1000);
+}
+
+TEST(deflate, round_trip_random)
+{
+    hilet original = deflate_tests::random_bytes(200'000);
+    deflate_tests::test_round_trip(original);
+
+    // Incompressible data falls back to stored blocks.
+    hilet compressed = deflate(original, 9);
+    ASSERT_LT(compressed.size(), original.size() + 100);
+}
+
+TEST(deflate, ratio)
+{
+    hilet original = file_view{library_source_dir() / "tests" / "data" / "gzip_test7.bin"};
+    hilet original_bytes = as_bstring_view(original);
+
+    hilet stored = deflate(original_bytes, 0);
+    hilet fast = deflate(original_bytes, 1);
+    hilet best = deflate(original_bytes, 9);
+    ASSERT_GT(stored.size(), original_bytes.size());
+    ASSERT_LT(fast.size(), stored.size());
+    ASSERT_LE(best.size(), fast.size());
+}
+
+TEST(deflate, checksums)
+{
+    ASSERT_EQ(detail::zlib_adler32(to_bstring("Wikipedia")), 0x11e6'0398);
+    ASSERT_EQ(detail::gzip_crc32(to_bstring("123456789")), 0xcbf4'3926);
+
+    // Checksums can be calculated in parts.
+    ASSERT_EQ(detail::zlib_adler32(to_bstring("pedia"), detail::zlib_adler32(to_bstring("Wiki"))), 0x11e6'0398);
+    ASSERT_EQ(detail::gzip_crc32(to_bstring("6789"), detail::gzip_crc32(to_bstring("12345"))), 0xcbf4'3926);
+}
+
+TEST(deflate, zlib_round_trip)
+{
+    hilet original = file_view{library_source_dir() / "tests" / "data" / "gzip_test4.bin"};
+    hilet original_bytes = as_bstring_view(original);
+
+    for (auto level = 0; level <= 9; ++level) {
+        hilet compressed = zlib_compress(original_bytes, level);
+        // The header is a multiple of 31.
+        ASSERT_EQ((std::to_integer<int>(compressed[0]) * 256 + std::to_integer<int>(compressed[1])) % 31, 0);
+        // The trailer is the big-endian Adler-32 checksum.
+        ASSERT_EQ(load_be<uint32_t>(compressed.data() + compressed.size() - 4), detail::zlib_adler32(original_bytes));
+
+        ASSERT_TRUE(zlib_decompress(compressed, original_bytes.size()) == original_bytes);
+    }
+}
+
+TEST(deflate, gzip_round_trip)
+{
+    hilet original = file_view{library_source_dir() / "tests" / "data" / "gzip_test5.bin"};
+    hilet original_bytes = as_bstring_view(original);
+
+    for (auto level = 0; level <= 9; ++level) {
+        hilet compressed = gzip_compress(original_bytes, level);
+        ASSERT_EQ(load_le<uint32_t>(compressed.data() + compressed.size() - 8), detail::gzip_crc32(original_bytes));
+        ASSERT_EQ(load_le<uint32_t>(compressed.data() + compressed.size() - 4), original_bytes.size());
+
+        ASSERT_TRUE(gzip_decompress(compressed, original_bytes.size()) == original_bytes);
+    }
+}
@@ -9,7 +9,12 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "inflate.hpp"
+#include "deflate.hpp"
+#include "bit_writer.hpp"
+#include <span>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 
 hi_export_module(hikogui.codec.gzip);
@@ -17,81 +22,51 @@ hi_export_module(hikogui.codec.gzip);
 hi_export namespace hi { inline namespace v1 {
 namespace detail {
 
-struct gzip_member_header {
-    uint8_t ID1;
-    uint8_t ID2;
-    uint8_t CM;
-    uint8_t FLG;
-    little_uint32_buf_t MTIME;
-    uint8_t XFL;
-    uint8_t OS;
-};
-
-[[nodiscard]] hi_inline bstring gzip_decompress_member(std::span<std::byte const> bytes, std::size_t &offset, std::size_t max_size)
-{
-    hilet header = make_placement_ptr<gzip_member_header>(bytes, offset);
-
-    hi_check(header->ID1 == 31, "GZIP Member header ID1 must be 31");
-    hi_check(header->ID2 == 139, "GZIP Member header ID2 must be 139");
-    hi_check(header->CM == 8, "GZIP Member header CM must be 8");
-    hi_check((header->FLG & 0xe0) == 0, "GZIP Member header FLG reserved bits must be 0");
-    hi_check(header->XFL == 2 or header->XFL == 4, "GZIP Member header XFL must be 2 or 4");
-    [[maybe_unused]] hilet FTEXT = to_bool(header->FLG & 1);
-    hilet FHCRC = to_bool(header->FLG & 2);
-    hilet FEXTRA = to_bool(header->FLG & 4);
-    hilet FNAME = to_bool(header->FLG & 8);
-    hilet FCOMMENT = to_bool(header->FLG & 16);
-
-    if (FEXTRA) {
-        hilet XLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-        offset += XLEN;
-    }
-
-    if (FNAME) {
-        auto c = std::byte{};
-        do {
-            hi_check(offset < bytes.size(), "GZIP Member header FNAME reading beyond end of buffer");
-            c = bytes[offset++];
-        } while (c != std::byte{0});
+constexpr auto gzip_crc32_table = []() {
+    auto r = std::array<uint32_t, 256>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        auto crc = narrow_cast<uint32_t>(i);
+        for (auto bit = 0; bit != 8; ++bit) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xedb8'8320 : crc >> 1;
+        }
+        r[i] = crc;
     }
-
-    if (FCOMMENT) {
-        auto c = std::byte{};
-        do {
-            hi_check(offset < bytes.size(), "GZIP Member header FCOMMENT reading beyond end of buffer");
-            c = bytes[offset++];
-        } while (c != std::byte{0});
-    }
-
-    if (FHCRC) {
-        [[maybe_unused]] hilet CRC16 = make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-    }
-
-    auto r = inflate(bytes, offset, max_size);
-
-    [[maybe_unused]] auto CRC32 = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
-    [[maybe_unused]] auto ISIZE = **make_placement_ptr<little_uint32_buf_t>(bytes, offset);
-
-    hi_check(
-        ISIZE == (size(r) & 0xffffffff),
-        "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
     return r;
+}();
+
+/** Calculate the CRC-32 checksum used by gzip.
+ *
+ * @param bytes The data to calculate the checksum over.
+ * @param checksum The checksum of the preceding data, 0 for the first call.
+ * @return The checksum.
+ */
+[[nodiscard]] constexpr uint32_t gzip_crc32(std::span<std::byte const> bytes, uint32_t checksum = 0) noexcept
+{
+    auto crc = ~checksum;
+    for (hilet c : bytes) {
+        crc = gzip_crc32_table[(crc ^ std::to_integer<uint32_t>(c)) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
 }
 
-}
-
+} // namespace detail
+
+/** Decompress gzip data.
+ *
+ * This is a one-shot wrapper around `inflater`, use `inflater` directly to
+ * decompress large files with constant memory.
+ *
+ * @param bytes The gzip data, with one or more members.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data of all members concatenated.
+ * @throws parse_error When the data is invalid or exceeds @a max_size.
+ */
 hi_export [[nodiscard]] hi_inline bstring gzip_decompress(std::span<std::byte const> bytes, std::size_t max_size)
 {
-    auto r = bstring{};
-
-    auto offset = 0_uz;
-    while (offset < bytes.size()) {
-        auto member = detail::gzip_decompress_member(bytes, offset, max_size);
-        max_size -= member.size();
-        r.append(member);
-    }
-
-    return r;
+    auto stream = inflater{inflate_format::gzip};
+    stream.add(bytes);
+    stream.close();
+    return stream.read_all(max_size);
 }
 
 hi_export [[nodiscard]] hi_inline bstring gzip_decompress(std::filesystem::path const &path, std::size_t max_size = 0x01000000)
@@ -99,4 +74,33 @@ hi_export [[nodiscard]] hi_inline bstring gzip_decompress(std::filesystem::path
     return gzip_decompress(as_span<std::byte const>(file_view{path}), max_size);
 }
 
+/** Compress data into the gzip format.
+ *
+ * A single gzip member is written without a file name or modification time.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level between 0 (stored) and 9 (best compression), see `deflate()`.
+ * @return The gzip data.
+ */
+hi_export [[nodiscard]] hi_inline bstring gzip_compress(std::span<std::byte const> bytes, int level = 6)
+{
+    auto writer = bit_writer{};
+
+    // ID1, ID2, CM=8 (deflate), FLG=0, MTIME=0.
+    writer.put(0x8b1f, 16);
+    writer.put(8, 8);
+    writer.put(0, 8);
+    writer.put(0, 32);
+    // XFL=2 (maximum compression) or 4 (fastest), OS=255 (unknown).
+    writer.put(level >= 9 ? 2 : level == 1 ? 4 : 0, 8);
+    writer.put(255, 8);
+
+    detail::deflate_encoder{writer, bytes, level}.encode();
+
+    writer.align();
+    writer.put(detail::gzip_crc32(bytes), 32);
+    writer.put(bytes.size() & 0xffff'ffff, 32);
+    return writer.take();
+}
+
 }} // namespace hi::inline v1
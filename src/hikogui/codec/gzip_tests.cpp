@@ -9,6 +9,9 @@
 #include "../macros.hpp"
 #include <gtest/gtest.h>
 #include <iostream>
+#include <format>
+#include <string_view>
+#include <vector>
 
 using namespace std;
 using namespace hi;
@@ -126,3 +129,49 @@ TEST(GZip, UnzipXargs1)
         ASSERT_EQ(decompressed[i], original_bytes[i]);
     }
 }
+
+static void test_gzip_stream(std::string_view name, std::size_t chunk_size, std::size_t buffer_size)
+{
+    hilet compressed = file_view{library_source_dir() / "tests" / "data" / std::format("{}.gz", name)};
+    hilet original = file_view{library_source_dir() / "tests" / "data" / name};
+    hilet original_bytes = as_bstring_view(original);
+
+    auto input = as_span<std::byte const>(compressed);
+    auto stream = inflater{inflate_format::gzip};
+    auto buffer = std::vector<std::byte>(buffer_size);
+    auto decompressed = bstring{};
+
+    while (not stream.done()) {
+        if (stream.need_input()) {
+            hilet chunk = input.first(std::min(input.size(), chunk_size));
+            input = input.subspan(chunk.size());
+            if (chunk.empty()) {
+                stream.close();
+            } else {
+                stream.add(chunk);
+            }
+        }
+
+        hilet size = stream.read(buffer);
+        decompressed.append(buffer.data(), size);
+    }
+
+    ASSERT_EQ(decompressed, original_bytes);
+}
+
+TEST(GZip, StreamSmallChunks)
+{
+    for (auto i = 1; i <= 8; ++i) {
+        test_gzip_stream(std::format("gzip_test{}.bin", i), 1, 100);
+        test_gzip_stream(std::format("gzip_test{}.bin", i), 13, 7);
+        test_gzip_stream(std::format("gzip_test{}.bin", i), 1000, 0x1'0000);
+    }
+}
+
+TEST(GZip, StreamTruncated)
+{
+    hilet compressed = file_view{library_source_dir() / "tests" / "data" / "gzip_test4.bin.gz"};
+    hilet bytes = as_span<std::byte const>(compressed);
+
+    ASSERT_THROW((void)gzip_decompress(bytes.first(bytes.size() / 2), 0x0100'0000), parse_error);
+}
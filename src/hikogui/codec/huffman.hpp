@@ -6,8 +6,10 @@
 
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
+#include "bit_reader.hpp"
 #include <span>
 #include <vector>
+#include <array>
 #include <algorithm>
 
 hi_export_module(hikogui.codec.huffman);
@@ -171,4 +173,320 @@ public:
     }
 };
 
+/** A table driven canonical-huffman decoder.
+ *
+ * The table is indexed by the next `PrimaryBits` bits of the stream, which will
+ * directly yield the symbol and its code-length for short codes. Codes that are
+ * longer than `PrimaryBits` are found in a secondary table, which is
+ * indexed by the bits following the primary bits.
+ *
+ * Codes are read LSB-first as used by deflate, which means that the table is
+ * indexed by the bit-reversed huffman code.
+ *
+ * @tparam PrimaryBits The number of bits used to index the primary table.
+ */
+hi_export template<std::size_t PrimaryBits>
+class huffman_table {
+public:
+    static_assert(PrimaryBits >= 1 and PrimaryBits <= 15);
+
+    /** The maximum length of a huffman code.
+     */
+    constexpr static std::size_t max_code_length = 15;
+
+    constexpr huffman_table() noexcept = default;
+    huffman_table(huffman_table const&) = default;
+    huffman_table(huffman_table&&) noexcept = default;
+    huffman_table& operator=(huffman_table const&) = default;
+    huffman_table& operator=(huffman_table&&) noexcept = default;
+
+    /** Get a symbol from the huffman encoded stream.
+     *
+     * @pre At least `max_code_length` bits must be available in @a reader, see `bit_reader::refill()`.
+     * @param reader The bit-reader to read the huffman code from.
+     * @return The decoded symbol.
+     * @throw parse_error on invalid code-bit sequence.
+     */
+    [[nodiscard]] hi_force_inline std::size_t get_symbol(bit_reader& reader) const
+    {
+        auto entry = _table[reader.peek(PrimaryBits)];
+        if (entry.kind == entry_kind::link) [[unlikely]] {
+            reader.skip(PrimaryBits);
+            entry = _table[entry.value + reader.peek(entry.length)];
+        }
+
+        if (entry.kind != entry_kind::symbol) [[unlikely]] {
+            throw parse_error("Code not in huffman table.");
+        }
+
+        reader.skip(entry.length);
+        return entry.value;
+    }
+
+    /** Build a canonical-huffman table from a set of lengths.
+     *
+     * @param lengths The code-length of each symbol, a length of zero means the symbol is unused.
+     * @throw parse_error when the code-lengths are over-subscribed.
+     */
+    [[nodiscard]] static huffman_table from_lengths(std::span<uint8_t const> lengths)
+    {
+        hi_axiom(lengths.size() <= std::numeric_limits<uint16_t>::max());
+
+        auto length_count = std::array<std::size_t, max_code_length + 1>{};
+        for (hilet length : lengths) {
+            hi_check(length <= max_code_length, "Huffman code-length too large.");
+            ++length_count[length];
+        }
+        length_count[0] = 0;
+
+        // Calculate the first canonical code for each code-length.
+        auto next_code = std::array<std::size_t, max_code_length + 1>{};
+        auto left = 1_uz;
+        auto code = 0_uz;
+        for (auto length = 1_uz; length <= max_code_length; ++length) {
+            left <<= 1;
+            hi_check(length_count[length] <= left, "Huffman code-lengths are over-subscribed.");
+            left -= length_count[length];
+
+            code = (code + length_count[length - 1]) << 1;
+            next_code[length] = code;
+        }
+
+        auto r = huffman_table{};
+        r._table.resize(primary_size);
+
+        // Determine for each primary-entry how many bits are needed for the secondary table.
+        auto secondary_bits = std::array<uint8_t, primary_size>{};
+        {
+            auto tmp_code = next_code;
+            for (hilet length : lengths) {
+                if (length > PrimaryBits) {
+                    hilet index = reverse_code(tmp_code[length], length) & primary_mask;
+                    secondary_bits[index] = std::max(secondary_bits[index], narrow_cast<uint8_t>(length - PrimaryBits));
+                }
+                ++tmp_code[length];
+            }
+        }
+
+        for (auto index = 0_uz; index != primary_size; ++index) {
+            if (hilet nr_bits = secondary_bits[index]) {
+                r._table[index] = {narrow_cast<uint16_t>(r._table.size()), nr_bits, entry_kind::link};
+                r._table.resize(r._table.size() + (1_uz << nr_bits));
+            }
+        }
+
+        for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+            hilet length = lengths[symbol];
+            if (length == 0) {
+                continue;
+            }
+
+            hilet reversed_code = reverse_code(next_code[length]++, length);
+            if (length <= PrimaryBits) {
+                hilet entry = entry_type{narrow_cast<uint16_t>(symbol), length, entry_kind::symbol};
+                for (auto index = reversed_code; index < primary_size; index += 1_uz << length) {
+                    r._table[index] = entry;
+                }
+
+            } else {
+                hilet link = r._table[reversed_code & primary_mask];
+                hi_axiom(link.kind == entry_kind::link);
+
+                hilet secondary_length = narrow_cast<uint8_t>(length - PrimaryBits);
+                hilet entry = entry_type{narrow_cast<uint16_t>(symbol), secondary_length, entry_kind::symbol};
+                for (auto index = reversed_code >> PrimaryBits; index < (1_uz << link.length); index += 1_uz << secondary_length) {
+                    r._table[link.value + index] = entry;
+                }
+            }
+        }
+
+        return r;
+    }
+
+private:
+    constexpr static std::size_t primary_size = 1_uz << PrimaryBits;
+    constexpr static std::size_t primary_mask = primary_size - 1;
+
+    enum class entry_kind : uint8_t {
+        /** The code is not in the table.
+         */
+        invalid,
+
+        /** The entry contains a symbol and the length of the code.
+         */
+        symbol,
+
+        /** The entry contains the offset to the secondary table and
+         * the number of bits used to index the secondary table.
+         */
+        link
+    };
+
+    struct entry_type {
+        uint16_t value = 0;
+        uint8_t length = 0;
+        entry_kind kind = entry_kind::invalid;
+    };
+
+    /** The primary table, followed by the secondary tables.
+     */
+    std::vector<entry_type> _table = {};
+
+    [[nodiscard]] constexpr static std::size_t reverse_code(std::size_t code, std::size_t length) noexcept
+    {
+        auto r = 0_uz;
+        for (auto i = 0_uz; i != length; ++i) {
+            r <<= 1;
+            r |= code & 1;
+            code >>= 1;
+        }
+        return r;
+    }
+};
+
+/** Calculate the code-lengths of a length-limited canonical-huffman code.
+ *
+ * The code-lengths are first calculated with the standard huffman algorithm,
+ * then codes that are too long are shortened, and the lengths of other codes
+ * are increased until the code is complete again.
+ *
+ * To make sure the decoder always reads at least one bit, a single used
+ * symbol gets a code-length of 1.
+ *
+ * @param frequencies The number of times each symbol is used.
+ * @param max_length The maximum code-length.
+ * @return The code-length of each symbol, zero for unused symbols.
+ */
+hi_export [[nodiscard]] hi_inline std::vector<uint8_t>
+huffman_lengths_from_frequencies(std::span<std::size_t const> frequencies, std::size_t max_length)
+{
+    hi_axiom(max_length >= 1 and max_length <= 15);
+
+    auto r = std::vector<uint8_t>(frequencies.size(), uint8_t{0});
+
+    struct node_type {
+        std::size_t frequency;
+        std::size_t index;
+    };
+
+    // The leaves, sorted by frequency.
+    auto leaves = std::vector<node_type>{};
+    for (auto symbol = 0_uz; symbol != frequencies.size(); ++symbol) {
+        if (frequencies[symbol] != 0) {
+            leaves.emplace_back(frequencies[symbol], symbol);
+        }
+    }
+
+    if (leaves.empty()) {
+        return r;
+    } else if (leaves.size() == 1) {
+        r[leaves.front().index] = 1;
+        return r;
+    }
+
+    std::stable_sort(leaves.begin(), leaves.end(), [](hilet& a, hilet& b) {
+        return a.frequency < b.frequency;
+    });
+
+    // Build the tree with two queues; internal nodes are created in order of
+    // increasing frequency. Leaves are numbered 0 to n - 1, internal nodes n to 2n - 2.
+    hilet nr_leaves = leaves.size();
+    auto parents = std::vector<std::size_t>(nr_leaves * 2 - 1, 0);
+    auto nodes = std::vector<std::size_t>{};
+    nodes.reserve(nr_leaves - 1);
+
+    auto leaf_it = 0_uz;
+    auto node_it = 0_uz;
+    hilet pop_smallest = [&] {
+        if (leaf_it != nr_leaves and (node_it == nodes.size() or leaves[leaf_it].frequency <= nodes[node_it])) {
+            hilet frequency = leaves[leaf_it].frequency;
+            return std::pair{leaf_it++, frequency};
+        } else {
+            hilet frequency = nodes[node_it];
+            return std::pair{nr_leaves + node_it++, frequency};
+        }
+    };
+
+    while (nodes.size() != nr_leaves - 1) {
+        hilet [a, a_frequency] = pop_smallest();
+        hilet [b, b_frequency] = pop_smallest();
+        parents[a] = parents[b] = nr_leaves + nodes.size();
+        nodes.push_back(a_frequency + b_frequency);
+    }
+
+    // Calculate the depth of each node, parents always have a higher index than their children.
+    auto depths = std::vector<std::size_t>(nr_leaves * 2 - 1, 0);
+    for (auto i = nr_leaves * 2 - 2; i != 0; --i) {
+        depths[i - 1] = depths[parents[i - 1]] + 1;
+    }
+
+    // Count the number of codes of each length, clamping to the maximum length.
+    auto length_count = std::array<std::size_t, 16>{};
+    for (auto i = 0_uz; i != nr_leaves; ++i) {
+        ++length_count[std::min(depths[i], max_length)];
+    }
+
+    // Clamping made the code over-subscribed, move leaves down the tree until it is complete again.
+    auto total = 0_uz;
+    for (auto length = 1_uz; length <= max_length; ++length) {
+        total += length_count[length] << (max_length - length);
+    }
+    while (total > (1_uz << max_length)) {
+        --length_count[max_length];
+        for (auto length = max_length - 1; length != 0; --length) {
+            if (length_count[length] != 0) {
+                --length_count[length];
+                length_count[length + 1] += 2;
+                break;
+            }
+        }
+        --total;
+    }
+
+    // Hand out the code-lengths, the least frequent symbols get the longest codes.
+    leaf_it = 0;
+    for (auto length = max_length; length != 0; --length) {
+        for (auto i = length_count[length]; i != 0; --i) {
+            r[leaves[leaf_it++].index] = narrow_cast<uint8_t>(length);
+        }
+    }
+    return r;
+}
+
+/** Calculate the codes of a canonical-huffman code.
+ *
+ * @param lengths The code-length of each symbol, a length of zero means the symbol is unused.
+ * @return The bit-reversed code of each symbol, so that it can be written LSB-first like deflate.
+ */
+hi_export [[nodiscard]] hi_inline std::vector<uint16_t> huffman_codes_from_lengths(std::span<uint8_t const> lengths)
+{
+    auto length_count = std::array<std::size_t, 16>{};
+    for (hilet length : lengths) {
+        hi_axiom(length <= 15);
+        ++length_count[length];
+    }
+    length_count[0] = 0;
+
+    auto next_code = std::array<std::size_t, 16>{};
+    auto code = 0_uz;
+    for (auto length = 1_uz; length != 16; ++length) {
+        code = (code + length_count[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    auto r = std::vector<uint16_t>(lengths.size(), uint16_t{0});
+    for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+        if (hilet length = lengths[symbol]) {
+            auto code_ = next_code[length]++;
+            auto reversed_code = 0_uz;
+            for (auto i = 0_uz; i != length; ++i) {
+                reversed_code = (reversed_code << 1) | (code_ & 1);
+                code_ >>= 1;
+            }
+            r[symbol] = narrow_cast<uint16_t>(reversed_code);
+        }
+    }
+    return r;
+}
+
 }} // namespace hi::v1
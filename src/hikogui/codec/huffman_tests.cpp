@@ -0,0 +1,144 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "huffman.hpp"
+#include "bit_reader.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using namespace std;
+using namespace hi;
+
+namespace huffman_tests {
+
+/** Encode symbols with the canonical-huffman code LSB-first like deflate.
+ */
+[[nodiscard]] static std::vector<std::byte> encode(std::vector<uint8_t> const& lengths, std::vector<std::size_t> const& symbols)
+{
+    auto length_count = std::array<std::size_t, 16>{};
+    for (hilet length : lengths) {
+        ++length_count[length];
+    }
+    length_count[0] = 0;
+
+    auto next_code = std::array<std::size_t, 16>{};
+    auto code = 0_uz;
+    for (auto length = 1_uz; length != 16; ++length) {
+        code = (code + length_count[length - 1]) << 1;
+        next_code[length] = code;
+    }
+
+    auto codes = std::vector<std::size_t>(lengths.size(), 0);
+    for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+        if (lengths[symbol] != 0) {
+            codes[symbol] = next_code[lengths[symbol]]++;
+        }
+    }
+
+    auto r = std::vector<std::byte>{};
+    auto bit_offset = 0_uz;
+    for (hilet symbol : symbols) {
+        hilet length = lengths[symbol];
+        for (auto i = length; i != 0; --i) {
+            if (bit_offset % 8 == 0) {
+                r.push_back(std::byte{0});
+            }
+            if ((codes[symbol] >> (i - 1)) & 1) {
+                r.back() |= static_cast<std::byte>(1 << (bit_offset % 8));
+            }
+            ++bit_offset;
+        }
+    }
+
+    // Trailer, so that the huffman_tree reference does not read beyond the end.
+    r.insert(r.end(), 4, std::byte{0});
+    return r;
+}
+
+} // namespace huffman_tests
+
+TEST(huffman, fixed_literal)
+{
+    auto lengths = std::vector<uint8_t>{};
+    lengths.insert(lengths.end(), 144, uint8_t{8});
+    lengths.insert(lengths.end(), 112, uint8_t{9});
+    lengths.insert(lengths.end(), 24, uint8_t{7});
+    lengths.insert(lengths.end(), 8, uint8_t{8});
+
+    auto symbols = std::vector<std::size_t>{};
+    for (auto i = 0_uz; i != 4 * lengths.size(); ++i) {
+        symbols.push_back((i * 7) % lengths.size());
+    }
+
+    hilet bytes = huffman_tests::encode(lengths, symbols);
+
+    hilet table = huffman_table<7>::from_lengths(lengths);
+    hilet tree = huffman_tree<int16_t>::from_lengths(lengths);
+
+    auto reader = bit_reader{bytes};
+    auto bit_offset = 0_uz;
+    for (hilet expected : symbols) {
+        reader.refill();
+        ASSERT_EQ(table.get_symbol(reader), expected);
+        ASSERT_EQ(tree.get_symbol(bytes, bit_offset), expected);
+        ASSERT_EQ(reader.bit_offset(), bit_offset);
+    }
+    ASSERT_FALSE(reader.overrun());
+}
+
+TEST(huffman, long_codes)
+{
+    // A skewed code which uses all code-lengths up to 15 bits.
+    auto lengths = std::vector<uint8_t>{};
+    for (auto length = uint8_t{1}; length != 15; ++length) {
+        lengths.push_back(length);
+    }
+    lengths.push_back(15);
+    lengths.push_back(15);
+
+    auto symbols = std::vector<std::size_t>{};
+    for (auto i = 0_uz; i != 8; ++i) {
+        for (auto symbol = 0_uz; symbol != lengths.size(); ++symbol) {
+            symbols.push_back(symbol);
+        }
+    }
+
+    hilet bytes = huffman_tests::encode(lengths, symbols);
+
+    hilet table = huffman_table<9>::from_lengths(lengths);
+    hilet tree = huffman_tree<int16_t>::from_lengths(lengths);
+
+    auto reader = bit_reader{bytes};
+    auto bit_offset = 0_uz;
+    for (hilet expected : symbols) {
+        reader.refill();
+        ASSERT_EQ(table.get_symbol(reader), expected);
+        ASSERT_EQ(tree.get_symbol(bytes, bit_offset), expected);
+        ASSERT_EQ(reader.bit_offset(), bit_offset);
+    }
+    ASSERT_FALSE(reader.overrun());
+}
+
+TEST(huffman, over_subscribed)
+{
+    hilet lengths = std::vector<uint8_t>{1, 1, 1};
+    ASSERT_THROW((void)huffman_table<9>::from_lengths(lengths), parse_error);
+}
+
+TEST(huffman, incomplete)
+{
+    // A single code of one bit is allowed in deflate for the distance table.
+    hilet lengths = std::vector<uint8_t>{0, 1};
+    hilet table = huffman_table<9>::from_lengths(lengths);
+
+    hilet bytes = std::vector<std::byte>{std::byte{0b10}, std::byte{0}, std::byte{0}, std::byte{0}};
+    auto reader = bit_reader{bytes};
+    reader.refill();
+    ASSERT_EQ(table.get_symbol(reader), 1);
+    ASSERT_THROW((void)table.get_symbol(reader), parse_error);
+}
@@ -9,214 +9,87 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "huffman.hpp"
+#include "bit_reader.hpp"
 #include <span>
+#include <array>
+#include <vector>
+#include <cstring>
 
 hi_export_module(hikogui.codec.inflate);
 
 hi_export namespace hi { inline namespace v1 {
 namespace detail {
 
-hi_inline void inflate_copy_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
-{
-    auto offset = (bit_offset + 7) / 8;
-
-    auto LEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-    [[maybe_unused]] auto NLEN = **make_placement_ptr<little_uint16_buf_t>(bytes, offset);
-
-    hi_check((offset + LEN) <= bytes.size(), "input buffer overrun");
-    hi_check((r.size() + LEN) <= max_size, "output buffer overrun");
-    r.append(&bytes[offset], LEN);
+/** The base value and number of extra bits of a deflate length or distance code.
+ */
+struct deflate_code {
+    uint16_t base;
+    uint8_t extra_bits;
+};
 
-    bit_offset = offset * 8;
-}
+/** Length base and extra-bits for literal/length symbols 257 to 285.
+ */
+constexpr auto deflate_length_codes = std::array<deflate_code, 29>{{
+    {3, 0},   {4, 0},   {5, 0},   {6, 0},   {7, 0},   {8, 0},   {9, 0},   {10, 0},  {11, 1},  {13, 1},
+    {15, 1},  {17, 1},  {19, 2},  {23, 2},  {27, 2},  {31, 2},  {35, 3},  {43, 3},  {51, 3},  {59, 3},
+    {67, 4},  {83, 4},  {99, 4},  {115, 4}, {131, 5}, {163, 5}, {195, 5}, {227, 5}, {258, 0}}};
 
-[[nodiscard]] hi_inline std::size_t
-inflate_decode_length(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t symbol)
-{
-    switch (symbol) {
-    case 257:
-        return 3;
-    case 258:
-        return 4;
-    case 259:
-        return 5;
-    case 260:
-        return 6;
-    case 261:
-        return 7;
-    case 262:
-        return 8;
-    case 263:
-        return 9;
-    case 264:
-        return 10;
-    case 265:
-        return get_bits(bytes, bit_offset, 1) + 11;
-    case 266:
-        return get_bits(bytes, bit_offset, 1) + 13;
-    case 267:
-        return get_bits(bytes, bit_offset, 1) + 15;
-    case 268:
-        return get_bits(bytes, bit_offset, 1) + 17;
-    case 269:
-        return get_bits(bytes, bit_offset, 2) + 19;
-    case 270:
-        return get_bits(bytes, bit_offset, 2) + 23;
-    case 271:
-        return get_bits(bytes, bit_offset, 2) + 27;
-    case 272:
-        return get_bits(bytes, bit_offset, 2) + 31;
-    case 273:
-        return get_bits(bytes, bit_offset, 3) + 35;
-    case 274:
-        return get_bits(bytes, bit_offset, 3) + 43;
-    case 275:
-        return get_bits(bytes, bit_offset, 3) + 51;
-    case 276:
-        return get_bits(bytes, bit_offset, 3) + 59;
-    case 277:
-        return get_bits(bytes, bit_offset, 4) + 67;
-    case 278:
-        return get_bits(bytes, bit_offset, 4) + 83;
-    case 279:
-        return get_bits(bytes, bit_offset, 4) + 99;
-    case 280:
-        return get_bits(bytes, bit_offset, 4) + 115;
-    case 281:
-        return get_bits(bytes, bit_offset, 5) + 131;
-    case 282:
-        return get_bits(bytes, bit_offset, 5) + 163;
-    case 283:
-        return get_bits(bytes, bit_offset, 5) + 195;
-    case 284:
-        return get_bits(bytes, bit_offset, 5) + 227;
-    case 285:
-        return 258;
-    default:
-        throw parse_error(std::format("Literal/Length symbol out of range {}", symbol));
-    }
-}
+/** Distance base and extra-bits for distance symbols 0 to 29.
+ */
+constexpr auto deflate_distance_codes = std::array<deflate_code, 30>{{
+    {1, 0},     {2, 0},     {3, 0},     {4, 0},     {5, 1},     {7, 1},     {9, 2},     {13, 2},    {17, 3},   {25, 3},
+    {33, 4},    {49, 4},    {65, 5},    {97, 5},    {129, 6},   {193, 6},   {257, 7},   {385, 7},   {513, 8},  {769, 8},
+    {1025, 9},  {1537, 9},  {2049, 10}, {3073, 10}, {4097, 11}, {6145, 11}, {8193, 12}, {12289, 12}, {16385, 13}, {24577, 13}}};
 
-[[nodiscard]] hi_inline std::size_t
-inflate_decode_distance(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t symbol)
-{
-    switch (symbol) {
-    case 0:
-        return 1;
-    case 1:
-        return 2;
-    case 2:
-        return 3;
-    case 3:
-        return 4;
-    case 4:
-        return get_bits(bytes, bit_offset, 1) + 5;
-    case 5:
-        return get_bits(bytes, bit_offset, 1) + 7;
-    case 6:
-        return get_bits(bytes, bit_offset, 2) + 9;
-    case 7:
-        return get_bits(bytes, bit_offset, 2) + 13;
-    case 8:
-        return get_bits(bytes, bit_offset, 3) + 17;
-    case 9:
-        return get_bits(bytes, bit_offset, 3) + 25;
-    case 10:
-        return get_bits(bytes, bit_offset, 4) + 33;
-    case 11:
-        return get_bits(bytes, bit_offset, 4) + 49;
-    case 12:
-        return get_bits(bytes, bit_offset, 5) + 65;
-    case 13:
-        return get_bits(bytes, bit_offset, 5) + 97;
-    case 14:
-        return get_bits(bytes, bit_offset, 6) + 129;
-    case 15:
-        return get_bits(bytes, bit_offset, 6) + 193;
-    case 16:
-        return get_bits(bytes, bit_offset, 7) + 257;
-    case 17:
-        return get_bits(bytes, bit_offset, 7) + 385;
-    case 18:
-        return get_bits(bytes, bit_offset, 8) + 513;
-    case 19:
-        return get_bits(bytes, bit_offset, 8) + 769;
-    case 20:
-        return get_bits(bytes, bit_offset, 9) + 1025;
-    case 21:
-        return get_bits(bytes, bit_offset, 9) + 1537;
-    case 22:
-        return get_bits(bytes, bit_offset, 10) + 2049;
-    case 23:
-        return get_bits(bytes, bit_offset, 10) + 3073;
-    case 24:
-        return get_bits(bytes, bit_offset, 11) + 4097;
-    case 25:
-        return get_bits(bytes, bit_offset, 11) + 6145;
-    case 26:
-        return get_bits(bytes, bit_offset, 12) + 8193;
-    case 27:
-        return get_bits(bytes, bit_offset, 12) + 12289;
-    case 28:
-        return get_bits(bytes, bit_offset, 13) + 16385;
-    case 29:
-        return get_bits(bytes, bit_offset, 13) + 24577;
-    default:
-        throw parse_error(std::format("Distance symbol out of range {}", symbol));
-    }
-}
+using inflate_literal_table = huffman_table<10>;
+using inflate_distance_table = huffman_table<8>;
+using inflate_code_length_table = huffman_table<7>;
 
-hi_inline void inflate_block(
-    std::span<std::byte const> bytes,
-    std::size_t& bit_offset,
-    std::size_t max_size,
-    huffman_tree<int16_t> const& literal_tree,
-    huffman_tree<int16_t> const& distance_tree,
-    bstring& r)
-{
-    while (true) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-        // - 15 bits maximum huffman code.
-        // -  5 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 27) >> 3) <= bytes.size(), "Input buffer overrun");
+/** The maximum number of bits for a literal or length/distance pair.
+ *
+ * - 15 bits literal/length huffman code.
+ * -  5 bits extra length.
+ * - 15 bits distance huffman code.
+ * - 13 bits extra distance.
+ */
+constexpr std::size_t inflate_max_symbol_bits = 48;
 
-        hilet literal_symbol = literal_tree.get_symbol(bytes, bit_offset);
+/** The maximum length of a match.
+ */
+constexpr std::size_t deflate_max_match_length = 258;
 
-        if (literal_symbol <= 255) {
-            hi_check(r.size() < max_size, "Output buffer overrun");
-            r.push_back(static_cast<std::byte>(literal_symbol));
+/** A decoded literal, end-of-block or length/distance pair.
+ */
+struct inflate_symbol {
+    /** The literal byte, 256 for end-of-block, or the length of a match.
+     */
+    std::size_t value = 0;
 
-        } else if (literal_symbol == 256) {
-            // End-of-block.
-            return;
+    /** The distance of a match, or zero for a literal or end-of-block.
+     */
+    std::size_t distance = 0;
+};
 
-        } else {
-            hilet length = inflate_decode_length(bytes, bit_offset, literal_symbol);
-            hi_check(r.size() + length <= max_size, "Output buffer overrun");
-
-            // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
-            // - 15 bits maximum huffman code.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 22) >> 3) <= bytes.size(), "Input buffer overrun");
-            hilet distance_symbol = distance_tree.get_symbol(bytes, bit_offset);
-
-            // Test only every inflate_decode_distance, the trailer is at least 32 bits (Checksum)
-            // - 13 bits extra length.
-            // -  7 bits rounding up to byte.
-            hi_check(((bit_offset + 20) >> 3) <= bytes.size(), "Input buffer overrun");
-            hilet distance = inflate_decode_distance(bytes, bit_offset, distance_symbol);
-
-            hi_check(distance <= r.size(), "Distance beyond start of decompressed data");
-            auto src_i = r.size() - distance;
-            for (auto i = 0; i != length; ++i) {
-                r.push_back(r[src_i++]);
-            }
+/** Copy a match from earlier in the output to the end of the output.
+ *
+ * @param dst The pointer to the end of the output.
+ * @param length The number of bytes to copy.
+ * @param distance The distance backward from @a dst to copy from.
+ */
+hi_inline void inflate_copy_match(std::byte *dst, std::size_t length, std::size_t distance) noexcept
+{
+    hilet src = dst - distance;
+    if (distance >= length) {
+        std::memcpy(dst, src, length);
+    } else {
+        // Overlapping copy, which repeats the last `distance` bytes.
+        for (auto i = 0_uz; i != length; ++i) {
+            dst[i] = src[i];
         }
     }
 }
 
-hi_inline huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
+hi_inline inflate_literal_table deflate_fixed_literal_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 143; ++i) {
@@ -232,162 +105,834 @@ hi_inline huffman_tree<int16_t> deflate_fixed_literal_tree = []() {
         lengths.push_back(8);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_literal_table::from_lengths(lengths);
 }();
 
-hi_inline huffman_tree<int16_t> deflate_fixed_distance_tree = []() {
+hi_inline inflate_distance_table deflate_fixed_distance_table = []() {
     std::vector<uint8_t> lengths;
 
     for (int i = 0; i <= 31; ++i) {
         lengths.push_back(5);
     }
 
-    return huffman_tree<int16_t>::from_lengths(lengths);
+    return inflate_distance_table::from_lengths(lengths);
 }();
 
-hi_inline void inflate_fixed_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
-{
-    inflate_block(bytes, bit_offset, max_size, deflate_fixed_literal_tree, deflate_fixed_distance_tree, r);
-}
-
-[[nodiscard]] hi_inline huffman_tree<int16_t>
-inflate_code_lengths(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t nr_symbols)
+[[nodiscard]] hi_inline inflate_code_length_table inflate_code_lengths(bit_reader& reader, std::size_t nr_symbols)
 {
     // The symbols are in different order in the table.
     constexpr auto symbols = std::array<int16_t, 19>{16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
 
-    hi_check(((bit_offset + (3 * static_cast<std::size_t>(nr_symbols)) + 7) >> 3) <= bytes.size(), "Input buffer overrun");
-
-    auto lengths = std::vector<uint8_t>(symbols.size(), 0);
+    // At most 19 * 3 = 57 bits; read in two parts to stay within a single refill.
+    auto lengths = std::array<uint8_t, symbols.size()>{};
     for (auto i = 0_uz; i != nr_symbols; ++i) {
+        if (i % 16 == 0) {
+            reader.refill();
+        }
         hilet symbol = symbols[i];
-        lengths[symbol] = narrow_cast<uint8_t>(get_bits(bytes, bit_offset, 3));
+        lengths[symbol] = narrow_cast<uint8_t>(reader.get(3));
     }
-    return huffman_tree<int16_t>::from_lengths(std::move(lengths));
+
+    hi_check(not reader.overrun(), "Input buffer overrun");
+    return inflate_code_length_table::from_lengths(lengths);
 }
 
-hi_inline std::vector<uint8_t> inflate_lengths(
-    std::span<std::byte const> bytes,
-    std::size_t& bit_offset,
-    std::size_t nr_symbols,
-    huffman_tree<int16_t> const& code_length_tree)
+hi_inline std::vector<uint8_t>
+inflate_lengths(bit_reader& reader, std::size_t nr_symbols, inflate_code_length_table const& code_length_table)
 {
     auto r = std::vector<uint8_t>{};
     r.reserve(nr_symbols);
 
-    auto prev_length = 0_uz;
     while (r.size() < nr_symbols) {
-        // Test only every get_symbol, the trailer is at least 32 bits (Checksum)
         // -  7 bits maximum huffman code.
         // -  7 bits extra length.
-        // -  7 bits rounding up to byte.
-        hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-        hilet symbol = code_length_tree.get_symbol(bytes, bit_offset);
+        reader.refill();
+        hilet symbol = code_length_table.get_symbol(reader);
 
         switch (symbol) {
         case 16:
             {
-                auto copy_length = get_bits(bytes, bit_offset, 2) + 3;
-                while (copy_length--) {
-                    r.push_back(static_cast<uint8_t>(prev_length));
-                }
+                hi_check(not r.empty(), "Repeat code-length without previous code-length");
+                hilet prev_length = r.back();
+                r.insert(r.end(), reader.get(2) + 3, prev_length);
             }
             break;
         case 17:
-            {
-                auto copy_length = get_bits(bytes, bit_offset, 3) + 3;
-                while (copy_length--) {
-                    r.push_back(0);
-                }
-            }
+            r.insert(r.end(), reader.get(3) + 3, uint8_t{0});
             break;
         case 18:
-            {
-                auto copy_length = get_bits(bytes, bit_offset, 7) + 11;
-                while (copy_length--) {
-                    r.push_back(0);
-                }
-            }
+            r.insert(r.end(), reader.get(7) + 11, uint8_t{0});
             break;
         default:
-            r.push_back(static_cast<uint8_t>(prev_length = symbol));
+            r.push_back(narrow_cast<uint8_t>(symbol));
         }
     }
 
+    hi_check(not reader.overrun(), "Input buffer overrun");
+    hi_check(r.size() == nr_symbols, "Code-lengths repeat beyond the number of symbols");
     return r;
 }
 
-hi_inline void inflate_dynamic_block(std::span<std::byte const> bytes, std::size_t& bit_offset, std::size_t max_size, bstring& r)
-{
-    // Test all lengths, the trailer is at least 32 bits (Checksum)
-    // - 14 bits lengths
-    // -  7 bits rounding up to byte.
-    hi_check(((bit_offset + 21) >> 3) <= bytes.size(), "Input buffer overrun");
-    hilet HLIT = get_bits(bytes, bit_offset, 5);
-    hilet HDIST = get_bits(bytes, bit_offset, 5);
-    hilet HCLEN = get_bits(bytes, bit_offset, 4);
-
-    hilet code_length_tree = inflate_code_lengths(bytes, bit_offset, HCLEN + 4);
-
-    hilet lengths = inflate_lengths(bytes, bit_offset, HLIT + HDIST + 258, code_length_tree);
-    hi_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
-
-    hilet lengths_ptr = lengths.data();
-    hi_assert_not_null(lengths_ptr);
-    hilet literal_tree = huffman_tree<int16_t>::from_lengths(lengths_ptr, HLIT + 257);
-    hilet distance_tree = huffman_tree<int16_t>::from_lengths(&lengths_ptr[HLIT + 257], HDIST + 1);
-
-    inflate_block(bytes, bit_offset, max_size, literal_tree, distance_tree, r);
-}
-
 } // namespace detail
 
-/** Inflate compressed data using the deflate algorithm
- * `bytes` should include at least 32 bit of trailer, for the overflow check which
- * will slightly overrun the actual compressed data for performance reasons.
- *
- * - gzip has a CRC32+ISIZE trailer.
- *   Since gzip has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - zlib has a 32 bit check value.
- *   Since zlib has no end-of-segment indicator, we need to include the trailer
- *   in the byte array passed to inflate anyway.
- * - png IDAT chunks include the full zlib-format, including the 32 bit check value.
+/** The format of the compressed data passed to the inflater.
  */
-hi_export [[nodiscard]] hi_inline bstring
-inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size = 0x0100'0000)
-{
-    std::size_t bit_offset = offset * 8;
-
-    auto r = bstring{};
+hi_export enum class inflate_format {
+    /** Raw deflate (RFC 1951) compressed data.
+     */
+    deflate,
 
-    auto BFINAL = false;
-    do {
-        // Test all lengths, the trailer is at least 32 bits (Checksum)
-        // - 3 bits header
-        // - 7 bits rounding up to byte.
-        hi_check(((bit_offset + 10) >> 3) <= bytes.size(), "Input buffer overrun");
+    /** zlib (RFC 1950) wrapped deflate compressed data.
+     */
+    zlib,
 
-        BFINAL = get_bit(bytes, bit_offset);
-        hilet BTYPE = get_bits(bytes, bit_offset, 2);
+    /** gzip (RFC 1952) wrapped deflate compressed data, with one or more members.
+     */
+    gzip
+};
 
-        switch (BTYPE) {
-        case 0:
-            detail::inflate_copy_block(bytes, bit_offset, max_size, r);
+/** Incremental inflater.
+ *
+ * The inflater decompresses data that is added in chunks, into output buffers
+ * supplied by the caller. Memory usage is constant: a sliding window for the
+ * back-references and a small carry buffer for codes that straddle chunks.
+ *
+ * Chunks are not copied, they must stay valid until `need_input()` returns true.
+ *
+ * Example of decompressing a large gzip file:
+ * ```
+ * auto stream = inflater{inflate_format::gzip};
+ * auto view = file_view{path};
+ * auto input = as_span<std::byte const>(view);
+ * auto buffer = std::array<std::byte, 0x1'0000>{};
+ *
+ * while (not stream.done()) {
+ *     if (stream.need_input()) {
+ *         hilet chunk = input.first(std::min(input.size(), 0x1'0000_uz));
+ *         input = input.subspan(chunk.size());
+ *         if (chunk.empty()) {
+ *             stream.close();
+ *         } else {
+ *             stream.add(chunk);
+ *         }
+ *     }
+ *
+ *     hilet size = stream.read(buffer);
+ *     process(std::span{buffer}.first(size));
+ * }
+ * ```
+ */
+hi_export class inflater {
+public:
+    /** The maximum distance of a back-reference.
+     */
+    constexpr static std::size_t window_size = 0x8000;
+
+    ~inflater() = default;
+    inflater(inflater const&) = delete;
+    inflater(inflater&&) noexcept = default;
+    inflater& operator=(inflater const&) = delete;
+    inflater& operator=(inflater&&) noexcept = default;
+
+    /** Create an inflater.
+     *
+     * @param format The format of the compressed data.
+     */
+    explicit inflater(inflate_format format = inflate_format::deflate) :
+        _format(format), _window(window_capacity, std::byte{0})
+    {
+        switch (format) {
+        case inflate_format::deflate:
+            _state = state_type::block_header;
             break;
-        case 1:
-            detail::inflate_fixed_block(bytes, bit_offset, max_size, r);
+        case inflate_format::zlib:
+            _state = state_type::header;
             break;
-        case 2:
-            detail::inflate_dynamic_block(bytes, bit_offset, max_size, r);
+        case inflate_format::gzip:
+            // A gzip file may be empty, or have one or more members.
+            _state = state_type::member_end;
             break;
         default:
-            throw parse_error("Reserved block type");
+            hi_no_default();
+        }
+    }
+
+    /** Check if the inflater needs more input to continue.
+     *
+     * @return True when `add()` or `close()` should be called.
+     */
+    [[nodiscard]] bool need_input() const noexcept
+    {
+        return _need_input;
+    }
+
+    /** Check if all the data was decompressed and read.
+     */
+    [[nodiscard]] bool done() const noexcept
+    {
+        return _state == state_type::done and _window_read == _window_end;
+    }
+
+    /** The number of bytes of compressed data that were consumed.
+     *
+     * After `done()` this is the offset of the first byte after the compressed data.
+     */
+    [[nodiscard]] std::size_t consumed() const noexcept
+    {
+        return _source_offset + (_reader.bit_offset() + 7) / 8;
+    }
+
+    /** Add a chunk of compressed data.
+     *
+     * @pre `need_input()` must be true.
+     * @param bytes The compressed data, which must remain valid until `need_input()` is true again.
+     */
+    void add(std::span<std::byte const> bytes)
+    {
+        hi_assert(_need_input);
+        hi_assert(not _closed);
+        _need_input = false;
+
+        // The partial code at the end of the previous chunk is copied
+        // together with the start of the new chunk into the carry buffer.
+        hilet source = this->source();
+        hilet bit_offset = _reader.bit_offset();
+        hilet byte_offset = bit_offset / 8;
+        hilet leftover = source.subspan(byte_offset);
+
+        _source_offset += byte_offset;
+        _chunk = bytes;
+
+        if (leftover.empty()) {
+            _reading_carry = false;
+            _reader = bit_reader{_chunk};
+
+        } else {
+            hilet lookahead = bytes.first(std::min(bytes.size(), carry_lookahead));
+
+            auto carry = std::vector<std::byte>{};
+            carry.reserve(leftover.size() + lookahead.size());
+            carry.insert(carry.end(), leftover.begin(), leftover.end());
+            carry.insert(carry.end(), lookahead.begin(), lookahead.end());
+
+            _carry = std::move(carry);
+            _carry_prefix = leftover.size();
+            _reading_carry = true;
+            _reader = bit_reader{_carry};
+            _reader.refill();
+            _reader.skip(bit_offset % 8);
         }
+    }
+
+    /** Mark the end of the compressed data.
+     *
+     * After `close()` the inflater will throw a `parse_error` when it needs
+     * more input to finish decompression.
+     */
+    void close() noexcept
+    {
+        _closed = true;
+        _need_input = false;
+    }
+
+    /** Read decompressed data.
+     *
+     * @param output The buffer to write the decompressed data into.
+     * @return The number of bytes written into @a output. This is less than
+     *         the size of @a output only when the inflater is `done()` or `need_input()`.
+     * @throws parse_error When the compressed data is invalid.
+     */
+    [[nodiscard]] std::size_t read(std::span<std::byte> output)
+    {
+        auto r = 0_uz;
+        while (true) {
+            if (hilet n = std::min(output.size() - r, _window_end - _window_read)) {
+                std::memcpy(output.data() + r, _window.data() + _window_read, n);
+                r += n;
+                _window_read += n;
+            }
+
+            if (r == output.size() or _state == state_type::done or _need_input) {
+                return r;
+            }
+
+            if (_window_end + detail::deflate_max_match_length >= _window.size()) {
+                slide_window();
+            }
+
+            // A match may overshoot the limit, the remaining bytes are read on the next call.
+            hilet limit = std::min(_window.size() - detail::deflate_max_match_length, _window_end + (output.size() - r));
+            if (not decode(limit)) {
+                hi_check(not _closed, "Unexpected end of compressed data");
+                _need_input = true;
+            }
+        }
+    }
+
+    /** Read all the remaining decompressed data.
+     *
+     * Reading stops when the inflater is `done()` or `need_input()`.
+     *
+     * @param max_size The maximum number of bytes to read.
+     * @return The decompressed data.
+     * @throws parse_error When the compressed data is invalid, or more than @a max_size bytes are decompressed.
+     */
+    [[nodiscard]] bstring read_all(std::size_t max_size = 0x0100'0000)
+    {
+        auto r = bstring{};
+        while (not done() and not need_input()) {
+            hilet offset = r.size();
+            hilet room = max_size - offset;
+            hilet grow_size = std::max(offset, 0x1'0000_uz);
+            hilet chunk_size = room < grow_size ? room + 1 : grow_size;
+
+            r.resize(offset + chunk_size);
+            r.resize(offset + read(std::span{r.data() + offset, chunk_size}));
+            hi_check(r.size() <= max_size, "Output buffer overrun");
+        }
+        return r;
+    }
+
+private:
+    constexpr static std::size_t window_capacity = 4 * window_size;
+
+    /** Number of bytes of a new chunk to copy into the carry buffer.
+     *
+     * Must be larger than the largest header, which are the dynamic huffman tables.
+     */
+    constexpr static std::size_t carry_lookahead = 0x1000;
+
+    enum class state_type : uint8_t {
+        header,
+        gzip_extra,
+        gzip_skip,
+        gzip_string,
+        block_header,
+        stored,
+        huffman,
+        trailer,
+        member_end,
+        done
+    };
+
+    inflate_format _format = inflate_format::deflate;
+    state_type _state = state_type::block_header;
+
+    /** The current block is the last block.
+     */
+    bool _final = false;
+    bool _fixed_tables = false;
+    bool _closed = false;
+    bool _need_input = true;
+
+    /** The gzip header flags that still need to be processed.
+     */
+    uint8_t _gzip_flags = 0;
+
+    /** Number of bytes to skip in the gzip header, or to copy from a stored block.
+     */
+    std::size_t _count = 0;
+
+    /** Number of bytes decompressed in the current gzip member.
+     */
+    std::size_t _member_size = 0;
+
+    /** The current chunk of compressed data, owned by the caller.
+     */
+    std::span<std::byte const> _chunk = {};
+
+    /** The unconsumed bytes of the previous chunk followed by the start of `_chunk`.
+     */
+    std::vector<std::byte> _carry = {};
+
+    /** The number of bytes in `_carry` from the previous chunk.
+     */
+    std::size_t _carry_prefix = 0;
+    bool _reading_carry = false;
+
+    /** The offset in the compressed data of the first byte of the source.
+     */
+    std::size_t _source_offset = 0;
+    bit_reader _reader = {};
+
+    detail::inflate_literal_table _literal_table = {};
+    detail::inflate_distance_table _distance_table = {};
+
+    /** Decompressed data, which includes at least the previous `window_size` bytes.
+     */
+    std::vector<std::byte> _window;
+    std::size_t _window_read = 0;
+    std::size_t _window_end = 0;
+
+    [[nodiscard]] std::span<std::byte const> source() const noexcept
+    {
+        return _reading_carry ? std::span<std::byte const>{_carry} : _chunk;
+    }
+
+    /** Switch from the carry buffer to the chunk once the bytes of the previous chunk are consumed.
+     */
+    void update_source() noexcept
+    {
+        if (_reading_carry and _reader.bit_offset() >= _carry_prefix * 8) {
+            hilet bit_offset = _reader.bit_offset() - _carry_prefix * 8;
+            _source_offset += _carry_prefix;
+            _reading_carry = false;
+            _reader = bit_reader{_chunk, bit_offset / 8};
+            _reader.refill();
+            _reader.skip(bit_offset % 8);
+        }
+    }
+
+    /** Check if a number of bytes are available in the source.
+     */
+    [[nodiscard]] bool available(std::size_t nr_bytes) noexcept
+    {
+        update_source();
+        return _reader.remaining_bits() >= nr_bytes * 8;
+    }
+
+    /** Decode an item of the compressed data, or rollback when the source is exhausted.
+     *
+     * @param f A function which decodes the item.
+     * @return True if the item was decoded, false if more input is needed.
+     */
+    template<typename F>
+    [[nodiscard]] bool transaction(F&& f)
+    {
+        hilet saved_reader = _reader;
+        hilet saved_state = _state;
+        hilet saved_final = _final;
+
+        try {
+            f();
+            if (not _reader.overrun()) {
+                return true;
+            }
+        } catch (parse_error const&) {
+            if (not _reader.overrun()) {
+                throw;
+            }
+        }
+
+        _reader = saved_reader;
+        _state = saved_state;
+        _final = saved_final;
+        return false;
+    }
+
+    /** Move the last `window_size` bytes to the start of the window.
+     */
+    void slide_window() noexcept
+    {
+        hi_axiom(_window_read == _window_end);
+        if (_window_end > window_size) {
+            std::memmove(_window.data(), _window.data() + _window_end - window_size, window_size);
+            _window_end = _window_read = window_size;
+        }
+    }
+
+    /** Decode until the window contains at least @a limit bytes.
+     *
+     * @return False if more input is needed.
+     */
+    [[nodiscard]] bool decode(std::size_t limit)
+    {
+        while (_window_end < limit) {
+            update_source();
+
+            auto r = true;
+            switch (_state) {
+            case state_type::header:
+                r = _format == inflate_format::gzip ? decode_gzip_header() : decode_zlib_header();
+                break;
+            case state_type::gzip_extra:
+                r = decode_gzip_extra();
+                break;
+            case state_type::gzip_skip:
+                r = decode_gzip_skip();
+                break;
+            case state_type::gzip_string:
+                r = decode_gzip_string();
+                break;
+            case state_type::block_header:
+                r = decode_block_header();
+                break;
+            case state_type::stored:
+                r = decode_stored(limit);
+                break;
+            case state_type::huffman:
+                r = decode_huffman(limit);
+                break;
+            case state_type::trailer:
+                r = decode_trailer();
+                break;
+            case state_type::member_end:
+                r = decode_member_end();
+                break;
+            case state_type::done:
+                return true;
+            default:
+                hi_no_default();
+            }
+
+            if (not r) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool decode_zlib_header()
+    {
+        if (not available(2)) {
+            return false;
+        }
+
+        _reader.refill();
+        hilet CMF = _reader.get(8);
+        hilet FLG = _reader.get(8);
+
+        hi_check((CMF * 256 + FLG) % 31 == 0, "zlib header checksum failed.");
+        hi_check((CMF & 0xf) == 8, "zlib compression method must be 8");
+        hi_check(((CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
+        hi_check((FLG & 0x20) == 0, "zlib must not use a preset dictionary");
+
+        _state = state_type::block_header;
+        return true;
+    }
+
+    [[nodiscard]] bool decode_gzip_header()
+    {
+        if (not available(10)) {
+            return false;
+        }
+
+        _reader.refill();
+        hilet ID1 = _reader.get(8);
+        hilet ID2 = _reader.get(8);
+        hilet CM = _reader.get(8);
+        hilet FLG = _reader.get(8);
+        _reader.refill();
+        [[maybe_unused]] hilet MTIME = _reader.get(32);
+        hilet XFL = _reader.get(8);
+        [[maybe_unused]] hilet OS = _reader.get(8);
+
+        hi_check(ID1 == 31, "GZIP Member header ID1 must be 31");
+        hi_check(ID2 == 139, "GZIP Member header ID2 must be 139");
+        hi_check(CM == 8, "GZIP Member header CM must be 8");
+        hi_check((FLG & 0xe0) == 0, "GZIP Member header FLG reserved bits must be 0");
+        hi_check(XFL == 0 or XFL == 2 or XFL == 4, "GZIP Member header XFL must be 0, 2 or 4");
+
+        // FTEXT is ignored.
+        _gzip_flags = narrow_cast<uint8_t>(FLG & 0x1e);
+        next_gzip_header_state();
+        return true;
+    }
+
+    /** Select the next optional field of the gzip header.
+     */
+    void next_gzip_header_state() noexcept
+    {
+        if (_gzip_flags & 4) {
+            // FEXTRA
+            _gzip_flags &= ~4;
+            _state = state_type::gzip_extra;
+
+        } else if (_gzip_flags & 8) {
+            // FNAME
+            _gzip_flags &= ~8;
+            _state = state_type::gzip_string;
+
+        } else if (_gzip_flags & 16) {
+            // FCOMMENT
+            _gzip_flags &= ~16;
+            _state = state_type::gzip_string;
+
+        } else if (_gzip_flags & 2) {
+            // FHCRC
+            _gzip_flags &= ~2;
+            _count = 2;
+            _state = state_type::gzip_skip;
+
+        } else {
+            _state = state_type::block_header;
+        }
+    }
+
+    [[nodiscard]] bool decode_gzip_extra()
+    {
+        if (not available(2)) {
+            return false;
+        }
+
+        _reader.refill();
+        _count = _reader.get(16);
+        _state = state_type::gzip_skip;
+        return true;
+    }
+
+    [[nodiscard]] bool decode_gzip_skip()
+    {
+        for (; _count != 0; --_count) {
+            if (not available(1)) {
+                return false;
+            }
+            _reader.refill();
+            _reader.skip(8);
+        }
+
+        next_gzip_header_state();
+        return true;
+    }
+
+    [[nodiscard]] bool decode_gzip_string()
+    {
+        while (true) {
+            if (not available(1)) {
+                return false;
+            }
+            _reader.refill();
+            if (_reader.get(8) == 0) {
+                break;
+            }
+        }
+
+        next_gzip_header_state();
+        return true;
+    }
+
+    [[nodiscard]] bool decode_block_header()
+    {
+        return transaction([&] {
+            _reader.refill();
+            _final = to_bool(_reader.get(1));
+            hilet BTYPE = _reader.get(2);
+
+            switch (BTYPE) {
+            case 0:
+                {
+                    _reader.align();
+                    _reader.refill();
+                    hilet LEN = _reader.get(16);
+                    hilet NLEN = _reader.get(16);
+                    hi_check(LEN == (~NLEN & 0xffff), "Stored block LEN does not match NLEN");
+                    _count = LEN;
+                    _state = state_type::stored;
+                }
+                break;
+
+            case 1:
+                _fixed_tables = true;
+                _state = state_type::huffman;
+                break;
+
+            case 2:
+                {
+                    _reader.refill();
+                    hilet HLIT = _reader.get(5);
+                    hilet HDIST = _reader.get(5);
+                    hilet HCLEN = _reader.get(4);
+
+                    hilet code_length_table = detail::inflate_code_lengths(_reader, HCLEN + 4);
+
+                    hilet lengths = detail::inflate_lengths(_reader, HLIT + HDIST + 258, code_length_table);
+                    hi_check(lengths[256] != 0, "The end-of-block symbol must be in the table");
+
+                    hilet lengths_span = std::span{lengths};
+                    _literal_table = detail::inflate_literal_table::from_lengths(lengths_span.first(HLIT + 257));
+                    _distance_table = detail::inflate_distance_table::from_lengths(lengths_span.subspan(HLIT + 257, HDIST + 1));
+                    _fixed_tables = false;
+                    _state = state_type::huffman;
+                }
+                break;
+
+            default:
+                throw parse_error("Reserved block type");
+            }
+        });
+    }
+
+    /** Select the state after the end of a block.
+     */
+    void next_block() noexcept
+    {
+        if (not _final) {
+            _state = state_type::block_header;
+        } else if (_format == inflate_format::deflate) {
+            _state = state_type::done;
+        } else {
+            _state = state_type::trailer;
+        }
+    }
+
+    [[nodiscard]] bool decode_stored(std::size_t limit)
+    {
+        if (_count != 0) {
+            hilet source = this->source();
+            hilet offset = _reader.byte_offset();
+            hilet size = std::min({_count, source.size() - offset, limit - _window_end});
+            if (size == 0) {
+                return false;
+            }
+
+            std::memcpy(_window.data() + _window_end, source.data() + offset, size);
+            _reader.seek(offset + size);
+            _window_end += size;
+            _member_size += size;
+            _count -= size;
+        }
+
+        if (_count == 0) {
+            next_block();
+        }
+        return true;
+    }
+
+    /** Decode a literal, end-of-block or a length/distance pair.
+     *
+     * @pre At least `inflate_max_symbol_bits` must be available in the bit-reader.
+     */
+    [[nodiscard]] hi_force_inline detail::inflate_symbol decode_symbol(
+        detail::inflate_literal_table const& literal_table,
+        detail::inflate_distance_table const& distance_table)
+    {
+        hilet literal_symbol = literal_table.get_symbol(_reader);
+        if (literal_symbol <= 256) {
+            return {literal_symbol, 0};
+        }
+
+        hi_check(literal_symbol <= 285, "Literal/Length symbol out of range {}", literal_symbol);
+        hilet length_code = detail::deflate_length_codes[literal_symbol - 257];
+        hilet length = length_code.base + _reader.get(length_code.extra_bits);
+
+        hilet distance_symbol = distance_table.get_symbol(_reader);
+        hi_check(distance_symbol <= 29, "Distance symbol out of range {}", distance_symbol);
+        hilet distance_code = detail::deflate_distance_codes[distance_symbol];
+        hilet distance = distance_code.base + _reader.get(distance_code.extra_bits);
+
+        return {length, distance};
+    }
+
+    [[nodiscard]] bool decode_huffman(std::size_t limit)
+    {
+        hilet& literal_table = _fixed_tables ? detail::deflate_fixed_literal_table : _literal_table;
+        hilet& distance_table = _fixed_tables ? detail::deflate_fixed_distance_table : _distance_table;
+
+        hilet window = _window.data();
+        hilet start = _window_end;
+        auto end = start;
+        auto r = true;
+
+        while (end < limit) {
+            auto symbol = detail::inflate_symbol{};
+
+            if (_reader.remaining_bits() >= detail::inflate_max_symbol_bits) [[likely]] {
+                _reader.refill();
+                symbol = decode_symbol(literal_table, distance_table);
+
+            } else if (_reading_carry and _reader.bit_offset() >= _carry_prefix * 8) {
+                update_source();
+                continue;
+
+            } else if (not transaction([&] {
+                           _reader.refill();
+                           symbol = decode_symbol(literal_table, distance_table);
+                       })) {
+                r = false;
+                break;
+            }
+
+            if (symbol.distance == 0) {
+                if (symbol.value <= 255) {
+                    window[end++] = static_cast<std::byte>(symbol.value);
+                } else {
+                    // End-of-block.
+                    next_block();
+                    break;
+                }
+
+            } else {
+                hi_check(symbol.distance <= end, "Distance beyond start of decompressed data");
+                detail::inflate_copy_match(window + end, symbol.value, symbol.distance);
+                end += symbol.value;
+            }
+        }
+
+        _member_size += end - start;
+        _window_end = end;
+        return r;
+    }
+
+    [[nodiscard]] bool decode_trailer()
+    {
+        _reader.align();
+
+        if (_format == inflate_format::zlib) {
+            if (not available(4)) {
+                return false;
+            }
+
+            _reader.refill();
+            [[maybe_unused]] hilet ADLER32 = _reader.get(32);
+            _state = state_type::done;
+
+        } else {
+            if (not available(8)) {
+                return false;
+            }
+
+            _reader.refill();
+            [[maybe_unused]] hilet CRC32 = _reader.get(32);
+            _reader.refill();
+            hilet ISIZE = _reader.get(32);
+
+            hi_check(
+                ISIZE == (_member_size & 0xffffffff),
+                "GZIP Member header ISIZE must be same as the lower 32 bits of the inflated size.");
+            _member_size = 0;
+            _state = state_type::member_end;
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool decode_member_end()
+    {
+        if (available(1)) {
+            _state = state_type::header;
+            return true;
+
+        } else if (_closed) {
+            _state = state_type::done;
+            return true;
+
+        } else {
+            return false;
+        }
+    }
+};
+
+/** Inflate raw compressed data using the deflate algorithm.
+ *
+ * This is a one-shot wrapper around `inflater`.
+ *
+ * @param bytes The bytes containing the compressed data.
+ * @param[in,out] offset The offset in @a bytes where the compressed data starts,
+ *                       on return the offset of the first byte after the compressed data.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throws parse_error When the compressed data is invalid or exceeds @a max_size.
+ */
+hi_export [[nodiscard]] hi_inline bstring
+inflate(std::span<std::byte const> bytes, std::size_t& offset, std::size_t max_size = 0x0100'0000)
+{
+    hi_check(offset <= bytes.size(), "Input buffer overrun");
 
-    } while (!BFINAL);
+    auto stream = inflater{};
+    stream.add(bytes.subspan(offset));
+    stream.close();
 
-    offset = (bit_offset + 7) / 8;
+    auto r = stream.read_all(max_size);
+    offset += stream.consumed();
     return r;
 }
 
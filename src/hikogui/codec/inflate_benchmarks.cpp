@@ -0,0 +1,43 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gzip.hpp"
+#include "../file/file.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(inflate_benchmarks, gzip_decompress)
+{
+    auto total_size = 0_uz;
+    auto files = std::vector<file_view>{};
+    for (auto i = 1; i <= 8; ++i) {
+        hilet path = library_source_dir() / "tests" / "data" / std::format("gzip_test{}.bin.gz", i);
+        hilet& compressed = files.emplace_back(path);
+        hilet compressed_bytes = as_span<std::byte const>(compressed);
+
+        hilet size = gzip_decompress(compressed_bytes, 0x0100'0000).size();
+        hilet rate = benchmark_rate([&] {
+            auto decompressed = gzip_decompress(compressed_bytes, 0x0100'0000);
+            ASSERT_EQ(decompressed.size(), size);
+        });
+
+        benchmark_report(path.filename().string(), rate * size / 1'000'000.0, "MB/s");
+        total_size += size;
+    }
+
+    hilet rate = benchmark_rate([&] {
+        for (hilet& compressed : files) {
+            [[maybe_unused]] auto decompressed = gzip_decompress(as_span<std::byte const>(compressed), 0x0100'0000);
+        }
+    });
+    benchmark_report("all", rate * total_size / 1'000'000.0, "MB/s");
+}
@@ -9,16 +9,20 @@
 #include "../image/image.hpp"
 #include "../geometry/geometry.hpp"
 #include "../container/container.hpp"
+#include "../concurrency/thread_pool.hpp"
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "zlib.hpp"
+#include "png_unfilter.hpp"
 #include <span>
 #include <vector>
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <numeric>
+#include <concepts>
 #include <filesystem>
 #include <memory>
+#include <algorithm>
 
 hi_export_module(hikogui.codec.png);
 
@@ -47,17 +51,104 @@ public:
         return _height;
     }
 
+    /** The number of lines that are decompressed, unfiltered and converted at once.
+     *
+     * A batch is large enough to convert it in parallel on the thread pool.
+     * When decoding progressively the completed rows are reported once per
+     * batch; batches start at multiples of this number of lines from the top
+     * of the image.
+     */
+    [[nodiscard]] std::size_t lines_per_batch() const noexcept
+    {
+        hilet max_nr_bands = thread_pool::global().size() + 1;
+        return std::max(1_uz, min_pixels_per_band * max_nr_bands / narrow_cast<std::size_t>(std::max(1, _width)));
+    }
+
+    /** Decode the image.
+     *
+     * @param image The image to decode into, must have the same size as the PNG.
+     * @throws parse_error When the image data is invalid.
+     */
     void decode_image(pixmap_span<sfloat_rgba16> image) const
     {
-        // There is a filter selection byte in front of every line.
-        hilet image_data_size = _stride * _height;
+        hi_axiom(image.width() == width() and image.height() == height());
+        decode_rows(image, 0, height(), [](std::size_t, std::size_t) {});
+    }
 
-        auto image_data = decompress_IDATs(image_data_size);
-        hi_check(ssize(image_data) == image_data_size, "Uncompressed image data has incorrect size.");
+    /** Decode a range of rows of the image.
+     *
+     * The image data is decompressed, unfiltered and converted a batch of lines
+     * at a time, so that memory usage does not depend on the size of the image.
+     * Decoding stops after the last line of the requested rows.
+     *
+     * Since the PNG lines are stored from top to bottom and the rows of an
+     * image from bottom to top; rows near the top of the image are the
+     * fastest to decode.
+     *
+     * @param image The image to decode into, must be as wide as the PNG and
+     *              as high as the number of requested rows.
+     * @param first The first row to decode, row 0 is the bottom row.
+     * @param last One beyond the last row to decode.
+     * @throws parse_error When the image data is invalid.
+     */
+    void decode_rows(pixmap_span<sfloat_rgba16> image, std::size_t first, std::size_t last) const
+    {
+        decode_rows(image, first, last, [](std::size_t, std::size_t) {});
+    }
 
-        unfilter_lines(image_data);
+    /** Decode a range of rows of the image progressively.
+     *
+     * @see decode_rows(pixmap_span<sfloat_rgba16>, std::size_t, std::size_t)
+     * @param image The image to decode into, must be as wide as the PNG and
+     *              as high as the number of requested rows.
+     * @param first The first row to decode, row 0 is the bottom row.
+     * @param last One beyond the last row to decode.
+     * @param on_rows Called with the range of rows in @a image that were
+     *                completed, as `on_rows(first, last)`. Rows complete from top to bottom.
+     * @throws parse_error When the image data is invalid.
+     */
+    template<std::invocable<std::size_t, std::size_t> OnRows>
+    void decode_rows(pixmap_span<sfloat_rgba16> image, std::size_t first, std::size_t last, OnRows const& on_rows) const
+    {
+        hi_axiom(first <= last and last <= height());
+        hi_axiom(image.width() == width() and image.height() == last - first);
+
+        hilet stride = narrow_cast<std::size_t>(_stride);
+
+        // The PNG lines to convert; decoding stops after the last line.
+        hilet first_line = height() - last;
+        hilet last_line = height() - first;
+
+        hilet nr_batch_lines = std::min(lines_per_batch(), std::max(1_uz, last_line));
+        auto batch = bstring(nr_batch_lines * stride, std::byte{0});
+        auto prev_line = std::vector<uint8_t>(_bytes_per_line, uint8_t{0});
+        auto idat_it = _idat_chunk_data.begin();
+        auto stream = inflater{inflate_format::zlib};
+
+        for (auto line = 0_uz; line < last_line; line += nr_batch_lines) {
+            hilet nr_lines = std::min(nr_batch_lines, last_line - line);
+            hilet lines = std::span{batch}.first(nr_lines * stride);
+
+            inflate_lines(stream, idat_it, lines);
+            unfilter_lines(lines, prev_line);
+
+            // Convert only the lines of the batch that are inside the requested rows.
+            hilet convert_first = std::max(line, first_line);
+            hilet convert_last = line + nr_lines;
+            if (convert_first < convert_last) {
+                // Line y of the PNG is row (height - 1 - y) of the PNG, and row (last_line - 1 - y) of the span.
+                hilet row_first = last_line - convert_last;
+                hilet row_last = last_line - convert_first;
+                data_to_image(
+                    lines.subspan((convert_first - line) * stride, (convert_last - convert_first) * stride),
+                    image.subimage(0, row_first, image.width(), row_last - row_first));
+                on_rows(row_first, row_last);
+            }
+        }
 
-        data_to_image(image_data, image);
+        if (last_line == height()) {
+            check_end_of_lines(stream, idat_it);
+        }
     }
 
     [[nodiscard]] static pixmap<sfloat_rgba16> load(std::filesystem::path const& path)
@@ -133,6 +224,10 @@ private:
     int _bytes_per_line = 0;
     int _stride = 0;
 
+    /** The minimum number of pixels to convert on a single thread.
+     */
+    constexpr static std::size_t min_pixels_per_band = 0x1'0000;
+
     /** Spans of compressed data.
      */
     std::vector<std::span<std::byte const>> _idat_chunk_data;
@@ -156,36 +251,6 @@ private:
         throw parse_error("string is not null terminated.");
     }
 
-    static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
-    {
-        hilet a = static_cast<int>(_a);
-        hilet b = static_cast<int>(_b);
-        hilet c = static_cast<int>(_c);
-
-        hilet p = a + b - c;
-        hilet pa = std::abs(p - a);
-        hilet pb = std::abs(p - b);
-        hilet pc = std::abs(p - c);
-
-        if (pa <= pb && pa <= pc) {
-            return narrow_cast<uint8_t>(a);
-        } else if (pb <= pc) {
-            return narrow_cast<uint8_t>(b);
-        } else {
-            return narrow_cast<uint8_t>(c);
-        }
-    }
-
-    static uint16_t get_sample(std::span<std::byte const> bytes, ssize_t& offset, bool two_bytes)
-    {
-        uint16_t value = static_cast<uint8_t>(bytes[offset++]);
-        if (two_bytes) {
-            value <<= 8;
-            value |= static_cast<uint8_t>(bytes[offset++]);
-        }
-        return value;
-    }
-
     void read_header(std::span<std::byte const> bytes, std::size_t& offset)
     {
         hilet png_header = make_placement_ptr<PNGHeader>(bytes, offset);
@@ -392,152 +457,187 @@ private:
         }
     }
 
-    [[nodiscard]] bstring decompress_IDATs(std::size_t image_data_size) const
+    /** Decompress the next lines of the image data.
+     *
+     * @param stream The inflater of the image data.
+     * @param idat_it The iterator to the next IDAT chunk to add to @a stream.
+     * @param lines The buffer to fill with lines, including the filter-type bytes.
+     * @throws parse_error When there is not enough image data.
+     */
+    void inflate_lines(
+        inflater& stream,
+        std::vector<std::span<std::byte const>>::const_iterator& idat_it,
+        std::span<std::byte> lines) const
     {
-        if (ssize(_idat_chunk_data) == 1) {
-            return zlib_decompress(_idat_chunk_data[0], image_data_size);
-        } else {
-            // Merge all idat chunks together.
-            hilet compressed_data_size =
-                std::accumulate(_idat_chunk_data.cbegin(), _idat_chunk_data.cend(), ssize_t{0}, [](hilet& a, hilet& b) {
-                    return a + ssize(b);
-                });
-
-            bstring compressed_data;
-            compressed_data.reserve(compressed_data_size);
-            for (hilet chunk_data : _idat_chunk_data) {
-                std::copy(chunk_data.begin(), chunk_data.end(), std::back_inserter(compressed_data));
+        while (not lines.empty()) {
+            if (stream.need_input()) {
+                if (idat_it == _idat_chunk_data.end()) {
+                    stream.close();
+                } else {
+                    stream.add(*idat_it++);
+                }
             }
 
-            return zlib_decompress(compressed_data, image_data_size);
-        }
-    }
-
-    void unfilter_lines(bstring& image_data) const
-    {
-        hilet image_bytes = std::span(reinterpret_cast<uint8_t *>(image_data.data()), image_data.size());
-        auto zero_line = std::vector<uint8_t>(_bytes_per_line, uint8_t{0});
-
-        auto prev_line = std::span(zero_line.data(), zero_line.size());
-        for (auto y = 0_uz; y != _height; ++y) {
-            hilet line = image_bytes.subspan(y * _stride, _stride);
-            unfilter_line(line, prev_line);
-            prev_line = line.subspan(1, _bytes_per_line);
+            hilet n = stream.read(lines);
+            lines = lines.subspan(n);
+            hi_check(lines.empty() or not stream.done(), "Uncompressed image data has incorrect size.");
         }
     }
 
-    void unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const
-    {
-        switch (line[0]) {
-        case 0:
-            return;
-        case 1:
-            return unfilter_line_sub(line.subspan(1, _bytes_per_line), prev_line);
-        case 2:
-            return unfilter_line_up(line.subspan(1, _bytes_per_line), prev_line);
-        case 3:
-            return unfilter_line_average(line.subspan(1, _bytes_per_line), prev_line);
-        case 4:
-            return unfilter_line_paeth(line.subspan(1, _bytes_per_line), prev_line);
-        default:
-            throw parse_error("Unknown line-filter type");
-        }
-    }
-
-    void unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+    /** Check that the image data ends after the last line.
+     *
+     * @param stream The inflater of the image data, after the last line was read.
+     * @param idat_it The iterator to the next IDAT chunk to add to @a stream.
+     * @throws parse_error When there is more image data than the image needs.
+     */
+    void check_end_of_lines(inflater& stream, std::vector<std::span<std::byte const>>::const_iterator& idat_it) const
     {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
+        auto extra = std::array<std::byte, 1>{};
+        while (not stream.done()) {
+            if (stream.need_input()) {
+                if (idat_it == _idat_chunk_data.end()) {
+                    stream.close();
+                } else {
+                    stream.add(*idat_it++);
+                }
+            }
 
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += prev_raw;
+            hi_check(stream.read(extra) == 0, "Uncompressed image data has incorrect size.");
         }
     }
 
-    void unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+    /** Unfilter lines of image data in place.
+     *
+     * @param lines The lines of image data, including the filter-type bytes.
+     * @param prev_line The unfiltered previous line; on return the last line of @a lines.
+     * @throws parse_error On an unknown filter type.
+     */
+    void unfilter_lines(std::span<std::byte> lines, std::vector<uint8_t>& prev_line) const
     {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            line[i] += prev_line[i];
+        hilet stride = narrow_cast<std::size_t>(_stride);
+        hilet bytes = std::span(reinterpret_cast<uint8_t *>(lines.data()), lines.size());
+
+        auto prev = std::span<uint8_t const>{prev_line};
+        for (auto offset = 0_uz; offset != bytes.size(); offset += stride) {
+            hilet line = bytes.subspan(offset, stride);
+            detail::png_unfilter_line(line[0], line.subspan(1), prev, _bytes_per_pixel);
+            prev = line.subspan(1);
         }
+        std::copy(prev.begin(), prev.end(), prev_line.begin());
     }
 
-    void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
-
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += (prev_raw + prev_line[i]) / 2;
-        }
-    }
-
-    void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
+    /** Convert unfiltered lines to the image.
+     *
+     * @param lines The unfiltered lines, including the filter-type bytes.
+     * @param image The image to write to; the first line is written to the top row.
+     */
+    void data_to_image(std::span<std::byte const> lines, pixmap_span<sfloat_rgba16> image) const
     {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
-
-            uint8_t const up = prev_line[i];
-            uint8_t const left = j >= 0 ? line[j] : 0;
-            uint8_t const left_up = j >= 0 ? prev_line[j] : 0;
-            line[i] += paeth_predictor(left, up, left_up);
-        }
+        // Rows are converted independently, split the image in bands of rows that are converted in parallel.
+        hilet height = image.height();
+        hilet nr_pixels = image.width() * height;
+        auto& pool = thread_pool::global();
+        hilet max_nr_bands = pool.size() + 1;
+        hilet nr_bands = std::clamp(nr_pixels / min_pixels_per_band, 1_uz, max_nr_bands);
+        hilet rows_per_band = std::max(1_uz, (height + nr_bands - 1) / nr_bands);
+
+        pool.parallel_for((height + rows_per_band - 1) / rows_per_band, [&](std::size_t band) {
+            hilet first = band * rows_per_band;
+            data_to_image_rows(lines, image, first, std::min(first + rows_per_band, height));
+        });
     }
 
-    void data_to_image(bstring bytes, pixmap_span<sfloat_rgba16> image) const noexcept
+    void data_to_image_rows(std::span<std::byte const> bytes, pixmap_span<sfloat_rgba16> image, std::size_t first, std::size_t last)
+        const
     {
-        auto bytes_span = std::span(bytes);
-
-        for (int y = 0; y != _height; ++y) {
-            int inv_y = _height - y - 1;
-
-            auto bytes_line = bytes_span.subspan(inv_y * _stride + 1, _bytes_per_line);
-            auto pixel_line = image[y];
-            data_to_image_line(bytes_line, pixel_line);
+        if (_bit_depth == 16) {
+            return data_to_image_rows<true>(bytes, image, first, last);
+        } else {
+            return data_to_image_rows<false>(bytes, image, first, last);
         }
     }
 
-    void data_to_image_line(std::span<std::byte const> bytes, std::span<sfloat_rgba16> line) const noexcept
+    template<bool SixteenBit>
+    void data_to_image_rows(std::span<std::byte const> bytes, pixmap_span<sfloat_rgba16> image, std::size_t first, std::size_t last)
+        const
     {
-        hilet alpha_mul = _bit_depth == 16 ? 1.0f / 65535.0f : 1.0f / 255.0f;
-        for (int x = 0; x != _width; ++x) {
-            hilet value = extract_pixel_from_line(bytes, x);
-
-            hilet linear_RGB =
-                f32x4{_transfer_function[value.x()], _transfer_function[value.y()], _transfer_function[value.z()], 1.0f};
-
-            hilet linear_sRGB_color = _color_to_sRGB * linear_RGB;
-            hilet alpha = static_cast<float>(value.w()) * alpha_mul;
-
-            // pre-multiply the alpha for use in texture-maps.
-            line[x] = linear_sRGB_color * f32x4::broadcast(alpha);
+        if (_is_color) {
+            if (_has_alpha) {
+                return data_to_image_rows<SixteenBit, true, true>(bytes, image, first, last);
+            } else {
+                return data_to_image_rows<SixteenBit, true, false>(bytes, image, first, last);
+            }
+        } else {
+            if (_has_alpha) {
+                return data_to_image_rows<SixteenBit, false, true>(bytes, image, first, last);
+            } else {
+                return data_to_image_rows<SixteenBit, false, false>(bytes, image, first, last);
+            }
         }
     }
 
-    u16x4 extract_pixel_from_line(std::span<std::byte const> bytes, int x) const noexcept
+    /** Convert rows of unfiltered image data to the image.
+     *
+     * Each row is first converted to linear pre-multiplied floats, then all the
+     * floats of the row are converted to half-floats in a single pass.
+     *
+     * @param bytes The unfiltered lines, including the filter-type bytes.
+     * @param image The image to write the rows to; the first line is written to the top row.
+     * @param first The first row of the image to convert.
+     * @param last One beyond the last row of the image to convert.
+     */
+    template<bool SixteenBit, bool IsColor, bool HasAlpha>
+    void data_to_image_rows(std::span<std::byte const> bytes, pixmap_span<sfloat_rgba16> image, std::size_t first, std::size_t last)
+        const
     {
-        hi_axiom(_bit_depth == 8 or _bit_depth == 16);
-        hi_axiom(not _is_palletted);
-
-        uint16_t r = 0;
-        uint16_t g = 0;
-        uint16_t b = 0;
-        uint16_t a = 0;
+        static_assert(sizeof(sfloat_rgba16) == sizeof(f32x4) / 2);
+
+        constexpr auto bytes_per_sample = SixteenBit ? 2_uz : 1_uz;
+        constexpr auto bytes_per_pixel = ((IsColor ? 3_uz : 1_uz) + (HasAlpha ? 1_uz : 0_uz)) * bytes_per_sample;
+        constexpr auto alpha_mul = SixteenBit ? 1.0f / 65535.0f : 1.0f / 255.0f;
+
+        hilet width = narrow_cast<std::size_t>(_width);
+        auto row = std::vector<f32x4>(width);
+
+        for (auto y = first; y != last; ++y) {
+            hilet inv_y = image.height() - y - 1;
+            hilet line = bytes.data() + inv_y * narrow_cast<std::size_t>(_stride) + 1;
+
+            hilet get_sample = [line](std::size_t offset) -> std::size_t {
+                if constexpr (SixteenBit) {
+                    return load_be<uint16_t>(line + offset);
+                } else {
+                    return std::to_integer<uint8_t>(line[offset]);
+                }
+            };
+
+            for (auto x = 0_uz; x != width; ++x) {
+                hilet offset = x * bytes_per_pixel;
+
+                auto linear_RGB = f32x4{};
+                if constexpr (IsColor) {
+                    linear_RGB = f32x4{
+                        _transfer_function[get_sample(offset)],
+                        _transfer_function[get_sample(offset + bytes_per_sample)],
+                        _transfer_function[get_sample(offset + bytes_per_sample * 2)],
+                        1.0f};
+                } else {
+                    hilet value = _transfer_function[get_sample(offset)];
+                    linear_RGB = f32x4{value, value, value, 1.0f};
+                }
+
+                auto linear_sRGB_color = _color_to_sRGB * linear_RGB;
+                if constexpr (HasAlpha) {
+                    // pre-multiply the alpha for use in texture-maps.
+                    hilet alpha = static_cast<float>(get_sample(offset + bytes_per_pixel - bytes_per_sample)) * alpha_mul;
+                    linear_sRGB_color = linear_sRGB_color * f32x4::broadcast(alpha);
+                }
+                row[x] = linear_sRGB_color;
+            }
 
-        ssize_t offset = x * _bytes_per_pixel;
-        if (_is_color) {
-            r = get_sample(bytes, offset, _bit_depth == 16);
-            g = get_sample(bytes, offset, _bit_depth == 16);
-            b = get_sample(bytes, offset, _bit_depth == 16);
-        } else {
-            r = g = b = get_sample(bytes, offset, _bit_depth == 16);
-        }
-        if (_has_alpha) {
-            a = get_sample(bytes, offset, _bit_depth == 16);
-        } else {
-            a = (_bit_depth == 16) ? 65535 : 255;
+            // sfloat_rgba16 is four halfs, the same layout as four uint16_t.
+            float_to_half(reinterpret_cast<float const *>(row.data()), reinterpret_cast<uint16_t *>(image[y].data()), width * 4);
         }
-
-        return u16x4{r, g, b, a};
     }
 };
 
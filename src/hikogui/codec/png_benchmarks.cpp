@@ -0,0 +1,90 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png.hpp"
+#include "png_unfilter.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(png_benchmarks, unfilter)
+{
+    constexpr auto nr_lines = 256_uz;
+    constexpr auto line_size = 4096_uz * 4;
+
+    auto engine = std::mt19937{42};
+    auto filtered = std::vector<uint8_t>(nr_lines * line_size);
+    for (auto& c : filtered) {
+        c = narrow_cast<uint8_t>(engine() & 0xff);
+    }
+
+    auto image = filtered;
+    constexpr auto filter_names = std::array{"none", "sub", "up", "average", "paeth"};
+    for (auto filter_type = uint8_t{1}; filter_type != 5; ++filter_type) {
+        for (hilet bytes_per_pixel : {3_uz, 4_uz, 8_uz}) {
+            hilet unfilter = [&](auto const& f) {
+                image = filtered;
+                for (auto y = 1_uz; y != nr_lines; ++y) {
+                    hilet line = std::span{image}.subspan(y * line_size, line_size);
+                    hilet prev_line = std::span{image}.subspan((y - 1) * line_size, line_size);
+                    f(filter_type, line, prev_line, bytes_per_pixel);
+                }
+            };
+
+            hilet generic_rate = benchmark_rate([&] {
+                unfilter(detail::png_unfilter_line_generic);
+            });
+            hilet simd_rate = benchmark_rate([&] {
+                unfilter(detail::png_unfilter_line);
+            });
+
+            hilet name = std::format("{} {} bytes/pixel", filter_names[filter_type], bytes_per_pixel);
+            benchmark_report(name + " generic", generic_rate * filtered.size() / 1'000'000.0, "MB/s");
+            benchmark_report(name + " simd", simd_rate * filtered.size() / 1'000'000.0, "MB/s");
+        }
+    }
+}
+
+TEST(png_benchmarks, load)
+{
+    // The largest RGBA image in the repository.
+    hilet path = library_source_dir() / "docs" / "media" / "screenshots" / "historic" /
+        "TTauri-screenshot-20190412-DynamicTextureAtlas.png";
+
+    hilet png_data = png(path);
+    auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+
+    hilet rate = benchmark_rate([&] {
+        png_data.decode_image(image);
+    });
+    benchmark_report("decode_image", rate * png_data.width() * png_data.height() / 1'000'000.0, "Mpixels/s");
+}
+
+TEST(png_benchmarks, decode_rows)
+{
+    hilet path = library_source_dir() / "docs" / "media" / "screenshots" / "historic" /
+        "TTauri-screenshot-20190412-DynamicTextureAtlas.png";
+
+    hilet png_data = png(path);
+
+    // Decoding stops after the requested rows, the top rows are the cheapest to decode.
+    for (hilet divider : {1_uz, 2_uz, 8_uz}) {
+        hilet nr_rows = png_data.height() / divider;
+        hilet first = png_data.height() - nr_rows;
+        auto rows = pixmap<sfloat_rgba16>{png_data.width(), nr_rows};
+
+        hilet rate = benchmark_rate([&] {
+            png_data.decode_rows(rows, first, png_data.height());
+        });
+        benchmark_report(std::format("decode_rows top 1/{}", divider), rate, "images/s");
+    }
+}
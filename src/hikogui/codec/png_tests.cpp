@@ -0,0 +1,101 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png.hpp"
+#include "../path/path.hpp"
+#include "../image/image.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <utility>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** A tall RGBA image, it is decoded in multiple batches.
+ *
+ * Lines use every filter type, and the image data is split over multiple IDAT chunks.
+ */
+[[nodiscard]] std::filesystem::path large_png_path()
+{
+    return library_source_dir() / "tests" / "data" / "png_test1.png";
+}
+
+} // namespace
+
+TEST(png, decode_rows)
+{
+    hilet png_data = png(large_png_path());
+    auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+    png_data.decode_image(image);
+
+    hilet height = png_data.height();
+    hilet ranges = std::array{
+        std::pair{0_uz, height},
+        std::pair{0_uz, 1_uz},
+        std::pair{height - 1, height},
+        std::pair{height / 3, height / 2},
+        std::pair{height / 2, height / 2}};
+
+    for (hilet [first, last] : ranges) {
+        auto rows = pixmap<sfloat_rgba16>{png_data.width(), last - first};
+        png_data.decode_rows(rows, first, last);
+        ASSERT_EQ(rows, image.subimage(0, first, png_data.width(), last - first));
+    }
+}
+
+TEST(png, decode_rows_progressive)
+{
+    hilet png_data = png(large_png_path());
+    hilet width = png_data.width();
+    hilet height = png_data.height();
+
+    auto image = pixmap<sfloat_rgba16>{width, height};
+    png_data.decode_image(image);
+
+    hilet first = 100_uz;
+    hilet last = height - 100;
+
+    // PNG lines are numbered from the top of the image, batches start at a multiple of lines_per_batch().
+    hilet nr_batch_lines = png_data.lines_per_batch();
+    hilet first_line = height - last;
+    hilet last_line = height - first;
+    auto expected_ranges = std::vector<std::pair<std::size_t, std::size_t>>{};
+    for (auto line = first_line / nr_batch_lines * nr_batch_lines; line < last_line; line += nr_batch_lines) {
+        hilet convert_first = std::max(line, first_line);
+        hilet convert_last = std::min(line + nr_batch_lines, last_line);
+        expected_ranges.emplace_back(last_line - convert_last, last_line - convert_first);
+    }
+
+    auto rows = pixmap<sfloat_rgba16>{width, last - first};
+    auto ranges = std::vector<std::pair<std::size_t, std::size_t>>{};
+    png_data.decode_rows(rows, first, last, [&](std::size_t row_first, std::size_t row_last) {
+        ranges.emplace_back(row_first, row_last);
+
+        // The reported rows are complete when the callback is called.
+        ASSERT_EQ(
+            rows.subimage(0, row_first, width, row_last - row_first),
+            image.subimage(0, first + row_first, width, row_last - row_first));
+    });
+
+    ASSERT_EQ(ranges, expected_ranges);
+    ASSERT_EQ(rows, image.subimage(0, first, width, last - first));
+}
+
+TEST(png, too_much_image_data)
+{
+    // The image data contains one more line than the height of the image.
+    hilet png_data = png(library_source_dir() / "tests" / "data" / "png_test2.png");
+    auto image = pixmap<sfloat_rgba16>{png_data.width(), png_data.height()};
+    ASSERT_THROW(png_data.decode_image(image), parse_error);
+
+    // Decoding rows that do not include the last line does not read the rest of the image data.
+    auto rows = pixmap<sfloat_rgba16>{png_data.width(), 4};
+    ASSERT_NO_THROW(png_data.decode_rows(rows, 4, 8));
+}
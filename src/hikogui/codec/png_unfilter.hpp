@@ -0,0 +1,411 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/png_unfilter.hpp Reverse the PNG line-filters.
+ *
+ * The Up filter is processed 16 or 32 bytes at a time. The Sub filter is a
+ * prefix-sum which is calculated inside a 16 byte register. The Average and
+ * Paeth filters depend on the unfiltered pixel to the left, these are processed
+ * one whole pixel at a time.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <bit>
+
+#if defined(HI_HAS_X86)
+#include <immintrin.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+hi_export_module(hikogui.codec.png_unfilter);
+
+hi_export namespace hi { inline namespace v1 {
+namespace detail {
+
+[[nodiscard]] constexpr uint8_t png_paeth_predictor(uint8_t a, uint8_t b, uint8_t c) noexcept
+{
+    hilet p = int{a} + int{b} - int{c};
+    hilet pa = std::abs(p - int{a});
+    hilet pb = std::abs(p - int{b});
+    hilet pc = std::abs(p - int{c});
+
+    if (pa <= pb and pa <= pc) {
+        return a;
+    } else if (pb <= pc) {
+        return b;
+    } else {
+        return c;
+    }
+}
+
+hi_inline void png_unfilter_sub_generic(std::span<uint8_t> line, std::size_t bytes_per_pixel) noexcept
+{
+    for (auto i = bytes_per_pixel; i < line.size(); ++i) {
+        line[i] += line[i - bytes_per_pixel];
+    }
+}
+
+hi_inline void png_unfilter_up_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    for (auto i = 0_uz; i != line.size(); ++i) {
+        line[i] += prev_line[i];
+    }
+}
+
+hi_inline void
+png_unfilter_average_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hilet first = std::min(bytes_per_pixel, line.size());
+    for (auto i = 0_uz; i != first; ++i) {
+        line[i] += prev_line[i] / 2;
+    }
+    for (auto i = first; i != line.size(); ++i) {
+        line[i] += narrow_cast<uint8_t>((line[i - bytes_per_pixel] + prev_line[i]) / 2);
+    }
+}
+
+hi_inline void
+png_unfilter_paeth_generic(std::span<uint8_t> line, std::span<uint8_t const> prev_line, std::size_t bytes_per_pixel) noexcept
+{
+    hilet first = std::min(bytes_per_pixel, line.size());
+    for (auto i = 0_uz; i != first; ++i) {
+        // The predictor with a and c zero is always b.
+        line[i] += prev_line[i];
+    }
+    for (auto i = first; i != line.size(); ++i) {
+        line[i] += png_paeth_predictor(line[i - bytes_per_pixel], prev_line[i], prev_line[i - bytes_per_pixel]);
+    }
+}
+
+/** Reverse the line-filter of a single PNG line.
+ *
+ * @param filter_type The filter type byte in front of the line.
+ * @param line The filtered bytes of the line, without the filter type byte.
+ * @param prev_line The unfiltered bytes of the previous line, or zeros for the first line.
+ * @param bytes_per_pixel The number of bytes per pixel, rounded up to at least 1.
+ * @throws parse_error On an unknown filter type.
+ */
+hi_inline void png_unfilter_line_generic(
+    uint8_t filter_type,
+    std::span<uint8_t> line,
+    std::span<uint8_t const> prev_line,
+    std::size_t bytes_per_pixel)
+{
+    hi_axiom(line.size() == prev_line.size());
+
+    switch (filter_type) {
+    case 0:
+        return;
+    case 1:
+        return png_unfilter_sub_generic(line, bytes_per_pixel);
+    case 2:
+        return png_unfilter_up_generic(line, prev_line);
+    case 3:
+        return png_unfilter_average_generic(line, prev_line, bytes_per_pixel);
+    case 4:
+        return png_unfilter_paeth_generic(line, prev_line, bytes_per_pixel);
+    default:
+        throw parse_error("Unknown line-filter type");
+    }
+}
+
+#if defined(HI_HAS_X86)
+
+/** Load a single pixel of up to 8 bytes.
+ */
+template<std::size_t Size>
+hi_target("sse2") [[nodiscard]] __m128i png_load_pixel_sse2(uint8_t const *p) noexcept
+{
+    static_assert(Size <= 8);
+    auto tmp = uint64_t{0};
+    std::memcpy(&tmp, p, Size);
+    return _mm_loadl_epi64(reinterpret_cast<__m128i const *>(&tmp));
+}
+
+/** Store a single pixel of up to 8 bytes.
+ */
+template<std::size_t Size>
+hi_target("sse2") void png_store_pixel_sse2(uint8_t *p, __m128i pixel) noexcept
+{
+    static_assert(Size <= 8);
+    auto tmp = uint64_t{0};
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(&tmp), pixel);
+    std::memcpy(p, &tmp, Size);
+}
+
+/** Mask off the bytes beyond a pixel.
+ *
+ * Pixels of 3 or 6 bytes are loaded and stored as 4 or 8 bytes, which is much
+ * faster than copying 3 or 6 bytes. The predictor is masked so that the extra
+ * bytes, which belong to the next pixel, are stored unmodified.
+ */
+template<std::size_t BytesPerPixel, std::size_t Size>
+hi_target("sse2") [[nodiscard]] __m128i png_mask_pixel_sse2(__m128i pixel) noexcept
+{
+    if constexpr (BytesPerPixel == Size) {
+        return pixel;
+    } else {
+        hilet mask = _mm_cvtsi64_si128(static_cast<int64_t>((uint64_t{1} << (BytesPerPixel * 8)) - 1));
+        return _mm_and_si128(pixel, mask);
+    }
+}
+
+hi_target("sse2") hi_inline void png_unfilter_up_sse2(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    auto i = 0_uz;
+    for (; i + 16 <= line.size(); i += 16) {
+        hilet x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(line.data() + i));
+        hilet b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(prev_line.data() + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(line.data() + i), _mm_add_epi8(x, b));
+    }
+    png_unfilter_up_generic(line.subspan(i), prev_line.subspan(i));
+}
+
+hi_target("sse2,avx,avx2") hi_inline void png_unfilter_up_avx2(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    auto i = 0_uz;
+    for (; i + 32 <= line.size(); i += 32) {
+        hilet x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(line.data() + i));
+        hilet b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(prev_line.data() + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(line.data() + i), _mm256_add_epi8(x, b));
+    }
+    png_unfilter_up_sse2(line.subspan(i), prev_line.subspan(i));
+}
+
+/** Reverse the Sub filter.
+ *
+ * The Sub filter is a prefix-sum of pixels. A register is filled with as many
+ * whole pixels as fit in 16 bytes; the prefix-sum inside the register is
+ * calculated by adding shifted copies, then the last pixel of the previous
+ * register is added to all the pixels.
+ */
+template<std::size_t BytesPerPixel>
+hi_target("sse2,ssse3") void png_unfilter_sub_ssse3(std::span<uint8_t> line) noexcept
+{
+    constexpr auto pixels_per_chunk = 16 / BytesPerPixel;
+    constexpr auto chunk_size = pixels_per_chunk * BytesPerPixel;
+
+    // Broadcast the last pixel of a chunk to every pixel of the chunk.
+    constexpr auto carry_shuffle = []() {
+        auto r = std::array<uint8_t, 16>{};
+        for (auto i = 0_uz; i != 16; ++i) {
+            r[i] = i < chunk_size ? narrow_cast<uint8_t>(chunk_size - BytesPerPixel + i % BytesPerPixel) : uint8_t{0x80};
+        }
+        return r;
+    }();
+
+    // The bytes after the last whole pixel in a chunk belong to the next chunk.
+    constexpr auto chunk_mask = []() {
+        auto r = std::array<uint8_t, 16>{};
+        for (auto i = 0_uz; i != 16; ++i) {
+            r[i] = i < chunk_size ? uint8_t{0xff} : uint8_t{0};
+        }
+        return r;
+    }();
+
+    hilet carry_shuffle_ = _mm_loadu_si128(reinterpret_cast<__m128i const *>(carry_shuffle.data()));
+    auto carry = _mm_setzero_si128();
+    auto i = 0_uz;
+    for (; i + 16 <= line.size(); i += chunk_size) {
+        hilet x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(line.data() + i));
+
+        auto sum = _mm_add_epi8(x, _mm_slli_si128(x, BytesPerPixel));
+        if constexpr (pixels_per_chunk > 2) {
+            sum = _mm_add_epi8(sum, _mm_slli_si128(sum, BytesPerPixel * 2));
+        }
+        if constexpr (pixels_per_chunk > 4) {
+            sum = _mm_add_epi8(sum, _mm_slli_si128(sum, BytesPerPixel * 4));
+        }
+        if constexpr (pixels_per_chunk > 8) {
+            sum = _mm_add_epi8(sum, _mm_slli_si128(sum, BytesPerPixel * 8));
+        }
+        sum = _mm_add_epi8(sum, carry);
+        carry = _mm_shuffle_epi8(sum, carry_shuffle_);
+
+        if constexpr (chunk_size != 16) {
+            hilet mask = _mm_loadu_si128(reinterpret_cast<__m128i const *>(chunk_mask.data()));
+            sum = _mm_or_si128(_mm_and_si128(mask, sum), _mm_andnot_si128(mask, x));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(line.data() + i), sum);
+    }
+
+    // Finish the last few pixels, one pixel at a time.
+    for (; i + BytesPerPixel <= line.size(); i += BytesPerPixel) {
+        carry = _mm_add_epi8(png_mask_pixel_sse2<BytesPerPixel, 8>(carry), png_load_pixel_sse2<BytesPerPixel>(line.data() + i));
+        png_store_pixel_sse2<BytesPerPixel>(line.data() + i, carry);
+    }
+}
+
+template<std::size_t BytesPerPixel, std::size_t Size>
+hi_target("sse2") [[nodiscard]] __m128i png_unfilter_average_pixel_sse2(uint8_t *x_ptr, uint8_t const *b_ptr, __m128i a) noexcept
+{
+    hilet b = png_load_pixel_sse2<Size>(b_ptr);
+    hilet x = png_load_pixel_sse2<Size>(x_ptr);
+
+    // _mm_avg_epu8() rounds up, subtract the rounding to get floor((a + b) / 2).
+    hilet average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+    hilet result = _mm_add_epi8(x, png_mask_pixel_sse2<BytesPerPixel, Size>(average));
+    png_store_pixel_sse2<Size>(x_ptr, result);
+    return result;
+}
+
+template<std::size_t BytesPerPixel>
+hi_target("sse2") void png_unfilter_average_sse2(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    constexpr auto access_size = std::bit_ceil(BytesPerPixel);
+
+    auto a = _mm_setzero_si128();
+    auto i = 0_uz;
+    for (; i + access_size <= line.size(); i += BytesPerPixel) {
+        a = png_unfilter_average_pixel_sse2<BytesPerPixel, access_size>(line.data() + i, prev_line.data() + i, a);
+    }
+    for (; i + BytesPerPixel <= line.size(); i += BytesPerPixel) {
+        a = png_unfilter_average_pixel_sse2<BytesPerPixel, BytesPerPixel>(line.data() + i, prev_line.data() + i, a);
+    }
+}
+
+/** Unfilter a single pixel with the Paeth filter.
+ *
+ * @param x_ptr Pointer to the pixel to unfilter.
+ * @param b_ptr Pointer to the pixel above.
+ * @param a The pixel on the left, widened to 16 bits.
+ * @param c The pixel above-left, widened to 16 bits; is set to the pixel above on return.
+ * @return The unfiltered pixel, widened to 16 bits.
+ */
+template<std::size_t BytesPerPixel, std::size_t Size>
+hi_target("sse2") [[nodiscard]] __m128i
+png_unfilter_paeth_pixel_sse2(uint8_t *x_ptr, uint8_t const *b_ptr, __m128i a, __m128i& c) noexcept
+{
+    hilet zero = _mm_setzero_si128();
+    hilet b = _mm_unpacklo_epi8(png_load_pixel_sse2<Size>(b_ptr), zero);
+    hilet x = png_load_pixel_sse2<Size>(x_ptr);
+
+    // p = a + b - c; pa = |p - a| = |b - c|; pb = |p - b| = |a - c|; pc = |p - c| = |pa + pb|.
+    auto pa = _mm_sub_epi16(b, c);
+    auto pb = _mm_sub_epi16(a, c);
+    auto pc = _mm_add_epi16(pa, pb);
+    pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+    pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+    pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+
+    hilet smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+
+    // Select a when pa is smallest, otherwise b when pb is smallest, otherwise c.
+    hilet use_a = _mm_cmpeq_epi16(smallest, pa);
+    hilet use_b = _mm_andnot_si128(use_a, _mm_cmpeq_epi16(smallest, pb));
+    hilet use_c = _mm_andnot_si128(_mm_or_si128(use_a, use_b), _mm_set1_epi16(-1));
+    hilet nearest = _mm_or_si128(_mm_or_si128(_mm_and_si128(use_a, a), _mm_and_si128(use_b, b)), _mm_and_si128(use_c, c));
+
+    hilet result = _mm_add_epi8(x, png_mask_pixel_sse2<BytesPerPixel, Size>(_mm_packus_epi16(nearest, nearest)));
+    png_store_pixel_sse2<Size>(x_ptr, result);
+
+    c = b;
+    return _mm_unpacklo_epi8(result, zero);
+}
+
+template<std::size_t BytesPerPixel>
+hi_target("sse2") void png_unfilter_paeth_sse2(std::span<uint8_t> line, std::span<uint8_t const> prev_line) noexcept
+{
+    constexpr auto access_size = std::bit_ceil(BytesPerPixel);
+
+    // The pixels are widened to 16 bits, to calculate the predictor without overflow.
+    auto a = _mm_setzero_si128();
+    auto c = _mm_setzero_si128();
+    auto i = 0_uz;
+    for (; i + access_size <= line.size(); i += BytesPerPixel) {
+        a = png_unfilter_paeth_pixel_sse2<BytesPerPixel, access_size>(line.data() + i, prev_line.data() + i, a, c);
+    }
+    for (; i + BytesPerPixel <= line.size(); i += BytesPerPixel) {
+        a = png_unfilter_paeth_pixel_sse2<BytesPerPixel, BytesPerPixel>(line.data() + i, prev_line.data() + i, a, c);
+    }
+}
+
+template<std::size_t BytesPerPixel>
+void png_unfilter_line_x86(uint8_t filter_type, std::span<uint8_t> line, std::span<uint8_t const> prev_line)
+{
+    switch (filter_type) {
+    case 0:
+        return;
+    case 1:
+        if (has_ssse3()) {
+            return png_unfilter_sub_ssse3<BytesPerPixel>(line);
+        }
+        return png_unfilter_sub_generic(line, BytesPerPixel);
+    case 2:
+        if (has_avx2()) {
+            return png_unfilter_up_avx2(line, prev_line);
+        }
+        return png_unfilter_up_sse2(line, prev_line);
+    case 3:
+        // For 3 and 6 byte pixels the store-to-load forwarding of overlapping
+        // pixels makes the SIMD version slower than the generic version.
+        if constexpr (std::has_single_bit(BytesPerPixel) and BytesPerPixel >= 4) {
+            return png_unfilter_average_sse2<BytesPerPixel>(line, prev_line);
+        }
+        return png_unfilter_average_generic(line, prev_line, BytesPerPixel);
+    case 4:
+        if constexpr (BytesPerPixel >= 3) {
+            return png_unfilter_paeth_sse2<BytesPerPixel>(line, prev_line);
+        }
+        return png_unfilter_paeth_generic(line, prev_line, BytesPerPixel);
+    default:
+        throw parse_error("Unknown line-filter type");
+    }
+}
+
+#endif
+
+/** Reverse the line-filter of a single PNG line.
+ *
+ * Uses SSE2, SSSE3 or AVX2 when available on the CPU.
+ *
+ * @param filter_type The filter type byte in front of the line.
+ * @param line The filtered bytes of the line, without the filter type byte.
+ * @param prev_line The unfiltered bytes of the previous line, or zeros for the first line.
+ * @param bytes_per_pixel The number of bytes per pixel, rounded up to at least 1.
+ * @throws parse_error On an unknown filter type.
+ */
+hi_inline void png_unfilter_line(
+    uint8_t filter_type,
+    std::span<uint8_t> line,
+    std::span<uint8_t const> prev_line,
+    std::size_t bytes_per_pixel)
+{
+    hi_axiom(line.size() == prev_line.size());
+
+#if defined(HI_HAS_X86)
+    if (has_sse2()) {
+        switch (bytes_per_pixel) {
+        case 1:
+            return png_unfilter_line_x86<1>(filter_type, line, prev_line);
+        case 2:
+            return png_unfilter_line_x86<2>(filter_type, line, prev_line);
+        case 3:
+            return png_unfilter_line_x86<3>(filter_type, line, prev_line);
+        case 4:
+            return png_unfilter_line_x86<4>(filter_type, line, prev_line);
+        case 6:
+            return png_unfilter_line_x86<6>(filter_type, line, prev_line);
+        case 8:
+            return png_unfilter_line_x86<8>(filter_type, line, prev_line);
+        default:;
+        }
+    }
+#endif
+
+    return png_unfilter_line_generic(filter_type, line, prev_line, bytes_per_pixel);
+}
+
+} // namespace detail
+}} // namespace hi::v1
@@ -0,0 +1,51 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "png_unfilter.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+using namespace hi;
+
+TEST(png_unfilter, compare_to_generic)
+{
+    auto engine = std::mt19937{42};
+
+    for (hilet bytes_per_pixel : {1_uz, 2_uz, 3_uz, 4_uz, 6_uz, 8_uz}) {
+        // Include widths which are not a multiple of the register size.
+        for (hilet width : {1_uz, 2_uz, 5_uz, 16_uz, 33_uz, 100_uz}) {
+            hilet size = width * bytes_per_pixel;
+
+            auto prev_line = std::vector<uint8_t>(size);
+            auto line = std::vector<uint8_t>(size);
+            for (auto i = 0_uz; i != size; ++i) {
+                prev_line[i] = narrow_cast<uint8_t>(engine() & 0xff);
+                line[i] = narrow_cast<uint8_t>(engine() & 0xff);
+            }
+
+            for (auto filter_type = uint8_t{0}; filter_type != 5; ++filter_type) {
+                auto expected = line;
+                detail::png_unfilter_line_generic(filter_type, expected, prev_line, bytes_per_pixel);
+
+                auto result = line;
+                detail::png_unfilter_line(filter_type, result, prev_line, bytes_per_pixel);
+
+                ASSERT_EQ(result, expected) << "bytes_per_pixel=" << bytes_per_pixel << " width=" << width
+                                            << " filter_type=" << int{filter_type};
+            }
+        }
+    }
+}
+
+TEST(png_unfilter, unknown_filter_type)
+{
+    auto prev_line = std::vector<uint8_t>(12);
+    auto line = std::vector<uint8_t>(12);
+    ASSERT_THROW(detail::png_unfilter_line(5, line, prev_line, 3), parse_error);
+}
@@ -9,40 +9,64 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "inflate.hpp"
+#include "deflate.hpp"
+#include "bit_writer.hpp"
+#include <span>
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 
 hi_export_module(hikogui.codec.zlib);
 
 hi_export namespace hi { inline namespace v1 {
+namespace detail {
 
-[[nodiscard]] hi_inline bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+/** Calculate the Adler-32 checksum used by zlib.
+ *
+ * @param bytes The data to calculate the checksum over.
+ * @param checksum The checksum of the preceding data, 1 for the first call.
+ * @return The checksum.
+ */
+[[nodiscard]] constexpr uint32_t zlib_adler32(std::span<std::byte const> bytes, uint32_t checksum = 1) noexcept
 {
-    struct zlib_header {
-        uint8_t CMF;
-        uint8_t FLG;
-    };
-
-    auto offset = 0_uz;
-
-    hilet header = make_placement_ptr<zlib_header>(bytes, offset);
-
-    hilet header_chksum = header->CMF * 256 + header->FLG;
-    hi_check(header_chksum % 31 == 0, "zlib header checksum failed.");
+    constexpr uint32_t modulo = 65521;
+    // The largest number of bytes for which s2 does not overflow 32 bits before the modulo.
+    constexpr std::size_t max_run = 5552;
 
-    hi_check((header->CMF & 0xf) == 8, "zlib compression method must be 8");
-    hi_check(((header->CMF >> 4) & 0xf) <= 7, "zlib LZ77 window too large");
-    hi_check((header->FLG & 0x20) == 0, "zlib must not use a preset dictionary");
-
-    if (header->FLG & 0x20) {
-        [[maybe_unused]] auto FDICT = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+    auto s1 = checksum & 0xffff;
+    auto s2 = checksum >> 16;
+    while (not bytes.empty()) {
+        hilet run = std::min(bytes.size(), max_run);
+        for (hilet c : bytes.first(run)) {
+            s1 += std::to_integer<uint32_t>(c);
+            s2 += s1;
+        }
+        s1 %= modulo;
+        s2 %= modulo;
+        bytes = bytes.subspan(run);
     }
+    return (s2 << 16) | s1;
+}
 
-    auto r = inflate(bytes, offset, max_size);
-
-    [[maybe_unused]] auto ADLER32 = make_placement_ptr<big_uint32_buf_t>(bytes, offset);
+} // namespace detail
 
-    return r;
+/** Decompress zlib data.
+ *
+ * This is a one-shot wrapper around `inflater`, use `inflater` directly to
+ * decompress large files with constant memory.
+ *
+ * @param bytes The zlib data.
+ * @param max_size The maximum size of the decompressed data.
+ * @return The decompressed data.
+ * @throws parse_error When the data is invalid or exceeds @a max_size.
+ */
+[[nodiscard]] hi_inline bstring zlib_decompress(std::span<std::byte const> bytes, std::size_t max_size)
+{
+    auto stream = inflater{inflate_format::zlib};
+    stream.add(bytes);
+    stream.close();
+    return stream.read_all(max_size);
 }
 
 [[nodiscard]] hi_inline bstring zlib_decompress(std::filesystem::path const& path, std::size_t max_size = 0x01000000)
@@ -50,4 +74,30 @@ hi_export namespace hi { inline namespace v1 {
     return zlib_decompress(as_span<std::byte const>(file_view(path)), max_size);
 }
 
+/** Compress data into the zlib format.
+ *
+ * @param bytes The data to compress.
+ * @param level The compression level between 0 (stored) and 9 (best compression), see `deflate()`.
+ * @return The zlib data.
+ */
+hi_export [[nodiscard]] hi_inline bstring zlib_compress(std::span<std::byte const> bytes, int level = 6)
+{
+    auto writer = bit_writer{};
+
+    // CM=8 (deflate), CINFO=7 (32K window), FLEVEL, and FCHECK so that the header is a multiple of 31.
+    hilet flevel = level <= 1 ? 0 : level <= 5 ? 1 : level == 6 ? 2 : 3;
+    hilet header = (0x78 << 8) | (flevel << 6);
+    writer.put(0x78, 8);
+    writer.put((flevel << 6) | ((31 - header % 31) % 31), 8);
+
+    detail::deflate_encoder{writer, bytes, level}.encode();
+
+    writer.align();
+    hilet checksum = detail::zlib_adler32(bytes);
+    for (auto shift = 32; shift != 0; shift -= 8) {
+        writer.put((checksum >> (shift - 8)) & 0xff, 8);
+    }
+    return writer.take();
+}
+
 }} // namespace hi::v1
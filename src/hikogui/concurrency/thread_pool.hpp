@@ -0,0 +1,230 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file concurrency/thread_pool.hpp A pool of worker threads.
+ * @ingroup concurrency
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
+#include <future>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <exception>
+#include <concepts>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+
+hi_export_module(hikogui.concurrency.thread_pool);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A pool of worker threads.
+ *
+ * The threads are started when the pool is constructed and live until the
+ * pool is destroyed, so that short parallel jobs do not pay for starting threads.
+ *
+ * @ingroup concurrency
+ */
+hi_export class thread_pool {
+public:
+    ~thread_pool() = default;
+    thread_pool(thread_pool const&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+    /** Start a pool of worker threads.
+     *
+     * @param nr_threads The number of worker threads, at least one.
+     */
+    explicit thread_pool(std::size_t nr_threads)
+    {
+        hi_axiom(nr_threads >= 1);
+
+        _threads.reserve(nr_threads);
+        for (auto i = 0_uz; i != nr_threads; ++i) {
+            _threads.emplace_back([this](std::stop_token stop) {
+                run(stop);
+            });
+        }
+    }
+
+    /** Start a pool with a worker thread for each CPU, except the calling thread's.
+     */
+    thread_pool() : thread_pool(std::max(2_uz, std::size_t{std::thread::hardware_concurrency()}) - 1) {}
+
+    /** The thread pool shared by the whole application.
+     */
+    [[nodiscard]] static thread_pool& global() noexcept
+    {
+        static auto r = thread_pool{};
+        return r;
+    }
+
+    /** The number of worker threads.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _threads.size();
+    }
+
+    /** Run a function on one of the worker threads.
+     *
+     * Tasks that have not started when the pool is destroyed are discarded,
+     * waiting on their future will throw a `std::future_error`.
+     *
+     * @param func The function to run.
+     * @return A future for the result of the function; the future also
+     *         returns the exception thrown by the function.
+     */
+    template<std::invocable Func>
+    [[nodiscard]] std::future<std::invoke_result_t<Func>> submit(Func&& func)
+    {
+        using result_type = std::invoke_result_t<Func>;
+
+        // std::function needs to be copyable.
+        auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<Func>(func));
+        auto r = task->get_future();
+        {
+            auto const lock = std::scoped_lock(_mutex);
+            _tasks.emplace_back([task = std::move(task)] {
+                (*task)();
+            });
+        }
+        _cv.notify_one();
+        return r;
+    }
+
+    /** Call a function for each index in parallel.
+     *
+     * The calling thread calls the function as well, so that the loop
+     * completes even when all the worker threads are busy; including when
+     * called from a worker thread.
+     *
+     * @param n The number of indices.
+     * @param func The function to call as `func(i)` for each index in [0, n).
+     * @throws The first exception thrown by @a func; the rest of the
+     *         indices are then skipped.
+     */
+    template<std::invocable<std::size_t> Func>
+    void parallel_for(std::size_t n, Func const& func)
+    {
+        if (n == 0) {
+            return;
+        } else if (n == 1) {
+            func(0_uz);
+            return;
+        }
+
+        auto state = std::make_shared<parallel_for_state>(n);
+
+        hilet nr_helpers = std::min(n - 1, size());
+        for (auto i = 0_uz; i != nr_helpers; ++i) {
+            {
+                auto const lock = std::scoped_lock(_mutex);
+                _tasks.emplace_back([state, &func] {
+                    {
+                        auto const lock = std::scoped_lock(state->mutex);
+                        if (state->closed) {
+                            // The loop has finished, and func may no longer exist.
+                            return;
+                        }
+                        ++state->nr_active;
+                    }
+
+                    state->run(func);
+
+                    {
+                        auto const lock = std::scoped_lock(state->mutex);
+                        --state->nr_active;
+                    }
+                    state->cv.notify_all();
+                });
+            }
+            _cv.notify_one();
+        }
+
+        state->run(func);
+
+        auto lock = std::unique_lock(state->mutex);
+        state->closed = true;
+        state->cv.wait(lock, [&state] {
+            return state->nr_active == 0;
+        });
+        if (state->exception) {
+            std::rethrow_exception(state->exception);
+        }
+    }
+
+private:
+    struct parallel_for_state {
+        std::size_t n;
+        std::atomic<std::size_t> next = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t nr_active = 0;
+        bool closed = false;
+        std::exception_ptr exception = nullptr;
+
+        parallel_for_state(std::size_t n) noexcept : n(n) {}
+
+        template<typename Func>
+        void run(Func const& func) noexcept
+        {
+            try {
+                for (auto i = next.fetch_add(1, std::memory_order::relaxed); i < n;
+                     i = next.fetch_add(1, std::memory_order::relaxed)) {
+                    func(i);
+                }
+            } catch (...) {
+                next.store(n, std::memory_order::relaxed);
+
+                auto const lock = std::scoped_lock(mutex);
+                if (not exception) {
+                    exception = std::current_exception();
+                }
+            }
+        }
+    };
+
+    std::mutex _mutex;
+    std::condition_variable_any _cv;
+    std::deque<std::function<void()>> _tasks;
+
+    /** The worker threads, destroyed first so that they stop before the task queue is destroyed.
+     */
+    std::vector<std::jthread> _threads;
+
+    void run(std::stop_token stop) noexcept
+    {
+        while (true) {
+            auto task = std::function<void()>{};
+            {
+                auto lock = std::unique_lock(_mutex);
+                if (not _cv.wait(lock, stop, [this] {
+                        return not _tasks.empty();
+                    })) {
+                    return;
+                }
+
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,81 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(thread_pool, submit)
+{
+    auto pool = thread_pool{2};
+    ASSERT_EQ(pool.size(), 2);
+
+    auto a = pool.submit([] {
+        return 42;
+    });
+    auto b = pool.submit([] {
+        throw std::runtime_error("b");
+    });
+
+    ASSERT_EQ(a.get(), 42);
+    ASSERT_THROW(b.get(), std::runtime_error);
+}
+
+TEST(thread_pool, parallel_for)
+{
+    auto pool = thread_pool{3};
+
+    for (auto n : {0_uz, 1_uz, 2_uz, 1000_uz}) {
+        auto counts = std::vector<std::atomic<int>>(n);
+        pool.parallel_for(n, [&](std::size_t i) {
+            ++counts[i];
+        });
+
+        for (hilet& count : counts) {
+            ASSERT_EQ(count.load(), 1);
+        }
+    }
+}
+
+TEST(thread_pool, parallel_for_exception)
+{
+    auto pool = thread_pool{3};
+
+    ASSERT_THROW(
+        pool.parallel_for(
+            1000,
+            [](std::size_t i) {
+                if (i == 500) {
+                    throw std::runtime_error("500");
+                }
+            }),
+        std::runtime_error);
+
+    // The pool is still usable after an exception.
+    auto count = std::atomic<int>{0};
+    pool.parallel_for(100, [&](std::size_t) {
+        ++count;
+    });
+    ASSERT_EQ(count.load(), 100);
+}
+
+TEST(thread_pool, nested_parallel_for)
+{
+    // Every worker is busy with the outer loop; the inner loops must complete on the calling threads.
+    auto pool = thread_pool{2};
+
+    auto count = std::atomic<int>{0};
+    pool.parallel_for(8, [&](std::size_t) {
+        pool.parallel_for(8, [&](std::size_t) {
+            ++count;
+        });
+    });
+    ASSERT_EQ(count.load(), 64);
+}
@@ -38,6 +38,13 @@ public:
         return _fifo.empty();
     }
 
+    /** The number of functions on the fifo.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _fifo.size();
+    }
+
     /** Run one of the function that was posted or send.
      *
      * @retval true One async function has been taken from the fifo and run.
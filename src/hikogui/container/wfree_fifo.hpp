@@ -60,7 +60,21 @@ public:
      */
     [[nodiscard]] bool empty() const noexcept
     {
-        return _head.load(std::memory_order::relaxed) == _tail;
+        return _head.load(std::memory_order::relaxed) == _tail.load(std::memory_order::relaxed);
+    }
+
+    /** The number of messages in the fifo.
+     *
+     * This includes the slots that are claimed by a writer which has not yet
+     * finished creating the message, and the message that is being taken.
+     *
+     * @note Must be called on the reader-thread.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        hilet head = _head.load(std::memory_order::relaxed);
+        hilet tail = _tail.load(std::memory_order::relaxed);
+        return static_cast<uint16_t>(head - tail) / slot_size;
     }
 
     /** Take one message from the fifo slot.
@@ -73,9 +87,10 @@ public:
     template<typename Func>
     auto take_one(Func&& func) noexcept
     {
-        auto result = get_slot(_tail).invoke_and_reset(std::forward<Func>(func));
+        hilet tail = _tail.load(std::memory_order::relaxed);
+        auto result = get_slot(tail).invoke_and_reset(std::forward<Func>(func));
         if (result) {
-            _tail += slot_size;
+            _tail.store(static_cast<uint16_t>(tail + slot_size), std::memory_order::release);
         }
         return result;
     }
@@ -125,6 +140,33 @@ public:
         return emplace_and_invoke<Message>([](Message&) -> void {}, std::forward<Args>(args)...);
     }
 
+    /** Create an message in-place on the fifo, unless the fifo is full.
+     *
+     * @tparam Message The message type derived from value_type to be stored in a free slot.
+     * @param args The arguments passed to the constructor of Message.
+     * @return true if the message was emplaced, false if the fifo was full.
+     */
+    template<typename Message, typename... Args>
+    hi_force_inline bool try_emplace(Args&&...args) noexcept
+    {
+        // Only claim the slot at _head when the reader has passed it, so that it
+        // is not still being written by a writer of the previous round. One slot
+        // is kept free, so that a full fifo is distinguishable from an empty fifo.
+        //
+        // The _tail is loaded before the _head, a stale _tail only makes the fifo
+        // look more full than it is.
+        hilet tail = _tail.load(std::memory_order::acquire);
+        auto offset = _head.load(std::memory_order::relaxed);
+        do {
+            if (static_cast<uint16_t>(offset - tail) >= fifo_size - slot_size) {
+                return false;
+            }
+        } while (not _head.compare_exchange_weak(offset, static_cast<uint16_t>(offset + slot_size), std::memory_order::relaxed));
+
+        get_slot(offset).template wait_emplace_and_invoke<Message>([](Message&) -> void {}, std::forward<Args>(args)...);
+        return true;
+    }
+
     template<typename Object>
     hi_force_inline void insert(Object &&object) noexcept
     {
@@ -141,7 +183,7 @@ private:
     std::array<slot_type, num_slots> _slots = {}; // must be at offset 0
     std::atomic<uint16_t> _head = 0;
     std::array<std::byte, destructive_interference_size> _dummy = {};
-    uint16_t _tail = 0;
+    std::atomic<uint16_t> _tail = 0;
 
     /** Get the slot that either the _head or _tail are pointing at.
      */
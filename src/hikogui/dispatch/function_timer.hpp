@@ -12,12 +12,24 @@
 #include <algorithm>
 #include <chrono>
 #include <functional>
+#include <utility>
+#include <cstddef>
 
 hi_export_module(hikogui.dispatch.function_timer);
 
 hi_export namespace hi::inline v1 {
 
 /** A timer that calls functions.
+ *
+ * The timers are stored in a 4-ary min-heap ordered by deadline. Inserting
+ * a timer and expiring a timer are O(log n) with a shallow tree, and the
+ * heap is stored in a single vector so that it stays cache friendly with
+ * many thousands of timers.
+ *
+ * A timer is cancelled by destroying the `callback` token that was returned
+ * when the timer was added. Cancelled timers are removed from the top of the
+ * heap eagerly, and the whole heap is swept of cancelled timers each time
+ * it has doubled in size; this keeps the cost of cancellation amortized O(1).
  */
 class function_timer {
 public:
@@ -28,6 +40,11 @@ public:
         return _functions.empty();
     }
 
+    [[nodiscard]] constexpr size_t size() const noexcept
+    {
+        return _functions.size();
+    }
+
     /** Add a function to be called at a certain time.
      *
      * @param time_point The time when to call the function.
@@ -37,14 +54,8 @@ public:
     template<forward_of<void()> Func>
     [[nodiscard]] std::pair<callback<void()>, bool> delay_function(utc_nanoseconds time_point, Func &&func) noexcept
     {
-        hilet it = std::lower_bound(_functions.begin(), _functions.end(), time_point, [](hilet& x, hilet& time_point) {
-            return x.time_point > time_point;
-        });
-
-        hilet next_to_call = it == _functions.end();
-
         auto token = callback<void()>{std::forward<Func>(func)};
-        _functions.emplace(it, time_point, std::chrono::nanoseconds::max(), token);
+        hilet next_to_call = insert(timer_type{time_point, std::chrono::nanoseconds::max(), token});
         return {std::move(token), next_to_call};
     }
 
@@ -61,13 +72,9 @@ public:
         utc_nanoseconds time_point,
         Func &&func) noexcept
     {
-        auto it = std::lower_bound(_functions.begin(), _functions.end(), time_point, [](hilet& x, hilet& time_point) {
-            return x.time_point > time_point;
-        });
-
         auto token = callback<void()>{std::forward<Func>(func)};
-        it = _functions.emplace(it, time_point, period, token);
-        return {std::move(token), it + 1 == _functions.end()};
+        hilet next_to_call = insert(timer_type{time_point, period, token});
+        return {std::move(token), next_to_call};
     }
 
     /** Add a function to be called repeatedly.
@@ -91,23 +98,65 @@ public:
         if (_functions.empty()) {
             return utc_nanoseconds::max();
         } else {
-            return _functions.back().time_point;
+            return _functions.front().time_point;
         }
     }
 
     /** Run all the function that should have run by the current_time.
+     *
+     * All the functions that have expired are first removed from the heap
+     * as a batch, then called in order of their deadline. Afterwards the
+     * repeating functions are reinserted. This means that a function that
+     * adds a new timer, which has already expired, will be called on the
+     * next call to `run_all()`.
      *
      * @param current_time The current time.
-     * @param args The arguments to pass to the function.
      */
-    void run_all(utc_nanoseconds current_time, auto const&...args) noexcept
+    void run_all(utc_nanoseconds current_time) noexcept
     {
-        while (current_deadline() <= current_time) {
-            run_one(current_time, args...);
+        // The batch is moved out of the member, so that a function that is
+        // called may safely add new timers.
+        auto batch = std::exchange(_batch, {});
+        hi_axiom(batch.empty());
+
+        while (not _functions.empty() and _functions.front().time_point <= current_time) {
+            batch.push_back(pop());
         }
+
+        for (auto& item : batch) {
+            if (item.callback.lock()) {
+                item.callback();
+                item.callback.unlock();
+            }
+        }
+
+        for (auto& item : batch) {
+            if (item.repeats() and not item.callback.expired()) {
+                // Delay the function to be called on the next period.
+                // However if the current_time already is passed the deadline, delay it even further.
+                item.time_point += item.period;
+                if (item.time_point <= current_time) {
+                    item.time_point = current_time + item.period;
+                }
+                insert(std::move(item));
+            }
+        }
+
+        batch.clear();
+        _batch = std::move(batch);
+
+        remove_expired_front();
     }
 
 private:
+    /** The number of children of each node in the heap.
+     */
+    constexpr static size_t arity = 4;
+
+    /** The minimum size of the heap before it is swept of cancelled timers.
+     */
+    constexpr static size_t minimum_sweep_size = 64;
+
     struct timer_type {
         utc_nanoseconds time_point;
         std::chrono::nanoseconds period;
@@ -124,70 +173,148 @@ private:
         {
         }
 
-        timer_type(utc_nanoseconds time_point, weak_callback<void()> callback) noexcept :
-            timer_type(time_point, std::chrono::nanoseconds::max(), std::move(callback))
-        {
-        }
-
-        timer_type(std::chrono::nanoseconds period, weak_callback<void()> callback) noexcept :
-            timer_type(std::chrono::utc_clock::now(), period, std::move(callback))
-        {
-        }
-
         [[nodiscard]] constexpr bool repeats() const noexcept
         {
             return period != std::chrono::nanoseconds::max();
         }
     };
 
-    void remove_or_reinsert(utc_nanoseconds current_time) noexcept
-    {
-        hi_assert(not _functions.empty());
+    /** Functions, as a 4-ary min-heap ordered by time.
+     */
+    std::vector<timer_type> _functions;
 
-        if (_functions.back().repeats() and not _functions.back().callback.expired()) {
-            // When the function is repeating, calculate the new.
-            auto item = std::move(_functions.back());
-            _functions.pop_back();
+    /** Functions that are being called by `run_all()`.
+     *
+     * This vector is kept to reuse its allocation.
+     */
+    std::vector<timer_type> _batch;
 
-            // Delay the function to be called on the next period.
-            // However if the current_time already is passed the deadline, delay it even further.
-            item.time_point += item.period;
-            if (item.time_point > current_time) {
-                item.time_point = current_time + item.period;
-            }
+    /** When the heap reaches this size it is swept of cancelled timers.
+     */
+    size_t _sweep_size = minimum_sweep_size;
 
-            // Reinsert the function in the sorted list of functions.
-            hilet it = std::lower_bound(_functions.begin(), _functions.end(), item.time_point, [](hilet& x, hilet& time_point) {
-                return x.time_point > time_point;
-            });
+    /** Insert a timer in the heap.
+     *
+     * @param item The timer to insert.
+     * @return true if the inserted timer is the next to call.
+     */
+    bool insert(timer_type item) noexcept
+    {
+        if (_functions.size() >= _sweep_size) {
+            sweep();
+        }
+
+        _functions.push_back(std::move(item));
+        return sift_up(_functions.size() - 1) == 0;
+    }
 
-            _functions.insert(it, std::move(item));
+    /** Remove the timer with the earliest deadline.
+     *
+     * @pre The heap must not be empty.
+     * @return The timer with the earliest deadline.
+     */
+    [[nodiscard]] timer_type pop() noexcept
+    {
+        hi_axiom(not _functions.empty());
 
+        auto r = std::move(_functions.front());
+        if (_functions.size() > 1) {
+            _functions.front() = std::move(_functions.back());
+            _functions.pop_back();
+            sift_down(0);
         } else {
             _functions.pop_back();
         }
+        return r;
     }
 
-    /** Call the next function on the list.
+    /** Remove cancelled timers from the front of the heap.
      *
-     * @note it is undefined behavior to call this function if the current_deadline() has not passed.
-     * @param current_time The current time, this is used when reinserting periodic function to handle starvation issues.
+     * This makes sure that `current_deadline()` does not wake up the loop
+     * for a timer that no longer exists.
      */
-    void run_one(utc_nanoseconds current_time)
+    void remove_expired_front() noexcept
     {
-        hi_assert(not _functions.empty());
+        while (not _functions.empty() and _functions.front().callback.expired()) {
+            [[maybe_unused]] hilet item = pop();
+        }
+    }
 
-        auto &callback = _functions.back().callback;
-        if (callback.lock()) {
-            callback();
-            callback.unlock();
+    /** Remove all cancelled timers from the heap.
+     *
+     * The heap is rebuilt bottom-up in O(n). The next sweep happens when the
+     * heap has doubled in size, so that a sweep is amortized O(1) per insert.
+     */
+    void sweep() noexcept
+    {
+        std::erase_if(_functions, [](hilet& item) {
+            return item.callback.expired();
+        });
+
+        if (_functions.size() > 1) {
+            for (auto i = (_functions.size() - 2) / arity + 1; i != 0; --i) {
+                sift_down(i - 1);
+            }
         }
-        remove_or_reinsert(current_time);
+
+        _sweep_size = std::max(minimum_sweep_size, _functions.size() * 2);
     }
 
-    /** Functions, sorted by descending time.
+    /** Move a timer up the heap to its position.
+     *
+     * A timer is not moved above a timer with the same deadline, so that a
+     * new timer is only the next to call when its deadline is the earliest.
+     *
+     * @param i The index of the timer to move.
+     * @return The new index of the timer.
      */
-    std::vector<timer_type> _functions;
+    size_t sift_up(size_t i) noexcept
+    {
+        auto item = std::move(_functions[i]);
+        while (i != 0) {
+            hilet parent = (i - 1) / arity;
+            if (not (item.time_point < _functions[parent].time_point)) {
+                break;
+            }
+            _functions[i] = std::move(_functions[parent]);
+            i = parent;
+        }
+        _functions[i] = std::move(item);
+        return i;
+    }
+
+    /** Move a timer down the heap to its position.
+     *
+     * @param i The index of the timer to move.
+     */
+    void sift_down(size_t i) noexcept
+    {
+        hilet size = _functions.size();
+
+        auto item = std::move(_functions[i]);
+        while (true) {
+            hilet first_child = i * arity + 1;
+            if (first_child >= size) {
+                break;
+            }
+
+            // Find the child with the earliest deadline.
+            hilet last_child = std::min(first_child + arity, size);
+            auto min_child = first_child;
+            for (auto child = first_child + 1; child != last_child; ++child) {
+                if (_functions[child].time_point < _functions[min_child].time_point) {
+                    min_child = child;
+                }
+            }
+
+            if (not (_functions[min_child].time_point < item.time_point)) {
+                break;
+            }
+            _functions[i] = std::move(_functions[min_child]);
+            i = min_child;
+        }
+        _functions[i] = std::move(item);
+    }
 };
 
 } // namespace hi::inline v1
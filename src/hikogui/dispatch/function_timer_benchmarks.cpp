@@ -0,0 +1,149 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_timer.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr auto num_timers = 100'000_uz;
+
+/** A timer that keeps the functions in a vector sorted by descending time.
+ *
+ * This is how function_timer was implemented before it used a heap, it is
+ * used here as a reference.
+ */
+class sorted_vector_timer {
+public:
+    template<forward_of<void()> Func>
+    [[nodiscard]] callback<void()> delay_function(utc_nanoseconds time_point, Func&& func) noexcept
+    {
+        hilet it = std::lower_bound(_functions.begin(), _functions.end(), time_point, [](hilet& x, hilet& time_point) {
+            return x.first > time_point;
+        });
+
+        auto token = callback<void()>{std::forward<Func>(func)};
+        _functions.emplace(it, time_point, token);
+        return token;
+    }
+
+    void run_all(utc_nanoseconds current_time) noexcept
+    {
+        while (not _functions.empty() and _functions.back().first <= current_time) {
+            auto& callback = _functions.back().second;
+            if (callback.lock()) {
+                callback();
+                callback.unlock();
+            }
+            _functions.pop_back();
+        }
+    }
+
+private:
+    std::vector<std::pair<utc_nanoseconds, weak_callback<void()>>> _functions;
+};
+
+/** Make deadlines spread randomly over one second.
+ */
+[[nodiscard]] std::vector<utc_nanoseconds> make_deadlines()
+{
+    auto engine = std::mt19937{42};
+    auto dist = std::uniform_int_distribution<long long>{0, 999'999'999};
+
+    auto r = std::vector<utc_nanoseconds>{};
+    r.reserve(num_timers);
+    for (auto i = 0_uz; i != num_timers; ++i) {
+        r.push_back(utc_nanoseconds{} + 1s + std::chrono::nanoseconds{dist(engine)});
+    }
+    return r;
+}
+
+template<typename Timer>
+[[nodiscard]] callback<void()> add_timer(Timer& timer, utc_nanoseconds deadline, size_t& count)
+{
+    if constexpr (std::is_same_v<Timer, function_timer>) {
+        return timer.delay_function(deadline, [&count] { ++count; }).first;
+    } else {
+        return timer.delay_function(deadline, [&count] { ++count; });
+    }
+}
+
+/** Add all timers, optionally cancel most of them, then expire them at 60 frames per second.
+ *
+ * @return The number of functions that were called.
+ */
+template<typename Timer>
+[[nodiscard]] size_t schedule_and_expire(std::vector<utc_nanoseconds> const& deadlines, bool cancel)
+{
+    auto timer = Timer{};
+    auto count = 0_uz;
+
+    auto tokens = std::vector<callback<void()>>{};
+    tokens.reserve(deadlines.size());
+    for (hilet deadline : deadlines) {
+        tokens.push_back(add_timer(timer, deadline, count));
+    }
+
+    if (cancel) {
+        // Cancel 9 out of 10 timers, like timeouts that never trigger.
+        for (auto i = 0_uz; i != tokens.size(); ++i) {
+            if (i % 10 != 0) {
+                tokens[i] = nullptr;
+            }
+        }
+    }
+
+    for (auto t = utc_nanoseconds{} + 1s; t < utc_nanoseconds{} + 2s; t += 16'666'667ns) {
+        timer.run_all(t);
+    }
+    timer.run_all(utc_nanoseconds{} + 2s);
+    return count;
+}
+
+template<typename Timer>
+void benchmark_timer(std::string_view name, std::vector<utc_nanoseconds> const& deadlines, bool cancel)
+{
+    hilet expected = cancel ? num_timers / 10 : num_timers;
+
+    auto count = 0_uz;
+    hilet rate = benchmark_rate(
+        [&] {
+            count = schedule_and_expire<Timer>(deadlines, cancel);
+        },
+        std::chrono::seconds(2));
+    ASSERT_EQ(count, expected);
+
+    benchmark_report(name, 1'000'000'000.0 / (rate * num_timers), "ns/timer");
+}
+
+} // namespace
+
+TEST(function_timer_benchmarks, schedule_and_expire)
+{
+    hilet deadlines = make_deadlines();
+
+    benchmark_timer<function_timer>("function_timer 100k timers", deadlines, false);
+    benchmark_timer<sorted_vector_timer>("sorted vector 100k timers", deadlines, false);
+}
+
+TEST(function_timer_benchmarks, schedule_cancel_and_expire)
+{
+    hilet deadlines = make_deadlines();
+
+    benchmark_timer<function_timer>("function_timer 100k timers 90% cancelled", deadlines, true);
+    benchmark_timer<sorted_vector_timer>("sorted vector 100k timers 90% cancelled", deadlines, true);
+}
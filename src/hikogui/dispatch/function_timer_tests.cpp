@@ -0,0 +1,133 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_timer.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+using namespace std::chrono_literals;
+
+TEST(function_timer, order)
+{
+    hilet start = utc_nanoseconds{} + 1s;
+
+    auto timer = function_timer{};
+    auto calls = std::vector<int>{};
+    auto tokens = std::vector<callback<void()>>{};
+
+    auto [a, a_first] = timer.delay_function(start + 3ms, [&] { calls.push_back(3); });
+    ASSERT_TRUE(a_first);
+    tokens.push_back(std::move(a));
+
+    auto [b, b_first] = timer.delay_function(start + 1ms, [&] { calls.push_back(1); });
+    ASSERT_TRUE(b_first);
+    tokens.push_back(std::move(b));
+
+    auto [c, c_first] = timer.delay_function(start + 2ms, [&] { calls.push_back(2); });
+    ASSERT_FALSE(c_first);
+    tokens.push_back(std::move(c));
+
+    // A timer with the same deadline as the next is not the next to call.
+    auto [d, d_first] = timer.delay_function(start + 1ms, [&] { calls.push_back(4); });
+    ASSERT_FALSE(d_first);
+    tokens.push_back(std::move(d));
+
+    ASSERT_EQ(timer.current_deadline(), start + 1ms);
+
+    timer.run_all(start);
+    ASSERT_TRUE(calls.empty());
+
+    timer.run_all(start + 2ms);
+    ASSERT_EQ(calls.size(), 3);
+    ASSERT_EQ(calls[2], 2);
+    ASSERT_EQ(timer.current_deadline(), start + 3ms);
+
+    timer.run_all(start + 3ms);
+    ASSERT_EQ(calls.size(), 4);
+    ASSERT_EQ(calls[3], 3);
+    ASSERT_TRUE(timer.empty());
+    ASSERT_EQ(timer.current_deadline(), utc_nanoseconds::max());
+}
+
+TEST(function_timer, cancel)
+{
+    hilet start = utc_nanoseconds{} + 1s;
+
+    auto timer = function_timer{};
+    auto count = 0;
+
+    auto [a, a_first] = timer.delay_function(start + 1ms, [&] { ++count; });
+    auto [b, b_first] = timer.delay_function(start + 2ms, [&] { ++count; });
+
+    // The cancelled timer at the front is removed after running the timer.
+    a = nullptr;
+    timer.run_all(start);
+    ASSERT_EQ(timer.size(), 1);
+    ASSERT_EQ(timer.current_deadline(), start + 2ms);
+
+    timer.run_all(start + 2ms);
+    ASSERT_EQ(count, 1);
+    ASSERT_TRUE(timer.empty());
+}
+
+TEST(function_timer, repeat)
+{
+    hilet start = utc_nanoseconds{} + 1s;
+
+    auto timer = function_timer{};
+    auto count = 0;
+
+    auto [a, a_first] = timer.repeat_function(10ms, start, [&] { ++count; });
+
+    timer.run_all(start);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(timer.current_deadline(), start + 10ms);
+
+    timer.run_all(start + 10ms);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(timer.current_deadline(), start + 20ms);
+
+    // When the loop was stalled, the missed periods are skipped.
+    timer.run_all(start + 55ms);
+    ASSERT_EQ(count, 3);
+    ASSERT_EQ(timer.current_deadline(), start + 65ms);
+
+    a = nullptr;
+    timer.run_all(start + 65ms);
+    ASSERT_EQ(count, 3);
+    ASSERT_TRUE(timer.empty());
+}
+
+TEST(function_timer, sweep)
+{
+    hilet start = utc_nanoseconds{} + 1s;
+
+    auto timer = function_timer{};
+    auto calls = std::vector<int>{};
+    auto tokens = std::vector<callback<void()>>{};
+
+    auto engine = std::mt19937{42};
+    auto dist = std::uniform_int_distribution<int>{0, 999};
+
+    // Cancel most of the timers, the cancelled timers are swept when the
+    // heap grows, so that the heap does not grow without bounds.
+    for (auto i = 0; i != 10'000; ++i) {
+        hilet t = dist(engine);
+        auto [token, first] = timer.delay_function(start + t * 1ms, [&calls, t] { calls.push_back(t); });
+        if (i % 10 == 0) {
+            tokens.push_back(std::move(token));
+        }
+    }
+    ASSERT_LE(timer.size(), 2'000);
+
+    timer.run_all(start + 1s);
+    ASSERT_EQ(calls.size(), tokens.size());
+    ASSERT_TRUE(std::is_sorted(calls.begin(), calls.end()));
+    ASSERT_TRUE(timer.empty());
+}
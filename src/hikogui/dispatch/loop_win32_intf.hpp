@@ -176,6 +176,16 @@ public:
         notify_has_send();
     }
 
+    /** The number of functions that were posted to the loop, and are not yet called.
+     *
+     * @note This function must be called from the same thread as `resume()`.
+     */
+    [[nodiscard]] std::size_t num_posted_functions() const noexcept
+    {
+        hi_axiom(on_thread());
+        return _function_fifo.size();
+    }
+
     /** Call a function from the loop.
      *
      * @note It is safe to call this function from another thread.
@@ -12,12 +12,27 @@
 #include <functional>
 #include <coroutine>
 #include <mutex>
+#include <memory>
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
 
 hi_export_module(hikogui.dispatch : notifier);
 
 hi_export namespace hi::inline v1 {
 
 /** A notifier which can be used to call a set of registered callbacks.
+ *
+ * The subscribers are stored in an immutable snapshot. A notification loads
+ * the current snapshot without taking a lock, so that callbacks may
+ * subscribe or unsubscribe while being notified. Subscribing copies the
+ * snapshot and atomically replaces it.
+ *
+ * Callbacks that are called asynchronously on the same loop are posted as
+ * a single function which calls all of them, instead of posting a function
+ * for each callback.
  *
  * @tparam Result The result of calling the callback.
  * @tparam Args The argument types of the callback function.
@@ -156,8 +171,15 @@ public:
     [[nodiscard]] callback_type subscribe(Func&& func, callback_flags flags = callback_flags::synchronous) noexcept
     {
         auto callback = callback_type{std::forward<Func>(func)};
+
         hilet lock = std::scoped_lock(_mutex);
-        _callbacks.emplace_back(callback, flags);
+        auto snapshot = copy_snapshot();
+        if (is_once(flags)) {
+            snapshot->once_subscribers.emplace_back(callback, flags, ++_once_id);
+        } else {
+            snapshot->subscribers[loop_index(flags)].emplace_back(callback);
+        }
+        _snapshot.store(std::move(snapshot), std::memory_order::release);
         return callback;
     }
 
@@ -170,22 +192,24 @@ public:
 
     /** Call the subscribed callbacks with the given arguments.
      *
-     * @note This function is not reentrant.
+     * The synchronous callbacks are called directly. The asynchronous
+     * callbacks are called from a single function posted to each loop.
+     *
      * @param args The arguments to pass with the invocation of the callback
      */
     void operator()(Args... args) const noexcept
     {
-        hilet lock = std::scoped_lock(_mutex);
-
-        for (auto& [callback, flags] : _callbacks) {
-            if (is_synchronous(flags)) {
-                if (callback.lock()) {
-                    callback(std::forward<Args>(args)...);
-                    callback.unlock();
-                }
+        hilet snapshot = _snapshot.load(std::memory_order::acquire);
+        if (not snapshot) {
+            return;
+        }
 
-            } else if (is_local(flags)) {
-                loop_local_post_function([=] {
+        // The once-subscribers are rare, they are claimed under the lock so
+        // that each is called exactly once, even when notified from multiple
+        // threads at the same time.
+        for (hilet& [callback, flags, id] : snapshot->once_subscribers) {
+            if (claim_once(id)) {
+                post_function(flags, [=] {
                     // The callback object here is captured by-copy, so that
                     // the loop can check if it was expired.
                     if (callback.lock()) {
@@ -195,68 +219,163 @@ public:
                         callback.unlock();
                     }
                 });
+            }
+        }
 
-            } else if (is_main(flags)) {
-                loop_main_post_function([=] {
-                    // The callback object here is captured by-copy, so that
-                    // the loop can check if it was expired.
-                    if (callback.lock()) {
-                        // The captured arguments are now plain copies so we do
-                        // not forward them in the call.
-                        callback(args...);
-                        callback.unlock();
-                    }
-                });
+        auto has_expired = false;
+        for (auto i = 1_uz; i != snapshot->subscribers.size(); ++i) {
+            hilet& callbacks = snapshot->subscribers[i];
+            if (callbacks.empty()) {
+                continue;
+            }
 
-            } else if (is_timer(flags)) {
-                loop_timer_post_function([=] {
-                    // The callback object here is captured by-copy, so that
-                    // the loop can check if it was expired.
-                    if (callback.lock()) {
-                        // The captured arguments are now plain copies so we do
-                        // not forward them in the call.
-                        callback(args...);
-                        callback.unlock();
-                    }
-                });
+            has_expired |= std::any_of(callbacks.begin(), callbacks.end(), [](hilet& callback) {
+                return callback.expired();
+            });
+
+            // The snapshot is immutable, so it is captured instead of
+            // copying each of the callbacks.
+            post_function(static_cast<callback_flags>(i), [=] {
+                // The captured arguments are now plain copies so we do
+                // not forward them in the call.
+                call_all(snapshot->subscribers[i], args...);
+            });
+        }
 
-            } else {
-                hi_no_default();
-            }
+        has_expired |= call_all(snapshot->subscribers[loop_index(callback_flags::synchronous)], args...);
 
-            // If the callback should only be triggered once, like inside an awaitable.
-            // Then reset the weak_ptr in _callbacks so that it will be cleaned up.
-            // In the lambda above the weak_ptr is copied first so that it callback will get executed
-            // as long as the shared_ptr's use count does not go to zero.
-            if (is_once(flags)) {
-                callback.reset();
-            }
+        if (has_expired) {
+            clean_up();
         }
-        clean_up();
     }
 
 private:
+    struct once_subscriber_type {
+        weak_callback_type callback;
+        callback_flags flags;
+        uint64_t id;
+    };
+
+    /** An immutable list of subscribers.
+     */
+    struct snapshot_type {
+        /** Subscribers, indexed by the loop on which they are called.
+         *
+         * The index is the lower 8 bits of the callback-flags.
+         */
+        std::array<std::vector<weak_callback_type>, 4> subscribers;
+
+        /** Subscribers that are only called once.
+         */
+        std::vector<once_subscriber_type> once_subscribers;
+    };
+
+    /** The mutex is only used by writers, to serialize updates of the snapshot.
+     */
     mutable unfair_mutex _mutex;
 
-    /** A list of callbacks and it's associated token.
+    /** The current list of subscribers.
      */
-    mutable std::vector<std::pair<weak_callback_type, callback_flags>> _callbacks;
+    mutable std::atomic<std::shared_ptr<snapshot_type const>> _snapshot;
 
-    void clean_up() const noexcept
+    /** The last id given to a once-subscriber.
+     */
+    uint64_t _once_id = 0;
+
+    [[nodiscard]] constexpr static size_t loop_index(callback_flags flags) noexcept
+    {
+        return std::to_underlying(flags) & 0xff;
+    }
+
+    /** Call the callbacks in a list.
+     *
+     * @param callbacks The callbacks to call.
+     * @param args The arguments to pass to each callback.
+     * @return true if any of the callbacks had expired.
+     */
+    static bool call_all(std::vector<weak_callback_type> const& callbacks, Args const&...args) noexcept
+    {
+        auto has_expired = false;
+        for (hilet& callback : callbacks) {
+            if (callback.lock()) {
+                callback(args...);
+                callback.unlock();
+            } else {
+                has_expired = true;
+            }
+        }
+        return has_expired;
+    }
+
+    template<forward_of<void()> F>
+    void post_function(callback_flags flags, F&& func) const noexcept
+    {
+        if (is_local(flags)) {
+            loop_local_post_function(std::forward<F>(func));
+        } else if (is_main(flags)) {
+            loop_main_post_function(std::forward<F>(func));
+        } else if (is_timer(flags)) {
+            loop_timer_post_function(std::forward<F>(func));
+        } else {
+            hi_axiom(is_synchronous(flags));
+            func();
+        }
+    }
+
+    /** Make a copy of the current snapshot, without the expired callbacks.
+     */
+    [[nodiscard]] std::shared_ptr<snapshot_type> copy_snapshot() const noexcept
     {
         hi_axiom(_mutex.is_locked());
 
-        // Cleanup all callbacks that have expired, or when they may only be triggered once.
-        std::erase_if(_callbacks, [](hilet& item) {
-            return item.first.expired();
+        auto r = std::make_shared<snapshot_type>();
+        if (hilet snapshot = _snapshot.load(std::memory_order::acquire)) {
+            for (auto i = 0_uz; i != r->subscribers.size(); ++i) {
+                r->subscribers[i].reserve(snapshot->subscribers[i].size() + 1);
+                std::copy_if(
+                    snapshot->subscribers[i].begin(),
+                    snapshot->subscribers[i].end(),
+                    std::back_inserter(r->subscribers[i]),
+                    [](hilet& callback) {
+                        return not callback.expired();
+                    });
+            }
+
+            std::copy_if(
+                snapshot->once_subscribers.begin(),
+                snapshot->once_subscribers.end(),
+                std::back_inserter(r->once_subscribers),
+                [](hilet& item) {
+                    return not item.callback.expired();
+                });
+        }
+        return r;
+    }
+
+    /** Remove a once-subscriber from the list.
+     *
+     * @param id The id of the once-subscriber.
+     * @return true if the subscriber was removed by this call, and should be called.
+     */
+    [[nodiscard]] bool claim_once(uint64_t id) const noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+
+        auto snapshot = copy_snapshot();
+        hilet num_erased = std::erase_if(snapshot->once_subscribers, [id](hilet& item) {
+            return item.id == id;
         });
+        _snapshot.store(std::move(snapshot), std::memory_order::release);
+        return num_erased != 0;
     }
 
-#ifndef NDEBUG
-    /** The notifier is currently calling all the callbacks.
+    /** Remove the expired callbacks from the list.
      */
-    mutable bool _notifying = false;
-#endif
+    void clean_up() const noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        _snapshot.store(copy_snapshot(), std::memory_order::release);
+    }
 };
 
 } // namespace hi::inline v1
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <string>
 #include <coroutine>
+#include <vector>
 
 using namespace std;
 using namespace hi;
@@ -113,3 +114,74 @@ TEST(notifier, local_coroutine)
     ASSERT_EQ(b, 1);
     ASSERT_TRUE(cr.done());
 }
+
+TEST(notifier, local_coalesced)
+{
+    auto count = 0;
+
+    auto n = notifier<void(int)>{};
+
+    auto cbts = std::vector<notifier<void(int)>::callback_type>{};
+    for (auto i = 0; i != 100; ++i) {
+        cbts.push_back(n.subscribe(
+            [&](int value) {
+                count += value;
+            },
+            callback_flags::local));
+    }
+
+    // Unsubscribe half of the callbacks.
+    for (auto i = 0; i != 100; i += 2) {
+        cbts[i] = {};
+    }
+
+    // All the callbacks are posted as a single function to the local event-loop.
+    hilet num_posted_functions = loop::local().num_posted_functions();
+    n(2);
+    ASSERT_EQ(count, 0);
+    ASSERT_EQ(loop::local().num_posted_functions(), num_posted_functions + 1);
+
+    loop::local().resume_once();
+    ASSERT_EQ(count, 100);
+}
+
+TEST(notifier, subscribe_while_notifying)
+{
+    auto a = 0;
+    auto b = 0;
+
+    auto n = notifier{};
+
+    auto b_cbt = notifier<>::callback_type{};
+    auto a_cbt = n.subscribe([&] {
+        ++a;
+        if (not b_cbt) {
+            // The new subscriber is called on the next notification.
+            b_cbt = n.subscribe([&] {
+                ++b;
+            });
+        }
+    });
+
+    n();
+    ASSERT_EQ(a, 1);
+    ASSERT_EQ(b, 0);
+
+    n();
+    ASSERT_EQ(a, 2);
+    ASSERT_EQ(b, 1);
+
+    // Unsubscribe from within the callback.
+    a_cbt = n.subscribe([&] {
+        ++a;
+        b_cbt = {};
+    });
+
+    n();
+    ASSERT_EQ(a, 3);
+    ASSERT_EQ(b, 2);
+
+    n();
+    ASSERT_EQ(a, 4);
+    ASSERT_EQ(b, 2);
+}
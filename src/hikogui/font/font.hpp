@@ -14,6 +14,8 @@
 #include "glyph_atlas_info.hpp" // export
 #include "glyph_id.hpp" // export
 #include "glyph_metrics.hpp" // export
+#include "glyph_sdf_cache.hpp" // export
+#include "glyph_sdf_tile.hpp" // export
 #include "hikogui_icon.hpp" // export
 #include "true_type_font.hpp" // export
 
@@ -9,16 +9,26 @@
 #include "true_type_font.hpp"
 #include "elusive_icon.hpp"
 #include "hikogui_icon.hpp"
+#include "glyph_sdf_tile.hpp"
+#include "glyph_sdf_cache.hpp"
 #include "../unicode/unicode.hpp"
 #include "../geometry/geometry.hpp"
 #include "../utility/utility.hpp"
 #include "../coroutine/coroutine.hpp"
 #include "../path/path.hpp"
+#include "../concurrency/thread_pool.hpp"
 #include <limits>
 #include <array>
+#include <memory>
 #include <new>
 #include <atomic>
+#include <deque>
 #include <filesystem>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 hi_export_module(hikogui.font.font_book);
 
@@ -57,6 +67,13 @@ public:
         {
             return get_metrics().bounding_rectangle;
         }
+
+        struct hash {
+            [[nodiscard]] std::size_t operator()(font_glyph_type const& rhs) const noexcept
+            {
+                return hash_mix(rhs.font, rhs.id);
+            }
+        };
     };
 
     struct font_glyphs_type {
@@ -86,12 +103,42 @@ public:
 
     static font_book& global() noexcept;
 
-    ~font_book() = default;
+    ~font_book()
+    {
+        // Wait for the pre-rasterization of glyphs, which uses the fonts and the tile table.
+        auto pending = std::vector<std::shared_future<void>>{};
+        {
+            auto const lock = std::scoped_lock(_glyph_tiles_mutex);
+            for (hilet& [glyph, entry] : _glyph_tiles) {
+                if (entry.state == glyph_tile_state::pending and entry.done.valid()) {
+                    pending.push_back(entry.done);
+                }
+            }
+        }
+        for (hilet& done : pending) {
+            done.wait();
+        }
+
+        flush_glyph_sdf_caches();
+    }
+
     font_book(font_book const&) = delete;
     font_book(font_book&&) = delete;
     font_book& operator=(font_book const&) = delete;
     font_book& operator=(font_book&&) = delete;
-    font_book() = default;
+
+    /** The default maximum number of pre-rasterized glyphs that have not been taken.
+     */
+    constexpr static std::size_t default_max_nr_ready_glyph_tiles = 4096;
+
+    /** Create a font_book.
+     *
+     * @param max_nr_ready_glyph_tiles The maximum number of pre-rasterized glyphs
+     *        that have not been taken; when exceeded the oldest tiles are dropped.
+     */
+    explicit font_book(std::size_t max_nr_ready_glyph_tiles) noexcept : _max_nr_ready_glyph_tiles(max_nr_ready_glyph_tiles) {}
+
+    font_book() noexcept : font_book(default_max_nr_ready_glyph_tiles) {}
 
     /** Register a font.
      * Duplicate registrations will be ignored.
@@ -117,6 +164,11 @@ public:
         _fonts.emplace_back(std::move(font));
         _font_ptrs.push_back(font_ptr);
 
+        {
+            auto const lock = std::scoped_lock(_glyph_sdf_caches_mutex);
+            _font_paths[font_ptr] = path;
+        }
+
         if (post_process) {
             this->post_process();
         }
@@ -324,7 +376,212 @@ public:
         return {font, glyph_id{0}};
     }
 
+    /** Rasterize glyphs into signed distance fields ahead of their use.
+     *
+     * The glyphs are deduplicated and glyphs that were requested before are
+     * skipped. The rest of the glyphs are rasterized on the global thread pool
+     * into tiles, which are taken by the glyph atlas using `take_glyph_sdf_tile()`.
+     * When too many tiles are not taken, the oldest tiles are dropped; these glyphs
+     * are rasterized again when they are taken.
+     *
+     * This allows the glyphs of a document to be rasterized on a background thread
+     * before they are shown.
+     *
+     * @note The fonts of the glyphs are loaded on the calling thread.
+     * @param glyphs The glyphs to rasterize.
+     * @return A future which becomes ready when all the glyphs are rasterized, including
+     *         glyphs that were requested earlier and are still being rasterized.
+     */
+    std::shared_future<void> prerasterize_glyphs(std::vector<font_glyph_type> const& glyphs)
+    {
+        auto const lock = std::scoped_lock(_glyph_tiles_mutex);
+
+        auto missing = std::vector<font_glyph_type>{};
+        auto dependencies = std::vector<std::shared_future<void>>{};
+        auto dependency_batches = std::vector<std::size_t>{};
+        for (hilet& glyph : glyphs) {
+            hi_axiom_not_null(glyph.font);
+
+            if (hilet it = _glyph_tiles.find(glyph); it != _glyph_tiles.end()) {
+                hilet& entry = it->second;
+                if (entry.state == glyph_tile_state::pending and entry.done.valid() and
+                    std::ranges::find(dependency_batches, entry.batch) == dependency_batches.end()) {
+                    dependency_batches.push_back(entry.batch);
+                    dependencies.push_back(entry.done);
+                }
+                continue;
+            }
+
+            try {
+                // get_path() may only be called from multiple threads on a loaded font.
+                [[maybe_unused]] hilet metrics = glyph.font->get_metrics(glyph.id);
+            } catch (std::exception const& e) {
+                hi_log_error("Could not load glyph {} from font {}: \"{}\"", *glyph.id, glyph.font->family_name, e.what());
+                continue;
+            }
+
+            _glyph_tiles.emplace(glyph, glyph_tile_entry{});
+            missing.push_back(glyph);
+        }
+
+        if (missing.empty() and dependencies.empty()) {
+            auto promise = std::promise<void>{};
+            promise.set_value();
+            return promise.get_future().share();
+        } else if (missing.empty() and dependencies.size() == 1) {
+            return dependencies.front();
+        }
+
+        hilet batch = ++_glyph_tiles_batch;
+        auto done = thread_pool::global()
+                        .submit([this, missing, dependencies = std::move(dependencies)] {
+                            rasterize_glyph_sdf_tiles(missing);
+
+                            // The dependencies were submitted to the pool earlier and have already
+                            // started, so waiting for them on a worker thread can not deadlock.
+                            for (hilet& dependency : dependencies) {
+                                dependency.wait();
+                            }
+                        })
+                        .share();
+
+        for (hilet& glyph : missing) {
+            auto& entry = _glyph_tiles[glyph];
+            entry.done = done;
+            entry.batch = batch;
+        }
+        return done;
+    }
+
+    /** Rasterize the glyphs of a text into signed distance fields ahead of their use.
+     *
+     * @see prerasterize_glyphs(std::vector<font_glyph_type> const&)
+     * @param font The font to use for the text, glyphs may be found in the fallback fonts.
+     * @param text The text to rasterize the glyphs of.
+     * @return A future which becomes ready when all the glyphs are rasterized.
+     */
+    std::shared_future<void> prerasterize_glyphs(font const& font, gstring const& text)
+    {
+        auto glyphs = std::vector<font_glyph_type>{};
+        for (hilet grapheme : text) {
+            hilet[glyph_font, ids] = find_glyph(font, grapheme);
+            for (hilet id : ids) {
+                glyphs.emplace_back(*glyph_font, id);
+            }
+        }
+        return prerasterize_glyphs(glyphs);
+    }
+
+    /** Rasterize the glyphs of a set of code-points into signed distance fields ahead of their use.
+     *
+     * @see prerasterize_glyphs(std::vector<font_glyph_type> const&)
+     * @param font The font to use for the code-points, glyphs may be found in the fallback fonts.
+     * @param code_points The code-points to rasterize the glyphs of.
+     * @return A future which becomes ready when all the glyphs are rasterized.
+     */
+    std::shared_future<void> prerasterize_glyphs(font const& font, std::u32string_view code_points)
+    {
+        auto glyphs = std::vector<font_glyph_type>{};
+        for (hilet code_point : code_points) {
+            glyphs.push_back(find_glyph(font, code_point));
+        }
+        return prerasterize_glyphs(glyphs);
+    }
+
+    /** Take a rasterized glyph.
+     *
+     * The glyph is taken from the pre-rasterized glyphs, or from the persistent
+     * glyph cache, or it is rasterized on the calling thread.
+     *
+     * After calling this function the glyph will not be pre-rasterized again, as it
+     * is expected that the glyph is added to the glyph atlas by the caller.
+     *
+     * @param font The font of the glyph.
+     * @param id The glyph in the font.
+     * @return The rasterized glyph.
+     * @throws std::exception If there was an error while loading the glyph from the font.
+     */
+    [[nodiscard]] glyph_sdf_tile take_glyph_sdf_tile(font const& font, glyph_id id)
+    {
+        {
+            auto const lock = std::scoped_lock(_glyph_tiles_mutex);
+
+            hilet[it, inserted] = _glyph_tiles.try_emplace(font_glyph_type{font, id});
+            auto& entry = it->second;
+            entry.state = glyph_tile_state::taken;
+            if (entry.tile) {
+                --_nr_ready_glyph_tiles;
+                return *std::exchange(entry.tile, std::nullopt);
+            }
+        }
+
+        return find_or_make_glyph_sdf_tile(font, id);
+    }
+
+    /** The number of pre-rasterized glyphs that have not been taken.
+     */
+    [[nodiscard]] std::size_t nr_ready_glyph_tiles() const noexcept
+    {
+        auto const lock = std::scoped_lock(_glyph_tiles_mutex);
+        return _nr_ready_glyph_tiles;
+    }
+
+    /** Enable the persistent glyph cache.
+     *
+     * Rasterized glyphs are stored in a cache file per font, so that
+     * the glyphs do not need to be rasterized again when the application is
+     * restarted. A cache file is named after the SHA-256 of the font file.
+     *
+     * @param directory The directory to store the cache files in.
+     */
+    void enable_glyph_sdf_cache(std::filesystem::path directory) noexcept
+    {
+        auto const lock = std::scoped_lock(_glyph_sdf_caches_mutex);
+        _glyph_sdf_cache_directory = std::move(directory);
+        _glyph_sdf_caches.clear();
+    }
+
+    /** Write newly rasterized glyphs to the persistent glyph cache.
+     */
+    void flush_glyph_sdf_caches() noexcept
+    {
+        auto const lock = std::scoped_lock(_glyph_sdf_caches_mutex);
+        for (hilet& [font, cache] : _glyph_sdf_caches) {
+            if (cache) {
+                cache->flush();
+            }
+        }
+    }
+
 private:
+    enum class glyph_tile_state : uint8_t {
+        /** The glyph is being rasterized.
+         */
+        pending,
+
+        /** The glyph has been rasterized, the tile is available.
+         */
+        ready,
+
+        /** The tile was taken, or the glyph was rasterized in another way.
+         */
+        taken
+    };
+
+    struct glyph_tile_entry {
+        glyph_tile_state state = glyph_tile_state::pending;
+
+        /** The batch of glyphs this glyph is rasterized in.
+         */
+        std::size_t batch = 0;
+
+        /** Becomes ready when the batch is rasterized.
+         */
+        std::shared_future<void> done = {};
+
+        std::optional<glyph_sdf_tile> tile = std::nullopt;
+    };
+
     /** Table of font_family_ids index using the family-name.
      */
     std::unordered_map<std::string, font_family_id> _family_names;
@@ -336,6 +593,155 @@ private:
     std::vector<std::unique_ptr<font>> _fonts;
     std::vector<hi::font *> _font_ptrs;
 
+    mutable std::mutex _glyph_tiles_mutex;
+
+    /** Pre-rasterized glyphs.
+     */
+    std::unordered_map<font_glyph_type, glyph_tile_entry, font_glyph_type::hash> _glyph_tiles;
+
+    /** Glyphs in the order their tiles became ready, may include glyphs that are no longer ready.
+     */
+    std::deque<font_glyph_type> _ready_glyph_tiles;
+
+    /** The number of glyph tiles that are ready.
+     */
+    std::size_t _nr_ready_glyph_tiles = 0;
+
+    std::size_t _max_nr_ready_glyph_tiles;
+
+    mutable std::mutex _glyph_sdf_caches_mutex;
+
+    /** The directory of the persistent glyph cache, or empty when disabled.
+     */
+    std::filesystem::path _glyph_sdf_cache_directory;
+
+    /** The path to the file of each registered font.
+     */
+    std::unordered_map<font const *, std::filesystem::path> _font_paths;
+
+    /** The persistent glyph cache of each font.
+     *
+     * An empty cache means that the font could not be hashed.
+     */
+    std::unordered_map<font const *, std::unique_ptr<glyph_sdf_cache>> _glyph_sdf_caches;
+
+    /** The number of batches of glyphs that were pre-rasterized.
+     */
+    std::size_t _glyph_tiles_batch = 0;
+
+    /** Rasterize glyphs on the global thread pool.
+     *
+     * @param glyphs The glyphs to rasterize, which have a pending entry in the tile table.
+     */
+    void rasterize_glyph_sdf_tiles(std::vector<font_glyph_type> const& glyphs)
+    {
+        thread_pool::global().parallel_for(glyphs.size(), [this, &glyphs](std::size_t i) {
+            hilet& glyph = glyphs[i];
+
+            auto tile = std::optional<glyph_sdf_tile>{};
+            try {
+                tile = find_or_make_glyph_sdf_tile(*glyph.font, glyph.id);
+            } catch (std::exception const& e) {
+                hi_log_error("Could not rasterize glyph {} from font {}: \"{}\"", *glyph.id, glyph.font->family_name, e.what());
+            }
+
+            auto const lock = std::scoped_lock(_glyph_tiles_mutex);
+            hilet it = _glyph_tiles.find(glyph);
+            hi_axiom(it != _glyph_tiles.end());
+            if (it->second.state != glyph_tile_state::pending) {
+                // The glyph was already added to the atlas by other means.
+                return;
+            }
+
+            if (tile) {
+                it->second.tile = std::move(tile);
+                it->second.state = glyph_tile_state::ready;
+                _ready_glyph_tiles.push_back(glyph);
+                ++_nr_ready_glyph_tiles;
+                evict_glyph_sdf_tiles();
+            } else {
+                // Let the atlas handle the error when it tries to rasterize the glyph itself.
+                it->second.state = glyph_tile_state::taken;
+            }
+        });
+
+        flush_glyph_sdf_caches();
+    }
+
+    /** Drop the oldest ready tiles when there are too many.
+     *
+     * The entries of dropped tiles are removed, so that the glyph is rasterized
+     * again when it is taken or pre-rasterized.
+     *
+     * @pre `_glyph_tiles_mutex` is locked.
+     */
+    void evict_glyph_sdf_tiles() noexcept
+    {
+        while (not _ready_glyph_tiles.empty()) {
+            hilet it = _glyph_tiles.find(_ready_glyph_tiles.front());
+            hilet is_ready = it != _glyph_tiles.end() and it->second.state == glyph_tile_state::ready;
+
+            if (is_ready and _nr_ready_glyph_tiles <= _max_nr_ready_glyph_tiles) {
+                break;
+            }
+
+            // Glyphs that were taken since are removed from the front as well.
+            _ready_glyph_tiles.pop_front();
+            if (is_ready) {
+                _glyph_tiles.erase(it);
+                --_nr_ready_glyph_tiles;
+            }
+        }
+    }
+
+    /** Get the persistent glyph cache of a font.
+     *
+     * The cache is opened on first use, which includes hashing the font file.
+     *
+     * @return The cache, or nullptr when the cache is disabled or not available for this font.
+     */
+    [[nodiscard]] glyph_sdf_cache *get_glyph_sdf_cache(font const& font) noexcept
+    {
+        auto const lock = std::scoped_lock(_glyph_sdf_caches_mutex);
+
+        if (_glyph_sdf_cache_directory.empty()) {
+            return nullptr;
+        }
+
+        hilet[it, inserted] = _glyph_sdf_caches.try_emplace(std::addressof(font));
+        if (inserted) {
+            if (hilet path_it = _font_paths.find(std::addressof(font)); path_it != _font_paths.end()) {
+                try {
+                    it->second = std::make_unique<glyph_sdf_cache>(
+                        _glyph_sdf_cache_directory, glyph_sdf_cache::hash_font_file(path_it->second));
+                } catch (std::exception const& e) {
+                    hi_log_error("Could not open glyph SDF cache for font {}: \"{}\"", path_it->second.string(), e.what());
+                }
+            }
+        }
+        return it->second.get();
+    }
+
+    /** Find a glyph in the persistent glyph cache, or rasterize and add it to the cache.
+     *
+     * @throws std::exception If there was an error while loading the glyph from the font.
+     */
+    [[nodiscard]] glyph_sdf_tile find_or_make_glyph_sdf_tile(font const& font, glyph_id id)
+    {
+        auto *cache = get_glyph_sdf_cache(font);
+        if (cache) {
+            if (auto tile = cache->find(font, id)) {
+                return *std::move(tile);
+            }
+        }
+
+        auto tile = make_glyph_sdf_tile(font, id);
+        if (cache) {
+            cache->insert(tile);
+        }
+        return tile;
+    }
+
     [[nodiscard]] std::vector<hi::font *> make_fallback_chain(font_weight weight, font_style style) noexcept
     {
         auto r = _font_ptrs;
@@ -0,0 +1,117 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "font_book.hpp"
+#include "glyph_sdf_tile.hpp"
+#include "../path/path.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+void assert_tile_eq(glyph_sdf_tile const& tile, glyph_sdf_tile const& expected)
+{
+    ASSERT_EQ(tile.font, expected.font);
+    ASSERT_EQ(tile.id, expected.id);
+    ASSERT_EQ(tile.metrics.bounding_rectangle, expected.metrics.bounding_rectangle);
+    ASSERT_EQ(tile.border_scale, expected.border_scale);
+    ASSERT_EQ(tile.image.width(), expected.image.width());
+    ASSERT_EQ(tile.image.height(), expected.image.height());
+    for (auto y = 0_uz; y != expected.image.height(); ++y) {
+        for (auto x = 0_uz; x != expected.image.width(); ++x) {
+            ASSERT_EQ(tile.image[y][x].value, expected.image[y][x].value);
+        }
+    }
+}
+
+class font_book_tests : public ::testing::Test {
+protected:
+    std::filesystem::path font_path;
+    std::u32string code_points;
+
+    void SetUp() override
+    {
+        font_path = library_source_dir() / "resources" / "elusiveicons-webfont.ttf";
+        for (auto c = U'\uf101'; c != U'\uf231'; ++c) {
+            code_points += c;
+        }
+    }
+
+    [[nodiscard]] static std::vector<glyph_id> find_glyphs(font_book& book, font const& font, std::u32string_view code_points)
+    {
+        auto r = std::vector<glyph_id>{};
+        for (hilet c : code_points) {
+            hilet glyph = book.find_glyph(font, c);
+            if (std::ranges::find(r, glyph.id) == r.end()) {
+                r.push_back(glyph.id);
+            }
+        }
+        return r;
+    }
+};
+
+} // namespace
+
+TEST_F(font_book_tests, prerasterize_and_take)
+{
+    auto book = font_book{};
+    hilet& font = book.register_font_file(font_path);
+    hilet glyphs = find_glyphs(book, font, code_points);
+
+    book.prerasterize_glyphs(font, code_points).wait();
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), glyphs.size());
+
+    for (hilet id : glyphs) {
+        assert_tile_eq(book.take_glyph_sdf_tile(font, id), make_glyph_sdf_tile(font, id));
+    }
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), 0);
+
+    // Glyphs that were taken are not rasterized again.
+    hilet done = book.prerasterize_glyphs(font, code_points);
+    ASSERT_EQ(done.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), 0);
+}
+
+TEST_F(font_book_tests, prerasterize_overlapping)
+{
+    auto book = font_book{};
+    hilet& font = book.register_font_file(font_path);
+    hilet glyphs = find_glyphs(book, font, code_points);
+
+    // The second request includes glyphs of the first, which are not rasterized twice.
+    hilet first = book.prerasterize_glyphs(font, std::u32string_view{code_points}.substr(0, 32));
+    hilet second = book.prerasterize_glyphs(font, code_points);
+    second.wait();
+    first.wait();
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), glyphs.size());
+
+    for (hilet id : glyphs) {
+        assert_tile_eq(book.take_glyph_sdf_tile(font, id), make_glyph_sdf_tile(font, id));
+    }
+}
+
+TEST_F(font_book_tests, prerasterize_evict)
+{
+    auto book = font_book{8};
+    hilet& font = book.register_font_file(font_path);
+    hilet glyphs = find_glyphs(book, font, code_points);
+    ASSERT_GT(glyphs.size(), 8);
+
+    book.prerasterize_glyphs(font, code_points).wait();
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), 8);
+
+    // Dropped tiles are rasterized again when they are taken.
+    for (hilet id : glyphs) {
+        assert_tile_eq(book.take_glyph_sdf_tile(font, id), make_glyph_sdf_tile(font, id));
+    }
+    ASSERT_EQ(book.nr_ready_glyph_tiles(), 0);
+}
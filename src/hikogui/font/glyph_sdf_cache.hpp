@@ -0,0 +1,443 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "glyph_sdf_tile.hpp"
+#include "glyph_id.hpp"
+#include "glyph_metrics.hpp"
+#include "../file/file.hpp"
+#include "../codec/codec.hpp"
+#include "../image/image.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <filesystem>
+#include <algorithm>
+#include <optional>
+#include <mutex>
+#include <vector>
+#include <map>
+#include <span>
+#include <bit>
+#include <cstring>
+#include <concepts>
+#include <array>
+
+hi_export_module(hikogui.font.glyph_sdf_cache);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+template<std::unsigned_integral T>
+hi_inline void glyph_sdf_cache_put(bstring& bytes, T value) noexcept
+{
+    auto buffer = std::array<std::byte, sizeof(T)>{};
+    store_le(value, buffer.data());
+    bytes.append(buffer.data(), buffer.size());
+}
+
+hi_inline void glyph_sdf_cache_put(bstring& bytes, float value) noexcept
+{
+    glyph_sdf_cache_put(bytes, std::bit_cast<uint32_t>(value));
+}
+
+[[nodiscard]] hi_inline float glyph_sdf_cache_get_float(std::byte const *ptr) noexcept
+{
+    return std::bit_cast<float>(load_le<uint32_t>(ptr));
+}
+
+} // namespace detail
+
+/** A persistent cache of signed distance fields of the glyphs of a single font.
+ *
+ * The cache is a file which is memory mapped, so that the signed distance fields
+ * and metrics of glyphs can be used at startup without decoding the outlines
+ * from the font file and generating the signed distance fields.
+ *
+ * The file is keyed by a SHA-256 of the font file, the version of the file format
+ * and the parameters of the signed distance fields. When any of these do not match,
+ * or the file is corrupt, the cache file is discarded.
+ *
+ * New tiles are kept in memory until `flush()` writes a new cache file, which
+ * replaces the old file atomically by renaming.
+ *
+ * File format, integers and floats are little endian:
+ *  - header: fourcc "hSDF", version, SHA-256 of the font (32 bytes), font size,
+ *    border, maximum distance, number of index entries, CRC-32 of the header.
+ *  - index: sorted on glyph id; glyph id, offset, size, CRC-32 of the record.
+ *  - records: bounding rectangle, left side bearing, right side bearing, advance,
+ *    border scale, width and height (uint16) followed by the pixels.
+ *
+ * This class is thread-safe.
+ */
+hi_export class glyph_sdf_cache {
+public:
+    /** The version of the file format.
+     */
+    constexpr static uint32_t version = 1;
+
+    constexpr static std::size_t header_size = 60;
+    constexpr static std::size_t index_entry_size = 16;
+    constexpr static std::size_t record_header_size = 40;
+
+    ~glyph_sdf_cache() = default;
+    glyph_sdf_cache(glyph_sdf_cache const&) = delete;
+    glyph_sdf_cache(glyph_sdf_cache&&) = delete;
+    glyph_sdf_cache& operator=(glyph_sdf_cache const&) = delete;
+    glyph_sdf_cache& operator=(glyph_sdf_cache&&) = delete;
+
+    /** Open the cache of a font.
+     *
+     * @param directory The directory where cache files are stored.
+     * @param font_hash The SHA-256 of the font file, see `hash_font_file()`.
+     */
+    glyph_sdf_cache(std::filesystem::path const& directory, bstring font_hash) noexcept :
+        _path(directory / (base16::encode(font_hash) + ".sdf")), _font_hash(std::move(font_hash))
+    {
+        hi_axiom(_font_hash.size() == 32);
+
+        auto const lock = std::scoped_lock(_mutex);
+        load();
+    }
+
+    /** Calculate the SHA-256 of a font file.
+     *
+     * @param path The path to the font file.
+     * @return The SHA-256 digest.
+     * @throws io_error When the file could not be read.
+     */
+    [[nodiscard]] static bstring hash_font_file(std::filesystem::path const& path)
+    {
+        hilet view = file_view{path};
+        auto hash = SHA256{};
+        hash.add(as_bstring_view(view));
+        return hash.get_bytes();
+    }
+
+    /** The path to the cache file.
+     */
+    [[nodiscard]] std::filesystem::path const& path() const noexcept
+    {
+        return _path;
+    }
+
+    /** The number of glyphs in the cache.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        auto r = _new_tiles.size();
+        for (hilet& entry : _index) {
+            if (not _new_tiles.contains(glyph_id{narrow_cast<uint16_t>(entry.id)})) {
+                ++r;
+            }
+        }
+        return r;
+    }
+
+    /** Find a glyph in the cache.
+     *
+     * @param font The font the cache is used for.
+     * @param id The glyph to find.
+     * @return The tile of the glyph, or empty when not in the cache.
+     */
+    [[nodiscard]] std::optional<glyph_sdf_tile> find(font const& font, glyph_id id) noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (hilet it = _new_tiles.find(id); it != _new_tiles.end()) {
+            auto r = it->second;
+            r.font = std::addressof(font);
+            return r;
+        }
+
+        hilet it = std::ranges::lower_bound(_index, *id, {}, &index_entry::id);
+        if (it == _index.end() or it->id != *id) {
+            return std::nullopt;
+        }
+
+        if (auto r = decode_record(*it)) {
+            r->font = std::addressof(font);
+            r->id = id;
+            return r;
+        }
+
+        hi_log_warning("Glyph SDF cache {} is corrupt, discarding.", _path.string());
+        discard();
+        return std::nullopt;
+    }
+
+    /** Add a glyph to the cache.
+     *
+     * @param tile The tile to add, replacing a previous tile of the same glyph.
+     */
+    void insert(glyph_sdf_tile tile) noexcept
+    {
+        hi_axiom(tile.image.width() <= std::numeric_limits<uint16_t>::max());
+        hi_axiom(tile.image.height() <= std::numeric_limits<uint16_t>::max());
+
+        auto const lock = std::scoped_lock(_mutex);
+        tile.font = nullptr;
+        _new_tiles.insert_or_assign(tile.id, std::move(tile));
+    }
+
+    /** Write the new glyphs to the cache file.
+     *
+     * Write errors are logged; the cache remains usable from memory.
+     */
+    void flush() noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        if (_new_tiles.empty()) {
+            return;
+        }
+
+        try {
+            write();
+        } catch (std::exception const& e) {
+            hi_log_error("Could not write glyph SDF cache {}: \"{}\"", _path.string(), e.what());
+        }
+
+        load();
+    }
+
+private:
+    struct index_entry {
+        uint32_t id;
+        uint32_t offset;
+        uint32_t size;
+        uint32_t checksum;
+    };
+
+    std::filesystem::path _path;
+    bstring _font_hash;
+
+    mutable std::mutex _mutex;
+
+    /** The memory mapped cache file.
+     */
+    file_view _view;
+
+    /** The index of the cache file, sorted on glyph id.
+     */
+    std::vector<index_entry> _index;
+
+    /** Tiles that are not yet written to the cache file.
+     */
+    std::map<glyph_id, glyph_sdf_tile> _new_tiles;
+
+    /** Make the header of the cache file.
+     */
+    [[nodiscard]] bstring make_header(std::size_t num_entries) const noexcept
+    {
+        auto r = bstring{};
+        r.reserve(header_size);
+        auto magic = std::array<std::byte, 4>{};
+        store_be("hSDF"_fcc, magic.data());
+        r.append(magic.data(), magic.size());
+        detail::glyph_sdf_cache_put(r, version);
+        r += _font_hash;
+        detail::glyph_sdf_cache_put(r, glyph_sdf_tile::font_size);
+        detail::glyph_sdf_cache_put(r, glyph_sdf_tile::border);
+        detail::glyph_sdf_cache_put(r, sdf_r8::max_distance);
+        detail::glyph_sdf_cache_put(r, narrow_cast<uint32_t>(num_entries));
+        detail::glyph_sdf_cache_put(r, detail::gzip_crc32(r));
+        hi_axiom(r.size() == header_size);
+        return r;
+    }
+
+    /** Load the cache file.
+     *
+     * When the cache file does not exist the cache is empty, when the cache file is
+     * incompatible or corrupt it is discarded.
+     */
+    void load() noexcept
+    {
+        _view = {};
+        _index.clear();
+
+        if (not std::filesystem::exists(_path)) {
+            return;
+        }
+
+        try {
+            _view = file_view{_path};
+        } catch (std::exception const& e) {
+            hi_log_warning("Could not open glyph SDF cache {}: \"{}\"", _path.string(), e.what());
+            return;
+        }
+
+        if (not load_index()) {
+            hi_log_warning("Glyph SDF cache {} is stale or corrupt, discarding.", _path.string());
+            discard();
+        }
+    }
+
+    /** Validate the header and load the index.
+     *
+     * @return True if the cache file is valid.
+     */
+    [[nodiscard]] bool load_index() noexcept
+    {
+        hilet bytes = as_bstring_view(_view);
+        if (bytes.size() < header_size) {
+            return false;
+        }
+
+        hilet num_entries = load_le<uint32_t>(bytes.data() + header_size - 8);
+        if (bytes.substr(0, header_size) != make_header(num_entries)) {
+            // Different version, font, parameters or a corrupt header.
+            return false;
+        }
+
+        if ((bytes.size() - header_size) / index_entry_size < num_entries) {
+            return false;
+        }
+
+        _index.reserve(num_entries);
+        auto ptr = bytes.data() + header_size;
+        for (auto i = 0_uz; i != num_entries; ++i, ptr += index_entry_size) {
+            hilet entry = index_entry{
+                load_le<uint32_t>(ptr), load_le<uint32_t>(ptr + 4), load_le<uint32_t>(ptr + 8), load_le<uint32_t>(ptr + 12)};
+
+            if (not _index.empty() and _index.back().id >= entry.id) {
+                return false;
+            }
+            if (entry.size < record_header_size or entry.offset > bytes.size() or entry.size > bytes.size() - entry.offset) {
+                return false;
+            }
+            _index.push_back(entry);
+        }
+        return true;
+    }
+
+    /** Decode a record of the cache file.
+     *
+     * @return The tile, or empty if the record is corrupt.
+     */
+    [[nodiscard]] std::optional<glyph_sdf_tile> decode_record(index_entry const& entry) const noexcept
+    {
+        hilet record = as_bstring_view(_view).substr(entry.offset, entry.size);
+        if (detail::gzip_crc32(record) != entry.checksum) {
+            return std::nullopt;
+        }
+
+        hilet ptr = record.data();
+        hilet width = load_le<uint16_t>(ptr + 36);
+        hilet height = load_le<uint16_t>(ptr + 38);
+        // Multiply as std::size_t; the uint16_t operands would be promoted to int, which may overflow.
+        if (record.size() != record_header_size + wide_cast<std::size_t>(width) * wide_cast<std::size_t>(height)) {
+            return std::nullopt;
+        }
+
+        auto r = glyph_sdf_tile{};
+        r.metrics.bounding_rectangle = aarectangle{
+            detail::glyph_sdf_cache_get_float(ptr),
+            detail::glyph_sdf_cache_get_float(ptr + 4),
+            detail::glyph_sdf_cache_get_float(ptr + 8),
+            detail::glyph_sdf_cache_get_float(ptr + 12)};
+        r.metrics.left_side_bearing = detail::glyph_sdf_cache_get_float(ptr + 16);
+        r.metrics.right_side_bearing = detail::glyph_sdf_cache_get_float(ptr + 20);
+        r.metrics.advance = detail::glyph_sdf_cache_get_float(ptr + 24);
+        r.border_scale = scale2{detail::glyph_sdf_cache_get_float(ptr + 28), detail::glyph_sdf_cache_get_float(ptr + 32)};
+
+        static_assert(sizeof(sdf_r8) == 1);
+        r.image = pixmap<sdf_r8>{width, height};
+        std::memcpy(r.image.data(), ptr + record_header_size, r.image.size());
+        return r;
+    }
+
+    /** Encode a tile as a record of the cache file.
+     */
+    [[nodiscard]] static bstring encode_record(glyph_sdf_tile const& tile) noexcept
+    {
+        auto r = bstring{};
+        r.reserve(record_header_size + tile.image.size());
+
+        hilet& rectangle = tile.metrics.bounding_rectangle;
+        detail::glyph_sdf_cache_put(r, rectangle.left());
+        detail::glyph_sdf_cache_put(r, rectangle.bottom());
+        detail::glyph_sdf_cache_put(r, rectangle.width());
+        detail::glyph_sdf_cache_put(r, rectangle.height());
+        detail::glyph_sdf_cache_put(r, tile.metrics.left_side_bearing);
+        detail::glyph_sdf_cache_put(r, tile.metrics.right_side_bearing);
+        detail::glyph_sdf_cache_put(r, tile.metrics.advance);
+        detail::glyph_sdf_cache_put(r, tile.border_scale.x());
+        detail::glyph_sdf_cache_put(r, tile.border_scale.y());
+        detail::glyph_sdf_cache_put(r, narrow_cast<uint16_t>(tile.image.width()));
+        detail::glyph_sdf_cache_put(r, narrow_cast<uint16_t>(tile.image.height()));
+
+        hilet pixels = reinterpret_cast<std::byte const *>(tile.image.data());
+        r.append(pixels, tile.image.size());
+        return r;
+    }
+
+    /** Write the existing and new records into a new cache file.
+     */
+    void write()
+    {
+        // Merge the existing records with the new tiles, ordered by glyph id.
+        auto records = std::vector<std::pair<uint32_t, bstring>>{};
+        records.reserve(_index.size() + _new_tiles.size());
+        hilet bytes = as_bstring_view(_view);
+        auto new_it = _new_tiles.begin();
+        for (hilet& entry : _index) {
+            for (; new_it != _new_tiles.end() and *new_it->first < entry.id; ++new_it) {
+                records.emplace_back(*new_it->first, encode_record(new_it->second));
+            }
+            if (new_it != _new_tiles.end() and *new_it->first == entry.id) {
+                continue;
+            }
+            records.emplace_back(entry.id, bstring{bytes.substr(entry.offset, entry.size)});
+        }
+        for (; new_it != _new_tiles.end(); ++new_it) {
+            records.emplace_back(*new_it->first, encode_record(new_it->second));
+        }
+
+        auto data = make_header(records.size());
+        auto offset = header_size + records.size() * index_entry_size;
+        for (hilet& [id, record] : records) {
+            detail::glyph_sdf_cache_put(data, id);
+            detail::glyph_sdf_cache_put(data, narrow_cast<uint32_t>(offset));
+            detail::glyph_sdf_cache_put(data, narrow_cast<uint32_t>(record.size()));
+            detail::glyph_sdf_cache_put(data, detail::gzip_crc32(record));
+            offset += record.size();
+        }
+        for (hilet& [id, record] : records) {
+            data += record;
+        }
+
+        // Write a temporary file and rename it over the cache file, so that the
+        // cache file is never partially written.
+        auto tmp_path = _path;
+        tmp_path += ".tmp";
+        std::filesystem::create_directories(_path.parent_path());
+        {
+            auto tmp_file = file{tmp_path, access_mode::truncate_or_create_for_write | access_mode::rename};
+            tmp_file.write(data);
+            tmp_file.flush();
+
+            // The current cache file must be unmapped before it can be replaced.
+            _view = {};
+            _index.clear();
+            tmp_file.rename(_path, true);
+        }
+        _new_tiles.clear();
+    }
+
+    /** Discard the cache file.
+     */
+    void discard() noexcept
+    {
+        _view = {};
+        _index.clear();
+
+        auto ec = std::error_code{};
+        std::filesystem::remove(_path, ec);
+    }
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,58 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "glyph_sdf_cache.hpp"
+#include "true_type_font.hpp"
+#include "../path/path.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(glyph_sdf_cache_benchmarks, startup)
+{
+    hilet font_path = library_source_dir() / "resources" / "elusiveicons-webfont.ttf";
+    hilet directory = std::filesystem::temp_directory_path() / "hikogui_glyph_sdf_cache_benchmarks";
+    std::filesystem::remove_all(directory);
+
+    auto glyphs = std::vector<glyph_id>{};
+    {
+        hilet font = true_type_font{font_path};
+        for (auto c = U'\uf101'; c != U'\uf231'; ++c) {
+            if (hilet id = font.find_glyph(c)) {
+                glyphs.push_back(id);
+            }
+        }
+    }
+    ASSERT_FALSE(glyphs.empty());
+
+    // Cold start: parse the font, rasterize all glyphs and write the cache.
+    hilet cold_rate = benchmark_rate([&] {
+        std::filesystem::remove_all(directory);
+        hilet font = true_type_font{font_path};
+        auto cache = glyph_sdf_cache{directory, glyph_sdf_cache::hash_font_file(font_path)};
+        for (hilet id : glyphs) {
+            cache.insert(make_glyph_sdf_tile(font, id));
+        }
+        cache.flush();
+    });
+
+    // Warm start: parse the font and read all glyphs from the cache.
+    hilet warm_rate = benchmark_rate([&] {
+        hilet font = true_type_font{font_path};
+        auto cache = glyph_sdf_cache{directory, glyph_sdf_cache::hash_font_file(font_path)};
+        for (hilet id : glyphs) {
+            [[maybe_unused]] hilet tile = cache.find(font, id);
+        }
+    });
+
+    std::filesystem::remove_all(directory);
+
+    benchmark_report("elusive icons cold", cold_rate * glyphs.size(), "glyphs/s");
+    benchmark_report("elusive icons warm", warm_rate * glyphs.size(), "glyphs/s");
+}
@@ -0,0 +1,115 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "glyph_sdf_cache.hpp"
+#include "true_type_font.hpp"
+#include "../path/path.hpp"
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+class glyph_sdf_cache_tests : public ::testing::Test {
+protected:
+    std::filesystem::path font_path;
+    std::filesystem::path directory;
+    std::unique_ptr<true_type_font> font;
+    bstring font_hash;
+    std::vector<glyph_id> glyphs;
+
+    void SetUp() override
+    {
+        font_path = library_source_dir() / "resources" / "elusiveicons-webfont.ttf";
+        directory = std::filesystem::temp_directory_path() / "hikogui_glyph_sdf_cache_tests";
+        std::filesystem::remove_all(directory);
+
+        font = std::make_unique<true_type_font>(font_path);
+        font_hash = glyph_sdf_cache::hash_font_file(font_path);
+
+        for (auto c = U'\uf101'; c != U'\uf231'; ++c) {
+            if (hilet id = font->find_glyph(c)) {
+                glyphs.push_back(id);
+            }
+        }
+        ASSERT_FALSE(glyphs.empty());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directory);
+    }
+
+    void fill_cache()
+    {
+        auto cache = glyph_sdf_cache{directory, font_hash};
+        for (hilet id : glyphs) {
+            cache.insert(make_glyph_sdf_tile(*font, id));
+        }
+        cache.flush();
+    }
+};
+
+} // namespace
+
+TEST_F(glyph_sdf_cache_tests, round_trip)
+{
+    fill_cache();
+
+    auto cache = glyph_sdf_cache{directory, font_hash};
+    ASSERT_EQ(cache.size(), glyphs.size());
+
+    for (hilet id : glyphs) {
+        hilet expected = make_glyph_sdf_tile(*font, id);
+        hilet tile = cache.find(*font, id);
+        ASSERT_TRUE(tile);
+        ASSERT_EQ(tile->font, font.get());
+        ASSERT_EQ(tile->id, id);
+        ASSERT_EQ(tile->metrics.advance, expected.metrics.advance);
+        ASSERT_EQ(tile->metrics.bounding_rectangle, expected.metrics.bounding_rectangle);
+        ASSERT_EQ(tile->border_scale, expected.border_scale);
+        ASSERT_EQ(tile->image.width(), expected.image.width());
+        ASSERT_EQ(tile->image.height(), expected.image.height());
+        for (auto y = 0_uz; y != expected.image.height(); ++y) {
+            for (auto x = 0_uz; x != expected.image.width(); ++x) {
+                ASSERT_EQ(tile->image[y][x].value, expected.image[y][x].value);
+            }
+        }
+    }
+}
+
+TEST_F(glyph_sdf_cache_tests, other_font)
+{
+    fill_cache();
+
+    auto other_hash = font_hash;
+    other_hash[0] ^= std::byte{1};
+    auto cache = glyph_sdf_cache{directory, other_hash};
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_FALSE(cache.find(*font, glyphs.front()));
+}
+
+TEST_F(glyph_sdf_cache_tests, corrupt)
+{
+    fill_cache();
+
+    auto path = glyph_sdf_cache{directory, font_hash}.path();
+    {
+        // Flip a bit in the last record.
+        auto bytes = bstring{as_bstring_view(file_view{path})};
+        bytes.back() ^= std::byte{1};
+        auto f = file{path, access_mode::truncate_or_create_for_write};
+        f.write(bytes);
+    }
+
+    auto cache = glyph_sdf_cache{directory, font_hash};
+    ASSERT_FALSE(cache.find(*font, glyphs.back()));
+    ASSERT_FALSE(std::filesystem::exists(path));
+}
@@ -0,0 +1,104 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "font_font.hpp"
+#include "glyph_id.hpp"
+#include "glyph_metrics.hpp"
+#include "../image/image.hpp"
+#include "../graphic_path/graphic_path.hpp"
+#include "../geometry/geometry.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+
+hi_export_module(hikogui.font.glyph_sdf_tile);
+
+hi_export namespace hi::inline v1 {
+
+/** A signed distance field of a glyph, rasterized on the CPU.
+ *
+ * The tile is ready to be uploaded into the glyph atlas.
+ */
+hi_export struct glyph_sdf_tile {
+    /** The size in pixels of 1 'em' of a glyph in the atlas.
+     */
+    constexpr static float font_size = 28.0f;
+
+    /** The size in pixels of the border around the bounding box of a glyph in the atlas.
+     *
+     * The border allows for bi-linear interpolation on the edges.
+     */
+    constexpr static float border = sdf_r8::max_distance;
+
+    hi::font const *font = nullptr;
+    hi::glyph_id id = {};
+
+    /** The metrics of the glyph.
+     */
+    glyph_metrics metrics = {};
+
+    /** The signed distance field of the glyph, including the border.
+     */
+    pixmap<sdf_r8> image = {};
+
+    /** The scaling factor used for scaling a quad to include the border.
+     */
+    scale2 border_scale = {};
+};
+
+/** Rasterize a glyph into a signed distance field.
+ *
+ * This function is thread-safe as long as the font is loaded, see `font::loaded()`.
+ *
+ * Structure of the image:
+ *
+ *  +---------------------+
+ *  |     draw border     |
+ *  |  +---------------+  |
+ *  |  | render border |  |
+ *  |  |  +---------+  |  |
+ *  |  |  |  glyph  |  |  |
+ *  |  |  | bounding|  |  |
+ *  |  |  |   box   |  |  |
+ *  |  |  +---------+  |  |
+ *  |  |               |  |
+ *  |  +---------------+  |
+ *  |                     |
+ *  O---------------------+
+ *
+ * @param font The font to get the glyph from.
+ * @param id The glyph to rasterize.
+ * @return The rasterized glyph.
+ * @throws std::exception If there was an error while loading the glyph from the font.
+ */
+hi_export [[nodiscard]] hi_inline glyph_sdf_tile make_glyph_sdf_tile(font const& font, glyph_id id)
+{
+    hilet glyph_metrics = font.get_metrics(id);
+    hilet glyph_path = font.get_path(id);
+    hilet glyph_bounding_box = glyph_metrics.bounding_rectangle;
+
+    hilet draw_scale = scale2{glyph_sdf_tile::font_size, glyph_sdf_tile::font_size};
+    hilet draw_bounding_box = draw_scale * glyph_bounding_box;
+
+    // Determine the size of the image in the atlas.
+    // This is the bounding box sized to the fixed font size and a border
+    hilet draw_offset = point2{glyph_sdf_tile::border, glyph_sdf_tile::border} - get<0>(draw_bounding_box);
+    hilet draw_extent = draw_bounding_box.size() + 2.0f * glyph_sdf_tile::border;
+    hilet image_size = ceil(draw_extent);
+
+    // Transform the path to the scale of the fixed font size and drawing the bounding box inside the image.
+    hilet draw_path = (translate2{draw_offset} * draw_scale) * glyph_path;
+
+    auto r = glyph_sdf_tile{};
+    r.font = std::addressof(font);
+    r.id = id;
+    r.metrics = glyph_metrics;
+    r.border_scale = image_size / draw_bounding_box.size();
+    r.image = pixmap<sdf_r8>{ceil_cast<std::size_t>(image_size.width()), ceil_cast<std::size_t>(image_size.height())};
+    fill(r.image, draw_path);
+    return r;
+}
+
+} // namespace hi::inline v1
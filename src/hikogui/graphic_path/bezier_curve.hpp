@@ -18,11 +18,25 @@
 #include <vector>
 #include <cmath>
 #include <span>
+#include <array>
+#include <utility>
 
 hi_export_module(hikogui.graphic_path.bezier_curve);
 
 hi_export namespace hi { inline namespace v1 {
 
+/** The rule to determine which parts of a path are inside.
+ */
+hi_export enum class fill_rule {
+    /** A point is inside when the curves wind around it a non-zero number of times.
+     */
+    non_zero,
+
+    /** A point is inside when the curves wind around it an odd number of times.
+     */
+    even_odd
+};
+
 /*! Bezier Curve
  * A linear, quadratic or cubic bezier curve.
  */
@@ -389,133 +403,334 @@ hi_export struct bezier_curve {
 
 namespace detail {
 
-[[nodiscard]] constexpr std::vector<float> solveCurvesXByY(std::vector<bezier_curve> const& v, float y) noexcept
-{
-    std::vector<float> r;
-    r.reserve(v.size());
+/** A line of a flattened path, used by the coverage rasterizer.
+ */
+struct coverage_edge {
+    /** The x coordinate at the top of the part of the edge in the current scan-line.
+     */
+    float x;
 
-    for (hilet& curve : v) {
-        hilet xValues = curve.solveXByY(y);
-        for (hilet x : xValues) {
-            r.push_back(x);
-        }
-    }
-    return r;
-}
+    /** The change of x for each step in y.
+     */
+    float dxdy;
+
+    /** The top y coordinate of the edge.
+     */
+    float y0;
 
-[[nodiscard]] constexpr std::optional<std::vector<std::pair<float, float>>>
-getFillSpansAtY(std::vector<bezier_curve> const& v, float y) noexcept
+    /** The bottom y coordinate of the edge.
+     */
+    float y1;
+
+    /** The direction of the original line, +1 when going down and -1 when going up.
+     */
+    float direction;
+};
+
+/** Calculate the prefix sum of 4 floats.
+ *
+ * @param v The values to sum.
+ * @return The running sum, `{v[0], v[0] + v[1], v[0] + v[1] + v[2], v[0] + v[1] + v[2] + v[3]}`
+ */
+[[nodiscard]] hi_inline f32x4 prefix_sum(f32x4 v) noexcept
 {
-    auto xValues = solveCurvesXByY(v, y);
+    v += swizzle<-1, 0, 1, 2>(v);
+    v += swizzle<-1, -1, 0, 1>(v);
+    return v;
+}
 
-    // Sort x values, each pair is a span.
-    std::sort(xValues.begin(), xValues.end());
+/** Scan-line rasterizer calculating the exact area coverage of each pixel.
+ *
+ * The curves are flattened into lines, which are kept in an edge table sorted on
+ * their top y coordinate. For each scan-line the edges that start in it are moved
+ * into the active edge list, and the edges that have ended are removed.
+ *
+ * Each active edge adds, for the part inside the scan-line, the signed area to the
+ * left of the edge in the pixels it passes and the remaining cover to the pixel
+ * after it, into an accumulation row. A prefix sum over the accumulation row then
+ * yields the signed winding area of each pixel, which is converted to coverage
+ * using the fill rule.
+ */
+class coverage_rasterizer {
+public:
+    /** The maximum distance in pixels between a curve and its flattened lines.
+     */
+    constexpr static float tolerance = 0.05f;
 
-    // End-to-end connected curves will yield duplicate values.
-    hilet uniqueEnd = std::unique(xValues.begin(), xValues.end());
+    /** The maximum number of lines a single curve is flattened into.
+     */
+    constexpr static float max_lines_per_curve = 1024.0f;
 
-    // After removing duplicates, we should end up with pairs of x values.
-    std::size_t const uniqueValueCount = (uniqueEnd - xValues.begin());
+    /** Prepare a rasterizer for curves.
+     *
+     * @param curves All curves of the path, in no particular order.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     */
+    coverage_rasterizer(std::vector<bezier_curve> const& curves, std::size_t width, std::size_t height) noexcept :
+        _width(width), _height(height)
+    {
+        for (hilet& curve : curves) {
+            add_curve(curve);
+        }
+
+        std::ranges::sort(_edges, {}, &coverage_edge::y0);
 
-    if (uniqueValueCount % 2 != 0) {
-        // Something is wrong in solving the curves. Probably numeric instability.
-        // In any case, just ignore this sample.
-        return {};
+        // Accumulation writes up to 2 floats beyond the right edge, the prefix sum
+        // reads in groups of 4.
+        _accumulator.resize(ceil(width + 2, 4_uz), 0.0f);
     }
 
-    // Create pairs of values.
-    auto r = std::vector<std::pair<float, float>>{};
-    r.reserve(uniqueValueCount / 2);
-    for (std::size_t i = 0; i < uniqueValueCount; i += 2) {
-        r.emplace_back(xValues[i], xValues[i + 1]);
+    /** Rasterize the edges into a gray scale image.
+     *
+     * @param image The image to write the coverage into, must be the size passed to the constructor.
+     * @param rule The rule to determine which parts of the path are inside.
+     */
+    void fill(pixmap_span<uint8_t> image, fill_rule rule) noexcept
+    {
+        hi_axiom(image.width() == _width and image.height() == _height);
+
+        auto next = _edges.begin();
+        _active.clear();
+
+        for (auto y = 0_uz; y != _height; ++y) {
+            hilet row_top = static_cast<float>(y);
+            hilet row_bottom = row_top + 1.0f;
+
+            std::erase_if(_active, [row_top](hilet& edge) {
+                return edge.y1 <= row_top;
+            });
+
+            for (; next != _edges.end() and next->y0 < row_bottom; ++next) {
+                auto edge = *next;
+                if (edge.y0 < row_top) {
+                    // Edge starts above the image.
+                    edge.x += (row_top - edge.y0) * edge.dxdy;
+                }
+                _active.push_back(edge);
+            }
+
+            for (auto& edge : _active) {
+                accumulate(edge, row_top, row_bottom);
+            }
+
+            if (rule == fill_rule::even_odd) {
+                resolve_row<fill_rule::even_odd>(image[y]);
+            } else {
+                resolve_row<fill_rule::non_zero>(image[y]);
+            }
+        }
     }
-    return r;
-}
 
-constexpr void fillPartialPixels(std::span<uint8_t> row, ssize_t const i, float const startX, float const endX) noexcept
-{
-    hilet pixelCoverage = std::clamp(endX, i + 0.0f, i + 1.0f) - std::clamp(startX, i + 0.0f, i + 1.0f);
+private:
+    /** The edge table, sorted on the top y coordinate.
+     */
+    std::vector<coverage_edge> _edges = {};
 
-    auto& pixel = row[i];
-    pixel = static_cast<uint8_t>(std::min(pixelCoverage * 51.0f + pixel, 255.0f));
-}
+    /** The edges which cross the current scan-line.
+     */
+    std::vector<coverage_edge> _active = {};
 
-constexpr void fillFullPixels(std::span<uint8_t> row, ssize_t const start, ssize_t const size) noexcept
-{
-    if (size < 16) {
-        hilet end = start + size;
-        for (ssize_t i = start; i < end; i++) {
-            row[i] += 0x33;
+    /** The area and cover added by the edges for each pixel of the current scan-line.
+     */
+    std::vector<float> _accumulator = {};
+
+    /** The range of the accumulation row that was modified in the current scan-line.
+     */
+    std::size_t _dirty_first = std::numeric_limits<std::size_t>::max();
+    std::size_t _dirty_last = 0;
+
+    std::size_t _width;
+    std::size_t _height;
+
+    /** Flatten a curve into lines.
+     *
+     * The number of lines is based on the second derivative of the curve, so that
+     * the distance between the curve and its lines is less than `tolerance`.
+     */
+    void add_curve(bezier_curve const& curve) noexcept
+    {
+        auto num_lines = 1.0f;
+        switch (curve.type) {
+        case bezier_curve::Type::Linear:
+            add_line(curve.P1, curve.P2);
+            return;
+        case bezier_curve::Type::Quadratic:
+            {
+                hilet dd = hypot((curve.P1 - curve.C1) + (curve.P2 - curve.C1));
+                num_lines = std::sqrt(dd / (4.0f * tolerance));
+            }
+            break;
+        case bezier_curve::Type::Cubic:
+            {
+                hilet dd = std::max(
+                    hypot((curve.P1 - curve.C1) + (curve.C2 - curve.C1)), hypot((curve.C1 - curve.C2) + (curve.P2 - curve.C2)));
+                num_lines = std::sqrt(dd * 0.75f / tolerance);
+            }
+            break;
+        default:
+            hi_no_default();
         }
-    } else {
-        auto u8p = &row[start];
-        hilet u8end = u8p + size;
 
-        // First add 51 to all pixels up to the alignment.
-        hilet alignedStart = hi::ceil(u8p, sizeof(uint64_t));
-        while (u8p < alignedStart) {
-            *(u8p++) += 0x33;
+        hilet n = static_cast<std::size_t>(std::clamp(std::ceil(num_lines), 1.0f, max_lines_per_curve));
+        auto p0 = curve.P1;
+        for (auto i = 1_uz; i != n; ++i) {
+            hilet p1 = curve.pointAt(static_cast<float>(i) / static_cast<float>(n));
+            add_line(p0, p1);
+            p0 = p1;
         }
+        add_line(p0, curve.P2);
+    }
 
-        // add 51 for each pixel, 8 pixels at a time.
-        auto u64p = reinterpret_cast<uint64_t *>(u8p);
-        auto const *const u64end = reinterpret_cast<uint64_t const *>(hi::floor(u8end, sizeof(uint64_t)));
-        while (u64p < u64end) {
-            *(u64p++) += 0x3333333333333333ULL;
+    /** Add a line to the edge table.
+     *
+     * Lines are split at the left and right side of the image, and the parts outside
+     * are moved onto these sides. On the left side the lines still add cover to the
+     * pixels of the scan-line, on the right side they are outside of the image.
+     */
+    void add_line(point2 p0, point2 p1) noexcept
+    {
+        for (hilet side : {0.0f, static_cast<float>(_width)}) {
+            if ((p0.x() < side and p1.x() > side) or (p0.x() > side and p1.x() < side)) {
+                hilet t = (side - p0.x()) / (p1.x() - p0.x());
+                hilet split = point2{side, p0.y() + t * (p1.y() - p0.y())};
+                add_line(p0, split);
+                add_line(split, p1);
+                return;
+            }
         }
 
-        // Add 51 to the last pixels.
-        u8p = reinterpret_cast<uint8_t *>(u64p);
-        while (u8p < u8end) {
-            *(u8p++) += 0x33;
+        hilet width = static_cast<float>(_width);
+        hilet x0 = std::clamp(p0.x(), 0.0f, width);
+        hilet x1 = std::clamp(p1.x(), 0.0f, width);
+
+        if (p0.y() == p1.y()) {
+            // Horizontal lines do not add any area.
+            return;
         }
-    }
-}
 
-/*! Render pixels in a row between two x values.
- * Fully covered sub-pixel will have the value 51.
- */
-constexpr void fillRowSpan(std::span<uint8_t> row, float const startX, float const endX) noexcept
-{
-    if (startX >= row.size() || endX < 0.0f) {
-        return;
-    }
+        hilet edge = p0.y() < p1.y() ? coverage_edge{x0, (x1 - x0) / (p1.y() - p0.y()), p0.y(), p1.y(), 1.0f} :
+                                       coverage_edge{x1, (x0 - x1) / (p0.y() - p1.y()), p1.y(), p0.y(), -1.0f};
 
-    hilet startX_int = floor_cast<std::size_t>(startX);
-    hilet endXplusOne = endX + 1.0f;
-    hilet endX_int = floor_cast<std::size_t>(endXplusOne);
-    hilet startColumn = std::max(startX_int, std::size_t{0});
-    hilet endColumn = std::min(endX_int, row.size());
-    hilet nrColumns = endColumn - startColumn;
+        if (edge.y1 <= 0.0f or edge.y0 >= static_cast<float>(_height)) {
+            return;
+        }
 
-    if (nrColumns == 1) {
-        fillPartialPixels(row, startColumn, startX, endX);
-    } else {
-        fillPartialPixels(row, startColumn, startX, endX);
-        fillFullPixels(row, startColumn + 1, nrColumns - 2);
-        fillPartialPixels(row, endColumn - 1, startX, endX);
+        _edges.push_back(edge);
     }
-}
 
-constexpr void fillRow(std::span<uint8_t> row, std::size_t rowY, std::vector<bezier_curve> const& curves) noexcept
-{
-    // 5 times super sampling.
-    for (float y = rowY + 0.1f; y < (rowY + 1); y += 0.2f) {
-        auto optionalSpans = getFillSpansAtY(curves, y);
-        if (!optionalSpans) {
-            // try again, with a slight offset.
-            optionalSpans = getFillSpansAtY(curves, y + 0.01f);
+    /** Add the area and cover of the part of an edge inside the scan-line.
+     */
+    void accumulate(coverage_edge& edge, float row_top, float row_bottom) noexcept
+    {
+        hilet width = static_cast<float>(_width);
+        hilet dy = std::min(edge.y1, row_bottom) - std::max(edge.y0, row_top);
+        if (dy <= 0.0f) {
+            // The edge ended exactly at the top of this scan-line.
+            return;
         }
 
-        if (optionalSpans) {
-            hilet& spans = optionalSpans.value();
+        hilet x_top = edge.x;
+        hilet x_bottom = std::clamp(x_top + edge.dxdy * dy, 0.0f, width);
+        edge.x = x_bottom;
+
+        hilet d = dy * edge.direction;
+        hilet x0 = std::min(x_top, x_bottom);
+        hilet x1 = std::max(x_top, x_bottom);
+        hilet x0_floor = std::floor(x0);
+        hilet x1_ceil = std::ceil(x1);
+        hilet x0_i = static_cast<std::size_t>(x0_floor);
+        hilet x1_i = static_cast<std::size_t>(x1_ceil);
+        hilet acc = _accumulator.data();
+
+        inplace_min(_dirty_first, x0_i);
+        inplace_max(_dirty_last, std::max(x0_i + 2, x1_i + 1));
+
+        if (x1_i <= x0_i + 1) {
+            // The edge stays within a single pixel; split the cover based on the
+            // average x position.
+            hilet x_mid = (x_top + x_bottom) * 0.5f - x0_floor;
+            acc[x0_i] += d - d * x_mid;
+            acc[x0_i + 1] += d * x_mid;
 
-            for (hilet& span : spans) {
-                fillRowSpan(row, span.first, span.second);
+        } else {
+            // The area to the right of the edge in each pixel, is a triangle in the
+            // first pixel, a trapezoid in the middle pixels, and the remainder of
+            // a triangle in the last pixel.
+            hilet s = 1.0f / (x1 - x0);
+            hilet x0_frac = x0 - x0_floor;
+            hilet a0 = 0.5f * s * (1.0f - x0_frac) * (1.0f - x0_frac);
+            hilet x1_frac = x1 - x1_ceil + 1.0f;
+            hilet am = 0.5f * s * x1_frac * x1_frac;
+
+            acc[x0_i] += d * a0;
+            if (x1_i == x0_i + 2) {
+                acc[x0_i + 1] += d * (1.0f - a0 - am);
+            } else {
+                hilet a1 = s * (1.5f - x0_frac);
+                acc[x0_i + 1] += d * (a1 - a0);
+                for (auto x = x0_i + 2; x < x1_i - 1; ++x) {
+                    acc[x] += d * s;
+                }
+                hilet a2 = a1 + static_cast<float>(x1_i - x0_i - 3) * s;
+                acc[x1_i - 1] += d * (1.0f - a2 - am);
             }
+            acc[x1_i] += d * am;
         }
     }
-}
+
+    /** Convert the signed winding area of 4 pixels into pixel values.
+     */
+    template<fill_rule Rule>
+    [[nodiscard]] static f32x4 coverage_to_value(f32x4 area) noexcept
+    {
+        auto coverage = max(area, -area);
+        if constexpr (Rule == fill_rule::even_odd) {
+            // Fold the winding area into a triangle wave between 0 and 1.
+            coverage -= floor(coverage * f32x4::broadcast(0.5f)) * f32x4::broadcast(2.0f);
+            coverage = min(coverage, f32x4::broadcast(2.0f) - coverage);
+        }
+        return min(coverage, f32x4::broadcast(1.0f)) * f32x4::broadcast(255.0f) + f32x4::broadcast(0.5f);
+    }
+
+    /** Convert the accumulation row into coverage, and clear it for the next scan-line.
+     *
+     * Only the part of the row touched by edges is summed, the pixels to the left of
+     * it are empty and the pixels to the right of it all have the same coverage.
+     */
+    template<fill_rule Rule>
+    void resolve_row(std::span<uint8_t> row) noexcept
+    {
+        hilet acc = _accumulator.data();
+        hilet first = std::min(floor(_dirty_first, 4_uz), _width);
+        hilet last = std::min(ceil(_dirty_last, 4_uz), _accumulator.size());
+
+        std::fill(row.begin(), row.begin() + first, uint8_t{0});
+
+        auto carry = f32x4{};
+        auto x = first;
+        for (; x < last and x < _width; x += 4) {
+            hilet sum = prefix_sum(f32x4{acc[x], acc[x + 1], acc[x + 2], acc[x + 3]}) + carry;
+            carry = f32x4::broadcast(sum.w());
+
+            hilet value = coverage_to_value<Rule>(sum);
+            hilet n = std::min(4_uz, _width - x);
+            for (auto i = 0_uz; i != n; ++i) {
+                row[x + i] = static_cast<uint8_t>(value[i]);
+            }
+        }
+
+        if (x < _width) {
+            std::fill(row.begin() + x, row.end(), static_cast<uint8_t>(coverage_to_value<Rule>(carry).x()));
+        }
+
+        if (first < last) {
+            std::fill(acc + first, acc + last, 0.0f);
+        }
+        _dirty_first = _accumulator.size();
+        _dirty_last = 0;
+    }
+};
 
 [[nodiscard]] constexpr float generate_sdf_r8_pixel(point2 point, std::vector<bezier_curve> const& curves) noexcept
 {
@@ -537,6 +752,476 @@ constexpr void fillRow(std::span<uint8_t> row, std::size_t rowY, std::vector<bez
     return nearest.signed_distance();
 }
 
+/** Generate a signed distance field with the same result as `generate_sdf_r8_pixel()`.
+ *
+ * Calculating the distance between a pixel and a quadratic curve is expensive,
+ * instead of calculating the distance to every curve for every pixel, the
+ * exact distance is only calculated for curves that may be the nearest:
+ *  - The curves are binned by their bounding box into a grid of cells.
+ *  - For each cell, the bins around the cell are visited in growing rings
+ *    until the rings are farther away than the nearest curve of every pixel in the cell.
+ *    The curves in the visited bins that may be nearer are kept.
+ *  - For 4 pixels at a time the lower and upper bound of the distance to each
+ *    remaining curve is calculated using SIMD.
+ *  - The exact distance is calculated for the curves whose lower bound is
+ *    below the smallest upper bound.
+ *
+ * Curves that are at least 0.01 squared-pixels farther away than the cluster
+ * of nearest curves can never be selected by `sdf_distance_result::operator<()`,
+ * so the nearest curve is selected from the remaining curves in the original order.
+ * When the bounds are not tight enough to prove this, the pixel is generated
+ * using `generate_sdf_r8_pixel()`.
+ *
+ * The maximum distance of the `sdf_r8` can not be used to cull curves,
+ * because the sign of a saturated pixel is still determined by the nearest curve.
+ */
+class sdf_r8_generator {
+public:
+    /** The width and height of a cell in pixels, a multiple of 4.
+     */
+    constexpr static std::size_t cell_size = 8;
+
+    /** The amount in squared-pixels that the exact distance of a curve may be above
+     * the smallest upper bound, before a curve is no longer considered.
+     */
+    constexpr static float slack = 0.25f;
+
+    /** The conservative distance between the squared-distance of curves in a cluster.
+     */
+    constexpr static float cluster_distance = 0.02f;
+
+    sdf_r8_generator(std::vector<bezier_curve> const& curves) noexcept : _curves(curves)
+    {
+        _bounds.reserve(curves.size());
+        for (hilet& curve : curves) {
+            _bounds.emplace_back(curve);
+        }
+    }
+
+    void fill(pixmap_span<sdf_r8> image) noexcept
+    {
+        // The error of the calculated distances grows with the magnitude of the coordinates.
+        auto max_coordinate = static_cast<float>(std::max(image.width(), image.height()));
+        for (hilet& bounds : _bounds) {
+            inplace_max(max_coordinate, bounds.max_coordinate);
+        }
+        _margin = 0.001f + max_coordinate * 0.00001f;
+
+        make_bins(image.width(), image.height());
+
+        for (auto y = 0_uz; y < image.height(); y += cell_size) {
+            for (auto x = 0_uz; x < image.width(); x += cell_size) {
+                fill_cell(image, x, y, std::min(x + cell_size, image.width()), std::min(y + cell_size, image.height()));
+            }
+        }
+    }
+
+private:
+    /** A curve reduced to values needed to calculate the distance bounds.
+     */
+    struct curve_bounds {
+        /** The line-segment between the end points of the curve.
+         */
+        float P1x;
+        float P1y;
+        float Dx;
+        float Dy;
+        float inv_sq_length;
+
+        /** The maximum distance between the curve and its line-segment.
+         */
+        float deviation;
+
+        /** Bounding box of the end and control points.
+         */
+        float min_x;
+        float min_y;
+        float max_x;
+        float max_y;
+
+        float max_coordinate;
+
+        /** Points on a quadratic curve, used for the upper bound.
+         */
+        std::array<point2, 5> samples;
+        bezier_curve::Type type;
+
+        curve_bounds(bezier_curve const& curve) noexcept : type(curve.type)
+        {
+            hilet D = curve.P2 - curve.P1;
+            hilet sq_length = squared_hypot(D);
+
+            P1x = curve.P1.x();
+            P1y = curve.P1.y();
+            Dx = D.x();
+            Dy = D.y();
+            inv_sq_length = sq_length == 0.0f ? 0.0f : 1.0f / sq_length;
+
+            min_x = std::min(curve.P1.x(), curve.P2.x());
+            min_y = std::min(curve.P1.y(), curve.P2.y());
+            max_x = std::max(curve.P1.x(), curve.P2.x());
+            max_y = std::max(curve.P1.y(), curve.P2.y());
+
+            if (type == bezier_curve::Type::Quadratic) {
+                // The quadratic curve is at most halfway between the center of the line-segment and the control point.
+                deviation = hypot(curve.C1 - midpoint(curve.P1, curve.P2)) * 0.5f;
+
+                inplace_min(min_x, curve.C1.x());
+                inplace_min(min_y, curve.C1.y());
+                inplace_max(max_x, curve.C1.x());
+                inplace_max(max_y, curve.C1.y());
+
+                for (auto i = 0_uz; i != samples.size(); ++i) {
+                    samples[i] = curve.pointAt(static_cast<float>(i) / static_cast<float>(samples.size() - 1));
+                }
+            } else {
+                deviation = 0.0f;
+            }
+
+            max_coordinate = std::max({std::abs(min_x), std::abs(min_y), std::abs(max_x), std::abs(max_y)});
+        }
+
+        /** Calculate the lower bound of the squared distance between the curve and a rectangle.
+         */
+        [[nodiscard]] float lower_bound(float x0, float y0, float x1, float y1, float margin) const noexcept
+        {
+            hilet dx = std::max({min_x - margin - x1, x0 - max_x - margin, 0.0f});
+            hilet dy = std::max({min_y - margin - y1, y0 - max_y - margin, 0.0f});
+            return dx * dx + dy * dy;
+        }
+
+        /** Calculate the upper bound of the squared distance between the curve and a point.
+         */
+        [[nodiscard]] float upper_bound(float x, float y, float margin) const noexcept
+        {
+            if (type == bezier_curve::Type::Quadratic) {
+                auto r = std::numeric_limits<float>::infinity();
+                for (hilet& sample : samples) {
+                    hilet dx = x - sample.x();
+                    hilet dy = y - sample.y();
+                    inplace_min(r, dx * dx + dy * dy);
+                }
+                return r;
+
+            } else if (inv_sq_length != 0.0f) {
+                hilet ax = x - P1x;
+                hilet ay = y - P1y;
+                hilet t = std::clamp((ax * Dx + ay * Dy) * inv_sq_length, 0.0f, 1.0f);
+                hilet ex = ax - t * Dx;
+                hilet ey = ay - t * Dy;
+                hilet distance = std::sqrt(ex * ex + ey * ey) + margin;
+                return distance * distance;
+
+            } else {
+                // sdf_distance() will not find a distance to a zero length line.
+                return std::numeric_limits<float>::infinity();
+            }
+        }
+
+        /** Calculate the upper bound of the squared distance between the curve and every point in a rectangle.
+         *
+         * The distance to a line-segment or to a point is a convex function, its
+         * maximum over the rectangle is at one of the corners. This does not hold for
+         * the distance to the nearest of the sample points of a quadratic curve; so
+         * the farthest corner is calculated for each sample point separately.
+         */
+        [[nodiscard]] float upper_bound(float x0, float y0, float x1, float y1, float margin) const noexcept
+        {
+            if (type == bezier_curve::Type::Quadratic) {
+                auto r = std::numeric_limits<float>::infinity();
+                for (hilet& sample : samples) {
+                    hilet dx = std::max(std::abs(sample.x() - x0), std::abs(sample.x() - x1));
+                    hilet dy = std::max(std::abs(sample.y() - y0), std::abs(sample.y() - y1));
+                    inplace_min(r, dx * dx + dy * dy);
+                }
+                return r;
+
+            } else {
+                return std::max(
+                    {upper_bound(x0, y0, margin), upper_bound(x1, y0, margin), upper_bound(x0, y1, margin), upper_bound(x1, y1, margin)});
+            }
+        }
+
+        /** Calculate the lower and upper bound of the squared distance between the curve and 4 points.
+         *
+         * @return The lower bound, upper bound.
+         */
+        [[nodiscard]] std::pair<f32x4, f32x4> bounds(f32x4 x, f32x4 y, float margin) const noexcept
+        {
+            // Distance to the line-segment.
+            hilet ax = x - f32x4::broadcast(P1x);
+            hilet ay = y - f32x4::broadcast(P1y);
+            hilet t = clamp(
+                (ax * f32x4::broadcast(Dx) + ay * f32x4::broadcast(Dy)) * f32x4::broadcast(inv_sq_length),
+                f32x4::make_zero(),
+                f32x4::make_one());
+            hilet ex = ax - t * f32x4::broadcast(Dx);
+            hilet ey = ay - t * f32x4::broadcast(Dy);
+            hilet distance = sqrt(ex * ex + ey * ey);
+
+            hilet lower = max(distance - f32x4::broadcast(deviation + margin), f32x4::make_zero());
+
+            if (type == bezier_curve::Type::Quadratic) {
+                auto upper = f32x4::broadcast(std::numeric_limits<float>::infinity());
+                for (hilet& sample : samples) {
+                    hilet sx = x - f32x4::broadcast(sample.x());
+                    hilet sy = y - f32x4::broadcast(sample.y());
+                    upper = min(upper, sx * sx + sy * sy);
+                }
+                return {lower * lower, upper};
+
+            } else if (inv_sq_length != 0.0f) {
+                hilet upper = distance + f32x4::broadcast(margin);
+                return {lower * lower, upper * upper};
+
+            } else {
+                // sdf_distance() will not find a distance to a zero length line.
+                return {lower * lower, f32x4::broadcast(std::numeric_limits<float>::infinity())};
+            }
+        }
+    };
+
+    std::vector<bezier_curve> const& _curves;
+    std::vector<curve_bounds> _bounds;
+
+    /** The margin to add to the bounds for rounding errors.
+     */
+    float _margin = 0.0f;
+
+    /** The number of columns and rows of bins, one bin per cell.
+     */
+    std::size_t _nr_columns = 0;
+    std::size_t _nr_rows = 0;
+
+    /** The offset in `_bin_curves` of the first curve of each bin, and one beyond the last bin.
+     */
+    std::vector<std::size_t> _bin_offsets;
+
+    /** Indices to the curves whose bounding box overlaps a bin, grouped by bin.
+     */
+    std::vector<std::size_t> _bin_curves;
+
+    /** For each curve, the last cell (plus one) in which the curve was visited.
+     */
+    std::vector<std::size_t> _visited;
+
+    /** Indices to the curves that may be nearest to the pixels of a cell.
+     */
+    std::vector<std::size_t> _cell_curves;
+
+    /** The lower bound of each cell curve, for 4 pixels.
+     */
+    std::vector<f32x4> _lower_bounds;
+
+    std::vector<bezier_curve::sdf_distance_result> _distances;
+    std::vector<float> _sq_distances;
+
+    /** Select the curves that may be nearest to the pixels of a cell.
+     *
+     * @return The threshold of the squared distance for the pixels in the cell.
+     */
+    [[nodiscard]] float select_cell_curves(std::size_t x0, std::size_t y0, std::size_t x1, std::size_t y1) noexcept
+    {
+        hilet left = static_cast<float>(x0);
+        hilet bottom = static_cast<float>(y0);
+        hilet right = static_cast<float>(x1 - 1);
+        hilet top = static_cast<float>(y1 - 1);
+
+        hilet center_x = (left + right) * 0.5f;
+        hilet center_y = (bottom + top) * 0.5f;
+        hilet half_diagonal = std::hypot(right - left, top - bottom) * 0.5f;
+
+        hilet column = x0 / cell_size;
+        hilet row = y0 / cell_size;
+        hilet stamp = row * _nr_columns + column + 1;
+
+        // Visit the bins in rings around the cell. The curves that are not in the
+        // rings up to r - 1 are at least r - 1 cells away from every pixel in the cell.
+        auto cell_upper_bound = std::numeric_limits<float>::infinity();
+        _cell_curves.clear();
+        for (auto r = 0_uz; r <= std::max(_nr_columns, _nr_rows); ++r) {
+            hilet ring_distance = static_cast<float>(std::max(r, 1_uz) - 1) * static_cast<float>(cell_size);
+            if (ring_distance * ring_distance >= cell_upper_bound + slack) {
+                break;
+            }
+
+            visit_ring(column, row, r, [&](std::size_t i) {
+                if (std::exchange(_visited[i], stamp) == stamp) {
+                    return;
+                }
+
+                // A pixel is at most half a diagonal away from the center of the cell, so the
+                // upper bound at the center plus the half diagonal is an upper bound for every pixel.
+                hilet upper_distance = std::sqrt(_bounds[i].upper_bound(center_x, center_y, _margin)) + half_diagonal + _margin;
+                inplace_min(cell_upper_bound, upper_distance * upper_distance);
+                inplace_min(cell_upper_bound, _bounds[i].upper_bound(left, bottom, right, top, _margin));
+                _cell_curves.push_back(i);
+            });
+        }
+        hilet cell_threshold = cell_upper_bound + slack;
+
+        // Keep the curves that may be nearest, in their original order.
+        std::erase_if(_cell_curves, [&](std::size_t i) {
+            return not(_bounds[i].lower_bound(left, bottom, right, top, _margin) < cell_threshold);
+        });
+        std::sort(_cell_curves.begin(), _cell_curves.end());
+        return cell_threshold;
+    }
+
+    void fill_cell(pixmap_span<sdf_r8> image, std::size_t x0, std::size_t y0, std::size_t x1, std::size_t y1) noexcept
+    {
+        hilet cell_threshold = select_cell_curves(x0, y0, x1, y1);
+        _lower_bounds.resize(_cell_curves.size());
+
+        for (auto y = y0; y != y1; ++y) {
+            hilet row = image[y];
+            hilet py = f32x4::broadcast(static_cast<float>(y));
+
+            for (auto x = x0; x < x1; x += 4) {
+                hilet fx = static_cast<float>(x);
+                hilet px = f32x4{fx, fx + 1.0f, fx + 2.0f, fx + 3.0f};
+
+                auto upper_bound = f32x4::broadcast(std::numeric_limits<float>::infinity());
+                for (auto i = 0_uz; i != _cell_curves.size(); ++i) {
+                    hilet [lower, upper] = _bounds[_cell_curves[i]].bounds(px, py, _margin);
+                    _lower_bounds[i] = lower;
+                    upper_bound = min(upper_bound, upper);
+                }
+
+                for (auto lane = 0_uz; lane != 4 and x + lane != x1; ++lane) {
+                    hilet threshold = std::min(upper_bound[lane] + slack, cell_threshold);
+                    row[x + lane] = generate_pixel(point2{px[lane], py[lane]}, lane, threshold);
+                }
+            }
+        }
+    }
+
+    /** Bin the curves by their bounding box into a grid of cells covering the image.
+     *
+     * Curves outside the image are binned in the cells at the edge of the image.
+     */
+    void make_bins(std::size_t width, std::size_t height) noexcept
+    {
+        _nr_columns = std::max(1_uz, (width + cell_size - 1) / cell_size);
+        _nr_rows = std::max(1_uz, (height + cell_size - 1) / cell_size);
+
+        hilet to_column = [this](float x) {
+            return static_cast<std::size_t>(std::clamp(x / static_cast<float>(cell_size), 0.0f, static_cast<float>(_nr_columns - 1)));
+        };
+        hilet to_row = [this](float y) {
+            return static_cast<std::size_t>(std::clamp(y / static_cast<float>(cell_size), 0.0f, static_cast<float>(_nr_rows - 1)));
+        };
+
+        // Count the curves of each bin, then place the curves at the offset of each bin.
+        _bin_offsets.assign(_nr_columns * _nr_rows + 1, 0);
+        for (hilet& bounds : _bounds) {
+            for (auto row = to_row(bounds.min_y - _margin); row <= to_row(bounds.max_y + _margin); ++row) {
+                for (auto column = to_column(bounds.min_x - _margin); column <= to_column(bounds.max_x + _margin); ++column) {
+                    ++_bin_offsets[row * _nr_columns + column + 1];
+                }
+            }
+        }
+        for (auto i = 1_uz; i != _bin_offsets.size(); ++i) {
+            _bin_offsets[i] += _bin_offsets[i - 1];
+        }
+
+        _bin_curves.resize(_bin_offsets.back());
+        auto next = std::vector<std::size_t>(_bin_offsets.begin(), _bin_offsets.end() - 1);
+        for (auto i = 0_uz; i != _bounds.size(); ++i) {
+            hilet& bounds = _bounds[i];
+            for (auto row = to_row(bounds.min_y - _margin); row <= to_row(bounds.max_y + _margin); ++row) {
+                for (auto column = to_column(bounds.min_x - _margin); column <= to_column(bounds.max_x + _margin); ++column) {
+                    _bin_curves[next[row * _nr_columns + column]++] = i;
+                }
+            }
+        }
+
+        _visited.assign(_bounds.size(), 0);
+    }
+
+    /** Call a function for each curve in the bins at a distance of @a r cells from a cell.
+     *
+     * A curve that overlaps multiple bins is visited multiple times.
+     */
+    template<typename Func>
+    void visit_ring(std::size_t column, std::size_t row, std::size_t r, Func const& func) const noexcept
+    {
+        hilet visit_bin = [&](std::size_t c, std::size_t r_) {
+            hilet i = r_ * _nr_columns + c;
+            for (auto j = _bin_offsets[i]; j != _bin_offsets[i + 1]; ++j) {
+                func(_bin_curves[j]);
+            }
+        };
+
+        // The ring is clipped to the grid; using signed arithmetic for the cells left and below the cell.
+        hilet c0 = static_cast<ptrdiff_t>(column) - static_cast<ptrdiff_t>(r);
+        hilet c1 = static_cast<ptrdiff_t>(column + r);
+        hilet r0 = static_cast<ptrdiff_t>(row) - static_cast<ptrdiff_t>(r);
+        hilet r1 = static_cast<ptrdiff_t>(row + r);
+        hilet nr_columns = static_cast<ptrdiff_t>(_nr_columns);
+        hilet nr_rows = static_cast<ptrdiff_t>(_nr_rows);
+
+        for (auto c = std::max(c0, ptrdiff_t{0}); c <= std::min(c1, nr_columns - 1); ++c) {
+            if (r0 >= 0) {
+                visit_bin(static_cast<std::size_t>(c), static_cast<std::size_t>(r0));
+            }
+            if (r != 0 and r1 < nr_rows) {
+                visit_bin(static_cast<std::size_t>(c), static_cast<std::size_t>(r1));
+            }
+        }
+        for (auto r_ = std::max(r0 + 1, ptrdiff_t{0}); r_ <= std::min(r1 - 1, nr_rows - 1); ++r_) {
+            if (c0 >= 0) {
+                visit_bin(static_cast<std::size_t>(c0), static_cast<std::size_t>(r_));
+            }
+            if (c1 < nr_columns) {
+                visit_bin(static_cast<std::size_t>(c1), static_cast<std::size_t>(r_));
+            }
+        }
+    }
+
+    /** Generate a pixel from the curves whose lower bound is below the threshold.
+     */
+    [[nodiscard]] float generate_pixel(point2 point, std::size_t lane, float threshold) noexcept
+    {
+        _distances.clear();
+        _sq_distances.clear();
+        for (auto i = 0_uz; i != _cell_curves.size(); ++i) {
+            if (_lower_bounds[i][lane] < threshold) {
+                _distances.push_back(_curves[_cell_curves[i]].sdf_distance(point));
+                _sq_distances.push_back(_distances.back().sq_distance);
+            }
+        }
+
+        if (_distances.empty()) {
+            return generate_sdf_r8_pixel(point, _curves);
+        }
+
+        // Find the largest distance in the cluster of nearest curves, curves
+        // with a smaller lower bound than this may still be selected.
+        std::sort(_sq_distances.begin(), _sq_distances.end());
+        auto cluster_max = _sq_distances.front();
+        for (hilet sq_distance : _sq_distances) {
+            if (sq_distance - cluster_max >= cluster_distance) {
+                break;
+            }
+            cluster_max = sq_distance;
+        }
+
+        if (not(cluster_max + cluster_distance <= threshold)) {
+            [[unlikely]] return generate_sdf_r8_pixel(point, _curves);
+        }
+
+        auto it = _distances.cbegin();
+        auto nearest = *it++;
+        for (; it != _distances.cend(); ++it) {
+            if (*it < nearest) {
+                nearest = *it;
+            }
+        }
+        return nearest.signed_distance();
+    }
+};
+
 } // namespace detail
 
 /** Make a contour of Bezier curves from a list of points.
@@ -687,30 +1372,26 @@ makeContourFromPoints(std::vector<bezier_point>::const_iterator begin, std::vect
 }
 
 /** Fill a linear gray scale image by filling a curve with anti-aliasing.
+ * The coverage of each pixel by the contours is written into the image.
+ *
  * @param image An alpha-channel image to make opaque where pixel is inside the contours
  * @param curves All curves of path, in no particular order.
+ * @param rule The rule to determine which parts of the path are inside.
  */
-constexpr void fill(pixmap_span<uint8_t> image, std::vector<bezier_curve> const& curves) noexcept
+hi_inline void fill(pixmap_span<uint8_t> image, std::vector<bezier_curve> const& curves, fill_rule rule = fill_rule::non_zero) noexcept
 {
-    for (auto y = 0_uz; y < image.height(); y++) {
-        detail::fillRow(image[y], y, curves);
-    }
+    auto rasterizer = detail::coverage_rasterizer{curves, image.width(), image.height()};
+    rasterizer.fill(image, rule);
 }
 
 /** Fill a signed distance field image from the given contour.
  * @param image An signed-distance-field which show distance toward the closest curve
  * @param curves All curves of path, in no particular order.
  */
-constexpr void fill(pixmap_span<sdf_r8> image, std::vector<bezier_curve> const& curves) noexcept
+hi_inline void fill(pixmap_span<sdf_r8> image, std::vector<bezier_curve> const& curves) noexcept
 {
-    for (auto row_nr = 0_uz; row_nr != image.height(); ++row_nr) {
-        hilet row = image[row_nr];
-        hilet y = static_cast<float>(row_nr);
-        for (auto column_nr = 0_uz; column_nr != image.width(); ++column_nr) {
-            hilet x = static_cast<float>(column_nr);
-            row[column_nr] = detail::generate_sdf_r8_pixel(point2(x, y), curves);
-        }
-    }
+    auto generator = detail::sdf_r8_generator{curves};
+    generator.fill(image);
 }
 
 }} // namespace hi::v1
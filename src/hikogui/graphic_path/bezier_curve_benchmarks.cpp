@@ -0,0 +1,128 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "bezier_curve.hpp"
+#include "../image/image.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <numbers>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a glyph-like path of a number of contours, at the size of a glyph in the atlas.
+ */
+[[nodiscard]] std::vector<bezier_curve> make_glyph(std::mt19937& engine, std::size_t nr_contours, std::size_t nr_curves_per_contour)
+{
+    auto center_dist = std::uniform_real_distribution<float>{10.0f, 24.0f};
+    auto radius_dist = std::uniform_real_distribution<float>{2.0f, 8.0f};
+    auto control_dist = std::uniform_real_distribution<float>{-1.5f, 1.5f};
+
+    auto r = std::vector<bezier_curve>{};
+    for (auto contour = 0_uz; contour != nr_contours; ++contour) {
+        hilet center = point2{center_dist(engine), center_dist(engine)};
+        hilet radius = radius_dist(engine);
+
+        auto points = std::vector<point2>{};
+        for (auto i = 0_uz; i != nr_curves_per_contour; ++i) {
+            hilet angle = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(nr_curves_per_contour);
+            hilet distance = radius * (0.7f + 0.3f * static_cast<float>(engine() % 2));
+            points.push_back(center + vector2{std::cos(angle) * distance, std::sin(angle) * distance});
+        }
+
+        for (auto i = 0_uz; i != nr_curves_per_contour; ++i) {
+            hilet P1 = points[i];
+            hilet P2 = points[(i + 1) % nr_curves_per_contour];
+            if (engine() % 2 == 0) {
+                r.emplace_back(P1, P2);
+            } else {
+                r.emplace_back(P1, midpoint(P1, P2) + vector2{control_dist(engine), control_dist(engine)}, P2);
+            }
+        }
+    }
+    return r;
+}
+
+void benchmark_sdf(std::string_view name, std::size_t nr_contours, std::size_t nr_curves_per_contour)
+{
+    constexpr auto nr_glyphs = 16_uz;
+
+    auto engine = std::mt19937{42};
+    auto glyphs = std::vector<std::vector<bezier_curve>>{};
+    for (auto i = 0_uz; i != nr_glyphs; ++i) {
+        glyphs.push_back(make_glyph(engine, nr_contours, nr_curves_per_contour));
+    }
+
+    // The size of a glyph in the SDF atlas: one 'em' of 28 pixels with a border.
+    auto image = pixmap<sdf_r8>{34, 34};
+
+    hilet reference_rate = benchmark_rate([&] {
+        for (hilet& curves : glyphs) {
+            for (auto y = 0_uz; y != image.height(); ++y) {
+                for (auto x = 0_uz; x != image.width(); ++x) {
+                    image[y][x] = detail::generate_sdf_r8_pixel(point2{static_cast<float>(x), static_cast<float>(y)}, curves);
+                }
+            }
+        }
+    });
+
+    hilet rate = benchmark_rate([&] {
+        for (hilet& curves : glyphs) {
+            fill(image, curves);
+        }
+    });
+
+    benchmark_report(std::format("{} reference", name), reference_rate * nr_glyphs, "glyphs/s");
+    benchmark_report(std::format("{} fill", name), rate * nr_glyphs, "glyphs/s");
+}
+
+void benchmark_fill(std::string_view name, std::size_t size)
+{
+    constexpr auto nr_glyphs = 16_uz;
+
+    hilet scale = scale2{static_cast<float>(size) / 34.0f};
+
+    auto engine = std::mt19937{42};
+    auto glyphs = std::vector<std::vector<bezier_curve>>{};
+    for (auto i = 0_uz; i != nr_glyphs; ++i) {
+        auto curves = make_glyph(engine, 2, 20);
+        for (auto& curve : curves) {
+            curve = scale * curve;
+        }
+        glyphs.push_back(std::move(curves));
+    }
+
+    auto image = pixmap<uint8_t>{size, size};
+
+    hilet rate = benchmark_rate([&] {
+        for (hilet& curves : glyphs) {
+            fill(image, curves);
+        }
+    });
+
+    benchmark_report(std::format("{} fill", name), rate * nr_glyphs, "glyphs/s");
+    benchmark_report(std::format("{} fill", name), rate * nr_glyphs * size * size / 1'000'000.0, "Mpixels/s");
+}
+
+} // namespace
+
+TEST(bezier_curve_benchmarks, fill_sdf_r8)
+{
+    benchmark_sdf("latin glyph, 40 curves", 2, 20);
+    benchmark_sdf("CJK glyph, 200 curves", 10, 20);
+    benchmark_sdf("icon, 400 curves", 20, 20);
+}
+
+TEST(bezier_curve_benchmarks, fill)
+{
+    benchmark_fill("glyph 34x34", 34);
+    benchmark_fill("glyph 256x256", 256);
+    benchmark_fill("path 1024x1024", 1024);
+}
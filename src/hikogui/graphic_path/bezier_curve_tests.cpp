@@ -7,6 +7,9 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <random>
+#include <numbers>
+#include <vector>
 
 using namespace std;
 using namespace hi;
@@ -69,6 +72,67 @@ testing::AssertionResult ResultsNearPredFormat(
 }
 }
 
+namespace bezier_curve_tests {
+
+/** Make a closed star shaped contour of linear and quadratic curves, similar to a glyph.
+ */
+[[nodiscard]] std::vector<bezier_curve>
+make_contour(std::mt19937& engine, point2 center, float radius, std::size_t nr_curves, bool clockwise)
+{
+    auto radius_dist = std::uniform_real_distribution<float>{radius * 0.5f, radius};
+    auto control_dist = std::uniform_real_distribution<float>{-radius * 0.3f, radius * 0.3f};
+
+    auto points = std::vector<point2>{};
+    for (auto i = 0_uz; i != nr_curves; ++i) {
+        auto angle = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(nr_curves);
+        if (clockwise) {
+            angle = -angle;
+        }
+        hilet r = radius_dist(engine);
+        points.push_back(center + vector2{std::cos(angle) * r, std::sin(angle) * r});
+    }
+
+    auto r = std::vector<bezier_curve>{};
+    for (auto i = 0_uz; i != nr_curves; ++i) {
+        hilet P1 = points[i];
+        hilet P2 = points[(i + 1) % nr_curves];
+        if (engine() % 2 == 0) {
+            r.emplace_back(P1, P2);
+        } else {
+            hilet C = midpoint(P1, P2) + vector2{control_dist(engine), control_dist(engine)};
+            r.emplace_back(P1, C, P2);
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<bezier_curve> make_rectangle(float x0, float y0, float x1, float y1)
+{
+    return {
+        bezier_curve{point2{x0, y0}, point2{x0, y1}},
+        bezier_curve{point2{x0, y1}, point2{x1, y1}},
+        bezier_curve{point2{x1, y1}, point2{x1, y0}},
+        bezier_curve{point2{x1, y0}, point2{x0, y0}}};
+}
+
+/** Calculate the winding number of the curves around a point.
+ */
+[[nodiscard]] int winding_number(std::vector<bezier_curve> const& curves, point2 point)
+{
+    auto angle = 0.0f;
+    for (hilet& curve : curves) {
+        auto a = curve.P1 - point;
+        for (auto i = 1; i <= 16; ++i) {
+            hilet b = curve.pointAt(static_cast<float>(i) / 16.0f) - point;
+            angle += std::atan2(cross(a, b), dot(a, b));
+            a = b;
+        }
+    }
+    return static_cast<int>(std::round(angle / (2.0f * std::numbers::pi_v<float>)));
+}
+
+} // namespace bezier_curve_tests
+
 #define ASSERT_RESULTS_NEAR(val1, val2, abs_error) ASSERT_PRED_FORMAT3(bezier_curve_tests::ResultsNearPredFormat, val1, val2, abs_error)
 
 #define ASSERT_RESULTS(val1, val2) ASSERT_RESULTS_NEAR(val1, val2, 0.000001)
@@ -80,3 +144,166 @@ TEST(bezier_cruve, solve_x_by_y)
     ASSERT_RESULTS(bezier_curve(point2(2.0f, 2.0f), point2(1.5f, 2.0f), point2(1.0f, 2.0f)).solveXByY(1.5f), make_lean_vector<double>());
     ASSERT_RESULTS(bezier_curve(point2(1.0f, 2.0f), point2(1.0f, 1.5f), point2(1.0f, 1.0f)).solveXByY(1.5f), make_lean_vector<double>(1.0f));
 }
+
+TEST(bezier_curve, fill_sdf_r8)
+{
+    auto engine = std::mt19937{42};
+
+    for (auto i = 0; i != 50; ++i) {
+        // Sizes that are not a multiple of the cell size.
+        hilet width = 20_uz + engine() % 30;
+        hilet height = 20_uz + engine() % 30;
+        hilet center = point2{static_cast<float>(width) * 0.5f, static_cast<float>(height) * 0.5f};
+        hilet radius = static_cast<float>(std::min(width, height)) * 0.5f;
+
+        // An outer contour with a hole.
+        auto curves = bezier_curve_tests::make_contour(engine, center, radius, 5 + engine() % 60, false);
+        hilet inner = bezier_curve_tests::make_contour(engine, center, radius * 0.3f, 3 + engine() % 20, true);
+        curves.insert(curves.end(), inner.begin(), inner.end());
+
+        auto image = pixmap<sdf_r8>{width, height};
+        fill(image, curves);
+
+        for (auto y = 0_uz; y != height; ++y) {
+            for (auto x = 0_uz; x != width; ++x) {
+                hilet expected = sdf_r8{detail::generate_sdf_r8_pixel(point2{static_cast<float>(x), static_cast<float>(y)}, curves)};
+                ASSERT_EQ(image[y][x].value, expected.value) << "image " << i << " pixel " << x << ", " << y;
+            }
+        }
+    }
+}
+
+TEST(bezier_curve, fill_sdf_r8_sparse)
+{
+    auto engine = std::mt19937{7};
+    auto coordinate_dist = std::uniform_real_distribution<float>{-40.0f, 140.0f};
+    auto control_dist = std::uniform_real_distribution<float>{-60.0f, 60.0f};
+
+    for (auto i = 0; i != 20; ++i) {
+        // A few strongly bent quadratic curves, far apart and partly outside the image.
+        auto curves = std::vector<bezier_curve>{};
+        for (auto j = 0; j != 1 + i % 4; ++j) {
+            hilet P1 = point2{coordinate_dist(engine), coordinate_dist(engine)};
+            hilet P2 = point2{coordinate_dist(engine), coordinate_dist(engine)};
+            hilet C = midpoint(P1, P2) + vector2{control_dist(engine), control_dist(engine)};
+            curves.emplace_back(P1, C, P2);
+        }
+
+        auto image = pixmap<sdf_r8>{100, 76};
+        fill(image, curves);
+
+        for (auto y = 0_uz; y != image.height(); ++y) {
+            for (auto x = 0_uz; x != image.width(); ++x) {
+                hilet expected = sdf_r8{detail::generate_sdf_r8_pixel(point2{static_cast<float>(x), static_cast<float>(y)}, curves)};
+                ASSERT_EQ(image[y][x].value, expected.value) << "image " << i << " pixel " << x << ", " << y;
+            }
+        }
+    }
+}
+
+TEST(bezier_curve, fill_sdf_r8_empty)
+{
+    auto image = pixmap<sdf_r8>{10, 10};
+    fill(image, std::vector<bezier_curve>{});
+
+    hilet expected = sdf_r8{-std::numeric_limits<float>::max()};
+    for (hilet pixel : image) {
+        ASSERT_EQ(pixel.value, expected.value);
+    }
+}
+
+TEST(bezier_curve, fill_rectangle)
+{
+    hilet curves = bezier_curve_tests::make_rectangle(2.25f, 1.5f, 7.75f, 6.25f);
+
+    auto image = pixmap<uint8_t>{10, 8};
+    fill(image, curves);
+
+    for (auto y = 0_uz; y != image.height(); ++y) {
+        for (auto x = 0_uz; x != image.width(); ++x) {
+            hilet fx = static_cast<float>(x);
+            hilet fy = static_cast<float>(y);
+            hilet coverage_x = std::clamp(std::min(fx + 1.0f, 7.75f) - std::max(fx, 2.25f), 0.0f, 1.0f);
+            hilet coverage_y = std::clamp(std::min(fy + 1.0f, 6.25f) - std::max(fy, 1.5f), 0.0f, 1.0f);
+            hilet expected = static_cast<int>(coverage_x * coverage_y * 255.0f + 0.5f);
+            ASSERT_NEAR(image[y][x], expected, 1) << "pixel " << x << ", " << y;
+        }
+    }
+}
+
+TEST(bezier_curve, fill_outside_image)
+{
+    // The rectangle extends beyond all sides of the image.
+    hilet curves = bezier_curve_tests::make_rectangle(-5.5f, -3.0f, 20.0f, 30.0f);
+
+    auto image = pixmap<uint8_t>{10, 8};
+    fill(image, curves);
+
+    for (hilet pixel : image) {
+        ASSERT_EQ(pixel, 255);
+    }
+}
+
+TEST(bezier_curve, fill_rule)
+{
+    // Two overlapping rectangles wound in the same direction.
+    auto curves = bezier_curve_tests::make_rectangle(1.0f, 1.0f, 6.0f, 6.0f);
+    hilet second = bezier_curve_tests::make_rectangle(3.0f, 3.0f, 8.0f, 8.0f);
+    curves.insert(curves.end(), second.begin(), second.end());
+
+    auto non_zero = pixmap<uint8_t>{10, 10};
+    fill(non_zero, curves, fill_rule::non_zero);
+    auto even_odd = pixmap<uint8_t>{10, 10};
+    fill(even_odd, curves, fill_rule::even_odd);
+
+    // Only in one rectangle.
+    ASSERT_EQ(non_zero[1][1], 255);
+    ASSERT_EQ(even_odd[1][1], 255);
+    ASSERT_EQ(non_zero[7][7], 255);
+    ASSERT_EQ(even_odd[7][7], 255);
+
+    // Inside both rectangles.
+    ASSERT_EQ(non_zero[4][4], 255);
+    ASSERT_EQ(even_odd[4][4], 0);
+
+    // Outside.
+    ASSERT_EQ(non_zero[0][0], 0);
+    ASSERT_EQ(even_odd[8][1], 0);
+}
+
+TEST(bezier_curve, fill_coverage)
+{
+    auto engine = std::mt19937{42};
+
+    for (auto i = 0; i != 10; ++i) {
+        hilet width = 20_uz + engine() % 30;
+        hilet height = 20_uz + engine() % 30;
+        hilet center = point2{static_cast<float>(width) * 0.5f, static_cast<float>(height) * 0.5f};
+        hilet radius = static_cast<float>(std::min(width, height)) * 0.5f;
+
+        // The random control points may cause the contours to self-intersect.
+        auto curves = bezier_curve_tests::make_contour(engine, center, radius, 5 + engine() % 60, false);
+        hilet inner = bezier_curve_tests::make_contour(engine, center, radius * 0.3f, 3 + engine() % 20, true);
+        curves.insert(curves.end(), inner.begin(), inner.end());
+
+        auto non_zero = pixmap<uint8_t>{width, height};
+        fill(non_zero, curves, fill_rule::non_zero);
+        auto even_odd = pixmap<uint8_t>{width, height};
+        fill(even_odd, curves, fill_rule::even_odd);
+
+        for (auto y = 0_uz; y != height; ++y) {
+            for (auto x = 0_uz; x != width; ++x) {
+                hilet pixel_center = point2{static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f};
+
+                // Only pixels that are completely inside or outside have an exact coverage.
+                if (std::abs(detail::generate_sdf_r8_pixel(pixel_center, curves)) < 0.75f) {
+                    continue;
+                }
+
+                hilet winding = bezier_curve_tests::winding_number(curves, pixel_center);
+                ASSERT_EQ(non_zero[y][x], winding != 0 ? 255 : 0) << "image " << i << " pixel " << x << ", " << y;
+                ASSERT_EQ(even_odd[y][x], winding % 2 != 0 ? 255 : 0) << "image " << i << " pixel " << x << ", " << y;
+            }
+        }
+    }
+}
@@ -661,6 +661,16 @@ hi_export struct graphic_path {
     }
 };
 
+/** Fill a linear gray scale image from the given path with anti-aliasing.
+ * @param dst An alpha-channel image to make opaque where pixel is inside the path
+ * @param path A path.
+ * @param rule The rule to determine which parts of the path are inside.
+ */
+hi_export hi_inline void fill(pixmap_span<uint8_t> dst, graphic_path const& path, fill_rule rule = fill_rule::non_zero) noexcept
+{
+    fill(dst, path.getBeziers(), rule);
+}
+
 /** Fill a signed distance field image from the given path.
  * @param dst An signed-distance-field which show distance toward the closest curve
  * @param path A path.
@@ -12,6 +12,7 @@
 #include "../macros.hpp"
 #include <typeinfo>
 #include <filesystem>
+#include <utility>
 
 hi_export_module(hikogui.settings.preferences);
 
@@ -22,7 +23,10 @@ namespace detail {
 
 class preference_item_base {
 public:
-    preference_item_base(preferences& parent, std::string_view path) noexcept : _parent(parent), _path(path) {}
+    preference_item_base(preferences& parent, std::string_view path) noexcept :
+        _parent(parent), _path(path), _compiled_path(_path)
+    {
+    }
 
     preference_item_base(preference_item_base const&) = delete;
     preference_item_base(preference_item_base&&) = delete;
@@ -42,6 +46,10 @@ protected:
     preferences& _parent;
     jsonpath _path;
 
+    /** The path compiled once, for reading the value when the preferences are (re)loaded.
+     */
+    compiled_jsonpath _compiled_path;
+
     /** Encode the value into a datum.
      *
      * @return A datum representing the value, or undefined if same as the initial value.
@@ -321,10 +329,11 @@ private:
 
     /** Read a value from the data.
      */
-    datum read(jsonpath const& path) noexcept
+    datum read(compiled_jsonpath const& path) noexcept
     {
         hilet lock = std::scoped_lock(mutex);
-        if (auto const *const r = _data.find_one(path)) {
+        // Search through a const reference, so that the shared data is not copied for modification.
+        if (auto const *const r = path.find_one(std::as_const(_data))) {
             return *r;
         } else {
             return datum{std::monostate{}};
@@ -348,7 +357,7 @@ private:
 
 hi_inline void detail::preference_item_base::load() noexcept
 {
-    hilet value = this->_parent.read(_path);
+    hilet value = this->_parent.read(_compiled_path);
     if (value.is_undefined()) {
         this->reset();
     } else {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "log.hpp"
+#include "latency_histogram.hpp"
 #include "../utility/utility.hpp"
 #include "../concurrency/concurrency.hpp"
 #include "../concurrency/unfair_mutex.hpp" // XXX #616
@@ -27,6 +28,59 @@ hi_export_module(hikogui.telemetry : counters);
 
 
 hi_export namespace hi::inline v1 {
+
+/** The statistics of a counter since the previous snapshot.
+ */
+hi_export struct counter_snapshot {
+    /** The value of the counter.
+     */
+    uint64_t total_count = 0;
+
+    /** The number of times the counter was incremented since the previous snapshot.
+     */
+    uint64_t delta_count = 0;
+
+    /** The time since the previous snapshot.
+     */
+    std::chrono::nanoseconds interval = {};
+
+    /** The durations that were added since the previous snapshot, in counts of `time_stamp_count`.
+     */
+    latency_histogram_snapshot durations;
+
+    /** The number of increments per second since the previous snapshot.
+     */
+    [[nodiscard]] double rate() const noexcept
+    {
+        hilet seconds = std::chrono::duration<double>{interval}.count();
+        return seconds > 0.0 ? static_cast<double>(delta_count) / seconds : 0.0;
+    }
+
+    /** Get a percentile of the durations since the previous snapshot.
+     *
+     * @param fraction The percentile as a fraction between 0.0 and 1.0, i.e. 0.99 for p99.
+     */
+    [[nodiscard]] std::chrono::nanoseconds percentile(double fraction) const noexcept
+    {
+        return time_stamp_count::duration_from_count(durations.percentile(fraction));
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds duration_min() const noexcept
+    {
+        return time_stamp_count::duration_from_count(durations.min());
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds duration_max() const noexcept
+    {
+        return time_stamp_count::duration_from_count(durations.max());
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds duration_mean() const noexcept
+    {
+        return time_stamp_count::duration_from_count(durations.mean());
+    }
+};
+
 namespace detail {
 
 class counter {
@@ -55,7 +109,7 @@ public:
     counter& operator=(counter const&) = delete;
     counter& operator=(counter&&) = delete;
 
-    constexpr counter() noexcept {}
+    counter() noexcept = default;
 
     operator uint64_t() const noexcept
     {
@@ -75,45 +129,61 @@ public:
     static void log_header() noexcept
     {
         hi_log_statistics("");
-        hi_log_statistics("{:>18} {:>9} {:>10} {:>10} {:>10}", "total", "delta", "min", "max", "mean");
-        hi_log_statistics("------------------ --------- ---------- ---------- ----------");
+        hi_log_statistics(
+            "{:>18} {:>9} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}", "total", "delta", "min", "p50", "p99", "p999", "max", "mean");
+        hi_log_statistics("------------------ --------- ---------- ---------- ---------- ---------- ---------- ----------");
     }
 
     /** Log the counter.
-     */
-    /** Log the counter.
+     *
+     * This takes a snapshot of the counter, see `snapshot()`.
      */
     void log(std::string const& tag) noexcept
     {
-        hilet total_count = _total_count.load(std::memory_order::relaxed);
-        hilet prev_count = _prev_count.exchange(_total_count, std::memory_order::relaxed);
-        hilet delta_count = total_count - prev_count;
-        if (delta_count != 0) {
-            hilet duration_max = time_stamp_count::duration_from_count(_duration_max.exchange(0, std::memory_order::relaxed));
-            hilet duration_min = time_stamp_count::duration_from_count(
-                _duration_min.exchange(std::numeric_limits<uint64_t>::max(), std::memory_order::relaxed));
-
-            hilet duration_avg = _duration_avg.exchange(0, std::memory_order::relaxed);
-            if (duration_avg == 0) {
-                hi_log_statistics("{:>18} {:>+9} {:10} {:10} {:10} {}", total_count, delta_count, "", "", "", tag);
+        hilet s = snapshot();
+        if (s.delta_count != 0) {
+            if (s.durations.count() == 0) {
+                hi_log_statistics("{:>18} {:>+9} {:10} {:10} {:10} {:10} {:10} {:10} {}", s.total_count, s.delta_count, "", "", "", "", "", "", tag);
 
             } else {
-                hilet avg_count = duration_avg & 0xffff;
-                hilet avg_sum = duration_avg >> 16;
-                hilet average = time_stamp_count::duration_from_count(avg_sum / avg_count);
-
                 hi_log_statistics(
-                    "{:18d} {:+9d} {:>10} {:>10} {:>10} {}",
-                    total_count,
-                    delta_count,
-                    format_engineering(duration_min),
-                    format_engineering(duration_max),
-                    format_engineering(average),
+                    "{:18d} {:+9d} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10} {}",
+                    s.total_count,
+                    s.delta_count,
+                    format_engineering(s.duration_min()),
+                    format_engineering(s.percentile(0.5)),
+                    format_engineering(s.percentile(0.99)),
+                    format_engineering(s.percentile(0.999)),
+                    format_engineering(s.duration_max()),
+                    format_engineering(s.duration_mean()),
                     tag);
             }
         }
     }
 
+    /** Take a snapshot of the counter.
+     *
+     * The durations of all threads are merged, and the values since
+     * the previous snapshot are returned.
+     *
+     * @note The statistics thread takes a snapshot each minute when logging the counters.
+     */
+    [[nodiscard]] counter_snapshot snapshot() noexcept
+    {
+        auto r = counter_snapshot{};
+
+        hilet lock = std::scoped_lock(_snapshot_mutex);
+        hilet now = std::chrono::steady_clock::now();
+        auto durations = _durations.read();
+
+        r.total_count = _total_count.load(std::memory_order::relaxed);
+        r.delta_count = r.total_count - std::exchange(_prev_count, r.total_count);
+        r.interval = std::chrono::duration_cast<std::chrono::nanoseconds>(now - std::exchange(_prev_time_point, now));
+        r.durations = durations - _prev_durations;
+        _prev_durations = std::move(durations);
+        return r;
+    }
+
     /** Rest the counter.
      * 
      * @return Old value of the 
@@ -146,18 +216,21 @@ public:
     }
 
     /** Add a duration.
+     *
+     * @param duration The duration in counts of `time_stamp_count`.
+     * @param shard The histogram shard of the current thread, see `acquire_shard()`.
      */
-    void add_duration(uint64_t duration) noexcept
+    void add_duration(uint64_t duration, latency_histogram::shard& shard) noexcept
     {
         _total_count.fetch_add(1, std::memory_order::relaxed);
-        fetch_max(_duration_max, duration, std::memory_order::relaxed);
-        fetch_min(_duration_min, duration, std::memory_order::relaxed);
+        shard.add(duration);
+    }
 
-        // Combine duration with count in a single atomic.
-        hi_axiom(duration <= (std::numeric_limits<uint64_t>::max() >> 10));
-        duration <<= 16;
-        ++duration;
-        _duration_avg.fetch_add(duration, std::memory_order::relaxed);
+    /** Get a histogram shard for the current thread.
+     */
+    [[nodiscard]] latency_histogram::shard& acquire_shard() noexcept
+    {
+        return _durations.acquire_shard();
     }
 
 protected:
@@ -170,16 +243,17 @@ protected:
     constinit static hi_inline atomic_unique_ptr<map_type> _map;
 
     std::atomic<uint64_t> _total_count = 0;
-    std::atomic<uint64_t> _prev_count = 0;
-    std::atomic<uint64_t> _duration_max = 0;
-    std::atomic<uint64_t> _duration_min = std::numeric_limits<uint64_t>::max();
 
-    /** Average duration.
-     *
-     * - [9:0] Count.
-     * - [63:10] Sum.
+    /** Histogram of durations, in counts of `time_stamp_count`.
+     */
+    latency_histogram _durations;
+
+    /** Mutex for taking snapshots.
      */
-    std::atomic<uint64_t> _duration_avg = 0;
+    unfair_mutex_impl<false> _snapshot_mutex;
+    uint64_t _prev_count = 0;
+    std::chrono::steady_clock::time_point _prev_time_point = {};
+    latency_histogram_snapshot _prev_durations;
 };
 
 template<fixed_string Tag>
@@ -192,6 +266,37 @@ public:
         hilet lock = std::scoped_lock(_mutex);
         _map.get_or_make()[std::string{Tag}] = this;
     }
+
+    /** Add a duration.
+     *
+     * The duration is added to the histogram shard of the current thread.
+     *
+     * @param duration The duration in counts of `time_stamp_count`.
+     */
+    hi_force_inline void add_duration(uint64_t duration) noexcept
+    {
+        auto *shard = _thread_shard.shard;
+        if (shard == nullptr) [[unlikely]] {
+            shard = _thread_shard.shard = &acquire_shard();
+        }
+        counter::add_duration(duration, *shard);
+    }
+
+private:
+    /** Releases the histogram shard when the thread exits.
+     */
+    struct thread_shard_type {
+        latency_histogram::shard *shard = nullptr;
+
+        ~thread_shard_type()
+        {
+            if (shard) {
+                shard->release();
+            }
+        }
+    };
+
+    inline static thread_local thread_shard_type _thread_shard;
 };
 
 } // namespace detail
@@ -41,3 +41,26 @@ TEST(counters, search_and_read)
     ASSERT_EQ(*get_global_counter_if("foo_b"), 1);
     ASSERT_EQ(*get_global_counter_if("bar_b"), 2);
 }
+
+TEST(counters, snapshot)
+{
+    [[maybe_unused]] hilet s0 = global_counter<"foo_c">.snapshot();
+
+    global_counter<"foo_c">.add_duration(100);
+    global_counter<"foo_c">.add_duration(200);
+    ++global_counter<"foo_c">;
+
+    hilet s1 = global_counter<"foo_c">.snapshot();
+    ASSERT_EQ(s1.total_count, 3);
+    ASSERT_EQ(s1.delta_count, 3);
+    ASSERT_EQ(s1.durations.count(), 2);
+    ASSERT_EQ(s1.durations.sum(), 300);
+
+    global_counter<"foo_c">.add_duration(300);
+
+    hilet s2 = global_counter<"foo_c">.snapshot();
+    ASSERT_EQ(s2.total_count, 4);
+    ASSERT_EQ(s2.delta_count, 1);
+    ASSERT_EQ(s2.durations.count(), 1);
+    ASSERT_EQ(s2.durations.sum(), 300);
+}
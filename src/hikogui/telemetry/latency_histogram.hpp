@@ -0,0 +1,309 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file latency_histogram.hpp
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../macros.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+hi_export_module(hikogui.telemetry : latency_histogram);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+/** The number of bits used for the linear sub-buckets in each power-of-two range.
+ *
+ * With 4 bits each power-of-two range is divided in 16 buckets, which
+ * gives a relative error of at most 6.25%.
+ */
+constexpr std::size_t latency_histogram_sub_bucket_bits = 4;
+constexpr std::size_t latency_histogram_sub_bucket_count = 1_uz << latency_histogram_sub_bucket_bits;
+
+/** Values below this are each stored in their own bucket.
+ */
+constexpr std::size_t latency_histogram_linear_count = latency_histogram_sub_bucket_count * 2;
+
+constexpr std::size_t latency_histogram_num_buckets =
+    latency_histogram_linear_count + (64 - latency_histogram_sub_bucket_bits - 1) * latency_histogram_sub_bucket_count;
+
+/** Get the index of the bucket for a value.
+ */
+[[nodiscard]] constexpr std::size_t latency_histogram_bucket(uint64_t value) noexcept
+{
+    if (value < latency_histogram_linear_count) {
+        return narrow_cast<std::size_t>(value);
+    }
+
+    hilet exponent = narrow_cast<std::size_t>(std::bit_width(value) - 1);
+    hilet shift = exponent - latency_histogram_sub_bucket_bits;
+    hilet mantissa = narrow_cast<std::size_t>(value >> shift) - latency_histogram_sub_bucket_count;
+    return latency_histogram_linear_count + (exponent - latency_histogram_sub_bucket_bits - 1) * latency_histogram_sub_bucket_count +
+        mantissa;
+}
+
+/** Get the lowest value that is stored in a bucket.
+ */
+[[nodiscard]] constexpr uint64_t latency_histogram_bucket_lowest(std::size_t index) noexcept
+{
+    hi_axiom(index < latency_histogram_num_buckets);
+
+    if (index < latency_histogram_linear_count) {
+        return index;
+    }
+
+    hilet i = index - latency_histogram_linear_count;
+    hilet shift = i / latency_histogram_sub_bucket_count + 1;
+    hilet mantissa = uint64_t{latency_histogram_sub_bucket_count + i % latency_histogram_sub_bucket_count};
+    return mantissa << shift;
+}
+
+/** Get the highest value that is stored in a bucket.
+ */
+[[nodiscard]] constexpr uint64_t latency_histogram_bucket_highest(std::size_t index) noexcept
+{
+    hi_axiom(index < latency_histogram_num_buckets);
+
+    if (index < latency_histogram_linear_count) {
+        return index;
+    }
+
+    hilet shift = (index - latency_histogram_linear_count) / latency_histogram_sub_bucket_count + 1;
+    return latency_histogram_bucket_lowest(index) + ((uint64_t{1} << shift) - 1);
+}
+
+} // namespace detail
+
+/** A merged copy of a latency histogram.
+ *
+ * Values are in the same unit as they were added to the histogram.
+ * A default constructed snapshot is empty and does not allocate.
+ */
+hi_export class latency_histogram_snapshot {
+public:
+    constexpr static std::size_t num_buckets = detail::latency_histogram_num_buckets;
+
+    latency_histogram_snapshot() noexcept = default;
+
+    /** The number of values.
+     */
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+        return _count;
+    }
+
+    /** The sum of all values.
+     */
+    [[nodiscard]] uint64_t sum() const noexcept
+    {
+        return _sum;
+    }
+
+    /** The mean of all values.
+     */
+    [[nodiscard]] uint64_t mean() const noexcept
+    {
+        return _count == 0 ? 0 : _sum / _count;
+    }
+
+    /** The lowest value, within the resolution of the histogram.
+     */
+    [[nodiscard]] uint64_t min() const noexcept
+    {
+        for (auto i = 0_uz; i != _buckets.size(); ++i) {
+            if (_buckets[i] != 0) {
+                return detail::latency_histogram_bucket_lowest(i);
+            }
+        }
+        return 0;
+    }
+
+    /** The highest value, within the resolution of the histogram.
+     */
+    [[nodiscard]] uint64_t max() const noexcept
+    {
+        for (auto i = _buckets.size(); i != 0; --i) {
+            if (_buckets[i - 1] != 0) {
+                return detail::latency_histogram_bucket_highest(i - 1);
+            }
+        }
+        return 0;
+    }
+
+    /** Get the value at a percentile.
+     *
+     * @param fraction The percentile as a fraction between 0.0 and 1.0, i.e. 0.99 for p99.
+     * @return The highest value of the bucket which contains the percentile, or zero if there are no values.
+     */
+    [[nodiscard]] uint64_t percentile(double fraction) const noexcept
+    {
+        hi_axiom(fraction >= 0.0 and fraction <= 1.0);
+
+        if (_count == 0) {
+            return 0;
+        }
+
+        hilet rank = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(_count))));
+        auto total = uint64_t{0};
+        for (auto i = 0_uz; i != _buckets.size(); ++i) {
+            total += _buckets[i];
+            if (total >= rank) {
+                return detail::latency_histogram_bucket_highest(i);
+            }
+        }
+        hi_no_default();
+    }
+
+    /** The number of values in a bucket.
+     */
+    [[nodiscard]] uint64_t bucket(std::size_t index) const noexcept
+    {
+        hi_axiom(index < num_buckets);
+        return _buckets.empty() ? 0 : _buckets[index];
+    }
+
+    /** Get the values that were added between two snapshots.
+     *
+     * @param lhs The later snapshot.
+     * @param rhs The earlier snapshot.
+     */
+    [[nodiscard]] friend latency_histogram_snapshot
+    operator-(latency_histogram_snapshot const& lhs, latency_histogram_snapshot const& rhs) noexcept
+    {
+        auto r = lhs;
+        if (not rhs._buckets.empty()) {
+            hi_axiom(r._buckets.size() == rhs._buckets.size());
+            for (auto i = 0_uz; i != num_buckets; ++i) {
+                r._buckets[i] -= rhs._buckets[i];
+            }
+        }
+        r._count = lhs._count - rhs._count;
+        r._sum = lhs._sum - rhs._sum;
+        return r;
+    }
+
+private:
+    std::vector<uint64_t> _buckets;
+    uint64_t _count = 0;
+    uint64_t _sum = 0;
+
+    friend class latency_histogram;
+};
+
+/** A log-linear histogram of latencies, in the style of a HDR histogram.
+ *
+ * Each thread adds values to its own shard, without any contention with
+ * other threads. The shards are merged when the histogram is read.
+ */
+hi_export class latency_histogram {
+public:
+    constexpr static std::size_t num_buckets = detail::latency_histogram_num_buckets;
+
+    /** The part of a histogram that is written by a single thread.
+     */
+    class shard {
+    public:
+        shard(shard const&) = delete;
+        shard(shard&&) = delete;
+        shard& operator=(shard const&) = delete;
+        shard& operator=(shard&&) = delete;
+        shard() noexcept = default;
+
+        /** Add a value to the histogram.
+         *
+         * @note Must only be called by the thread that owns this shard.
+         */
+        hi_force_inline void add(uint64_t value) noexcept
+        {
+            // Only this thread writes to the shard, so a read-modify-write
+            // without a lock-prefix is sufficient.
+            auto& bucket = _buckets[detail::latency_histogram_bucket(value)];
+            bucket.store(bucket.load(std::memory_order::relaxed) + 1, std::memory_order::relaxed);
+            _sum.store(_sum.load(std::memory_order::relaxed) + value, std::memory_order::relaxed);
+        }
+
+        /** Release the shard when the thread that owns it exits.
+         *
+         * The values in the shard remain part of the histogram, and the
+         * shard may be reused by another thread.
+         */
+        void release() noexcept
+        {
+            _owned.store(false, std::memory_order::release);
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, num_buckets> _buckets = {};
+        std::atomic<uint64_t> _sum = 0;
+        std::atomic<bool> _owned = true;
+
+        friend class latency_histogram;
+    };
+
+    constexpr latency_histogram() noexcept = default;
+    latency_histogram(latency_histogram const&) = delete;
+    latency_histogram(latency_histogram&&) = delete;
+    latency_histogram& operator=(latency_histogram const&) = delete;
+    latency_histogram& operator=(latency_histogram&&) = delete;
+
+    /** Get a shard for the current thread.
+     *
+     * A shard that was released by an exited thread is reused, otherwise a new shard is made.
+     * The caller should keep the shard for the lifetime of the thread.
+     */
+    [[nodiscard]] shard& acquire_shard() noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+
+        for (hilet& shard_ : _shards) {
+            auto expected = false;
+            if (shard_->_owned.compare_exchange_strong(expected, true, std::memory_order::acquire)) {
+                return *shard_;
+            }
+        }
+
+        return *_shards.emplace_back(std::make_unique<shard>());
+    }
+
+    /** Merge the shards of all threads.
+     *
+     * @return The values added since the histogram was created.
+     */
+    [[nodiscard]] latency_histogram_snapshot read() const noexcept
+    {
+        auto r = latency_histogram_snapshot{};
+        r._buckets.assign(num_buckets, 0);
+
+        hilet lock = std::scoped_lock(_mutex);
+        for (hilet& shard_ : _shards) {
+            for (auto i = 0_uz; i != num_buckets; ++i) {
+                hilet count = shard_->_buckets[i].load(std::memory_order::relaxed);
+                r._buckets[i] += count;
+                r._count += count;
+            }
+            r._sum += shard_->_sum.load(std::memory_order::relaxed);
+        }
+        return r;
+    }
+
+private:
+    /** We disable the dead_lock_detector, so that this mutex can be used before main().
+     */
+    mutable unfair_mutex_impl<false> _mutex;
+    std::vector<std::unique_ptr<shard>> _shards;
+};
+
+} // namespace hi::inline v1
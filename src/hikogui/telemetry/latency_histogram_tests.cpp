@@ -0,0 +1,59 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "latency_histogram.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+TEST(latency_histogram, buckets)
+{
+    for (auto i = 0_uz; i + 1 != latency_histogram::num_buckets; ++i) {
+        ASSERT_EQ(detail::latency_histogram_bucket_highest(i) + 1, detail::latency_histogram_bucket_lowest(i + 1));
+    }
+
+    for (auto value : {uint64_t{0}, uint64_t{31}, uint64_t{32}, uint64_t{1000}, uint64_t{123'456'789}, std::numeric_limits<uint64_t>::max()}) {
+        hilet i = detail::latency_histogram_bucket(value);
+        ASSERT_LT(i, latency_histogram::num_buckets);
+        ASSERT_LE(detail::latency_histogram_bucket_lowest(i), value);
+        ASSERT_GE(detail::latency_histogram_bucket_highest(i), value);
+    }
+}
+
+TEST(latency_histogram, percentile)
+{
+    auto histogram = latency_histogram{};
+
+    {
+        auto threads = std::vector<std::jthread>{};
+        for (auto i = 0; i != 4; ++i) {
+            threads.emplace_back([&histogram] {
+                auto& shard = histogram.acquire_shard();
+                for (auto value = uint64_t{1}; value <= 10'000; ++value) {
+                    shard.add(value);
+                }
+                shard.release();
+            });
+        }
+    }
+
+    hilet snapshot = histogram.read();
+    ASSERT_EQ(snapshot.count(), 40'000);
+    ASSERT_EQ(snapshot.mean(), 5'000);
+    ASSERT_EQ(snapshot.min(), 1);
+    ASSERT_NEAR(static_cast<double>(snapshot.percentile(0.5)), 5'000.0, 5'000.0 * 0.0625);
+    ASSERT_NEAR(static_cast<double>(snapshot.percentile(0.99)), 9'900.0, 9'900.0 * 0.0625);
+    ASSERT_NEAR(static_cast<double>(snapshot.max()), 10'000.0, 10'000.0 * 0.0625);
+
+    // The released shard is reused.
+    auto& shard = histogram.acquire_shard();
+    shard.add(20);
+    hilet delta = histogram.read() - snapshot;
+    ASSERT_EQ(delta.count(), 1);
+    ASSERT_EQ(delta.percentile(0.5), 20);
+}
@@ -6,6 +6,7 @@
 
 #include "delayed_format.hpp"
 #include "format_check.hpp"
+#include "log_sink.hpp"
 #include "../container/container.hpp"
 #include "../time/time.hpp"
 #include "../utility/utility.hpp"
@@ -21,6 +22,8 @@
 #include <atomic>
 #include <memory>
 #include <thread>
+#include <vector>
+#include <iterator>
 #include <filesystem>
 #include <cstdio>
 
@@ -35,8 +38,11 @@ public:
     hi_force_inline log_message_base() noexcept = default;
     virtual ~log_message_base() = default;
 
-    [[nodiscard]] virtual std::string format() const noexcept = 0;
-    [[nodiscard]] virtual std::unique_ptr<log_message_base> make_unique_copy() const noexcept = 0;
+    /** Format the message and append it to a buffer.
+     *
+     * @param buffer The buffer to append the formatted message to, including a terminating newline.
+     */
+    virtual void format_to(std::string& buffer) const noexcept = 0;
 };
 
 template<global_state_type Level, fixed_string SourcePath, int SourceLine, fixed_string Fmt, typename... Values>
@@ -44,6 +50,8 @@ class log_message : public log_message_base {
 public:
     static_assert(std::popcount(std::to_underlying(Level)) == 1);
 
+    constexpr static global_state_type level = Level;
+
     // clang-format off
     constexpr static char const *log_level_name =
         Level == global_state_type::log_fatal ? "fatal" :
@@ -66,7 +74,7 @@ public:
     {
     }
 
-    std::string format() const noexcept override
+    void format_to(std::string& buffer) const noexcept override
     {
         hilet utc_time_point = time_stamp_utc::make(_time_stamp);
         hilet sys_time_point = std::chrono::clock_cast<std::chrono::system_clock>(utc_time_point);
@@ -77,11 +85,13 @@ public:
         hilet thread_name = get_thread_name(thread_id);
 
         if constexpr (to_bool(Level & global_state_type::log_statistics)) {
-            return std::format("{} {}({}) {:5} {}", local_time_point, thread_name, cpu_id, log_level_name, _what());
+            std::format_to(
+                std::back_inserter(buffer), "{} {}({}) {:5} {}\n", local_time_point, thread_name, cpu_id, log_level_name, _what());
         } else {
             auto source_filename = std::filesystem::path{static_cast<std::string_view>(SourcePath)}.filename().generic_string();
-            return std::format(
-                "{} {}({}) {:5} {} ({}:{})",
+            std::format_to(
+                std::back_inserter(buffer),
+                "{} {}({}) {:5} {} ({}:{})\n",
                 local_time_point,
                 thread_name,
                 cpu_id,
@@ -92,11 +102,6 @@ public:
         }
     }
 
-    [[nodiscard]] std::unique_ptr<log_message_base> make_unique_copy() const noexcept override
-    {
-        return std::make_unique<log_message>(*this);
-    }
-
 private:
     time_stamp_count _time_stamp;
     delayed_format<Fmt, Values...> _what;
@@ -126,12 +131,14 @@ public:
         // Add messages in the queue, block when full.
         // * This reduces amount of instructions needed to be executed during logging.
         // * Simplifies logged_fatal_message logic.
-        // * Will make sure everything gets logged.
-        // * Blocking is bad in a real time thread, so maybe count the number of times it is blocked.
+        // * Will make sure everything gets logged, unless dropping is enabled.
+        // * Blocking is bad in a real time thread, so the number of times it is blocked is counted.
+        using message_type = detail::log_message<Level, SourcePath, SourceLine, Fmt, forward_value_t<Args>...>;
 
         // Emplace a message directly on the queue.
-        _fifo.emplace<detail::log_message<Level, SourcePath, SourceLine, Fmt, forward_value_t<Args>...>>(
-            std::forward<Args>(args)...);
+        if (not _fifo.try_emplace<message_type>(std::forward<Args>(args)...)) {
+            [[unlikely]] add_when_full<message_type>(std::forward<Args>(args)...);
+        }
 
         if (to_bool(Level & global_state_type::log_fatal) or not to_bool(state & global_state_type::log_is_running)) {
             // If the logger did not start we will log in degraded mode and log from the current thread.
@@ -143,26 +150,102 @@ public:
     /** Flush all messages from the log_queue directly from this thread.
      * Flushing includes writing the message to a log file or displaying
      * them on the console.
+     *
+     * Messages are formatted in batches into a reusable buffer, and
+     * each batch is written to each sink with a single call.
      */
     hi_no_inline void flush() noexcept
     {
-        bool wrote_message;
+        hilet lock = std::scoped_lock(_mutex);
+
+        auto wrote_message = false;
         do {
-            std::unique_ptr<detail::log_message_base> copy_of_message;
+            _buffer.clear();
+
+            if (hilet num_dropped = _num_dropped.load(std::memory_order::relaxed); num_dropped != _num_dropped_reported) {
+                std::format_to(
+                    std::back_inserter(_buffer), "{} log messages were dropped\n", num_dropped - _num_dropped_reported);
+                _num_dropped_reported = num_dropped;
+            }
 
-            {
-                hilet lock = std::scoped_lock(_mutex);
+            for (auto i = 0_uz; i != max_batch_size and _buffer.size() < max_batch_buffer_size; ++i) {
+                if (not _fifo.take_one([this](auto& message) {
+                        message.format_to(_buffer);
+                    })) {
+                    break;
+                }
+            }
 
-                wrote_message = _fifo.take_one([&copy_of_message](auto& message) {
-                    copy_of_message = message.make_unique_copy();
-                });
+            if (not _buffer.empty()) {
+                for (hilet& sink : _sinks) {
+                    sink->write(_buffer);
+                }
+                wrote_message = true;
             }
+        } while (not _buffer.empty());
 
-            if (wrote_message) {
-                hi_assert_not_null(copy_of_message);
-                write(copy_of_message->format());
+        if (wrote_message) {
+            for (hilet& sink : _sinks) {
+                sink->flush();
             }
-        } while (wrote_message);
+        }
+    }
+
+    /** Add a sink to write log messages to.
+     *
+     * By default messages are written to a `stderr_log_sink`.
+     *
+     * @param sink The sink to add.
+     */
+    void add_sink(std::shared_ptr<log_sink> sink) noexcept
+    {
+        hi_axiom_not_null(sink);
+
+        hilet lock = std::scoped_lock(_mutex);
+        _sinks.push_back(std::move(sink));
+    }
+
+    /** Remove a sink.
+     *
+     * @param sink The sink to remove.
+     */
+    void remove_sink(std::shared_ptr<log_sink> const& sink) noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        std::erase(_sinks, sink);
+    }
+
+    /** Remove all sinks.
+     */
+    void clear_sinks() noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        _sinks.clear();
+    }
+
+    /** Drop messages instead of blocking when the queue is full.
+     *
+     * Fatal and error messages are never dropped.
+     *
+     * @param flag true to drop messages when the queue is full.
+     */
+    void set_drop_when_full(bool flag) noexcept
+    {
+        _drop_when_full.store(flag, std::memory_order::relaxed);
+    }
+
+    /** The number of messages that were dropped because the queue was full.
+     */
+    [[nodiscard]] uint64_t num_dropped() const noexcept
+    {
+        return _num_dropped.load(std::memory_order::relaxed);
+    }
+
+    /** The number of times a thread was blocked because the queue was full.
+     */
+    [[nodiscard]] uint64_t num_blocked() const noexcept
+    {
+        return _num_blocked.load(std::memory_order::relaxed);
     }
 
     /** Start the logger system.
@@ -183,18 +266,54 @@ public:
     }
 
 private:
+    /** The maximum number of messages formatted in a single batch.
+     */
+    constexpr static std::size_t max_batch_size = 256;
+
+    /** The size of the buffer after which a batch is written.
+     */
+    constexpr static std::size_t max_batch_buffer_size = 65536;
+
     /** The global log queue contains messages to be displayed by the logger thread.
      */
     wfree_fifo<detail::log_message_base, 64> _fifo;
+
+    /** Protects the sinks and the buffer, and makes sure only one thread reads from the fifo.
+     */
     mutable unfair_mutex _mutex;
 
-    /** Write to a log file and console.
-     * This will write to the console if one is open.
-     * It will also create a log file in the application-data directory.
+    /** The sinks to write the messages to.
      */
-    void write(std::string const& str) const noexcept
+    std::vector<std::shared_ptr<log_sink>> _sinks = {std::make_shared<stderr_log_sink>()};
+
+    /** Reusable buffer for formatting a batch of messages.
+     */
+    std::string _buffer;
+
+    std::atomic<bool> _drop_when_full = false;
+    std::atomic<uint64_t> _num_dropped = 0;
+    std::atomic<uint64_t> _num_blocked = 0;
+
+    /** The number of dropped messages that have been reported in the log.
+     */
+    uint64_t _num_dropped_reported = 0;
+
+    /** Add a message when the queue is full.
+     *
+     * Either drops the message, or blocks until the logger thread has made room.
+     */
+    template<typename Message, typename... Args>
+    hi_no_inline void add_when_full(Args&&...args) noexcept
     {
-        std::println(stderr, "{}", str);
+        constexpr auto level = Message::level;
+        constexpr auto droppable = not to_bool(level & (global_state_type::log_fatal | global_state_type::log_error));
+
+        if (droppable and _drop_when_full.load(std::memory_order::relaxed)) {
+            _num_dropped.fetch_add(1, std::memory_order::relaxed);
+        } else {
+            _num_blocked.fetch_add(1, std::memory_order::relaxed);
+            _fifo.emplace<Message>(std::forward<Args>(args)...);
+        }
     }
 
     /** The global logger thread.
@@ -0,0 +1,93 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log.hpp"
+#include "log_sink.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** A sink which only counts the bytes, to measure the logger itself.
+ */
+class null_log_sink : public log_sink {
+public:
+    std::size_t num_bytes = 0;
+    std::size_t num_writes = 0;
+
+    void write(std::string_view batch) noexcept override
+    {
+        num_bytes += batch.size();
+        ++num_writes;
+    }
+};
+
+void benchmark_log(std::size_t nr_threads)
+{
+    constexpr auto nr_messages_per_thread = 100'000_uz;
+
+    auto log_ = std::make_unique<hi::log>();
+    auto sink = std::make_shared<null_log_sink>();
+    log_->clear_sinks();
+    log_->add_sink(sink);
+
+    // Pretend the logger thread is running, so that producers do not flush themselves.
+    set_log_level(global_state_type::log_level_info);
+    global_state_enable(global_state_type::log_is_running);
+
+    hilet start = std::chrono::steady_clock::now();
+    {
+        auto consumer = std::jthread([&log_](std::stop_token stop_token) {
+            while (not stop_token.stop_requested()) {
+                log_->flush();
+            }
+        });
+
+        {
+            auto producers = std::vector<std::jthread>{};
+            for (auto t = 0_uz; t != nr_threads; ++t) {
+                producers.emplace_back([&log_, t] {
+                    for (auto i = 0_uz; i != nr_messages_per_thread; ++i) {
+                        log_->add<global_state_type::log_info, __FILE__, __LINE__, "message {} from producer {}">(i, t);
+                    }
+                });
+            }
+        }
+
+        consumer.request_stop();
+    }
+    log_->flush();
+    hilet duration = std::chrono::duration<double>{std::chrono::steady_clock::now() - start};
+
+    global_state_disable(global_state_type::log_is_running);
+    set_log_level(global_state_type::log_level_default);
+
+    hilet nr_messages = nr_threads * nr_messages_per_thread;
+    benchmark_report(std::format("{} producer threads", nr_threads), nr_messages / duration.count(), "messages/s");
+    benchmark_report(
+        std::format("{} producer threads", nr_threads),
+        static_cast<double>(nr_messages) / static_cast<double>(sink->num_writes),
+        "messages/write");
+    benchmark_report(std::format("{} producer threads", nr_threads), static_cast<double>(log_->num_blocked()), "blocked");
+}
+
+} // namespace
+
+TEST(log_benchmarks, producers)
+{
+    benchmark_log(1);
+    benchmark_log(2);
+    benchmark_log(4);
+    benchmark_log(8);
+}
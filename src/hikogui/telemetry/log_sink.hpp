@@ -0,0 +1,238 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../file/file_intf.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+hi_export_module(hikogui.telemetry : log_sink);
+
+hi_export namespace hi { inline namespace v1 {
+
+/** A destination for log messages.
+ *
+ * The logger formats a batch of messages into a single buffer and passes
+ * the buffer to each sink. `write()` and `flush()` are called by the
+ * logger while holding its lock, so a sink is only called from a single thread
+ * at a time.
+ */
+hi_export class log_sink {
+public:
+    virtual ~log_sink() = default;
+    log_sink() noexcept = default;
+    log_sink(log_sink const&) = delete;
+    log_sink(log_sink&&) = delete;
+    log_sink& operator=(log_sink const&) = delete;
+    log_sink& operator=(log_sink&&) = delete;
+
+    /** Write a batch of messages.
+     *
+     * @param batch One or more formatted messages, each terminated by a newline.
+     */
+    virtual void write(std::string_view batch) noexcept = 0;
+
+    /** Flush messages that are buffered by the sink.
+     *
+     * This is called when the logger has no more messages to write.
+     */
+    virtual void flush() noexcept {}
+};
+
+/** Write log messages to the standard error stream.
+ */
+hi_export class stderr_log_sink : public log_sink {
+public:
+    void write(std::string_view batch) noexcept override
+    {
+        std::fwrite(batch.data(), 1, batch.size(), stderr);
+    }
+
+    void flush() noexcept override
+    {
+        std::fflush(stderr);
+    }
+};
+
+/** Keep the most recent log messages in memory.
+ *
+ * This is useful for showing the log inside the application, or to
+ * attach the log to a crash report.
+ */
+hi_export class memory_log_sink : public log_sink {
+public:
+    /** Create a memory sink.
+     *
+     * @param capacity The maximum number of messages to keep.
+     */
+    explicit memory_log_sink(std::size_t capacity = 1000) noexcept : _capacity(capacity)
+    {
+        hi_axiom(capacity != 0);
+    }
+
+    void write(std::string_view batch) noexcept override
+    {
+        auto const lock = std::scoped_lock(_mutex);
+
+        while (not batch.empty()) {
+            hilet i = batch.find('\n');
+            hilet line = batch.substr(0, i);
+            batch = i == batch.npos ? std::string_view{} : batch.substr(i + 1);
+
+            if (_messages.size() == _capacity) {
+                auto recycled = std::move(_messages.front());
+                _messages.pop_front();
+                recycled.assign(line);
+                _messages.push_back(std::move(recycled));
+            } else {
+                _messages.emplace_back(line);
+            }
+        }
+    }
+
+    /** Get a copy of the messages, oldest first.
+     *
+     * This function is thread-safe.
+     */
+    [[nodiscard]] std::vector<std::string> messages() const noexcept
+    {
+        auto const lock = std::scoped_lock(_mutex);
+        return {_messages.begin(), _messages.end()};
+    }
+
+private:
+    std::size_t _capacity;
+    mutable std::mutex _mutex;
+    std::deque<std::string> _messages;
+};
+
+/** Write log messages to a file, which is rotated when it becomes too large or too old.
+ *
+ * On rotation the log file "name.log" is renamed to "name.1.log", "name.1.log"
+ * is renamed to "name.2.log", etc. Files beyond the maximum number of files are removed.
+ */
+hi_export class rotating_file_log_sink : public log_sink {
+public:
+    /** Create a rotating file sink.
+     *
+     * @param path The path to the log file.
+     * @param max_size The size in bytes after which the log file is rotated.
+     * @param max_age The age after which the log file is rotated.
+     * @param max_files The number of rotated files to keep, besides the current log file.
+     */
+    rotating_file_log_sink(
+        std::filesystem::path path,
+        std::size_t max_size = 10'000'000,
+        std::chrono::system_clock::duration max_age = std::chrono::hours{24},
+        std::size_t max_files = 5) noexcept :
+        _path(std::move(path)), _max_size(max_size), _max_age(max_age), _max_files(max_files)
+    {
+    }
+
+    ~rotating_file_log_sink() override
+    {
+        close();
+    }
+
+    /** The path to the current log file.
+     */
+    [[nodiscard]] std::filesystem::path const& path() const noexcept
+    {
+        return _path;
+    }
+
+    /** The path to a rotated log file.
+     *
+     * @param i The index of the rotated file, 1 being the most recent.
+     */
+    [[nodiscard]] std::filesystem::path rotated_path(std::size_t i) const noexcept
+    {
+        hi_axiom(i != 0);
+
+        auto r = _path;
+        r.replace_filename(std::format("{}.{}{}", _path.stem().string(), i, _path.extension().string()));
+        return r;
+    }
+
+    void write(std::string_view batch) noexcept override
+    {
+        try {
+            if (_file and (_size + batch.size() > _max_size or std::chrono::system_clock::now() - _opened > _max_age)) {
+                rotate();
+            }
+
+            if (not _file) {
+                open();
+            }
+
+            _file->write(batch);
+            _size += batch.size();
+
+        } catch (std::exception const& e) {
+            // Errors can not be logged, since this is the logger.
+            std::println(stderr, "Could not write log file {}: \"{}\"", _path.string(), e.what());
+            _file = std::nullopt;
+        }
+    }
+
+private:
+    std::filesystem::path _path;
+    std::size_t _max_size;
+    std::chrono::system_clock::duration _max_age;
+    std::size_t _max_files;
+
+    std::optional<file> _file;
+    std::size_t _size = 0;
+    std::chrono::system_clock::time_point _opened;
+
+    void open()
+    {
+        _file = file{_path, access_mode::open | access_mode::create | access_mode::write | access_mode::create_directories};
+        _size = _file->seek(0, seek_whence::end);
+
+        // The age of an existing log file is not known, start counting from the moment it was opened.
+        _opened = std::chrono::system_clock::now();
+    }
+
+    void close() noexcept
+    {
+        if (_file) {
+            try {
+                _file->close();
+            } catch (...) {
+            }
+            _file = std::nullopt;
+        }
+    }
+
+    void rotate()
+    {
+        close();
+
+        auto ec = std::error_code{};
+        if (_max_files == 0) {
+            std::filesystem::remove(_path, ec);
+            return;
+        }
+
+        std::filesystem::remove(rotated_path(_max_files), ec);
+        for (auto i = _max_files - 1; i != 0; --i) {
+            std::filesystem::rename(rotated_path(i), rotated_path(i + 1), ec);
+        }
+        std::filesystem::rename(_path, rotated_path(1), ec);
+    }
+};
+
+}} // namespace hi::v1
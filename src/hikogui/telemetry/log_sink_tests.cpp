@@ -0,0 +1,54 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "log_sink.hpp"
+#include "../file/file.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+
+using namespace std;
+using namespace hi;
+
+TEST(log_sink, memory)
+{
+    auto sink = memory_log_sink{3};
+
+    sink.write("one\ntwo\n");
+    ASSERT_EQ(sink.messages(), (std::vector<std::string>{"one", "two"}));
+
+    sink.write("three\nfour\nfive\n");
+    ASSERT_EQ(sink.messages(), (std::vector<std::string>{"three", "four", "five"}));
+}
+
+TEST(log_sink, rotating_file)
+{
+    hilet directory = std::filesystem::temp_directory_path() / "hikogui_log_sink_tests";
+    std::filesystem::remove_all(directory);
+
+    {
+        auto sink = rotating_file_log_sink{directory / "test.log", 10, std::chrono::hours{1}, 2};
+        ASSERT_EQ(sink.rotated_path(1), directory / "test.1.log");
+
+        sink.write("aaaaaaaa\n");
+        sink.write("bbbbbbbb\n");
+        sink.write("cccccccc\n");
+        sink.write("dddddddd\n");
+    }
+
+    ASSERT_EQ(as_string_view(file_view{directory / "test.log"}), "dddddddd\n");
+    ASSERT_EQ(as_string_view(file_view{directory / "test.1.log"}), "cccccccc\n");
+    ASSERT_EQ(as_string_view(file_view{directory / "test.2.log"}), "bbbbbbbb\n");
+    ASSERT_FALSE(std::filesystem::exists(directory / "test.3.log"));
+
+    {
+        // Appending to an existing log file.
+        auto sink = rotating_file_log_sink{directory / "test.log", 20, std::chrono::hours{1}, 2};
+        sink.write("eeeeeeee\n");
+    }
+    ASSERT_EQ(as_string_view(file_view{directory / "test.log"}), "dddddddd\neeeeeeee\n");
+
+    std::filesystem::remove_all(directory);
+}
@@ -4,7 +4,10 @@
 #include "counters.hpp" // export
 #include "delayed_format.hpp" // export
 #include "format_check.hpp" // export
+#include "latency_histogram.hpp" // export
 #include "log.hpp" // export
+#include "log_sink.hpp" // export
 #include "trace.hpp" // export
+#include "trace_recorder.hpp" // export
 
 hi_export_module(hikogui.telemetry);
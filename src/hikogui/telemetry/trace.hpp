@@ -7,6 +7,7 @@
 #include "../utility/utility.hpp"
 #include "../time/time.hpp"
 #include "counters.hpp"
+#include "trace_recorder.hpp"
 #include "../macros.hpp"
 #include <array>
 #include <tuple>
@@ -52,6 +53,10 @@ public:
 
         hilet current_time_stamp = time_stamp_count{time_stamp_count::inplace{}};
         global_counter<Tag>.add_duration(current_time_stamp.count() - _time_stamp.count());
+
+        if (to_bool(global_state.load(std::memory_order::relaxed) & global_state_type::trace_is_recording)) [[unlikely]] {
+            trace_recorder_global.record(static_cast<std::string_view>(Tag), _time_stamp.count(), current_time_stamp.count());
+        }
     }
 
     void log() const noexcept override
@@ -0,0 +1,38 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "trace.hpp"
+#include "trace_recorder.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+
+using namespace std;
+using namespace hi;
+
+TEST(trace_benchmarks, trace)
+{
+    constexpr auto nr_traces = 1000;
+
+    hilet rate = benchmark_rate([] {
+        for (auto i = 0; i != nr_traces; ++i) {
+            [[maybe_unused]] hilet t = trace<"trace_benchmark">{};
+        }
+    });
+
+    hilet path = std::filesystem::temp_directory_path() / "hikogui_trace_benchmarks.json";
+    start_trace_recording(path);
+    hilet recording_rate = benchmark_rate([] {
+        for (auto i = 0; i != nr_traces; ++i) {
+            [[maybe_unused]] hilet t = trace<"trace_benchmark">{};
+        }
+    });
+    stop_trace_recording();
+    std::filesystem::remove(path);
+
+    benchmark_report("trace", rate * nr_traces, "traces/s");
+    benchmark_report("trace recording", recording_rate * nr_traces, "traces/s");
+    benchmark_report("trace recording", static_cast<double>(trace_recorder_global.num_dropped()), "dropped");
+}
@@ -0,0 +1,396 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file trace_recorder.hpp Record traces as a timeline in the Chrome Trace Event format.
+ */
+
+#pragma once
+
+#include "log.hpp"
+#include "../file/file_intf.hpp"
+#include "../utility/utility.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/unfair_mutex.hpp" // XXX #616
+#include "../concurrency/thread.hpp" // XXX #616
+#include "../time/time.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+hi_export_module(hikogui.telemetry : trace_recorder);
+
+hi_export namespace hi::inline v1 {
+namespace detail {
+
+/** A completed trace.
+ */
+struct trace_event {
+    /** The tag of the trace, with static storage duration.
+     */
+    std::string_view tag;
+
+    /** The time stamp count at the start of the trace.
+     */
+    uint64_t begin;
+
+    /** The time stamp count at the end of the trace.
+     */
+    uint64_t end;
+};
+
+/** A single-producer/single-consumer ring buffer of trace events of a thread.
+ */
+class trace_ring {
+public:
+    constexpr static std::size_t capacity = 4096;
+
+    trace_ring(trace_ring const&) = delete;
+    trace_ring(trace_ring&&) = delete;
+    trace_ring& operator=(trace_ring const&) = delete;
+    trace_ring& operator=(trace_ring&&) = delete;
+
+    explicit trace_ring(thread_id id) noexcept : _thread_id(id) {}
+
+    [[nodiscard]] thread_id id() const noexcept
+    {
+        return _thread_id;
+    }
+
+    /** Add an event.
+     *
+     * @note Must only be called by the thread that owns this ring.
+     * @return false if the ring is full.
+     */
+    [[nodiscard]] bool push(trace_event const& event) noexcept
+    {
+        hilet head = _head.load(std::memory_order::relaxed);
+        if (head - _tail.load(std::memory_order::acquire) == capacity) {
+            return false;
+        }
+
+        _events[head % capacity] = event;
+        _head.store(head + 1, std::memory_order::release);
+        return true;
+    }
+
+    /** Take all events from the ring.
+     *
+     * @note Must only be called by a single consumer thread.
+     */
+    template<typename Func>
+    void take_all(Func const& func) noexcept
+    {
+        auto tail = _tail.load(std::memory_order::relaxed);
+        hilet head = _head.load(std::memory_order::acquire);
+        for (; tail != head; ++tail) {
+            func(_events[tail % capacity]);
+        }
+        _tail.store(tail, std::memory_order::release);
+    }
+
+    /** Mark the ring as closed, when the thread exits.
+     */
+    void close() noexcept
+    {
+        _closed.store(true, std::memory_order::release);
+    }
+
+    [[nodiscard]] bool closed() const noexcept
+    {
+        return _closed.load(std::memory_order::acquire);
+    }
+
+private:
+    std::array<trace_event, capacity> _events;
+    std::atomic<std::size_t> _head = 0;
+    std::atomic<std::size_t> _tail = 0;
+    std::atomic<bool> _closed = false;
+    thread_id _thread_id;
+};
+
+/** Records traces of all threads and writes them to a file.
+ *
+ * Each thread writes the completed traces in its own ring buffer. A background
+ * thread periodically takes the events from the ring buffers and appends them
+ * as Chrome Trace Event JSON to a file, which can be opened in
+ * chrome://tracing or https://ui.perfetto.dev.
+ */
+class trace_recorder {
+public:
+    trace_recorder(trace_recorder const&) = delete;
+    trace_recorder(trace_recorder&&) = delete;
+    trace_recorder& operator=(trace_recorder const&) = delete;
+    trace_recorder& operator=(trace_recorder&&) = delete;
+    trace_recorder() noexcept = default;
+
+    ~trace_recorder()
+    {
+        stop();
+    }
+
+    /** Record a completed trace of the current thread.
+     *
+     * When the ring buffer of the thread is full the event is dropped.
+     */
+    hi_no_inline void record(std::string_view tag, uint64_t begin, uint64_t end) noexcept
+    {
+        if (not thread_ring().push(trace_event{tag, begin, end})) {
+            _num_dropped.fetch_add(1, std::memory_order::relaxed);
+        }
+    }
+
+    /** Start recording to a file.
+     *
+     * @param path The path to the file to write the trace to.
+     * @throws io_error When the file could not be created.
+     */
+    void start(std::filesystem::path const& path)
+    {
+        stop();
+
+        {
+            hilet lock = std::scoped_lock(_mutex);
+
+            _file = file{path, access_mode::truncate_or_create_for_write};
+            _file->write(std::string_view{"[\n"});
+            _first_event = true;
+            _start_count = time_stamp_count{time_stamp_count::inplace{}}.count();
+            _num_dropped.store(0, std::memory_order::relaxed);
+
+            for (hilet& ring : _rings) {
+                // Discard events from a previous recording.
+                ring->take_all([](auto const&) {});
+                write_thread_name(*ring);
+            }
+        }
+
+        _flush_thread = std::jthread{[this](std::stop_token stop_token) {
+            using namespace std::chrono_literals;
+
+            set_thread_name("trace_recorder");
+            while (not stop_token.stop_requested()) {
+                std::this_thread::sleep_for(100ms);
+                flush();
+            }
+        }};
+
+        global_state_enable(global_state_type::trace_is_recording);
+    }
+
+    /** Stop recording and close the file.
+     */
+    void stop() noexcept
+    {
+        global_state_disable(global_state_type::trace_is_recording);
+
+        if (_flush_thread.joinable()) {
+            _flush_thread.request_stop();
+            _flush_thread.join();
+        }
+
+        flush();
+
+        hilet lock = std::scoped_lock(_mutex);
+        if (_file) {
+            try {
+                _file->write(std::string_view{"\n]\n"});
+                _file->close();
+            } catch (std::exception const& e) {
+                hi_log_error("Could not write trace file: \"{}\"", e.what());
+            }
+            _file = std::nullopt;
+        }
+    }
+
+    /** Write all recorded events to the file.
+     *
+     * The events are written with a single write.
+     */
+    void flush() noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+
+        // Rings of threads that have exited are removed after taking the last events,
+        // also when not recording so that the rings do not accumulate.
+        std::erase_if(_rings, [this](hilet& ring) {
+            hilet closed = ring->closed();
+            if (_file) {
+                ring->take_all([this, &ring](trace_event const& event) {
+                    write_event(ring->id(), event);
+                });
+            }
+            return closed;
+        });
+
+        if (_file and not _buffer.empty()) {
+            try {
+                _file->write(std::string_view{_buffer});
+            } catch (std::exception const& e) {
+                hi_log_error("Could not write trace file: \"{}\"", e.what());
+            }
+            _buffer.clear();
+        }
+    }
+
+    /** The number of threads that have a ring buffer.
+     */
+    [[nodiscard]] std::size_t num_threads() const noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        return _rings.size();
+    }
+
+    /** The number of events that were dropped because a ring buffer was full.
+     */
+    [[nodiscard]] uint64_t num_dropped() const noexcept
+    {
+        return _num_dropped.load(std::memory_order::relaxed);
+    }
+
+private:
+    /** Closes the ring of a thread when the thread exits.
+     */
+    struct thread_ring_type {
+        std::shared_ptr<trace_ring> ring;
+
+        ~thread_ring_type()
+        {
+            if (ring) {
+                ring->close();
+            }
+        }
+    };
+
+    inline static thread_local thread_ring_type _thread_ring;
+
+    /** Protects all members below, except for the rings themselves.
+     */
+    mutable unfair_mutex_impl<false> _mutex;
+    std::vector<std::shared_ptr<trace_ring>> _rings;
+    std::optional<file> _file;
+    std::string _buffer;
+    bool _first_event = true;
+    uint64_t _start_count = 0;
+
+    std::atomic<uint64_t> _num_dropped = 0;
+    std::jthread _flush_thread;
+
+    [[nodiscard]] trace_ring& thread_ring() noexcept
+    {
+        if (not _thread_ring.ring) [[unlikely]] {
+            _thread_ring.ring = std::make_shared<trace_ring>(current_thread_id());
+
+            hilet lock = std::scoped_lock(_mutex);
+            _rings.push_back(_thread_ring.ring);
+            write_thread_name(*_thread_ring.ring);
+        }
+        return *_thread_ring.ring;
+    }
+
+    void write_separator() noexcept
+    {
+        if (not std::exchange(_first_event, false)) {
+            _buffer += ",\n";
+        }
+    }
+
+    /** Add a metadata event with the name of the thread.
+     */
+    void write_thread_name(trace_ring const& ring) noexcept
+    {
+        if (not _file) {
+            return;
+        }
+
+        write_separator();
+        std::format_to(std::back_inserter(_buffer), R"({{"name":"thread_name","ph":"M","pid":1,"tid":{},"args":{{"name":)", ring.id());
+        write_string(get_thread_name(ring.id()));
+        _buffer += "}}";
+    }
+
+    /** Add a quoted and escaped JSON string.
+     */
+    void write_string(std::string_view str) noexcept
+    {
+        constexpr auto hex_digits = std::string_view{"0123456789abcdef"};
+
+        _buffer += '"';
+        for (hilet c : str) {
+            if (c == '"' or c == '\\') {
+                _buffer += '\\';
+                _buffer += c;
+            } else if (char_cast<uint8_t>(c) < 0x20) {
+                _buffer += "\\u00";
+                _buffer += hex_digits[char_cast<uint8_t>(c) >> 4];
+                _buffer += hex_digits[char_cast<uint8_t>(c) & 0xf];
+            } else {
+                _buffer += c;
+            }
+        }
+        _buffer += '"';
+    }
+
+    /** Add a complete event.
+     */
+    void write_event(thread_id id, trace_event const& event) noexcept
+    {
+        hilet begin = static_cast<int64_t>(event.begin - _start_count);
+        hilet duration = event.end - event.begin;
+
+        // Time in the Chrome Trace Event format is in microseconds.
+        hilet begin_ns = begin < 0 ? -time_stamp_count::duration_from_count(static_cast<uint64_t>(-begin)) :
+                                     time_stamp_count::duration_from_count(static_cast<uint64_t>(begin));
+        hilet begin_us = std::chrono::duration<double, std::micro>{begin_ns};
+        hilet duration_us = std::chrono::duration<double, std::micro>{time_stamp_count::duration_from_count(duration)};
+
+        write_separator();
+        std::format_to(
+            std::back_inserter(_buffer),
+            R"({{"name":"{}","ph":"X","pid":1,"tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+            event.tag,
+            id,
+            begin_us.count(),
+            duration_us.count());
+    }
+};
+
+} // namespace detail
+
+hi_inline detail::trace_recorder trace_recorder_global;
+
+/** Start recording traces to a file.
+ *
+ * The completed `trace<Tag>` scopes of all threads are written as
+ * Chrome Trace Event JSON, which can be viewed in chrome://tracing or
+ * https://ui.perfetto.dev.
+ *
+ * When not recording a `trace` only checks a flag in `global_state`.
+ *
+ * @param path The path to the JSON file to write.
+ * @throws io_error When the file could not be created.
+ */
+hi_export hi_inline void start_trace_recording(std::filesystem::path const& path)
+{
+    trace_recorder_global.start(path);
+}
+
+/** Stop recording traces and close the file.
+ */
+hi_export hi_inline void stop_trace_recording() noexcept
+{
+    trace_recorder_global.stop();
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,88 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "trace.hpp"
+#include "trace_recorder.hpp"
+#include "../file/file.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <string>
+#include <thread>
+
+using namespace std;
+using namespace hi;
+
+TEST(trace_recorder, record)
+{
+    hilet path = std::filesystem::temp_directory_path() / "hikogui_trace_recorder_tests.json";
+
+    {
+        [[maybe_unused]] hilet t = trace<"not_recorded">{};
+    }
+
+    start_trace_recording(path);
+    {
+        [[maybe_unused]] hilet t1 = trace<"outer_trace">{};
+        {
+            [[maybe_unused]] hilet t2 = trace<"inner_trace">{};
+        }
+
+        auto thread = std::jthread([] {
+            [[maybe_unused]] hilet t3 = trace<"thread_trace">{};
+        });
+    }
+    stop_trace_recording();
+
+    {
+        [[maybe_unused]] hilet t = trace<"not_recorded">{};
+    }
+
+    hilet text = std::string{as_string_view(file_view{path})};
+    ASSERT_TRUE(text.starts_with("["));
+    ASSERT_TRUE(text.ends_with("]\n"));
+    ASSERT_NE(text.find(R"("name":"outer_trace","ph":"X")"), std::string::npos);
+    ASSERT_NE(text.find(R"("name":"inner_trace","ph":"X")"), std::string::npos);
+    ASSERT_NE(text.find(R"("name":"thread_trace","ph":"X")"), std::string::npos);
+    ASSERT_NE(text.find(R"("name":"thread_name","ph":"M")"), std::string::npos);
+    ASSERT_EQ(text.find("not_recorded"), std::string::npos);
+
+    std::filesystem::remove(path);
+}
+
+TEST(trace_recorder, thread_name_escaped)
+{
+    hilet path = std::filesystem::temp_directory_path() / "hikogui_trace_recorder_tests_name.json";
+
+    auto recorder = detail::trace_recorder{};
+    recorder.start(path);
+    {
+        auto thread = std::jthread([&recorder] {
+            set_thread_name("quote\" backslash\\");
+            recorder.record("event", 0, 1);
+        });
+    }
+    recorder.stop();
+
+    hilet text = std::string{as_string_view(file_view{path})};
+    ASSERT_NE(text.find(R"("args":{"name":"quote\" backslash\\"})"), std::string::npos);
+
+    std::filesystem::remove(path);
+}
+
+TEST(trace_recorder, prune_exited_threads)
+{
+    auto recorder = detail::trace_recorder{};
+
+    // Threads may record an event just after the recording was stopped.
+    for (auto i = 0; i != 10; ++i) {
+        auto thread = std::jthread([&recorder] {
+            recorder.record("event", 0, 1);
+        });
+    }
+    ASSERT_EQ(recorder.num_threads(), 10);
+
+    recorder.flush();
+    ASSERT_EQ(recorder.num_threads(), 0);
+}
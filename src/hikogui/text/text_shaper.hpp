@@ -142,6 +142,135 @@ public:
     {
     }
 
+    /** Replace part of the text.
+     *
+     * Only the paragraphs that are touched by the edit are analyzed again;
+     * the results are spliced into the existing text. The lines of the
+     * unchanged paragraphs are kept, so that the next call to `layout()`
+     * with the same width only has to lay out the lines of the edited paragraphs.
+     *
+     * @param first The index of the first character to replace.
+     * @param last The index one beyond the last character to replace.
+     * @param text The new text to insert at @a first.
+     * @param style The text-style of the new text.
+     */
+    void replace(size_t first, size_t last, gstring_view text, text_style const& style) noexcept
+    {
+        hi_axiom(first <= last);
+        hi_axiom(last <= _text.size());
+
+        hilet old_size = _text.size();
+        hilet new_size = old_size - (last - first) + text.size();
+        hilet delta = static_cast<ptrdiff_t>(new_size) - static_cast<ptrdiff_t>(old_size);
+
+        // The break opportunities are reset after a paragraph separator, so we
+        // only need to analyze the paragraphs that contain the edit.
+        auto par_first = first;
+        while (par_first != 0 and _text[par_first - 1].general_category != unicode_general_category::Zp) {
+            --par_first;
+        }
+        auto par_last = last;
+        while (par_last != old_size and _text[par_last++].general_category != unicode_general_category::Zp) {}
+
+        // Remove the lines of the edited paragraphs, the lines of other paragraphs are kept.
+        if (_lines_are_dirty) {
+            // Include the paragraphs of a previous edit that have not been laid out yet.
+            inplace_min(par_first, _dirty_first);
+            inplace_max(par_last, _dirty_last);
+        }
+        hilet line_ranges = remove_lines(par_first, par_last, delta);
+        _lines_are_dirty = true;
+        _dirty_first = par_first;
+        _dirty_last = narrow_cast<size_t>(static_cast<ptrdiff_t>(par_last) + delta);
+
+        // Splice the new characters into the text.
+        hilet& font = find_font(style->family_id, style->variant);
+        auto new_chars = char_vector{};
+        new_chars.reserve(text.size());
+        for (hilet& c : text) {
+            hilet clean_c = c == '\n' ? grapheme{unicode_PS} : c;
+
+            auto& tmp = new_chars.emplace_back(clean_c, style, _dpi_scale);
+            tmp.initialize_glyph(font);
+        }
+        _text.erase(_text.begin() + first, _text.begin() + last);
+        _text.insert(_text.begin() + first, std::make_move_iterator(new_chars.begin()), std::make_move_iterator(new_chars.end()));
+
+        auto new_widths = std::vector<float>{};
+        new_widths.reserve(_dirty_last - _dirty_first);
+        for (auto i = _dirty_first; i != _dirty_last; ++i) {
+            new_widths.push_back(is_visible(_text[i].general_category) ? _text[i].width : -_text[i].width);
+        }
+        _line_break_widths.erase(_line_break_widths.begin() + par_first, _line_break_widths.begin() + par_last);
+        _line_break_widths.insert(_line_break_widths.begin() + par_first, new_widths.begin(), new_widths.end());
+
+        hilet paragraphs_first = _text.begin() + _dirty_first;
+        hilet paragraphs_last = _text.begin() + _dirty_last;
+        if (par_first == 0 and par_last == old_size) {
+            // The whole text was edited.
+            _line_break_opportunities = unicode_line_break(_text.begin(), _text.end(), [](hilet& c) -> decltype(auto) {
+                return c.grapheme.starter();
+            });
+            _word_break_opportunities = unicode_word_break(_text.begin(), _text.end(), [](hilet& c) -> decltype(auto) {
+                return c.grapheme.starter();
+            });
+            _sentence_break_opportunities = unicode_sentence_break(_text.begin(), _text.end(), [](hilet& c) -> decltype(auto) {
+                return c.grapheme.starter();
+            });
+
+        } else {
+            // At least one side of the edited paragraphs is next to a paragraph separator,
+            // the break opportunities at both sides of the edited paragraphs remain unchanged.
+            replace_break_opportunities(
+                _line_break_opportunities,
+                par_first,
+                par_last,
+                unicode_line_break(paragraphs_first, paragraphs_last, [](hilet& c) -> decltype(auto) {
+                    return c.grapheme.starter();
+                }));
+            replace_break_opportunities(
+                _word_break_opportunities,
+                par_first,
+                par_last,
+                unicode_word_break(paragraphs_first, paragraphs_last, [](hilet& c) -> decltype(auto) {
+                    return c.grapheme.starter();
+                }));
+            replace_break_opportunities(
+                _sentence_break_opportunities,
+                par_first,
+                par_last,
+                unicode_sentence_break(paragraphs_first, paragraphs_last, [](hilet& c) -> decltype(auto) {
+                    return c.grapheme.starter();
+                }));
+        }
+        hi_axiom(_line_break_opportunities.size() == new_size + 1);
+        hi_axiom(_word_break_opportunities.size() == new_size + 1);
+        hi_axiom(_sentence_break_opportunities.size() == new_size + 1);
+
+        _text_direction = unicode_bidi_direction(
+            _text.begin(),
+            _text.end(),
+            [](text_shaper::char_const_reference it) {
+                return it.grapheme.starter();
+            },
+            _bidi_context);
+
+        resolve_script(_dirty_first, _dirty_last);
+        rebase_lines(line_ranges);
+    }
+
+    /** Replace part of the text.
+     *
+     * @param first The index of the first character to replace.
+     * @param last The index one beyond the last character to replace.
+     * @param text The new text to insert at @a first.
+     * @param style The text-style of the new text.
+     */
+    void replace(size_t first, size_t last, std::string_view text, text_style const& style) noexcept
+    {
+        replace(first, last, to_gstring(text), style);
+    }
+
     [[nodiscard]] bool empty() const noexcept
     {
         return _text.empty();
@@ -231,6 +360,10 @@ public:
      * It will estimate the width and height based on the glyphs before glyph-morphing and kerning
      * and fold the lines using the unicode line breaking algorithm to the width of the @a rectangle.
      *
+     * After `replace()`, when the width, sub-pixel-size and spacing are the same
+     * as the previous layout, only the lines of the edited paragraphs are laid out;
+     * the other lines are only moved vertically.
+     *
      * @post The lines have been laid out.
      * @param rectangle The rectangle to position the glyphs in.
      * @param baseline The position of the recommended base-line.
@@ -245,10 +378,23 @@ public:
         float line_spacing = 1.0f,
         float paragraph_spacing = 1.5f) noexcept
     {
+        hilet same_width = rectangle.left() == _rectangle.left() and rectangle.right() == _rectangle.right();
+        hilet same_parameters = same_width and sub_pixel_size == _sub_pixel_size and line_spacing == _line_spacing and
+            paragraph_spacing == _paragraph_spacing;
+
         _rectangle = rectangle;
-        _lines = make_lines(rectangle, baseline, sub_pixel_size, line_spacing, paragraph_spacing);
-        hi_assert(not _lines.empty());
-        position_glyphs(rectangle, sub_pixel_size);
+        _sub_pixel_size = sub_pixel_size;
+        _line_spacing = line_spacing;
+        _paragraph_spacing = paragraph_spacing;
+
+        if (_lines_are_dirty and same_parameters and not _lines.empty()) {
+            layout_dirty_lines(rectangle, baseline, sub_pixel_size);
+        } else {
+            _lines = make_lines(rectangle, baseline, sub_pixel_size, line_spacing, paragraph_spacing);
+            hi_assert(not _lines.empty());
+            position_glyphs(rectangle, sub_pixel_size);
+        }
+        _lines_are_dirty = false;
     }
 
     /** The rectangle used when laying out the text.
@@ -885,6 +1031,33 @@ private:
      */
     aarectangle _rectangle;
 
+    /** The sub-pixel-size used for laying out.
+     */
+    extent2 _sub_pixel_size;
+
+    /** The line-spacing used for laying out.
+     */
+    float _line_spacing = 1.0f;
+
+    /** The paragraph-spacing used for laying out.
+     */
+    float _paragraph_spacing = 1.5f;
+
+    /** The text was edited since the last layout.
+     *
+     * When true `_lines` contains only the lines of the paragraphs outside
+     * of the characters `[_dirty_first, _dirty_last)`.
+     */
+    bool _lines_are_dirty = false;
+
+    /** The index of the first character of the edited paragraphs.
+     */
+    size_t _dirty_first = 0;
+
+    /** The index one beyond the last character of the edited paragraphs.
+     */
+    size_t _dirty_last = 0;
+
     static void
     layout_lines_vertical_spacing(text_shaper::line_vector& lines, float line_spacing, float paragraph_spacing) noexcept
     {
@@ -952,19 +1125,26 @@ private:
 
     /** Run the bidi-algorithm over the text and replace the columns of each line.
      *
-     * @param[in,out] lines The lines to be modified
+     * @param first The first line to be modified, at the start of a paragraph.
+     * @param last One beyond the last line to be modified, at the end of a paragraph.
      * @param[in,out] text The input text. non-const because modifications on the text is required.
      * @param writing_direction The initial writing direction.
      */
-    static void
-    bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text, unicode_bidi_context bidi_context) noexcept
+    static void bidi_algorithm(
+        text_shaper::line_iterator first,
+        text_shaper::line_iterator last,
+        text_shaper::char_vector& text,
+        unicode_bidi_context bidi_context) noexcept
     {
-        hi_assert(not lines.empty());
+        hi_assert(first != last);
+
+        auto lines = std::ranges::subrange(first, last);
+        hilet num_chars = narrow_cast<size_t>(std::distance(first->first, (last - 1)->last));
 
         // Create a list of all character indices.
         auto char_its = std::vector<text_shaper::char_iterator>{};
         // Make room for implicit line-separators.
-        char_its.reserve(text.size() + lines.size());
+        char_its.reserve(num_chars + lines.size());
         for (hilet& line : lines) {
             // Add all the characters of a line.
             for (auto it = line.first; it != line.last; ++it) {
@@ -1036,86 +1216,51 @@ private:
             char_it->column_nr = column_nr++;
         }
 
-        // All of the characters in the text must be positioned.
-        for (auto& c : text) {
-            hi_axiom(c.line_nr != std::numeric_limits<size_t>::max() and c.column_nr != std::numeric_limits<size_t>::max());
+        // All of the characters in the lines must be positioned.
+        for (auto it = first->first; it != (last - 1)->last; ++it) {
+            hi_axiom(it->line_nr != std::numeric_limits<size_t>::max() and it->column_nr != std::numeric_limits<size_t>::max());
         }
     }
 
     [[nodiscard]] static generator<std::pair<std::vector<size_t>, float>>
     get_widths(unicode_break_vector const& opportunities, std::vector<float> const& widths, float dpi_scale) noexcept
     {
-        struct entry_type {
-            size_t min_height;
-            size_t max_height;
-            float min_width;
-            float max_width;
-        };
-
-        auto stack = std::vector<entry_type>{};
+        hilet fitter = unicode_line_fitter{opportunities, widths};
+        if (fitter.empty()) {
+            co_return;
+        }
 
         hilet a4_one_column = 172.0f * 2.83465f * dpi_scale;
         hilet a4_two_column = 88.0f * 2.83465f * dpi_scale;
 
         // Max-width first.
-        auto [max_width, max_lines] = detail::unicode_LB_maximum_width(opportunities, widths);
+        auto [max_width, max_lines] = fitter.maximum_width();
         auto height = max_lines.size();
         co_yield {std::move(max_lines), max_width};
 
         if (max_width >= a4_two_column) {
             // If this is wide text, then only try a few sizes.
             if (max_width > a4_one_column) {
-                auto [width, lines] = detail::unicode_LB_width(opportunities, widths, a4_one_column);
-                if (std::exchange(height, lines.size()) > lines.size()) {
+                auto lines = fitter.fit(a4_one_column);
+                if (std::exchange(height, lines.size()) < lines.size()) {
+                    hilet width = fitter.width(lines);
                     co_yield {std::move(lines), width};
                 }
             }
 
-            auto [width, lines] = detail::unicode_LB_width(opportunities, widths, a4_two_column);
-            if (std::exchange(height, lines.size()) > lines.size()) {
+            auto lines = fitter.fit(a4_two_column);
+            if (std::exchange(height, lines.size()) < lines.size()) {
+                hilet width = fitter.width(lines);
                 co_yield {std::move(lines), width};
             }
 
         } else {
-            // With small text we try every size that changes the number of lines.
-            auto [min_width, min_lines] = detail::unicode_LB_minimum_width(opportunities, widths);
-            if (min_lines.size() >= height) {
-                // There are no multiple sizes.
-                co_return;
-            }
-
-            stack.emplace_back(min_lines.size(), height, min_width, max_width);
-            co_yield {std::move(min_lines), min_width};
-
-            do {
-                hilet entry = stack.back();
-                stack.pop_back();
-
-                if (entry.max_height > entry.max_height + 1 and entry.max_width >= entry.min_width + 2.0f) {
-                    // There lines between the current two sizes; split in two.
-                    hilet half_width = (entry.min_width + entry.max_width) * 0.5f;
-
-                    auto [split_width, split_lines] = detail::unicode_LB_width(opportunities, widths, half_width);
-                    hilet split_height = split_lines.size();
-
-                    if (split_height == entry.min_height) {
-                        // We didn't find a proper split, need to try the upper half. Use `half_width` to split right down the
-                        // middle.
-                        stack.emplace_back(split_height, entry.max_height, half_width, entry.max_width);
-
-                    } else if (split_height == entry.max_height) {
-                        // We didn't find a proper split, need to try the lower half. Use `half_width` to split right down the
-                        // middle.
-                        stack.emplace_back(entry.min_height, split_height, entry.min_width, half_width);
-
-                    } else {
-                        // Split through the middle, use the split_width for faster searching.
-                        co_yield {std::move(split_lines), split_width};
-                        stack.emplace_back(entry.min_height, split_height, entry.min_width, split_width);
-                        stack.emplace_back(split_height, entry.max_height, split_width, entry.max_width);
-                    }
+            // With small text we try every size that changes the number of lines, found in a single sweep.
+            for (auto& [width, lines] : fitter.line_count_steps()) {
+                if (lines.size() > height) {
+                    co_yield {std::move(lines), width};
                 }
-            } while (not stack.empty());
+            }
         }
     }
 
@@ -1177,23 +1322,251 @@ private:
         hi_assert(not _lines.empty());
 
         // The bidi algorithm will reorder the characters on each line, and mirror the brackets in the text when needed.
-        bidi_algorithm(_lines, _text, _bidi_context);
+        bidi_algorithm(_lines.begin(), _lines.end(), _text, _bidi_context);
         for (auto& line : _lines) {
             // Position the glyphs on each line. Possibly morph glyphs to handle ligatures and calculate the bounding rectangles.
             line.layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
         }
     }
 
+    /** Layout the lines of the edited paragraphs.
+     *
+     * The lines of the other paragraphs are kept and moved vertically.
+     *
+     * @pre The width and spacing are the same as the previous layout.
+     * @param rectangle The rectangle to position the glyphs in.
+     * @param baseline The position of the recommended base-line.
+     * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
+     */
+    void layout_dirty_lines(aarectangle rectangle, float baseline, extent2 sub_pixel_size) noexcept
+    {
+        hi_axiom(_lines_are_dirty);
+        hi_axiom(_dirty_first <= _dirty_last and _dirty_last <= _text.size());
+
+        // The edited paragraphs start and end with a mandatory break.
+        hilet line_sizes = unicode_line_break(
+            unicode_break_vector{
+                _line_break_opportunities.begin() + _dirty_first, _line_break_opportunities.begin() + _dirty_last + 1},
+            std::vector<float>{_line_break_widths.begin() + _dirty_first, _line_break_widths.begin() + _dirty_last},
+            rectangle.width());
+
+        auto new_lines = line_vector{};
+        new_lines.reserve(line_sizes.size() + 1);
+
+        auto char_it = _text.begin() + _dirty_first;
+        auto width_it = _line_break_widths.begin() + _dirty_first;
+        for (hilet line_size : line_sizes) {
+            hi_axiom(line_size > 0);
+            hilet char_eol = char_it + line_size;
+            hilet width_eol = width_it + line_size;
+
+            hilet line_width = detail::unicode_LB_width(width_it, width_eol);
+            new_lines.emplace_back(0_uz, _text.begin(), char_it, char_eol, line_width, _initial_line_metrics);
+
+            char_it = char_eol;
+            width_it = width_eol;
+        }
+
+        // The empty line at the end of the text is removed together with the last paragraph.
+        if (_dirty_last == _text.size() and (_text.empty() or is_Zp_or_Zl(_text.back().general_category))) {
+            new_lines.emplace_back(0_uz, _text.begin(), _text.end(), _text.end(), 0.0f, _initial_line_metrics);
+            new_lines.back().paragraph_direction = _text_direction;
+        }
+
+        auto old_y = std::vector<float>{};
+        old_y.reserve(_lines.size());
+        for (hilet& line : _lines) {
+            old_y.push_back(line.y);
+        }
+
+        hilet first_line_nr = narrow_cast<size_t>(std::distance(
+            _lines.begin(), std::partition_point(_lines.begin(), _lines.end(), [&](hilet& line) {
+                return line.first < _text.begin() + _dirty_first;
+            })));
+        hilet num_new_lines = new_lines.size();
+        hilet last_line_nr = first_line_nr + num_new_lines;
+        _lines.insert(
+            _lines.begin() + first_line_nr, std::make_move_iterator(new_lines.begin()), std::make_move_iterator(new_lines.end()));
+
+        // Renumber the lines after the edit.
+        for (auto line_nr = first_line_nr; line_nr != _lines.size(); ++line_nr) {
+            auto& line = _lines[line_nr];
+            if (std::exchange(line.line_nr, line_nr) != line_nr and line_nr >= last_line_nr) {
+                for (auto it = line.first; it != line.last; ++it) {
+                    it->line_nr = line_nr;
+                }
+            }
+        }
+
+        layout_lines_vertical_spacing(_lines, _line_spacing, _paragraph_spacing);
+        layout_lines_vertical_alignment(
+            _lines, _alignment.vertical(), baseline, rectangle.bottom(), rectangle.top(), sub_pixel_size.height());
+
+        // Move the glyphs of the lines that were kept.
+        for (auto line_nr = 0_uz; line_nr != _lines.size(); ++line_nr) {
+            if (line_nr >= first_line_nr and line_nr < last_line_nr) {
+                continue;
+            }
+
+            auto& line = _lines[line_nr];
+            hilet dy = line.y - old_y[line_nr < first_line_nr ? line_nr : line_nr - num_new_lines];
+            if (dy != 0.0f) {
+                hilet offset = translate2{0.0f, dy};
+                for (auto it = line.first; it != line.last; ++it) {
+                    it->position = offset * it->position;
+                    it->rectangle = offset * it->rectangle;
+                }
+                line.rectangle = offset * line.rectangle;
+            }
+        }
+
+        if (num_new_lines != 0) {
+            hilet first = _lines.begin() + first_line_nr;
+            hilet last = _lines.begin() + last_line_nr;
+            bidi_algorithm(first, last, _text, _bidi_context);
+            for (auto it = first; it != last; ++it) {
+                it->layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
+            }
+        }
+    }
+
+    /** Remove the lines of the edited paragraphs.
+     *
+     * @param first The index of the first character of the edited paragraphs.
+     * @param last The index one beyond the last character of the edited paragraphs, before the edit.
+     * @param delta The difference in the number of characters after the edit.
+     * @return The first and last character index of each remaining line, after the edit.
+     */
+    [[nodiscard]] std::vector<std::pair<size_t, size_t>> remove_lines(size_t first, size_t last, ptrdiff_t delta) noexcept
+    {
+        auto r = std::vector<std::pair<size_t, size_t>>{};
+        if (_lines.empty()) {
+            return r;
+        }
+
+        hilet char_index = [&](char_const_iterator it) {
+            return narrow_cast<size_t>(std::distance(_text.cbegin(), it));
+        };
+
+        hilet remove_first = std::partition_point(_lines.begin(), _lines.end(), [&](hilet& line) {
+            return char_index(line.first) < first;
+        });
+        // When the last paragraph is edited, also remove the empty line at the end of the text.
+        hilet remove_last = last == _text.size() ? _lines.end() :
+                                                   std::partition_point(remove_first, _lines.end(), [&](hilet& line) {
+                                                       return char_index(line.first) < last;
+                                                   });
+
+        hilet shifted_char_index = [&](char_const_iterator it) {
+            return narrow_cast<size_t>(std::distance(_text.cbegin(), it) + delta);
+        };
+
+        r.reserve(_lines.size());
+        for (auto it = _lines.begin(); it != remove_first; ++it) {
+            r.emplace_back(char_index(it->first), char_index(it->last));
+        }
+        for (auto it = remove_last; it != _lines.end(); ++it) {
+            r.emplace_back(shifted_char_index(it->first), shifted_char_index(it->last));
+        }
+
+        _lines.erase(remove_first, remove_last);
+        return r;
+    }
+
+    /** Update the iterators of the lines after the text was edited.
+     *
+     * @param line_ranges The first and last character index of each line.
+     */
+    void rebase_lines(std::vector<std::pair<size_t, size_t>> const& line_ranges) noexcept
+    {
+        hi_axiom(line_ranges.size() == _lines.size());
+
+        for (auto line_nr = 0_uz; line_nr != _lines.size(); ++line_nr) {
+            auto& line = _lines[line_nr];
+            hilet[first, last] = line_ranges[line_nr];
+
+            line.first = _text.begin() + first;
+            line.last = _text.begin() + last;
+
+            // The characters know their column, use it to update the display order.
+            for (auto it = line.first; it != line.last; ++it) {
+                if (it->column_nr < line.columns.size()) {
+                    line.columns[it->column_nr] = it;
+                }
+            }
+        }
+    }
+
+    /** Replace the break opportunities of the edited paragraphs.
+     *
+     * The edited paragraphs start at the start of the text or after a paragraph separator, and
+     * end at the end of the text or after a paragraph separator. Therefor the break opportunities
+     * at both sides of the paragraphs do not change.
+     *
+     * @param[in,out] opportunities The break opportunities of the text.
+     * @param first The index of the first character of the edited paragraphs.
+     * @param last The index one beyond the last character of the edited paragraphs, before the edit.
+     * @param paragraphs The break opportunities of the edited paragraphs, after the edit.
+     */
+    static void replace_break_opportunities(
+        unicode_break_vector& opportunities,
+        size_t first,
+        size_t last,
+        unicode_break_vector const& paragraphs) noexcept
+    {
+        hi_axiom(first <= last and last < opportunities.size());
+        hi_axiom(not paragraphs.empty());
+
+        hilet last_opportunity = opportunities[last];
+        opportunities.erase(opportunities.begin() + first + 1, opportunities.begin() + last + 1);
+        if (paragraphs.size() == 1) {
+            // The edited paragraphs were removed.
+            opportunities[first] = last_opportunity;
+        } else {
+            opportunities.insert(opportunities.begin() + first + 1, paragraphs.begin() + 1, paragraphs.end() - 1);
+            opportunities.insert(opportunities.begin() + first + paragraphs.size() - 1, last_opportunity);
+        }
+    }
+
     /** Resolve the script of each character in text.
      */
     void resolve_script() noexcept
     {
-        // Find the first script in the text if no script is found use the text_shaper's default script.
+        resolve_script(0, _text.size());
+    }
+
+    /** Resolve the script of each character in a range of paragraphs.
+     *
+     * Each paragraph is resolved on its own, so that editing a paragraph does
+     * not change the scripts of the other paragraphs.
+     *
+     * @param first The index of the first character of a paragraph.
+     * @param last The index one beyond the last character of a paragraph.
+     */
+    void resolve_script(size_t first, size_t last) noexcept
+    {
+        while (first != last) {
+            auto paragraph_last = first;
+            while (paragraph_last != last and _text[paragraph_last++].general_category != unicode_general_category::Zp) {}
+
+            resolve_paragraph_script(first, paragraph_last);
+            first = paragraph_last;
+        }
+    }
+
+    /** Resolve the script of each character in a paragraph.
+     *
+     * @param first The index of the first character of the paragraph.
+     * @param last The index one beyond the last character of the paragraph.
+     */
+    void resolve_paragraph_script(size_t first, size_t last) noexcept
+    {
+        // Find the first script in the paragraph if no script is found use the text_shaper's default script.
         auto first_script = _script;
-        for (auto& c : _text) {
-            hilet script = ucd_get_script(c.grapheme.starter());
-            if (script != iso_15924::wildcard() or script == iso_15924::uncoded() or script == iso_15924::common() or
-                script == iso_15924::inherited()) {
+        for (auto i = first; i != last; ++i) {
+            hilet script = ucd_get_script(_text[i].grapheme.starter());
+            if (script != iso_15924::wildcard() and script != iso_15924::uncoded() and script != iso_15924::common() and
+                script != iso_15924::inherited()) {
                 first_script = script;
                 break;
             }
@@ -1204,8 +1577,8 @@ private:
         // Close brackets will not be fixed, those will be fixed in the last forward pass.
         auto word_script = iso_15924::common();
         auto previous_script = first_script;
-        for (auto i = std::ssize(_text) - 1; i >= 0; --i) {
-            auto& c = _text[i];
+        for (auto i = last; i != first;) {
+            auto& c = _text[--i];
 
             if (_word_break_opportunities[i + 1] != unicode_break_opportunity::no) {
                 word_script = iso_15924::common();
@@ -1228,7 +1601,7 @@ private:
 
         // Forward pass: fix all common and inherited with previous or first script.
         previous_script = first_script;
-        for (auto i = 0_uz; i != _text.size(); ++i) {
+        for (auto i = first; i != last; ++i) {
             auto& c = _text[i];
 
             if (c.script == iso_15924::common() or c.script == iso_15924::inherited()) {
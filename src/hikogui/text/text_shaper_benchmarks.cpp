@@ -0,0 +1,103 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "text_shaper.hpp"
+#include "../font/font.hpp"
+#include "../path/path.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Make a document of about 1 MB, with paragraphs of about 1000 characters.
+ */
+[[nodiscard]] gstring make_document()
+{
+    auto paragraph = std::string{};
+    while (paragraph.size() < 1000) {
+        paragraph += "The quick brown fox jumps over the lazy dog, while the cat sleeps on the warm windowsill. ";
+    }
+    paragraph += '\n';
+
+    auto r = std::string{};
+    while (r.size() < 1024 * 1024) {
+        r += paragraph;
+    }
+    return to_gstring(r);
+}
+
+[[nodiscard]] text_style make_text_style()
+{
+    // The resources only contain icon fonts, the text is shaped with the glyphs of the fallback font.
+    hilet& font = register_font_file(library_source_dir() / "resources" / "elusiveicons-webfont.ttf");
+    hilet family_id = find_font_family(font.family_name);
+
+    auto sub_styles = std::vector<text_sub_style>{};
+    sub_styles.emplace_back(
+        phrasing_mask::all,
+        iso_639{},
+        iso_15924{},
+        family_id,
+        font_variant{},
+        14.0f,
+        color{1.0f, 1.0f, 1.0f},
+        text_decoration::None);
+    return text_style(sub_styles);
+}
+
+auto const layout_rectangle = aarectangle{point2{0.0f, -100'000'000.0f}, point2{600.0f, 0.0f}};
+constexpr auto sub_pixel_size = extent2{1.0f, 1.0f};
+
+} // namespace
+
+TEST(text_shaper_benchmarks, keystroke)
+{
+    hilet style = make_text_style();
+    hilet document = make_document();
+    hilet typed = to_gstring(std::string_view{"x"});
+
+    // Type in the middle of a paragraph in the middle of the document.
+    hilet index = document.size() / 2;
+    auto typed_document = document;
+    typed_document.insert(index, typed);
+
+    auto shaped_text = text_shaper{document, style, 1.0f, alignment::top_flush(), true};
+    shaped_text.layout(layout_rectangle, 0.0f, sub_pixel_size);
+
+    // Type and remove a character, this is two keystrokes.
+    hilet incremental_rate = benchmark_rate([&] {
+        shaped_text.replace(index, index, typed, style);
+        shaped_text.layout(layout_rectangle, 0.0f, sub_pixel_size);
+        shaped_text.replace(index, index + 1, gstring_view{}, style);
+        shaped_text.layout(layout_rectangle, 0.0f, sub_pixel_size);
+    });
+
+    // Re-shape the whole document on each keystroke.
+    auto toggle = false;
+    hilet full_rate = benchmark_rate([&] {
+        toggle = not toggle;
+        auto tmp = text_shaper{toggle ? typed_document : document, style, 1.0f, alignment::top_flush(), true};
+        tmp.layout(layout_rectangle, 0.0f, sub_pixel_size);
+    });
+
+    // The incremental layout must result in the same lines as a full layout.
+    shaped_text.replace(index, index, typed, style);
+    shaped_text.layout(layout_rectangle, 0.0f, sub_pixel_size);
+    auto expected = text_shaper{typed_document, style, 1.0f, alignment::top_flush(), true};
+    expected.layout(layout_rectangle, 0.0f, sub_pixel_size);
+    ASSERT_EQ(shaped_text.lines().size(), expected.lines().size());
+    for (auto i = 0_uz; i != expected.lines().size(); ++i) {
+        ASSERT_EQ(shaped_text.lines()[i].y, expected.lines()[i].y);
+        ASSERT_EQ(shaped_text.lines()[i].size(), expected.lines()[i].size());
+    }
+
+    benchmark_report("text_shaper 1 MB keystroke incremental", 1'000'000.0 / (incremental_rate * 2.0), "us");
+    benchmark_report("text_shaper 1 MB keystroke full", 1'000'000.0 / full_rate, "us");
+}
@@ -0,0 +1,194 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "text_shaper.hpp"
+#include "../font/font.hpp"
+#include "../path/path.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+struct text_edit {
+    size_t first;
+    size_t last;
+    std::string_view text;
+};
+
+[[nodiscard]] text_style const& get_text_style()
+{
+    static auto const r = [] {
+        // The resources only contain icon fonts, the text is shaped with the glyphs of the fallback font.
+        hilet& font = register_font_file(library_source_dir() / "resources" / "elusiveicons-webfont.ttf");
+        hilet family_id = find_font_family(font.family_name);
+
+        auto sub_styles = std::vector<text_sub_style>{};
+        sub_styles.emplace_back(
+            phrasing_mask::all,
+            iso_639{},
+            iso_15924{},
+            family_id,
+            font_variant{},
+            14.0f,
+            color{1.0f, 1.0f, 1.0f},
+            text_decoration::None);
+        return text_style(sub_styles);
+    }();
+    return r;
+}
+
+// Narrow enough to break the paragraphs into multiple lines.
+auto const layout_rectangle = aarectangle{point2{0.0f, -10'000.0f}, point2{80.0f, 0.0f}};
+constexpr auto sub_pixel_size = extent2{1.0f, 1.0f};
+
+void assert_same_text(text_shaper const& incremental, text_shaper const& expected)
+{
+    ASSERT_EQ(incremental.size(), expected.size());
+    ASSERT_EQ(incremental.text_direction(), expected.text_direction());
+
+    for (auto i = 0_uz; i != expected.size(); ++i) {
+        hilet& c = *incremental.get_it(i);
+        hilet& e = *expected.get_it(i);
+        ASSERT_EQ(c.grapheme, e.grapheme) << "index " << i;
+        ASSERT_EQ(c.script, e.script) << "index " << i;
+        ASSERT_EQ(c.direction, e.direction) << "index " << i;
+        ASSERT_EQ(c.line_nr, e.line_nr) << "index " << i;
+        ASSERT_EQ(c.column_nr, e.column_nr) << "index " << i;
+        ASSERT_NEAR(c.position.x(), e.position.x(), 0.001f) << "index " << i;
+        ASSERT_NEAR(c.position.y(), e.position.y(), 0.001f) << "index " << i;
+
+        // The word and sentence break opportunities.
+        hilet cursor = expected.get_before_cursor(i);
+        ASSERT_EQ(incremental.select_word(cursor), expected.select_word(cursor)) << "index " << i;
+        ASSERT_EQ(incremental.select_sentence(cursor), expected.select_sentence(cursor)) << "index " << i;
+    }
+
+    ASSERT_EQ(incremental.lines().size(), expected.lines().size());
+    for (auto i = 0_uz; i != expected.lines().size(); ++i) {
+        hilet& line = incremental.lines()[i];
+        hilet& e = expected.lines()[i];
+        ASSERT_EQ(line.line_nr, e.line_nr) << "line " << i;
+        ASSERT_EQ(incremental.get_index(line.first), expected.get_index(e.first)) << "line " << i;
+        ASSERT_EQ(incremental.get_index(line.last), expected.get_index(e.last)) << "line " << i;
+        ASSERT_EQ(line.y, e.y) << "line " << i;
+        ASSERT_EQ(line.width, e.width) << "line " << i;
+        ASSERT_EQ(line.paragraph_direction, e.paragraph_direction) << "line " << i;
+        ASSERT_EQ(line.size(), e.size()) << "line " << i;
+        for (auto j = 0_uz; j != e.size(); ++j) {
+            ASSERT_EQ(incremental.get_index(line.columns[j]), expected.get_index(e.columns[j])) << "line " << i;
+        }
+    }
+}
+
+/** Check that editing a text and laying it out gives the same result as shaping the edited text from scratch.
+ *
+ * All the edits are done before a single layout.
+ */
+void check_replace(std::string_view original, std::vector<text_edit> const& edits)
+{
+    hilet& style = get_text_style();
+
+    auto incremental = text_shaper{original, style, 1.0f, alignment::top_flush(), true};
+    incremental.layout(layout_rectangle, 0.0f, sub_pixel_size);
+
+    auto text = to_gstring(original);
+    for (hilet& edit : edits) {
+        incremental.replace(edit.first, edit.last, edit.text, style);
+        text.replace(edit.first, edit.last - edit.first, to_gstring(edit.text));
+    }
+    incremental.layout(layout_rectangle, 0.0f, sub_pixel_size);
+
+    auto expected = text_shaper{text, style, 1.0f, alignment::top_flush(), true};
+    expected.layout(layout_rectangle, 0.0f, sub_pixel_size);
+
+    assert_same_text(incremental, expected);
+}
+
+constexpr auto three_paragraphs = std::string_view{"The quick brown fox.\nJumps over the lazy dog.\nThe end."};
+
+} // namespace
+
+TEST(text_shaper, replace_in_paragraph)
+{
+    check_replace(three_paragraphs, {{27, 31, "under"}});
+    check_replace(three_paragraphs, {{21, 21, "Suddenly it "}});
+}
+
+TEST(text_shaper, replace_insert_paragraph_separator)
+{
+    // Split the middle paragraph.
+    check_replace(three_paragraphs, {{31, 31, "\n"}});
+    // Add an empty paragraph between two paragraphs.
+    check_replace(three_paragraphs, {{21, 21, "\n"}});
+    // Add a paragraph at the start.
+    check_replace(three_paragraphs, {{0, 0, "First.\n"}});
+}
+
+TEST(text_shaper, replace_delete_paragraph_separator)
+{
+    // Join the first two paragraphs.
+    check_replace(three_paragraphs, {{20, 21, ""}});
+    // Join the last two paragraphs, with a separator replaced by a space.
+    check_replace(three_paragraphs, {{45, 46, " "}});
+    // Remove the middle paragraph completely.
+    check_replace(three_paragraphs, {{21, 46, ""}});
+}
+
+TEST(text_shaper, replace_last_paragraph)
+{
+    check_replace(three_paragraphs, {{50, 53, "finish"}});
+    check_replace(three_paragraphs, {{54, 54, " Really."}});
+
+    // A text ending in a paragraph separator has an empty line at the end.
+    constexpr auto trailing = std::string_view{"The quick brown fox.\nJumps over the lazy dog.\n"};
+    check_replace(trailing, {{46, 46, "New"}});
+    check_replace(trailing, {{45, 46, ""}});
+    check_replace(trailing, {{46, 46, "\n"}});
+    check_replace(trailing, {{21, 46, ""}});
+    check_replace(three_paragraphs, {{54, 54, "\n"}});
+    check_replace(three_paragraphs, {{45, 54, ""}});
+}
+
+TEST(text_shaper, replace_multiple_before_layout)
+{
+    // Edits in different paragraphs.
+    check_replace(three_paragraphs, {{4, 9, "slow"}, {49, 49, "very "}});
+    // The second edit is before the first.
+    check_replace(three_paragraphs, {{46, 49, "A"}, {0, 3, "A"}});
+    // Overlapping edits, including paragraph separators.
+    check_replace(three_paragraphs, {{10, 30, "x\ny"}, {9, 14, ""}, {2, 2, "\n\n"}});
+    // Undo an edit.
+    check_replace(three_paragraphs, {{21, 21, "abc\n"}, {21, 25, ""}});
+}
+
+TEST(text_shaper, replace_script_and_bidi)
+{
+    // Latin, Hebrew and Arabic paragraphs; with digits and brackets whose script and direction
+    // depend on the text around them.
+    constexpr auto mixed = std::string_view{
+        "abc (def) 123\n"
+        "\u05e9\u05dc\u05d5\u05dd (\u05e2\u05d5\u05dc\u05dd) 456\n"
+        "789 \u0645\u0631\u062d\u0628\u0627 xyz\n"
+        "(12) end"};
+    hilet mixed_size = to_gstring(mixed).size();
+
+    // Change the script of the first paragraph.
+    check_replace(mixed, {{0, 3, "\u05d0\u05d1\u05d2"}});
+    // Insert right-to-left text in a left-to-right paragraph.
+    check_replace(mixed, {{4, 4, "\u05d0\u05d1\u05d2 "}});
+    // Change a paragraph's direction by removing its first strong character.
+    check_replace(mixed, {{14, 26, ""}});
+    // Join a Hebrew and an Arabic paragraph.
+    check_replace(mixed, {{29, 30, " "}});
+    // Edit the last paragraph, which starts with a bracket.
+    check_replace(mixed, {{mixed_size - 3, mixed_size, "\u0633\u0644\u0627\u0645"}});
+    // Add a paragraph which only has common characters.
+    check_replace(mixed, {{14, 14, "123 (456)\n"}});
+}
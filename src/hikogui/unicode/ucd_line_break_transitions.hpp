@@ -0,0 +1,167 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_line_break_classes.hpp"
+#include "../utility/utility.hpp"
+#include <cstdint>
+#include <utility>
+
+hi_export_module(hikogui.unicode.ucd_line_break_transitions);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+// The first columns of the transition table are the values of unicode_line_break_class.
+static_assert(std::to_underlying(unicode_line_break_class::XX) == 0);
+static_assert(std::to_underlying(unicode_line_break_class::CM) == 1);
+static_assert(std::to_underlying(unicode_line_break_class::BA) == 2);
+static_assert(std::to_underlying(unicode_line_break_class::LF) == 3);
+static_assert(std::to_underlying(unicode_line_break_class::BK) == 4);
+static_assert(std::to_underlying(unicode_line_break_class::CR) == 5);
+static_assert(std::to_underlying(unicode_line_break_class::SP) == 6);
+static_assert(std::to_underlying(unicode_line_break_class::EX) == 7);
+static_assert(std::to_underlying(unicode_line_break_class::QU) == 8);
+static_assert(std::to_underlying(unicode_line_break_class::AL) == 9);
+static_assert(std::to_underlying(unicode_line_break_class::PR) == 10);
+static_assert(std::to_underlying(unicode_line_break_class::PO) == 11);
+static_assert(std::to_underlying(unicode_line_break_class::OP) == 12);
+static_assert(std::to_underlying(unicode_line_break_class::CP) == 13);
+static_assert(std::to_underlying(unicode_line_break_class::IS) == 14);
+static_assert(std::to_underlying(unicode_line_break_class::HY) == 15);
+static_assert(std::to_underlying(unicode_line_break_class::SY) == 16);
+static_assert(std::to_underlying(unicode_line_break_class::NU) == 17);
+static_assert(std::to_underlying(unicode_line_break_class::CL) == 18);
+static_assert(std::to_underlying(unicode_line_break_class::NL) == 19);
+static_assert(std::to_underlying(unicode_line_break_class::GL) == 20);
+static_assert(std::to_underlying(unicode_line_break_class::AI) == 21);
+static_assert(std::to_underlying(unicode_line_break_class::BB) == 22);
+static_assert(std::to_underlying(unicode_line_break_class::HL) == 23);
+static_assert(std::to_underlying(unicode_line_break_class::SA) == 24);
+static_assert(std::to_underlying(unicode_line_break_class::JL) == 25);
+static_assert(std::to_underlying(unicode_line_break_class::JV) == 26);
+static_assert(std::to_underlying(unicode_line_break_class::JT) == 27);
+static_assert(std::to_underlying(unicode_line_break_class::NS) == 28);
+static_assert(std::to_underlying(unicode_line_break_class::ZW) == 29);
+static_assert(std::to_underlying(unicode_line_break_class::ZWJ) == 30);
+static_assert(std::to_underlying(unicode_line_break_class::B2) == 31);
+static_assert(std::to_underlying(unicode_line_break_class::IN) == 32);
+static_assert(std::to_underlying(unicode_line_break_class::WJ) == 33);
+static_assert(std::to_underlying(unicode_line_break_class::ID) == 34);
+static_assert(std::to_underlying(unicode_line_break_class::EB) == 35);
+static_assert(std::to_underlying(unicode_line_break_class::CJ) == 36);
+static_assert(std::to_underlying(unicode_line_break_class::H2) == 37);
+static_assert(std::to_underlying(unicode_line_break_class::H3) == 38);
+static_assert(std::to_underlying(unicode_line_break_class::SG) == 39);
+static_assert(std::to_underlying(unicode_line_break_class::CB) == 40);
+static_assert(std::to_underlying(unicode_line_break_class::RI) == 41);
+static_assert(std::to_underlying(unicode_line_break_class::EM) == 42);
+
+constexpr auto ucd_line_break_action_width = 2_uz;
+
+constexpr uint8_t ucd_line_break_transitions[61][46] = {
+    {  4,  4,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,  0, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,  4,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,  0, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41, 64,105},
+    {  5,  8,  8, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 24, 92,116, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  6,  6, 10, 14, 14, 18, 22, 26, 30,  6, 34, 38, 42, 46, 50, 54, 58, 62, 66, 14, 70,  6, 74, 78,  6, 82, 86, 90, 26, 94,  2, 98, 26, 70,102,106, 26, 86, 90,  6,110,114,102, 42, 66,106},
+    {  6,  6, 10, 12, 14, 18, 22, 26, 30,  6, 34, 38, 42, 46, 50, 54, 58, 62, 66, 14, 70,  6, 74, 78,  6, 82, 86, 90, 26, 94,  2, 98, 26, 70,102,106, 26, 86, 90,  6,110,114,102, 42, 66,106},
+    {  5,  5,  9, 12, 12, 16, 20, 24, 29,  5, 33, 37, 41, 44, 48, 53, 56, 61, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 25, 92,  1, 97, 25, 68,101,105, 25, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5, 24,  8, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,120, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 28,  8, 12, 12, 16,124, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92, 28, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 32,  8, 12, 12, 16, 20, 24, 28,  4, 33, 37, 43, 44, 48, 52, 56, 60, 64, 12, 68,  4, 73, 76,  4, 80, 84, 88, 24, 92,128, 97, 24, 68,100,104, 24, 84, 88,  4,109,113,100, 43, 64,104},
+    {  4, 36,  8, 12, 12, 16, 20, 24, 28,  4, 33, 37, 43, 44, 48, 52, 56, 60, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,132, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 43, 64,105},
+    {  4, 40,  8, 12, 12, 16,136, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92, 40, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 44,  8, 12, 12, 16,140, 24, 28,  4, 33, 37, 41, 44, 48, 52, 56, 60, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,144, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41, 64,105},
+    {  4, 48,  8, 12, 12, 16, 20, 24, 28,  4, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,148, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41, 64,105},
+    {  5, 52,  8, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 60, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 24, 92,152, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5, 56,  8, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 76,  5, 81, 85, 89, 24, 92,156, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 60,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40,160,164, 52,168, 60,172, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,176, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41,172,105},
+    {  5, 64,  8, 12, 12, 16,140, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,180, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 68,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92, 68, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 72,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,184, 96, 24, 68,100,104, 24, 84, 88,  4,109,112,100, 40, 64,104},
+    {  4, 76, 72, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 72, 56, 60, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,188, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41, 64,105},
+    {  5, 80,  8, 12, 12, 16, 20, 24, 28,  5, 33, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 80, 84, 89, 24, 92,192, 97, 24, 68,101,105, 24, 84, 88,  5,109,113,101, 41, 64,105},
+    {  5, 84,  8, 12, 12, 16, 20, 24, 28,  5, 33, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 84, 88, 24, 92,196, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5, 88,  8, 12, 12, 16, 20, 24, 28,  5, 33, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 88, 24, 92,200, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5,  5,  9, 12, 12, 16, 92, 25, 29,  5, 33, 37, 41, 45, 49, 53, 57, 61, 65, 12, 69,  5, 73, 77,  5, 81, 85, 89, 25, 92,  1, 97, 25, 69,101,105, 25, 85, 89,  5,109,113,101, 41, 65,105},
+    {  5, 96,  8, 12, 12, 16,204, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,208, 96, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5,100,  8, 12, 12, 16, 20, 24, 28,  5, 33, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,212, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5,104,  8, 12, 12, 16, 20, 24, 28,  5, 33, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,216, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,100, 41, 64,105},
+    {  5,108,  9, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 53, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 25, 92,220, 97, 25, 68,101,105, 25, 85, 89,  5,109,113,101, 41, 64,105},
+    {  5,112,  8, 12, 12, 16, 20, 24, 28,  5, 33, 37, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,224, 97, 24, 68,101,105, 24, 85, 89,  5,109, 24,101, 41, 64,105},
+    {  4,  8,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,116, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 24,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,120, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  5,  5,  9, 12, 12, 16,124, 24, 29,  5, 33, 37, 40, 44, 48, 53, 56, 61, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 25, 92,  1, 97, 25, 68,101,105, 25, 85, 89,  5,109,113,101, 40, 64,105},
+    {  4, 32,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,128, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 36,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,132, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,  4,  8, 12, 12, 16,136, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,  0, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  5,  5,  9, 12, 12, 16,140, 24, 29,  5, 33, 37, 41, 44, 48, 53, 56, 61, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 24, 92,  1, 97, 25, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 44,  8, 12, 12, 16,140, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,144, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 48,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,148, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 52,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,152, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 56,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,156, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,160,  8, 12, 12, 16,140, 24, 28,  4, 32, 36, 41, 44, 48, 52, 56, 60, 64, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,228, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41, 64,105},
+    {  4,164,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 41,160,164, 52,168, 60,172, 12, 68,  4, 73, 76,  4, 81, 85, 89, 24, 92,232, 97, 24, 68,101,105, 24, 85, 89,  4,109,113,101, 41,172,105},
+    {  5,168,  8, 12, 12, 16, 20, 24, 28,  5, 32, 36, 41,160,164, 52,168, 60,172, 12, 68,  5, 73, 76,  5, 81, 85, 89, 24, 92,236, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41,172,105},
+    {  5,172,  8, 12, 12, 16,140, 24, 28,  5, 32, 36, 41, 44, 48, 52, 56, 61, 64, 12, 68,  5, 73, 77,  5, 81, 85, 89, 24, 92,240, 97, 24, 68,101,105, 24, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 60,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40,160,164, 52,168, 60,172, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,176, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40,172,104},
+    {  4, 64,  8, 12, 12, 16,140, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,180, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 72,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,184, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 76, 72, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 72, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,188, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 80,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,192, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 84,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,196, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4, 88,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,200, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  5,  5,  9, 12, 12, 16,204, 24, 29,  5, 33, 37, 41, 44, 48, 53, 56, 61, 64, 12, 69,  5, 73, 77,  5, 81, 85, 89, 25, 92,  1, 96, 25, 68,101,105, 25, 85, 89,  5,109,113,101, 41, 64,105},
+    {  4, 96,  8, 12, 12, 16,204, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,208, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,100,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,212, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,104,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,216, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,108,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,220, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,112,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,224, 96, 24, 68,100,104, 24, 84, 88,  4,108, 24,100, 40, 64,104},
+    {  4,160,  8, 12, 12, 16,140, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,228, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+    {  4,164,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40,160,164, 52,168, 60,172, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,232, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40,172,104},
+    {  4,168,  8, 12, 12, 16, 20, 24, 28,  4, 32, 36, 40,160,164, 52,168, 60,172, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,236, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40,172,104},
+    {  4,172,  8, 12, 12, 16,140, 24, 28,  4, 32, 36, 40, 44, 48, 52, 56, 60, 64, 12, 68,  4, 72, 76,  4, 80, 84, 88, 24, 92,240, 96, 24, 68,100,104, 24, 84, 88,  4,108,112,100, 40, 64,104},
+};
+
+} // namespace detail
+
+/** The symbols of the line break state machine, after the values of unicode_line_break_class.
+ *
+ * These are used for the rules that need other properties of a character than its line break class.
+ */
+constexpr uint8_t ucd_line_break_symbol_OP_FWH = 43;
+constexpr uint8_t ucd_line_break_symbol_CP_FWH = 44;
+constexpr uint8_t ucd_line_break_symbol_ID_ExtPict_Cn = 45;
+
+/** The action of the line break state machine before the next character.
+ *
+ * The actions other than `no`, `yes` and `mandatory` prevent a break when their condition is true.
+ */
+enum class unicode_line_break_action : uint8_t {
+    no = 0,
+    yes = 1,
+    mandatory = 2,
+    LB25 = 3,
+};
+
+/** Get a transition of the line break state machine.
+ *
+ * The classes AI, SG, XX, CJ and SA are resolved by the state machine as in rule LB1.
+ * Except for the SA characters in the general categories Mn and Mc, which must be passed as CM.
+ *
+ * @param state The state after the previous character; the start state is zero.
+ * @param symbol The line break class, or one of the `ucd_line_break_symbol_*` of the next character.
+ * @return The action before the next character, and the state after the next character.
+ */
+[[nodiscard]] constexpr std::pair<unicode_line_break_action, uint8_t>
+ucd_get_line_break_transition(uint8_t state, uint8_t symbol) noexcept
+{
+    auto const transition = detail::ucd_line_break_transitions[state][symbol];
+    return {
+        static_cast<unicode_line_break_action>(transition & ((1 << detail::ucd_line_break_action_width) - 1)),
+        static_cast<uint8_t>(transition >> detail::ucd_line_break_action_width)};
+}
+
+}} // namespace hi::v1
+
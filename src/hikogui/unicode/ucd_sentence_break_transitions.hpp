@@ -0,0 +1,76 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_sentence_break_properties.hpp"
+#include "../utility/utility.hpp"
+#include <cstdint>
+#include <utility>
+
+hi_export_module(hikogui.unicode.ucd_sentence_break_transitions);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+// The columns of the transition table are the values of unicode_sentence_break_property.
+static_assert(std::to_underlying(unicode_sentence_break_property::Other) == 0);
+static_assert(std::to_underlying(unicode_sentence_break_property::Sp) == 1);
+static_assert(std::to_underlying(unicode_sentence_break_property::LF) == 2);
+static_assert(std::to_underlying(unicode_sentence_break_property::CR) == 3);
+static_assert(std::to_underlying(unicode_sentence_break_property::STerm) == 4);
+static_assert(std::to_underlying(unicode_sentence_break_property::Close) == 5);
+static_assert(std::to_underlying(unicode_sentence_break_property::SContinue) == 6);
+static_assert(std::to_underlying(unicode_sentence_break_property::ATerm) == 7);
+static_assert(std::to_underlying(unicode_sentence_break_property::Numeric) == 8);
+static_assert(std::to_underlying(unicode_sentence_break_property::Upper) == 9);
+static_assert(std::to_underlying(unicode_sentence_break_property::Lower) == 10);
+static_assert(std::to_underlying(unicode_sentence_break_property::Sep) == 11);
+static_assert(std::to_underlying(unicode_sentence_break_property::Format) == 12);
+static_assert(std::to_underlying(unicode_sentence_break_property::OLetter) == 13);
+static_assert(std::to_underlying(unicode_sentence_break_property::Extend) == 14);
+
+constexpr auto ucd_sentence_break_action_width = 2_uz;
+
+constexpr uint8_t ucd_sentence_break_transitions[10][15] = {
+    {  5,  5,  1,  9, 13,  5,  5, 17,  5, 21, 21,  1,  5,  5,  5},
+    {  4,  4,  0,  8, 12,  4,  4, 16,  4, 20, 20,  0,  4,  4,  4},
+    {  5,  5,  0,  9, 13,  5,  5, 17,  5, 21, 21,  1,  5,  5,  5},
+    {  5, 24,  0,  8, 12, 12,  4, 16,  5, 21, 21,  0, 12,  5, 12},
+    {  6, 28,  0,  8, 12, 32,  4, 16,  4, 21, 20,  0, 16,  5, 16},
+    {  4,  4,  0,  8, 12,  4,  4, 36,  4, 20, 20,  0, 20,  4, 20},
+    {  5, 24,  0,  8, 12,  5,  4, 16,  5, 21, 21,  0, 24,  5, 24},
+    {  6, 28,  0,  8, 12,  6,  4, 16,  6, 21, 20,  0, 28,  5, 28},
+    {  6, 28,  0,  8, 12, 32,  4, 16,  6, 21, 20,  0, 32,  5, 32},
+    {  6, 28,  0,  8, 12, 32,  4, 16,  4, 20, 20,  0, 36,  5, 36},
+};
+
+} // namespace detail
+
+/** The action of the sentence break state machine before the next character.
+ *
+ * The actions other than `no` and `yes` prevent a break when their condition is true.
+ */
+enum class unicode_sentence_break_action : uint8_t {
+    no = 0,
+    yes = 1,
+    SB8 = 2,
+};
+
+/** Get a transition of the sentence break state machine.
+ *
+ * @param state The state after the previous character; the start state is zero.
+ * @param property The sentence break property of the next character.
+ * @return The action before the next character, and the state after the next character.
+ */
+[[nodiscard]] constexpr std::pair<unicode_sentence_break_action, uint8_t>
+ucd_get_sentence_break_transition(uint8_t state, unicode_sentence_break_property property) noexcept
+{
+    auto const transition = detail::ucd_sentence_break_transitions[state][std::to_underlying(property)];
+    return {
+        static_cast<unicode_sentence_break_action>(transition & ((1 << detail::ucd_sentence_break_action_width) - 1)),
+        static_cast<uint8_t>(transition >> detail::ucd_sentence_break_action_width)};
+}
+
+}} // namespace hi::v1
+
@@ -0,0 +1,2335 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_general_categories.hpp"
+#include "ucd_grapheme_cluster_breaks.hpp"
+#include "ucd_line_break_classes.hpp"
+#include "ucd_east_asian_widths.hpp"
+#include "ucd_word_break_properties.hpp"
+#include "ucd_sentence_break_properties.hpp"
+#include "ucd_bidi_classes.hpp"
+#include "ucd_scripts.hpp"
+#include "../utility/utility.hpp"
+#include "../i18n/i18n.hpp"
+#include <cstdint>
+#include <bit>
+#include <iterator>
+#include <limits>
+
+hi_export_module(hikogui.unicode.ucd_text_properties);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+constexpr auto ucd_text_properties_chunk_size = 128_uz;
+constexpr auto ucd_text_properties_index_width = 9_uz;
+constexpr auto ucd_text_properties_indices_size = 8704_uz;
+constexpr auto ucd_text_properties_record_index_width = 11_uz;
+constexpr auto ucd_text_properties_general_category_shift = 0_uz;
+constexpr auto ucd_text_properties_general_category_width = 5_uz;
+constexpr auto ucd_text_properties_grapheme_cluster_break_shift = 5_uz;
+constexpr auto ucd_text_properties_grapheme_cluster_break_width = 4_uz;
+constexpr auto ucd_text_properties_line_break_class_shift = 9_uz;
+constexpr auto ucd_text_properties_line_break_class_width = 6_uz;
+constexpr auto ucd_text_properties_east_asian_width_shift = 15_uz;
+constexpr auto ucd_text_properties_east_asian_width_width = 3_uz;
+constexpr auto ucd_text_properties_word_break_property_shift = 18_uz;
+constexpr auto ucd_text_properties_word_break_property_width = 5_uz;
+constexpr auto ucd_text_properties_sentence_break_property_shift = 23_uz;
+constexpr auto ucd_text_properties_sentence_break_property_width = 4_uz;
+constexpr auto ucd_text_properties_bidi_class_shift = 27_uz;
+constexpr auto ucd_text_properties_bidi_class_width = 5_uz;
+constexpr auto ucd_text_properties_script_shift = 32_uz;
+constexpr auto ucd_text_properties_script_width = 10_uz;
+
+static_assert(std::has_single_bit(ucd_text_properties_chunk_size));
+
+constexpr uint8_t ucd_text_properties_indices_bytes[9808] = {
+     0,  0, 64, 64, 48, 32, 20, 12,  7,  4,  2, 65, 64,176, 96, 52, 28, 15,  8,  4, 66, 65, 48,160, 84, 44, 23, 12,  6, 67, 65,176,
+   224,116, 60, 31, 16,  8, 68, 66, 49, 32,148, 76, 39, 20, 10, 69, 34,145, 80,172, 88, 45, 23, 11,198,  3, 17,144,204,104, 53, 27,
+    13,199,  3,145,208,236,120, 61, 31, 15,200,  4, 18, 17, 12,136, 69, 35, 17,201,  4,146, 81, 44,152, 77, 39, 19,137,229,  2,137,
+    68,164, 83, 42, 21, 74,197,114,193,100,180, 91, 46, 23, 75,197,243,  1,132,196, 99, 50, 25, 12,134, 67, 33,144,200,100, 50, 25,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 83, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134,
+    67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 51, 25,204,230,115, 57,156,206,103, 51,154, 13, 38,147, 81,172,216,109, 55, 27,206,  7, 19,145,
+   204,232,117, 59, 29,207,  7,147,209,236,248,118, 59,158, 15, 39,163,217,240,236,119, 60, 30, 79, 71,179,225,216,238,120, 60,158,
+   143,103,195,177,220,240,121, 61, 30,207,135, 99,185,224,242,122, 61,159, 14,199,115,193,228,244,123, 62, 29,142,231,131,201,232,
+   246,124, 59, 29,207,  7,147,209,236,248,118, 59,158, 15, 39,163,217,240,236,119, 60, 30, 79, 71,179,225,216,238,120, 60,158,143,
+   103,195,177,220,240,125, 63, 31,143,199,227,241,248,252,126, 63, 31,143,199,227,241,248,252,126, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,204,134, 68,  2,  5,  4,131, 66, 33, 16,168,100, 58, 33, 18,138,
+    69,163, 17,168,228,122, 65, 34,146, 73,165, 18,169,100,186, 93, 48,153, 77, 38,211,137,212,242,125, 64,161, 81, 40,212,136,245,
+    42,153, 78,168, 84,170,149,106,197,106,185, 94,143, 88, 44, 81,235, 37,154,209,106,143, 91, 45,215, 11,149,210,237,120,143, 94,
+   175,151,236,  4,123,  5,132,195, 98, 49, 24,140, 70, 35, 17,136,197, 99, 49, 24,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,200,100,178, 89, 44,150, 83, 45,152,201,102,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,103, 51,153,204,246,130, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143,104,180, 90, 45, 22,147, 77,168,213, 71,163,209,232,246,179, 93,176,217,109, 54,155, 77,
+   166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,218,
+   109, 54,155, 77,166,211,105,180,218,109, 54,155, 77,166,211,105,180,219,109, 54,155, 77,166,211,105,184,220,110, 55, 91,200,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,223,112, 56, 92, 78, 55, 27,145, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143,114,185,145,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,206,232,116,186,157,110,199,107,185,222,143,120, 60, 94,
+    79, 55,163,213,236,247,124, 62, 31, 15,135,203,233, 30,143, 71,163,209,232,244,122, 61,246,143,126, 63, 95,200,244,123,253, 30,
+   143, 71,192, 17,232,244,122, 61, 31,  1,129, 64,224,136,244,122, 61, 30,143,130,193,160,232,248, 68, 37, 30,143,133, 66,225,144,
+   216,116, 62, 33, 17,137, 68,226,145, 88,180, 94, 49, 25,141, 70,227,145,216,244,126, 65, 33,135,195,225,240,248,124, 62, 31, 34,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,
+   144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134,
+    67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 36,140,200,100, 50, 25, 12,134, 67, 33,
+   144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,146, 72,100,146,153,
+    12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,
+   200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 36,152,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,
+   134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,
+   100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,201, 39,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40, 50, 25, 12,134, 73, 76,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 42,
+    50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67,
+    33,144,200,100, 50, 25, 12,134, 67, 33,146, 86,100, 50, 25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,200,100, 50,
+    25, 12,134, 67, 33,144,200,100, 50, 25, 12,134, 67, 33,144,201, 44,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,
+   162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74,
+    37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162,
+    81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37,
+    18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81,
+    40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,
+   148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137,
+    68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148,
+    74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,
+   162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74,
+    37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162,
+    81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37,
+    18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81,
+    40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,
+   137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 40,148, 74, 37, 18,137, 68,162, 81, 42,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+   150,203,165,243,  9,116,186, 93, 46,151, 75,165,210,233,116,186, 93, 46,151, 75,165,210,233,116,186, 93, 46,151, 75,165,210,233,
+   116,186, 93, 46, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,
+   122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,
+   163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122,
+    61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,
+   209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61,
+    30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,
+   232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,
+   143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,
+   244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143, 71,163,209,232,244,122, 61, 30,143,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,255, 49,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127,
+    63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,
+   249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,
+   159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,
+   252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,
+   207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,
+   254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,
+   231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,
+   127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,
+   243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,255, 49,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint8_t ucd_text_properties_record_indices_bytes[53872] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  1,  0, 48,  8,  1, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0, 12,  1,128, 48,  7,  1,  0, 36,  5,  0,176, 24,  3, 64,112, 15,  2,  0, 68,  7,  1, 32, 38,  5,  0,
+   168, 22,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 12,  1,144, 52,  6,128,208,  9,  1,192,108, 13,129,176, 54,  6,
+   192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,  0, 56,
+     4, 64,232, 30,  3,160,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,  0, 64,  8, 64,208,  0,  0,  0,  0,  0,  0,  0,  0,  8,128,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4, 96,144, 18,
+   128,192, 76,  3,  1, 56, 40,  5, 32,168, 21,130,192, 52, 11, 65,112, 29,  5,224,192, 24,131, 16,100, 12,193, 64, 52,  5, 32,196,
+    21,131, 80,108, 13,129,176, 36,  6,224,220, 27,131,112,110, 13,193,192, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  7,  0,
+   220, 27,131,112,110, 13,193,184, 57,  7,  0,220, 27,131,112,110, 13,193,192, 58,  7, 64,232, 29,131,176,118, 14,193,208, 59,  7,
+    64,232, 29,  3,176,116, 14,129,216, 59,  7, 64,236, 29,  3,160,118, 14,193,216, 57,  7, 64,232, 29,  3,176,116, 14,193,208, 59,
+     6,224,232, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,232, 27,131,160,110, 14,193,184,
+    59,  6,224,236, 27,131,160,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,192, 58,  6,224,236, 27,131,160,110, 14,193,
+   184, 59,  6,224,232, 28,  3,160,110, 14,193,184, 59,  7, 64,220, 29,131,112,118, 13,193,216, 56,  7, 64,224, 29,  3,112,116, 13,
+   193,216, 55,  7, 64,232, 28,  3,160,110, 14,129,184, 59,  6,224,236, 28,  3,160,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,192, 58,  6,224,236, 27,131,160,110, 14,193,184, 59,  6,224,236, 27,131,176,
+   110, 14,193,184, 59,  6,224,220, 29,131,112,118, 13,193,216, 59,  7, 96,220, 27,131,176,110, 14,193,184, 55,  7, 96,220, 27,131,
+   112,118, 14,193,184, 55,  6,224,220, 29,131,112,110, 14,193,184, 55,  6,224,236, 29,131,176,110, 13,193,216, 55,  6,224,236, 27,
+   131,176,110, 14,193,184, 55,  7, 96,220, 29,131,176,110, 14,193,184, 55,  7, 96,220, 27,131,112,118, 13,193,216, 55,  6,224,236,
+    29,131,192,110, 14,193,216, 59,  7,128,240, 30,  3,192,110, 15, 65,216, 55,  7,160,236, 27,131,208,118, 13,193,208, 55,  7, 64,
+   220, 29,  3,112,116, 13,193,208, 55,  7, 64,220, 29,  3,112,116, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,
+   224,236, 27,131,176,110, 14,193,184, 59,  7, 96,220, 30,131,176,110, 14,193,184, 55,  6,224,236, 27,131,176,110, 14,193,184, 59,
+     6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184,
+    59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  6,224,236, 27,131,176,118, 14,193,216, 59,  7, 96,236, 27,131,112,118, 13,193,184, 59,  7, 96,220, 29,131,112,110, 13,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7, 96,232, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118,
+    14,193,216, 59,  7, 96,232, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,120, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,252,
+    31,132,  0,128, 16,  2,  0, 64,  8, 33,  4, 33,  4, 32,134, 16,129,248, 68,  8,161, 16, 34,  4, 64,138, 17,  1,248, 63,  8,193,
+     0, 33,  4, 32,132, 16,130, 16, 66,  5, 32,164, 20,130,144,142, 10, 66, 16, 72,  7,192,248, 31,  3,224,124, 16,130, 16, 66,  8,
+    65,  8, 36,132,144,126, 16,130,  0, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,
+     9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80,
+    74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130,
+    80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,
+   130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 75,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,150,
+    18,194, 88, 75,  9, 97, 44, 37,132,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9,129, 52, 38,  4,208,
+   126, 19,130, 96, 77,  9,225, 60, 40,  4,208,154, 19, 66,136, 76,  9,225, 60, 39,132,240,156, 17,194, 96, 82,  9,129, 48, 38,  4,
+   240,152, 19,194, 96, 76,  9,161, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 39,
+   133, 48,166, 20,194,152, 83, 10, 97, 76, 38,  4,192,154, 19, 66,104, 77,  9,161, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 38,133, 64,168, 21,  2,160, 84, 10,129, 80, 38,132,208,154, 19, 66,104, 76,  9,161,
+    52, 38,  4,192,152, 19, 66,104, 77,  9,129, 52, 38,  4,208,152, 19, 66, 96, 77,  9,129, 52, 42,133, 96,170, 21,130,168, 86, 10,
+   161, 88, 42,133, 96,170, 21,130,168, 86,  9,161, 52, 38,132,208,152, 19, 66,184, 76,  9,161, 48, 38,  4,208,154, 19,  2, 96, 76,
+    11,  1,100, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11, 33,100, 44,133,144,178, 22, 66,200,
+    89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,
+   200, 89, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,
+   130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 97,104, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182,
+    22,194,216, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,
+   176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 46,  5,208,186, 23,130,240, 93, 11,225,124, 44,  5,
+   176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,
+     5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108,
+    44,  5,176,176, 22,194,192, 91, 11,  1, 96, 45,133,128,182, 22,  2,216, 88, 11, 97, 96, 45,133,128,182, 22,  2,216, 91, 11,  1,
+   108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,
+     1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91,
+    11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192,
+    91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,
+   192, 91,  9,225,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 79,  9,225,132, 49,  6, 32,196,
+    24,195, 16,100, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,152, 51,132,
+   240,158, 26,  3, 64,105,  9,225,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,
+     6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168,
+    53,  6,160,212, 26,131, 88,106, 13,129,168, 53,  6,192,212, 26,131,104,106,  9,225, 60, 39,132,240,158, 19,194,120, 79, 13,193,
+   184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,
+   193,184, 55,  4,240,158, 19,194,120,110, 13,193,184, 55,  6,240,224, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    14, 33,196, 56,135, 16,226, 28,131,152,115, 14,129,212, 58,135, 96,238, 30,  3,200,121, 15, 65,232, 61,  7,160,244, 30,131,208,
+   122, 15, 65,232, 61,  7,176,248, 31, 67,232,126, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 16,  1,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,133,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,131,208,122, 15, 65,232, 61,  7,160,244,
+    30,131,208,122, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 58,136, 33,  6, 33,  3,248,127, 11,193,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,
+   252, 63,135,240,250, 31,195,208,122, 15, 65,232, 61,  7,160,244, 28,131,200,122, 15, 65,232, 61,  7,160,244, 33, 68, 40,122, 15,
+    65,228, 61,  7,160,244, 30,131,248,127, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 63,135,240,254, 33,196, 56,127,
+    17,  2, 32, 68,  8,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 66,120,138, 17, 98, 48, 69,136,177, 22, 34,196, 88,
+   139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,
+     4, 96,140, 17,130, 48, 70,  4,240,158, 34,196, 88,139, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,
+   209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,
+   136,209, 26, 35, 68,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 52, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 72,  9,  1, 32, 36,  4,128,144, 18,  2,
+    64, 72,  9,  1, 32, 36,  4,128,144, 18,  2, 64, 72,  9,  1, 32, 36,  4,128,144, 18,  2, 64, 72,  9,  1, 32, 36,  4,128,144, 18,
+     2, 64, 72,  9, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 36, 36,132,152,148, 18,162, 88, 73,  4,240,158, 36, 68,184,151,
+    19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,200,
+   153, 19, 34,100, 77,  9,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 52, 38, 68,200,153, 19, 66,100, 76,137,145, 50, 38, 66,
+   120, 79, 19, 98,108, 77,137,177, 54, 38,196,216,156, 19, 98,112, 77,137,177, 54, 39,  4,224, 79, 19,162,116, 78,137,209, 58, 39,
+    68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,116, 78,137,209, 58, 39, 68,232,157, 19,162,120, 79,  9,224,158,
+    19,196,248, 79, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,132,240,158, 19,194,120, 79, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 20,  1,252, 63,135,
+   240,254, 31,195,248, 79, 14, 33,196, 39,132,240,158, 19,194,120, 79, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,226, 20, 61,  7,160,244, 30,131,208,122, 15, 65,
+   232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 57,  7,160,244, 30,131,208,122, 15,
+    65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122,
+    20, 34,132, 80,138, 33, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,
+   163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197,
+    24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 80,138, 33, 66, 40,197, 16,162, 20, 66,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,136, 81, 10, 33, 68, 40, 69, 16,162, 20, 97,120, 47,  5,224,188, 40, 69,  8,161, 20, 98,140, 81,138, 49, 70,
+    40,197, 24,163, 20, 98,140, 80,138, 17, 72, 41,  5, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,194,156, 81,138, 49,
+    70, 40,197, 24,163, 20, 98,140, 81,138, 49, 70, 40,197, 24,163, 21,  2,164, 85, 10,160,158, 42,  5, 64,168, 21,  2,160, 84, 10,
+   129, 80, 19,194,120,168, 21,  1, 60, 39,138,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84,
+    10,129, 80, 42,  5, 64,168, 21,  1, 60, 84, 10,129, 80, 42,  5, 64,168, 21,  1, 60, 84,  4,240,158, 19,197, 64,168, 21,  2,160,
+    39,132,241, 82, 42,  5, 88,170, 21, 66,164, 84,138,145, 82, 19,194,120,170, 21, 65, 60, 39,138,161, 84, 42, 69, 64, 79,  9,225,
+    60, 39,132,240,158, 19,194,120,171,  9,225, 60, 39,132,241, 80, 42,  2,120,168, 21,  2,160, 84,138,144,158, 19,197, 96,172, 21,
+   130,176, 86, 10,193, 88, 43,  5, 96,172, 21,  2,160, 86,138,209, 92, 43,133,112,174, 21,194,188, 88, 11, 17, 80, 44,133, 72, 79,
+     9,226,204, 89,139, 64,158, 45, 69,168,181, 22,162,212, 90,132,240,158, 19,194,120,181, 22,161, 60, 39,139, 81,106, 45, 69,168,
+   181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,161, 60, 90,139, 81,106, 45, 69,
+   168,181, 22,161, 60, 90,139, 80,158, 45, 69,168, 79, 22,162,212, 39,132,241,102, 19,197,160,180, 22,130,204, 89,132,240,158, 19,
+   194,120,179, 22, 97, 60, 39,139, 49,102, 44,194,120, 79,  9,226,204, 39,132,240,158, 19,194,120, 79,  9,226,212, 90,139, 81,106,
+    19,197,168, 79,  9,225, 60, 39,132,240,158, 19,197,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22, 98,204, 90,139, 81,
+   106, 44,197,184, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,226,224, 92, 11,144,158, 46,133,208,186, 23, 66,232, 93, 11,
+   161,116, 46,130,120,186, 23, 66,232, 39,139,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93,
+    11,161,116, 46,133,208,186, 23, 65, 60, 93, 11,161,116, 46,133,208,186, 23, 65, 60, 93, 11,160,158, 46,133,208,186, 23, 66,232,
+    39,132,241,112, 46,133,200,185, 23, 34,224, 92, 11,129,112, 46,  2,120,184, 23,  2,228, 39,139,145,114, 46,  2,120, 79, 23, 65,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 23, 66,232, 92, 11,128,158, 19,197,216,187, 23,
+    98,236, 93,139,177,118, 46,197,216,187, 23,130,244, 39,132,240,158, 19,194,120, 79,  9,226,232, 92, 11,129,112, 46,  5,192,184,
+     9,226,248, 95,139,240,158, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 19,194,120,192, 24,  1, 60, 39,140,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  1, 60, 96, 12,  1,128, 48,  6,
+     0,192, 24,  1, 60, 96, 12,  0,158, 48,  6,  0,192, 24,  3,  0, 39,132,241,124, 48,  6,  8,190, 23,226,248, 95, 11,225,124, 19,
+   194,120,191, 23,225, 60, 39,139,241,126, 47,130,120, 79,  9,225, 60, 39,132,240,158, 47,133,240,193,  9,225, 60, 39,132,241,128,
+    48,  2,120,192, 24,  3,  0, 95, 11,224,158, 19,198, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 99,  0, 98, 12, 65,
+   136, 49,  6, 32,196,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 98,140, 96,158, 49,134, 48,198, 24,195, 24, 99,  4,
+   240,158, 19,198, 48,198, 24,193, 60, 99, 12, 97,140, 49,130,120, 79,  9,227, 24, 99,  4,241,140, 19,198, 48,198,  9,225, 60, 39,
+   140, 97,140, 19,194,120, 79, 24,195, 24, 99,  4,240,158, 19,198, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24,
+    39,132,240,158, 19,198, 56,200, 24,163, 32,100,  4,240,158, 19,198, 64,200, 25,  1, 60,100, 12,129,144, 49, 66,120, 79, 24,193,
+    60, 39,132,240,158, 19,194,120,199,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,198, 72,201, 25,
+    35, 36,100,140,145,146, 50, 70, 72,201, 25, 67, 40,101, 12,177,150, 50,198, 88,203, 25, 99, 48,101,132,240,158, 19,194,120, 79,
+    25,163, 56,103, 12,225,154, 51,198,120,207, 25,227, 60,103,140,241,158, 19,198,120,207, 25,225, 60,103,140,241,158, 51,198,120,
+   207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,225, 60,103,140,241,158, 51,198,
+   120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60, 39,132,241,154, 51,198,104,205, 25,163, 56,103, 12,225,156, 19,
+   198,104,205, 25,161, 60,102,140,209,154, 51, 66,120, 79,  9,225, 60, 39,132,240,158, 51, 70,104, 79, 25,227, 60,103,132,240,158,
+    51,194,120, 79, 25,227, 60,102,140,208,158, 19,198,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208,  9,225, 60, 39,132,240,
+   158, 19,194,120,209, 26, 67, 72,105, 13, 33,164, 52,134,144,211, 26,131, 84,107, 13, 97,174, 53,  6,160,212, 26,131, 80,106, 13,
+    65,168, 19,198,160,212, 26,129, 60,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106,
+    13, 65,168, 53,  6,160,212, 26,129, 60,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 64,158, 53,  6,160,212, 26,131, 80,
+    39,132,241,170, 53,  6,176,216, 26,195, 88,108,141, 97,172, 19,198,192,214, 26,193, 60,107, 13, 97,170, 53, 66,120, 79,  9,225,
+    60, 39,132,240,158, 54, 70,200, 79,  9,225, 60, 39,132,240,158, 53,  6,160, 79, 26,131, 80,106,141, 80,158, 19,198,208,218, 27,
+    67,104,109, 13,161,180, 54,134,208,218,  9,227, 80,106, 13, 96,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    27, 99,108,110, 13,193,186, 55, 70,232,221, 27,163,116,110,141,209,186, 19,198,232,221, 27,161, 60,110,141,209,186, 55, 70,232,
+   221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,
+   232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,177,182, 55, 70,240,220, 27,131,108,109,141,177,182, 19,
+   198,224,220, 27,129, 60,110, 13,193,184, 54,198,248,224,  9,225, 60, 39,132,241,186, 55, 70,232,222, 28, 35,132,112,142, 17,194,
+    56, 71,  8,221, 27,163,116,109,141,176,158, 19,199, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 35,132,112,142, 17,
+   194, 56, 71,  8,225, 28, 35,140,110,141,209,186, 55, 70,232,221,  9,227,144,114,142, 80,158, 57,135, 48,230, 28,195,152,115, 14,
+    97,204, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48, 79,  9,225, 60,115, 14, 97,204, 57,135, 48,230, 28,195,152,115,
+    14, 97,204, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48,230, 28,195,152, 39,142, 97,204, 57,135, 48,230, 28,195,152,
+   115, 14, 96,158, 57,130,120, 79, 28,195,152,115, 14, 97,204, 57,135, 48, 79,  9,225, 60,114,  4,240,158, 19,194,120,231, 28,163,
+   148,114, 14, 65,200, 19,199, 32, 79, 28,163,148,114,142, 81,202, 57, 71, 40,231,  9,225, 60, 39,132,240,158, 19,199, 64,232, 29,
+     3,160,116, 14,129,208, 58,  7, 64,232,  9,225, 60,114,142, 81,210, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,227,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,
+   234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135,
+    80,234, 29, 67,172,117, 14,193,214, 58,199, 88,235, 29, 99,172,117,132,240,158, 19,194,120,237, 29, 67,168,117, 14,161,212, 58,
+   135,112,235, 29, 99,172,117,142,177,214, 58,199, 88,239, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120,143, 16,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,227,200,121,  4,241,228, 19,199,144,242, 30, 67,200,121,  4,
+   241,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121,
+    15, 32,158, 60,130,120,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,204,121, 15, 65,230, 60,199,152,243, 30, 99,204,
+   121,143, 49,230, 60,130,120, 79, 30, 67,200,121, 15, 33,228, 19,199,168, 79, 30, 99,204,121,143, 49,230, 60,199,152, 79, 30,195,
+   216,123, 15, 97,236, 61,135,176,246, 30,195,216, 39,132,241,228, 60,135,144,242,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    30,227,224,124, 15,129,242, 62,135,200,249, 31, 99,228,124,143,193,246, 63, 71,232,253, 31,163,244,125,143,225,250, 63,135,240,
+   254, 31,227,252,127, 15,225,252, 63,135,240,254, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128,144, 18,  2, 64, 72,
+     9,  1, 32, 36,  4,128,144, 18,  4, 63,199,240,255, 31,195,252,129,144, 66,  6, 65,  8, 41,  5, 30,227,220,123,143,113,238, 61,
+   199,184,247,  9,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238,
+    61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 19,194,120, 79,  9,227,252,127,143,241,
+   254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,249,  6, 31,227,252,127,143,241,254, 63,  7,248,255, 30,227,220,123,143,
+   113,238, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255,  9,227,252,127,143,241,254, 63,199,248,255, 31,227,252,127,
+   143,241,254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,227,252,127,143,241,254, 63,199,248,255, 31,227,252,
+   127,143,241,254, 19,200, 17,  2, 31,195,248,127, 15,225,252, 63,135,248,254, 31,195,248,127, 15,225,252, 19,199,240,254, 31, 35,
+   228,126, 15,145,244, 65,200, 57,  7, 32,227,236,125,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,
+     8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,146, 18, 66,136,
+    81, 10, 33, 68, 44,133, 16,162, 20, 66,136, 81, 10, 33, 36, 40,133, 16,178, 22, 66,136, 81,  8, 33,132, 48,134, 16,194, 24, 67,
+     8, 97, 12, 33,132, 48,134,144,210, 28, 67,136,113, 14, 33,  4, 32,132, 16,130, 16, 66,  8, 89, 11, 33, 68, 40,132, 16,130, 16,
+    66,  8, 81, 10, 33, 68, 32,132,144,146, 18, 66,  8, 65,  9, 33, 36, 36,132,144,146, 18, 66, 72, 65,  8, 33,  4, 40,133, 16,162,
+    20, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,133, 16,146, 22, 66,136, 81,  9, 33, 36, 36,132,144,
+   146, 18, 66,136, 65,  9, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,132,144,146, 18, 66,136,121, 15, 34,  4, 64,136,
+    17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,
+   136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  2,121, 16,  9,225, 60, 39,132,240,158, 68,  2,120, 79, 34, 36,
+    68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34,
+    36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 34, 38, 68, 72,137, 17,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40,
+    69,  8,161, 20, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82,
+    42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145,
+    82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,
+   145, 82, 42, 69, 72,169, 21, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,
+   139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,
+   196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22,
+    34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185,
+    23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,
+   200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,225, 60,139,145,114, 46,
+    69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114,
+    46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,
+   114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,
+   145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,
+   139,145,114, 46, 69,200,184, 79, 34,225, 60,139,145,114, 46, 69,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228,
+    92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,
+   228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23,
+    34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,225, 60,139,145,114, 46, 69,194,120,
+    79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,
+   200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,132,240,158,
+    70,  8,193, 24, 35, 36,104,141,145,146, 50, 70, 72,201, 27, 35,100,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 17,194,
+    56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,
+   114, 46, 69,200,185, 23, 35,164,116,142,145,210, 58, 71, 72,233, 29, 35,164,116, 39,132,240,158, 19,194,120, 79, 35,196,120,143,
+    17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,
+   143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,
+   120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,
+   196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,130,120, 79, 35,228,124,143,145,242, 62, 71,194,120, 79,
+    36,  4,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9,
+    33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,
+     9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,
+    73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,
+    72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146,
+    18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,
+   146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33,
+    36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9,
+    33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,
+     9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,
+    73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,
+    72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,137, 25, 33, 36, 36,132,144,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,132,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146,
+    82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 98, 78, 19,194,120, 79, 37,  4,160,148,
+    18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,
+   148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,
+     4,160,148, 18,146, 82, 74, 73, 81, 42, 37, 68,160,148, 18,130, 80, 74,  9, 65, 40, 37,  1, 60, 39,132,240,158, 19,194,120, 79,
+    37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,150, 18,194, 88, 75, 66,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,121, 43, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,
+   113, 46, 37,196,184,151,146,242, 96, 41,  5, 32, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 38, 36,196,152,147, 18, 98, 76,
+    73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,153, 19, 32,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 19,201,153, 51, 38, 97, 60,154, 19, 64,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147,
+    82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,
+   147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,108, 77,137,185, 54, 38,196,216,
+   155, 19, 98,108, 77,137,185, 55, 38,228,220,155,147,114,110, 77,201,177, 55, 38,228,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,112, 78,  9,201, 58, 39,  4,236,156, 19,194,106, 77,130,120, 79, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,
+   164,244, 39,132,240,158, 19,194,120, 79, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248, 39,132,240,158, 19,194,120, 79,
+    39,228,252,160, 20, 18,132, 80,202, 33, 63, 40,165, 24,159,148,114,142, 81,202, 65, 71, 41, 37, 36,164,148,146,146, 82, 74, 73,
+    73, 41, 37, 36, 39,132,240,158, 19,194,120, 79, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138,
+    81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,178,148, 82,
+   138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148,
+    82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,
+   148, 82,138, 81, 74, 41, 65, 60, 39,132,240,158, 19,194,120, 79, 41, 69, 40,165, 20,162,148, 81,202, 57, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165,
+    20,162,148, 82,138, 81, 74, 41, 69, 28,165,  4,240,158, 19,194,120, 79, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97,
+    76, 41,133, 48,166, 20,194,152, 83, 10, 96, 79, 41,165, 52,166,148,226,156, 83,138,113, 77, 41,165, 56,167, 20,224,158, 19,194,
+   120, 79, 41,197, 56,166,148,226,156, 83,138,113, 78, 41,197, 52,166,148,208,158, 19,194,120, 79, 41,225, 60, 39,132,242,160, 84,
+    10,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164,
+    84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,130,120, 79, 42, 69, 72,169, 21, 34,
+   164, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149,
+    50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,
+   149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 48,158, 19,194,120, 79, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,
+   169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76, 39,132,240,158, 19,194,120, 79, 42,133,
+    80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,132,240,158, 19,202,177, 86, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,
+   229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193,
+    89, 43, 37,104,173, 21,144,158, 19,202,217, 91, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,
+   225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87,
+    10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 74,241, 93, 43,197,120,175, 21,226,188,
+    87,138,240, 79, 43,197,124,175, 21,242,190, 87,138,241, 94, 43,197,120,175, 21,226,188, 87, 74,233, 93, 43,165,116,174,149,226,
+   188, 87,138,241, 94, 43,197,120,175, 21,226,188, 19,194,121, 96, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132, 39,132,
+   240,158, 19,194,120, 79, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132, 39,132,240,158, 19,194,120, 79, 44, 69,136,177,
+    22, 34,196, 88,139, 17, 99, 44,133,144,178, 22, 66,196, 88,130,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120,
+    47,  5,224,188, 23,139, 40, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    44,197,152,179, 22, 98,206, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,
+   104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11,
+    65,104, 45,  5,160,180, 22,130,204, 90, 75, 49,102, 44,197,152,179, 22,114,204, 89,203, 57,103, 44,229,156,179, 22,114,206, 90,
+    11, 65,104, 45,  5,160,180, 22,130,208, 19,194,120, 79, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181,150,178,216,
+    91, 75, 89,107, 45,165,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,
+   220, 91,139,113,110, 45,197,184,183, 22,226,220, 90,203, 88, 79, 45,229,188,184, 23, 18,226, 92, 75,137,113, 46, 37,196,184,151,
+    18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,192,183,
+   150,242,222, 91,203,129,112, 45,229,188,184, 22,242,222, 91,203,137,113, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,
+   184,151, 18,226, 92, 75,137,113, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,
+   204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,161,117, 46,
+   133,208,186,151, 82,234, 93, 11,169,116, 46,133,208,186,151, 80,158, 19,194,120, 79,  9,225, 60, 39,132,242,236, 93,139,177,118,
+    46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,
+   119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,240, 94, 11,193,120, 47,  5,224,188, 23,130,242, 94, 75,
+   201,121, 47, 37,228,188,151,146,240, 94, 11,201,121,  9,225, 60, 39,151,162,244, 94,203,217,123, 47,133,240,190, 23,194,248, 95,
+    11,225,124, 47,133,240, 39,132,240,158, 93,203,185,119, 47,165,244,190,151,210,250, 95, 75,233,125, 47,165,244,191, 23,226,252,
+    95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,252, 95,139,241,126, 47,197,248,191, 23,226,
+   252, 95,139,241,126, 47,229,252,191,151,242,254, 95,204,  1,128, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97, 60, 39,132,
+   240,158, 19,194,120, 79, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,
+   152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,
+   192,132,240,158, 96, 76,  9,129, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,193,
+   120, 47, 17, 32,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,198, 12, 47,  5,224,188, 23,130,240, 94, 11,
+   198, 16,194, 24, 67,  8, 23,140, 33,132, 48,134, 16,194, 24, 64,188, 97, 12, 33,131, 11,193,120,194,  4,240,158, 19,194,120, 79,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216,
+    59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,194,104, 77,  9,161, 52, 38,133,176,124, 15,129,
+   240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+   129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    20,  2,128, 80, 10,  1, 64, 31,  3,224,124, 15,130,128, 80, 10,  1, 64, 40,  3,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,
+   118, 14,193,216, 59, 48,160,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  3,224,124, 15,129,240, 80, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 97,130,240, 94, 11,193,
+   120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,
+   193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,227, 12, 23,130,240, 94,
+     6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184,
+    59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,
+   110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,
+   176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,184, 59,  6,224,236, 27,
+   131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236,
+    27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,
+   236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,
+   224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,
+     9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,154, 19, 66,120,
+    79,  9,129, 48, 38,  4,192,152, 19,  2,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2,
+    96, 76,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,154, 19,
+    66,120, 79,  9,129, 48, 38,  4,192,152, 19,  2,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,225, 48, 39,132,192,158,
+    19,  2,120, 76,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,161, 52, 38,132,208,
+   154, 19, 66,104, 77,  9,161, 52, 38,132,208,154, 19, 66,120, 79,  9,161, 52, 38,132,208,154, 19, 66,104, 77, 48,230, 28,195,152,
+   115, 14, 97,204, 57,135,  9,161, 52, 38,132,208,154, 19, 66,104, 77, 48,230, 28,195,152,115, 14, 97,204, 57,135,  9,161, 52, 38,
+   132,208,154, 19, 66,104, 77, 48,230, 28,195,152,115, 14, 97,204, 57,135,  9,161, 52, 38,132,208,154, 19,194,104, 77,  9,129, 48,
+    38,  4,195, 14, 19,130,104, 78,  9,193, 56, 38,132,208,154, 19,194,104, 77,  9,129, 48, 38,  4,195, 14, 19,130,112, 78,  9,161,
+    52, 38,132,208,158, 19,194,104, 77,  9,129, 48, 38,  4,192,158, 19,130,112, 78,  9,161, 52, 38,132,208,154, 19, 66,104, 77,  9,
+   129, 48, 38,  4,192,152, 19,130,112, 78,  9,225, 60, 38,132,208,154, 19,194,104, 77,  9,129, 48, 38,  4,195, 14, 98,  2,112, 79,
+    49, 38, 36,196,152,147, 18, 98, 76, 73,138, 49, 38, 36,196,152,179, 24, 99, 76,113,143, 50,  6, 68,201, 25, 51, 40,101, 65, 65,
+   150, 50,230, 96,204,130,195, 52,102,204,200, 44,  5,  0,160,206, 25, 99, 58,103,140,241,159, 52,  6,132,209, 26, 51, 72,105, 77,
+    49,167, 53,  6,164,212, 26,131, 82,106,141, 89,171, 50,192,176, 26,130,131, 88,107, 76,225,174, 53,198, 88,203, 25, 99, 94,102,
+    77,129,173, 53,166,176,203, 25, 99, 44,101,140,177,150, 50,198, 88,216,153, 99, 92,101,138, 25,171, 40,101, 12,161,148, 51, 44,
+    80,202, 25,137, 54, 70,204,217,155, 51,102,109, 13,169,182, 54,230,224,220,155,147,114,110, 77,201,185, 55, 64,248, 39,132,240,
+    98,110,141,209,186, 55, 70,232,221,155,179, 98,102, 77,129,188, 55, 64,196, 24,131, 16, 98,110,141,209,186, 55, 70,232,221,155,
+   179, 98,102, 77,128, 79,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 19,194,120, 79, 29,163,180,118,
+   142,209,218, 59, 71,105,189, 29,166,248,118,142,208, 76, 59, 71,104,237, 29,163,180,118,142,209,218, 59, 77,232,237, 29,163,180,
+   118,155,209,218, 59, 77,232,237, 55,166,252,223,155,243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 11,193,
+   120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 89, 75, 41,101, 44,161,120,178,150, 82,202, 23,130,240, 94, 11,
+   193,120, 47,  5,224,188, 23,130,240, 94, 11,193, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    56,  7,  0,224,156, 35,128,112,206,  1,193, 56,  7,  8, 25,156, 19,130,112, 65,152, 51, 56, 39,  4,224,156, 67,128,112, 78, 41,
+   192, 54, 39,  4,224,156, 19,130,112, 78,  1,192, 56,  7, 12,227, 28,  3,130,112,  2,153,192, 56, 39,  0, 27,156,115,130,112, 78,
+    64, 51, 56, 39,  4, 27,156, 16,102, 97, 12, 33,132, 48,135, 36,224, 28,  0,102, 12,206,  9,193, 54, 38,196,216,155, 19, 98,112,
+    65,152, 51,  6, 96,204,224, 27, 19,128,112,  1,217,  7, 57, 71, 40,229, 28,176,108,115, 14, 81,202, 57, 71, 40,229,  3, 99,150,
+   114,193,177,202, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,156,115,142,113,206, 57,231, 60,231,156,243,
+   158,115,206,121,207, 57,231, 60,232, 29,  3,160,116, 14,129,208, 58, 39, 68,232,131,112,118,116, 78,137,209, 58, 32,216,224, 28,
+     0,158, 19,194,120, 79,  7, 32,228, 28,131,147,164,113,142, 49,198, 56,199, 24,216,155, 19,128,112, 14,  1,192, 54, 39,  0,224,
+    27, 19,128,112, 13,137,192, 56,  0,168, 21, 28,  3,128,112, 13,137,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 58,103, 76,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 13,137,177, 56,  7,
+     0, 28,156,  0,114,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,211, 56,
+     7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+     7, 38,196, 28,131,147, 98,108, 77,136, 57,  7, 38,196,216,131,147, 98,108, 77,136, 57, 54, 32,228,234, 29, 83, 98, 14, 77,137,
+   177, 54, 38,196, 28,155, 19, 98, 14, 65,200, 57,  7, 38,196,216,131,147, 98, 14, 77,136, 57,  7, 32,228, 28,131,144,114,108, 65,
+   201,177, 54, 38,196,216,155, 16,114, 14, 65,200, 57, 54, 38,196,216,155, 16,114, 14, 77,137,177, 54, 38,196,216,155, 19, 98,108,
+    77,137,177,  7, 38,196,216,155, 16,114,108, 77,137,177, 54, 38,196, 28,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,
+   108, 77,137,177,  7, 32,228,216,155, 16,114, 14, 65,200, 57, 54, 38,196, 28,131,147, 98,108, 65,200, 57, 54, 38,196,216,155, 19,
+    98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196, 28,131,147, 98,108, 65,200, 57, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98, 14, 77,137,177, 54, 32,228,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98, 14, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,136, 57, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,216,155, 19, 98,108, 77,137,214, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 51, 38,192,204,155,  3,128,112, 14,  1,192, 56,  7,  0,225,156,  3,128,112, 14,  1,
+   192, 56,  7,  0,235,157,115,128,112, 14,  1,192, 54, 38,196,224, 28,  3,128,112, 14,  1,192,  5, 71, 96,236,156,  3,128,112, 14,
+     1,192, 56,  7,  0,224, 28,  3,128,112,  8, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,200, 57,  7, 32,228, 28,131,156,  3, 98,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192,  5, 71,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128, 65,206,  1,192, 56,  7,  0,224, 27, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  0, 42, 56,  7,
+     0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3, 98,108, 77,137,177, 54, 38,196,224, 28,  3,128,112, 14,  1,192, 56,
+     7,104,237, 29,163,180, 10,129, 80, 42, 58,231,108,237,157,115,128,112, 14,  1,192,  5, 64,168, 21, 28,  3,128,112, 14,  1,192,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  0, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 56,  7,  0,224, 28,  3,128,112,
+    14,  1,192, 56,  7,  0,224,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,
+   108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6, 32,196, 24,131,
+    16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 19,184,119, 14,225,220, 59,135,112,238,
+    29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,233,221, 59,167,116,
+   238,157,211,186,119, 78,233,221, 59,167,116,239, 29,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,231,
+   124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,
+   231,124,230,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,177,203,
+    56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,
+   195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206,
+    25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,
+   206, 25,195, 56,103, 12,225,156, 51,128,112, 14,  1,192, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,
+   112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,
+   192,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156,
+    51,134,112,206, 25,195, 56,  7,  0,225,156, 51,134,112,206,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,103, 12,224,
+    28, 51,134,112,206, 25,195, 56,103, 12, 21,  2,163,128,112, 14,  1,192, 56,  7,  0,225,156, 51,128,112, 14, 48, 57, 56,  7,  0,
+   224, 28,  3,134,112,206,  1,192, 56,192,228,224, 28,  3,128,112, 14, 25,195, 56,103,  0,224, 28, 51,128,112, 14, 25,195, 56,103,
+    12,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,225,156, 51,134,112,206,  1,192, 56,
+     7,  0,224, 28,  3,128,112, 14,  1,195, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 54, 38,196,216,158, 19,194,120,143, 17,177,
+    59,103,108,237,157,176, 84,113,142, 24, 42,  5, 71, 24, 21,  2,160, 84, 10,142, 49,198,  5, 64,168, 21, 28,  3,174,117,207, 25,
+   227, 59, 96,168,237,157,179,200,121, 79, 33,219,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 71,108,237,157,176, 84, 10,129, 80, 42, 56,192,168,227,  2,160, 84, 10,
+   129, 80, 42, 59, 71,104,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84,
+    10,129, 80, 42, 56,199, 24, 21, 28, 99,140,113,129, 81,198, 60,135, 24,227,  2,163,140,113,129, 81,210,  5, 64,168, 21,  2,160,
+    84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 81,215,  5, 64,168, 21,  2,160, 84, 10,142,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192,  5, 64,168, 21, 29,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,142, 49,198,  5, 71,104, 21,
+     2,160, 84, 10,129, 80, 42,  5, 64,168,237, 29,163,204, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168,
+    21,  2,160, 84,117,206,185,228, 59,103,108,237,157,179,174,117,207, 33,228, 60,135, 24,227, 28, 99,140,121, 14,209,228, 60,135,
+   144,227, 30, 67,174,113,142, 49,198, 60,135,144,227, 28, 99,200,113,142, 49,228, 60,135,144, 21, 28, 96, 84, 10,129, 80, 42, 56,
+   199, 24,235,156, 99,140,113,142, 49,198, 56,199,144,235,157,115,200,117,206, 49,228, 60,135,156,235,156, 99,140,117,207, 33,228,
+    59,103,108,237,157,179,182,118,142,  1,192, 59,103,108,244, 30,131,202,121, 65, 80, 42,  5, 64,168, 21, 28,  0, 84,112,  1, 81,
+   192, 56,  7,  0,224, 28,  3,128, 10,142,  1,192, 56,  0,168,224, 28,  3,128,112, 14,  1,192, 59, 71,  0,224, 28,  3,128,112, 14,
+     1,192, 56,  7,  0,224,  2,160, 84,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,116,206,  1,192, 56,  7,  0,224, 28,  0, 84,112,
+    14,  0, 42, 56,  7,  0,224, 28,  3,180,112, 14,209,192, 56,  7,  0,224, 29,163,180,118,142,  1,233, 56,  7,  0,224, 30,163,212,
+   122,143, 81,234, 61, 71,  0,245,158,195,182, 10,129, 80, 42, 51, 38,192,204,155,  3, 50,108, 12,201,176, 51, 38,192,204,155,  3,
+    50,108,  1,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48,230, 28,
+   195,152,115, 14, 97,204, 57,135, 48,230, 28,195,128,118,142,209,218, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  0,168,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 59, 71,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,218, 54, 38,196,216,155, 19, 98,102, 77,129,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 64,128, 33,  2,
+     0,132,  8,  2, 16, 32,  8, 76,201,176, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,
+   237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,
+   105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123,
+    79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,
+   123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,
+   218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,194,120, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    54, 38,196,216,153,147, 96,  4,  1,  9,153, 54,  6,100,216, 25,147, 96,102, 77,129,153, 54,  6,100,216, 25,147, 96,102, 77,129,
+   153, 54,  6,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108,
+    77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 51, 38,192,204,155,  3, 98,
+   108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,
+    98,108, 77,137,177, 54, 38,196,216,155, 19, 50,108, 13,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    56,  7,  0,224, 28,  3,128, 10,129, 80, 42, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 29,163,180,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,
+     1,192, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,112,
+    14,  1,177, 54, 38,196,216,155, 19, 98,112, 14,  1,192, 59, 71,  0,224, 28,  3,128,122, 78, 25,195, 56,103, 12,224, 28,  3,128,
+   112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  0,
+   158, 19,206,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112,  2,121,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,
+     0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,
+     7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192,
+    61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,
+   238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,
+   113,238, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,
+   207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,
+   123,207,121,239,  6,224,236, 27,131,112,110, 14,193,216, 55,  7, 96,220, 29,131,112,118, 13,193,184, 55,  6,224,236, 27,131,176,
+   118, 13,193,216, 59,  7, 96,236, 29,131,176,124, 15,129,184, 55, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133,
+    96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,
+   133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88,
+    42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161,
+    88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,170, 21,130,168, 86, 10,161, 88, 42,133, 96,172,124, 15,129,240, 62,
+     7,192,248,  5, 80,172, 21, 66,177,241, 62, 39,196, 42,133, 96,158, 19,194,120, 79,  9,231,200,249,159, 51,230,125, 15,145,243,
+    62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,
+   245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 66,121,245,  9,225, 60, 39,132,240,158,125, 66,
+   120, 79, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,
+   143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,
+   125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246,  9,225, 60, 39,132,240,158, 19,194,121,247, 63,  1, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,121,249, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,
+   114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,184, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,
+   145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,
+   139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228,
+    92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,
+   161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93,
+    63, 71,232, 22,  3, 80, 88, 13, 79,209,250, 63, 64,176, 26,159,160, 88, 13, 74, 25, 67, 40,101, 12,161,148, 50,134, 80,204,177,
+   146, 63,101, 12,254, 25, 96, 88, 13, 76,177,150,  5,128,212,204,155,  3, 50,108, 12,201,176, 51, 38,192,161,148, 50,134, 80,202,
+     8, 63, 40,101, 12,203, 20, 50,134,101,140,177,150, 50,198, 88,254,159,211,252, 80,202, 25,150, 50, 69, 12,204,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,153, 98,134,101,138, 25, 67, 56,  7,  0,203, 20, 18,130,102, 77,129,153, 54,  6,100,216, 25,147, 96,
+   100,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,
+   243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252, 39,159,243,254,127,207,249,255, 63,231,252,255,
+   159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,
+   255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,
+   252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,
+   231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,
+   255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,
+   249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,
+   207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,
+   127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,
+   254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,
+   243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,
+   159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,
+   255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,
+   252,255,159,243,254,127,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  0,158, 19,194,120, 79,
+    64, 40,  9,  1,160, 68,  0,129, 80, 50,  7, 59,  7,100,236, 29,147,176,118, 78,193,217, 59,  7,101,  0, 32,  3,176,118, 78,193,
+   217, 59,  7,100,236, 29,148, 16,118, 14,201,217, 64,  8, 29,  3,160,116, 14,129,208, 58,  7, 64,232, 29,  4,160,148, 18,130, 80,
+    82, 10, 65,104, 49,  6, 32,196, 24,131, 80,  2,  0, 64,232, 29,  3,160, 84, 28,131,208,  2, 16,  9,232, 69,  9, 33, 20, 36,132,
+    80,146, 17, 66, 72, 69,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 20, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 20, 36,132, 80,146, 17, 66, 72, 73,  9, 33,
+    36, 36,132,144,138, 18, 66, 72, 73,  9, 33, 36, 36,132, 80,136, 79,  9,232, 37,  4,161, 52, 38,133, 16,162, 18, 66,168, 89, 11,
+   161,100, 46,133,144,186, 22, 66,232, 89, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93,
+    11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,100, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232,
+    93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,100, 46,133,144,186, 22, 66,
+   232, 93, 11,161,116, 46,133,208,178, 23, 66,232, 93, 11,161,116, 46,133,144,178, 23, 66,232, 93, 11,161,132, 50,134,144,210, 23,
+     9,225, 60, 39,132,240,158,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218,
+    27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,
+   218, 27,  9,232,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135,
+    16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,
+   135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196,
+    56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,
+   196, 56,135, 16,224, 79, 67,168,117, 15, 33,228, 60,135,144,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,104,109, 13,
+   161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109,
+    13,161,180, 54,134,208,218, 27, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,
+     1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  0,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22,
+    67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250,
+    31, 67,232,125, 15,161,244, 62,136, 17,  0, 79, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 14,161,212, 58,135, 80,
+   234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135,
+    80,234, 29, 68, 40,133, 16,162, 20, 66,136, 81, 10, 33, 64,  8,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,
+   136,145, 18, 34, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244,
+    62,135,208,250, 31, 67,232,125, 15,161,244, 64,136, 17,  2, 29, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 14,161,
+   212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 35, 67,168,141, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,
+   161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137,
+    17, 34, 36, 68,136,145, 18, 34, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212,  0,128, 16,  2,  0, 68,136,
+   145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,
+   136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 29,
+    68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34,
+    36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17,
+    34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137,
+    17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 67,168,117, 14,161,212, 58,
+   135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212,
+    58,135, 80,234,  0, 64,  8,  1,  0, 33,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,
+   212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,
+   161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117,
+    14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,
+   117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,  2,  0, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,
+   168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234,  0,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137,
+    81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84,
+    74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,
+     0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,
+     7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192,
+    68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,209, 50,
+    38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145,
+    50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,
+   145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,
+   137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100,
+    76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,
+   100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19,
+    34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153,
+    19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,
+   153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,
+   200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38,
+    68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76, 19,194,120, 79, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138,
+    17, 64, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,
+   138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148,
+    82,138, 81, 74, 41, 69, 72,169, 21, 34,164, 84,138,145, 90, 44, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,
+   162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181,
+    22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,
+   181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,
+   168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 92,139,209,130, 49, 69,168,181, 22,162,212, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 22,162,208,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,  1,108, 44,  5,176,176, 22,
+   194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176,
+    22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,209,152, 93, 11,225,124, 47,163, 64,
+   186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 81,162, 53, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,
+   176,176, 22,194,192, 91, 11,  1,108, 44,  5,176,176, 22,194,192, 91, 11,  1,108, 44,  5,179, 10, 97, 66,232, 93, 70,200,217, 27,
+    35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,
+   217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,186, 55, 70,
+   232,221, 27,163,116,110,141,209,186, 55, 71,  8,225, 28,163,164,118,142,209,218, 58,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     8,225, 28, 35,132,112,142, 17,194, 56, 71,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16,
+    63,  7,224,252, 31,131,240,126, 15,193,248, 63,  8, 65,  8, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,
+   184, 59,  7, 96,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,
+   193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110,
+    14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7,192,236, 29,131,176,
+   118, 14,193,216, 59,  7, 96,220, 29,131,112,118, 13,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  7,232,241, 30,  3,
+   112,118, 13,193,216, 60,  6,224,236, 27,131,176,118, 14,193,184, 59,  6,224,236, 27,131,176,110, 14,193,184, 59,  6,224,236, 27,
+   131,176,110, 14,193,184, 59,  6,224,236, 27,131,112,110, 13,193,184, 59,  6,224,220, 27,131,112,110, 14,193,184, 59,  6,224,236,
+    27,131,176,110, 14,193,184, 59,  6,224,236, 27,131,176,110, 13,193,184, 55,  7, 96,220, 29,132,240,158, 19,194,120, 79,  6,224,
+   236, 39,131,176,158, 14,193,184, 59,  6,224,236, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 31,  3,224,124, 13,193,216, 60,  7,192,248, 29,131,192,120, 15,  1,224, 60,
+    71,168,245, 31, 35,212,122,143, 81,242, 61, 71,168,245, 30,163,228,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234,
+    61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,244,126,143,145,242, 63, 72,  9,  1, 32, 36,  4,124, 19,194,
+   120, 79, 72, 41,  5, 32,164, 20,130,144, 72, 57,  7, 55,167, 32, 39,132,240,158, 19,194,120, 79, 72, 73,  9, 33, 36, 36,132,144,
+   146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   134,144,210, 34, 68,  9,225, 60, 39,132,240,158, 19,194,120, 79, 72,169, 21, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35,
+    36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,138,145, 82, 42, 69, 72,169, 21,
+    34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,142,145,194,120, 79,  9,225, 60, 39,132,240,158, 19,210, 66, 72, 73, 41,
+    37, 36,164,148,146,146, 82, 74, 73, 73, 41, 36, 39,132,240,158, 19,194,120, 79, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 81,138, 49, 70, 40,197, 24,163, 20,194,152, 83, 10, 52,148, 40,197, 24,161,
+    73,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 45, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18, 98,
+    76, 73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18,106, 77, 73,169, 53, 38,164,212,154,147, 73,
+    74, 78, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,
+   210,122, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40,165, 16,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,122, 82, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 19,194,120, 79, 74,105, 77, 41,165, 68,170,149, 82,170, 85, 74,169, 85, 42,165,
+    84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,
+   165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 52,168,149, 18,154, 83, 74,105, 77,
+    42, 37, 68,166,148,210,162, 84, 74,137, 89, 43, 37,100,172,149,146,178, 87, 75,  9, 97, 43, 37,100,172,149,130,120, 64, 75, 41,
+   101, 44,165,148,178,150, 82,202, 89, 75, 41,100, 39,132,240,158, 19,210,178, 86, 33,  4, 32,132, 16,130, 16, 66,146,209,  8, 33,
+     4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,132, 16,130, 16, 66,  8, 64, 79,
+    75,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,165,180,182,150,210,218,
+    91, 75,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,165,180,182,150,210,218, 91, 75,105,113, 46, 37,196,184,151, 18,
+   226, 93, 75,169,113, 46, 37,212,186,151, 18,224, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 75,105,109, 45,165,196,182,150,
+   210,218, 91, 75,105,109, 45,165,180,184,151, 66,120, 79, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,120, 39,132,244,190,
+   152, 19,  2, 96, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 75, 68, 32,132, 16,130,
+    16, 66,  8, 65, 15, 33,228, 60,132, 16,146, 20, 66, 72, 65,  8, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166,
+    20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,
+   166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 73,133, 49, 38, 36,196,152, 83, 10, 98, 76, 73,133,
+    48,166, 20,194,152, 83, 18, 98, 76, 41,137, 48,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,166, 20,194,152,211, 34,100, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,
+   169,149, 50,166,100,206,153,211, 50,102, 77,  9,161, 50,166,148,210,153,147, 56, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,228, 92,139,145,114, 46, 69,200,184, 79,  9,228, 92,139,145,114, 46, 69,200,184, 79,  9,228, 92,139,145,114, 46, 69,200,184,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,
+   184, 79,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,163,192,124,
+    15,129,240, 62,  7, 96,236, 29,131,176,118, 19, 65,216, 59,  7, 96,248, 35,132,112,158, 19,194,120, 79, 35,228,124,143,145,242,
+    62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,
+   242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,
+   145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,
+   143,145,242, 62, 71,200,249, 31, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,
+   149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166,100,204,153,211, 50,102, 76,
+   233,153, 51, 38,132,204,153,194,120, 79, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,168, 39,132,240,158, 19,194,120, 79,
+    77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,
+   108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,
+    98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,
+   177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108,
+    77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,
+   108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,
+    98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,
+   177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108,
+    77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,
+   108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,
+    98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54,
+    38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,
+    54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,
+   177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108,
+    77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,
+   108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19,
+    98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108, 77,105,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,
+   155, 19, 98,108, 77,137,177, 54, 38,196,214,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,105,177, 54, 38,
+   196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,192,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,
+   138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,168, 79,  9,225, 60, 39,145, 98, 44, 69,136,177, 22, 34,196,
+    88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,
+   196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 96,158, 19,194,120, 79,
+    77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,
+   109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,
+   106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155,
+    83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,
+   155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,
+   218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,
+   228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55,
+    38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185,
+    55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,
+   185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,
+   201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137,
+    81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 83,122,111, 68,168,149, 18,162, 84,
+    74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,
+     7, 96,236, 29,131,176,118, 14,193,216, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,134, 80,202, 25, 67, 40,
+   101,  9,225, 60, 39,132,240,158, 27,131, 80,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,201,192, 55,  6,224,220, 27,131,
+   112,110, 13,193,184, 55,  6,224,220, 27,131,112, 79, 13,193,184, 55,  6,224,220, 19,195,112, 79, 13,193,184, 39,134,224,220, 19,
+   195,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128,
+    80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,
+   225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,205,129,153, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15, 33,228, 60,135,144,242, 30, 67,200,121, 15,225,
+   252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,
+   225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,  9,225, 60, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127,  9,225, 60, 39,132,240,158, 19,194,120,121,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,236, 30, 67,200,121,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74, 78, 40,  9, 57, 39, 52,232,157, 83,169,216, 59, 41,216, 39,132,240,158, 19,194,120, 79, 11,193,120, 47,
+     5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,232, 93, 64,137,221, 59,167,132,240,118, 14,201,216, 59, 39, 96,
+   236,157,131,178,118, 14,201,216, 59, 39, 96,236,157,131,178,129, 16, 33,216, 59, 40, 17,  2, 32, 68,  8,158, 19,194,120, 79, 41,
+   233, 61,132,244,248,159, 83,242,126, 78,231, 96,236,157,131,178,118, 14,202,127, 64,136, 17, 64, 40, 21,  4,160,148, 16, 79, 64,
+   138, 13, 66, 32, 64,158, 19,194,120, 79, 15,225,252, 63,135,240,254, 19,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127,
+    15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254,
+    31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,
+   254, 31,195,248,127, 15,225,252, 63,135,240,254, 19,194,121,178,  9,234, 21, 67, 40,117, 16,162, 84, 50,138, 81,106, 49, 67, 40,
+   213, 28,163,212,130,145, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73,169, 69, 42,165, 84,170,133, 80,202, 89, 75,
+    41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89,
+    75, 40,181, 12,163, 20,186,152, 82,234,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,
+   101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,168,181, 42,163, 20,170,139, 81,138,105, 77,169,197, 58,167,148,250,160, 84,
+    10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 42,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159,
+    83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,
+   159, 83,234,125, 79,169,245, 62,167,213, 18,162, 84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213,
+    26,163, 84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 24, 79,  9,225, 61, 81,170, 53, 70,168,
+   213, 26,163,  9,225, 61, 81,170, 53, 70,168,213, 26,163,  9,225, 61, 81,170, 53, 70,168,213, 26,163,  9,225, 61, 81,170, 53, 70,
+    19,194,120, 79, 84,138, 33, 74,169,117, 74,162, 20, 64, 79, 84,202,157, 83,170,117, 78,169,149, 48, 79, 54,134,208,218, 27, 67,
+   104,109, 13,161,180, 54,138,161, 84, 42,133, 82,112,194,120, 79, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,
+   160,158,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85,
+    42,165, 84,170,149, 80, 79, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169,
+    85,  4,245, 84,170,130,122,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,130,120, 79, 85, 74,
+   169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,
+   170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149,
+    82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,
+   149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,
+   170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165,
+    84,170,149, 82,170, 85, 74,169, 85,  4,240,158, 19,194,120, 79, 37, 37, 12,148,132,240,158, 19,194,122, 65, 72, 41,  5, 32,164,
+    20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,
+   164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 16,158, 19,194,121,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,
+   173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,
+   106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,171, 21, 98,172, 85,138,181, 86,170,213, 90,171, 85,106,173,
+    85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86, 42,197, 90,171,149,112, 79, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 28,  3,128, 19,194,120, 79, 85,161, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 23,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,
+   175, 85,234,189, 87,170,245, 94, 19,194,120, 79, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,
+   130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172,
+    21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86,  1, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 11,198,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,
+   116,110,141,209,186, 55, 70,232,221, 27,160,158, 19,194,120, 79, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171,
+    21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 74,201, 89,
+    43, 32,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,172, 85,138,177, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205,
+    89,171, 53,102,172,213,154,179, 86,106,209, 89,171, 53,102,172,213,154,179, 86,106,205, 90,  4,240,158, 19,194,120, 79, 86,170,
+   213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,
+   170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,178,182, 86,202,217, 91,  4,240,158, 19,194,120, 79,
+    86,234,221, 91,171,117,110,173,213,186,183, 86,234,221, 91,171,117,110,173,213,186,183, 86,234,221, 91,171,117,110,173,213,186,
+   183, 86,234,221, 91,171,117,110,173,194,122,184, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,
+   202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,144,158, 19,
+   194,120, 79, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 74,237, 93,171,181,118,174,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,
+   197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94,
+    43,197,120,175, 21,226,188, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245,
+    94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,202,
+   249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,
+   202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190,
+    87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,
+   191, 87,234,253, 95,171,245,126,175,194,120, 79, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  0, 39,132,240,158, 19,194,
+   120, 79, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 21,130,176,
+    86, 10,193, 88, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172, 16,158, 19,194,120, 79, 88, 75,  9, 97, 44, 37,132,
+   176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,
+   132,176,150, 18,194, 88, 75,  9, 97, 44, 32,158, 19,194,120, 79, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172,
+    53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,
+   172, 53,134,176,214, 26,195,  9,225, 60, 39,132,240,158, 19,194,120, 79, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17,
+    98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139,
+    17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 64,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,122,197, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99,  4,245,140,177,150, 50,198,
+    88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99,  4,245,140,177,150, 50,198, 88,203, 25, 99,  4,245,140,177,130,122,
+   199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 28, 39,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214,
+    58,199, 88,235, 28, 39,172,117,142,177,214, 58,199, 88,235, 28, 39,172,117,142, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,
+   133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100,
+    44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,
+   100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11,
+    33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89,
+    11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200,
+    89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,
+   200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22,
+    66,200, 89, 11, 33,100, 44,133,144,178, 22, 64, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 89, 11, 33,100, 44,133,144,178,
+    22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178,  2,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 89, 11, 33,100, 44,133,144,178, 22, 66,200,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  7,203, 37,100,131,224,124, 15,130,120, 62,  7,192,248, 31,  3,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,193, 60, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    89, 75, 41,101, 44,165,148,178,130,120, 79, 89, 65, 61,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,
+   202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150,
+    82,202, 89, 75, 41,101, 44,165,148,178,130,122,202, 89, 65, 60, 39,132,245,148, 19,194,122,202, 89,107, 45,101,172,181,150,178,
+   214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,194,122,204, 89,171, 53,102,172,213,154,
+   179, 86,106,205, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,
+   156,179,150,114,207, 89,235, 65,104, 45,  5,160,180, 22,130,208, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173,
+    21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,136, 79,  9,225, 60, 39,
+   132,240,158, 19,194,122,210, 90, 75, 73,105, 45, 37,164,180,150,146,210,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 90,107, 77,105,173, 53,166,180,214,154,211, 90,
+   107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,132,245,166,180,194,120, 79,  9,225, 60, 39,173, 69,168,181, 22,162,212,
+    90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,178,
+   214, 90,203, 89,107, 45, 96,158, 19,194,122,215, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,
+   194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 96, 39,132,240,158, 19,194,122,217,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 91, 75,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,
+   165,180,182,150,210,218, 91, 75,105,109, 45,165,180,182,150,210,218, 91, 75,105,109, 45,165,180,182,150,210,218, 91,107,109,109,
+   173,181,182,182,214,218,219, 91,107,109,109,173,181,182,182,214,218,219, 91,107,109,109,173,181,182,182,214,218,219,  9,225, 60,
+    39,132,245,184,183, 22,218,219, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220,  9,225,
+    61,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,
+   139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220,
+    91,171,121,111, 45,224,158,183,150,240, 79,  9,225, 60, 39,132,245,188,183,150,242,222, 91,171,117,110,173,208,158,183, 86,234,
+   221,  9,235,117,110,173,213,186,183, 86,234,221, 91,171,117,110,173,213,186,183, 86,234,221, 91,171,117,110,173,213,186,183, 86,
+   234,221, 91,171,117,110,173,213,186,183, 66,120, 79, 91,203,121,111,  4,240,158, 19,194,122,222, 91,235,125,111,173,245,190,183,
+   214,250,223, 91,225, 60, 39,132,240,158, 19,194,120, 79, 92, 11,129,112, 46,  5,192,184, 23, 10,225, 92, 65, 60, 39,132,240,158,
+    19,194,120, 79, 92,107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,
+   198,184,215, 26,227, 92,107,141,113,174, 53,198,185, 23, 34,229, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,
+   101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,215, 58,231,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 43,161,116, 46,133,208,186, 23, 66,232, 93, 11,
+   161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186,151, 80, 79,  9,
+   225, 60, 39,174,181,214,186,215, 90,235, 93,139,177,118, 46,197,216,187, 23,104, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,
+   238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,
+   114,238, 93,203,185,119, 46,229,220,187,130,120, 79,  9,235,189,119,174,245,222,187,215,122,239, 94, 11,193,120, 47,  5,224,188,
+    23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188,  2,120, 79, 94, 43,197,120,175, 21,226,
+   188, 87,138,241, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121,  4,240,
+   158, 19,194,120, 79, 94,107,205,121,175, 53,230,188,215,154,243, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47,
+    69,232,189, 23,162,244, 94,139,208, 39,132,240,158, 19,194,120, 79,  9,235,213,122,175, 85,234, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,235,217,123, 47,101,236,189,151,178,246,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,215,186,
+   247, 94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,215,
+   186,247, 94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,215,186,247, 94,235,221,123,175,117,238,189,
+   215,186,247, 94,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,
+   133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124,
+    47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124,  4,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,
+   229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95,
+    43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,132,240,158, 19,194,120, 79,  9,225, 61,125, 47,165,244,190,151,210,250,
+    95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,
+   251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,248,191, 23,226,252,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,244, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 95,203,249,127, 47,229,252,191,151,242,254, 95,
+   203,249,127, 47,229,252,191,151,242,254, 95,203,249,127, 47,229,252,191,151,242,254, 95,203,249,127, 47,229,252,191,151,240, 79,
+    95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,254,191,215,250,
+   255, 95,235,253,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,254,191,215,250,255, 95,235,252, 39,176,  6,  0,192, 66,
+   120, 79, 95,235,252, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 30,131,208,122, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48,
+    38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,216, 27,  3, 96,108, 13,129,
+   176, 54,  6,192,216, 27,  2,  9,225, 60, 39,132,240,158, 19,194,120, 79, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,
+   130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 43,  5, 96,172, 21,130,176, 86, 10,193, 88, 43,  5, 96,172,
+    25,131, 48,102, 12,193,216, 59,  7, 96,236, 28, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 97, 12, 33,132, 48,134, 16,194, 24, 67,  8, 97, 12, 33,132, 48,134, 16,194, 24, 67,  8,
+    97, 12, 33,132,176,150, 18,194, 88, 83, 10, 97, 76, 40, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,195,
+    24, 99, 12, 97,140, 49,134, 48,192,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214,
+    26,195, 88,104, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 97,204, 61,135, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,
+     6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136,
+    49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 97,236, 61,
+   135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 17, 98, 44, 73,137, 49, 38, 36,196,130,120, 79,  9,225,
+    61,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,163, 20, 98,
+   140, 81,138, 49, 70, 40,197, 24,163, 20, 97,236, 65,136, 48,246, 30,196,  2,120, 79,  9,225, 60, 39,132,240,158, 19,194,123, 15,
+    98,172, 85,139, 49,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187,
+    23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,
+   187, 23, 98,204, 89,139, 49, 86, 42,197, 88,171, 22, 98,204, 85,138,177,134, 48,198, 88,211, 26, 99, 76,105,138,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158,198, 66,120, 79, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,
+   198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99, 97, 60, 39,132,240,158, 19,194,120, 79, 99,140,113,142, 49,198,
+    56,199, 24,227, 28, 99,140,112, 39,132,240,158, 19,194,120, 79, 99,172,117,142,177,230, 60,199,152,243, 30, 99,204,121,143, 49,
+   230, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,199,152,243, 30, 99,204,121,143,
+    49,230, 60,199,152,243, 29, 99,172,117,142,177,214, 62,199, 88,235, 29, 99,172,117,142,177,214, 58, 19,217,  3, 32,100, 12,129,
+   144, 50,  6, 64,200, 25,  3, 32,100, 44,137,145, 50, 38, 60,199,216,251, 30,  9,225, 60, 39,132,240,158, 19,194,120, 79,100,108,
+   141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,
+   108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 70, 74,201,153, 24, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   100,236,157,148, 50,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75,
+    41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89,
+    75, 41,101, 44,165,148,178,134, 80,202, 25, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 40,101, 12,165,149, 50,166, 82,202,
+   217, 91, 44,101,172,157,147,178,118, 78,203,153, 67, 39,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,148,179,  6, 82,
+   203, 89, 91, 43,  9,236,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22,
+    98, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51,
+    38,100,204,153,147, 50,102, 76,200, 39,179, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153,
+    51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,102,204,217,155, 52,102,140,209,153,179, 54,104,204,217,163, 52,102,172,213,
+   155, 51, 86,106,205,153,163, 50,102, 76,208, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   102,236,221,155,179,118,110,205,217,184, 79,102,225, 61,155,179,118,110,205,194,123, 55,102,236,221,155,179,118,110,205,217,187,
+    55,102,236,221,155,179,118,110,205,194,123, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,224, 39,132,240,158, 19,194,
+   120, 79,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206,
+    89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,
+   206, 89,203, 58,103,108,237,157,179,166,116,206,153,211, 58,103, 76,233,157,  4,240,158, 19,194,120, 79,103,140,241,158, 51,198,
+   120,207, 25,227, 60,103,140,240, 39,132,240,158, 19,194,120, 79,103,172,245,159, 51,224,158,207,217,251, 63,103,236,253,159,179,
+   246,126, 19,194,123, 63,103,225, 60, 39,179,246,126,207,217,251, 63,103,236,253,159,179,246,126,207,217,251, 63,103,236,253,159,
+   179,246,126,207,217,251, 63,103,225, 61,159,179,246,126,207,217,251, 63,103,225, 61,159,179,240,158,207,217,251, 63,103,236,252,
+    39,133,230,122,207,218,  3, 62,103,172,249,159, 51,230,124, 19,194,123, 62,103,193, 60, 39,179,230,124,207,130,120, 79,103,225,
+    60, 39,132,240,158, 19,194,123, 64,  9,225, 60, 39,132,240,158,207,217,251, 63,103,236,253,159, 51,224,158, 19,217,235, 61,103,
+   172,245,158,179,214,122, 19,194,120, 79,103,172,245,158,179,214,122, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11,
+    65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 90,
+    11, 65,104, 45,  5,160,180, 22,130,208,154, 19, 66,104,109, 13,161,180, 54,134,208,218, 27, 67,104, 77,  9,161,180, 54,134,208,
+   154, 27, 65,104, 45,  5,160,180, 70,136,209, 90, 43, 70,104,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,162,180, 80,158,
+   209,154, 27, 65,104, 45,  4, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,
+   134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164,
+    52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 45, 41,165, 52,182,150,210,218, 91, 75,105,109, 41,
+   165,180,166,148,210, 90, 83, 75,105,109, 41,165,180,182,144,210, 26, 99, 72,  9,225, 60, 39,132,240,158, 19,194,120, 79,105,173,
+    53,166,180,214,154,211, 90,107, 77,105,173, 52, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115,
+    78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,
+   115, 79,106, 13, 65,168,181, 22,162,212, 66,120, 79,106, 13, 65,168, 53,  6,162,212, 90,131, 81,106, 45, 73,169,181, 54,168,213,
+    26,171, 85,106,173, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,105,205, 57,167, 52,230,162,
+   212, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,
+   102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171,
+    53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,237, 93,171,181,134,176,214, 26,195, 88,107, 13, 97,
+   172, 53,118,174,214, 26,187, 88,107, 13,101,172,181,166,172, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,107,109,
+   109,173,181,182,182,214,218,219, 91,107,109,108, 39,132,240,158, 19,194,120, 79,107,141,113,174, 53,198,184,215, 26,227, 92,107,
+   141,113,174, 53,198,184, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235,
+    93,107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,230,190,215,154,
+   251, 95,107,205,121,175, 53,230,188,215,154,251, 94,107,173,128, 39,132,240,158, 19,194,120, 79,108, 45,133,176,182, 22,194,216,
+    91, 11, 97,108, 45,132, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54,
+    38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177,  4,240,158,216,219, 27, 99,108,141,145,177,
+   182, 54,198,216,219, 43, 99,108,109,141,177,182, 48,158, 19,194,120, 79,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,
+   179,182,118,208,218, 27, 67,105,108, 77,137,177, 54, 38,196,216,155, 16, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,
+   106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,214,218,219,
+    91,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,109,177,182, 54,208,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,109,205,185,183,
+    54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,
+   183, 54,230,220,219,155,115,110,109,237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,237,
+   189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,110, 13,193,184, 55,  6,224,220, 27,131,112,110,
+    13,193,184,183, 22,226,220, 91,139,113,110, 45,197,184,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,123,114,
+   110,109,205,185,183, 54,230,220,219,152, 79,  9,237,204, 39,132,246,230,220,219,155,115,110,109,205,185,183, 48,158,220,219,152,
+    79,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,
+   155,115,110,141,213,186,183, 86,234,221, 66,123,117,110,161, 60, 39,183,102,236,221, 91,179,119,110,173,221,186,183,102,240,222,
+    91,192, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,232, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,111,109,237,189,
+   183,182,246,222,219,219,123,  9,225, 61,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,237,
+   189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,
+   241,190, 55,198,250,223, 91,235,125,  9,225, 61,190,183,214,248,223, 27,227,124,111,173,237,191, 55,182,248, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   111,238,  1,192, 56,  7,  0,224, 28,  3,129,112, 46,  1,192, 55,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,
+   127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,
+   251,127,111,237,253,191,184,  7,  0,224, 28,  3,128,112, 14,  9,193,184,  7,  0,224, 28,  3,132,112,174, 25,195,184,119, 12,225,
+    28, 43,128,  9,225, 60, 39,132,240,158, 19,194,120, 79,113, 14, 37,196,184,151, 18,226, 92, 75,138,113, 78, 37,196,184,151, 16,
+   226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135,
+    16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 22,226,220, 91,139,113,110, 45,196,184,
+   151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 75,138,113, 46, 37,198, 56,215, 26,226, 28,115,142,113,206, 49,198,
+     4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238,
+    61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,
+   238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,225, 60, 39,132,240,158, 19,194,120, 79,
+    73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 40, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,  1, 61,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,145,114, 78, 73,201, 57, 39, 36,228,156,144, 79,114, 78, 73,
+   201, 57, 39, 36,228,156,139,147,114, 14, 81,202, 57, 87, 42,229, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,114,206,
+    89,203, 57,103, 44,229,156,179,150,114,206, 89,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,
+   238, 93,203,185,119, 46, 19,194,120, 79,115, 14,101,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,
+   115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,  9,225, 61,205,185,183, 54,230,220,219,
+   155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,  9,238,113,205,185,183, 54,230,220,
+   219,155,115,110,113,205,185,183, 56,230,220,216, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,115,174,117,206,185,215, 58,231, 92,232, 79,115,174,116, 39,185,
+   215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,
+   185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,121,207, 57,231, 60,231,156,240, 79,  9,225, 61,
+   207,  4,247, 60,231,130,123,158,115,206,121,207, 57,231, 60,231,156,251,158,  9,225, 60, 39,132,240,158, 19,194,120, 79,116, 14,
+   129,208, 58,  7, 64,232, 29,  3,160,116, 14,128, 39,132,240,158, 19,194,120, 79,116, 46,133,208,186, 23, 66,232, 66,123,161,116,
+    33, 61,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,208,186, 23, 66,232, 93, 11,161,
+   116, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,209, 58, 39, 68,232,157, 16, 79,116,110,140, 39,186, 39, 68,232,221, 19,
+   163,116, 33, 60, 39,132,240,158, 19,194,120, 79,116,142,145,210, 58, 71, 72,233, 29, 35,164,116,142,144, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,116,174,149,210,186, 87, 74,233, 93, 43,165,116,
+   174,149,210,186, 87, 74,233, 93, 43,165,116,174,149,210,186,103, 76,233,221, 59,168,117,  1, 60, 39,132,240,158, 19,194,120, 79,
+   117, 46,165,213, 58,183, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,129, 61,214, 58,199, 88,235, 29, 99,
+   172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29,
+    99,172,117,142,177,214, 58,199, 86,234,221, 75,169,117, 46,165,212,132,240,158, 19,221, 91,171,117, 46,173,212,186,215, 90,235,
+   157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,238,189,215,186,247, 94,235,221,123,175,117,238,188, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 69, 33, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67,
+    40,101, 12,161,148, 50,198, 88,203, 25, 99, 44,101,140,177,150,236, 29,131,176,118,  3, 44,101,140,177,150, 50,198, 88,203, 25,
+    99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,123,177,
+   118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,
+   178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,
+   147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,
+   236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,
+   100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59,
+    39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,200, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,
+   179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,
+   155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,
+   221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,
+   236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,152, 79,118,142,209,218, 59, 71,
+   104, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59,
+    39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217,
+    59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,
+   217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 32,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,118,174,213,218,187, 87,106,237, 93,171,
+   181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,
+   171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237,
+    93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,
+   237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,213,218,187, 87,106,237, 93,171,181,118,174,217,219,  4,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,
+   119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,
+   219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,
+   221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,
+   238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,
+   118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,
+   221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,119, 14,225,220, 59,151,114,
+   238, 93,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,
+   110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,220,187,119,110,237,221,195,185,119, 14,229,219,187,
+   119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,
+   219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,
+   221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,
+   238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,
+   118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,
+   183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,
+   187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,
+   221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,
+   237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,
+   110,237,221,187,183,118,238,225,220,187,151,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,
+   119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,
+   187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,119, 78,233,221, 59,167,116,238,157,211,187,119,142,233,
+   221, 59,167,118,239, 29,219,188,119,174,221,219,187,119,110,237,221,187,189,119,174,245,222,187,215,122,239, 93,235,189,119,174,
+   245,222,187,215,122,239, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,
+   190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,
+   243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,
+   157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,
+   239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,
+   124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,
+   231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223,
+    59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,
+   223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,251,192,119,206,
+   249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,
+   206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,
+   119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,
+   190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,
+   243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,
+   157,240, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,
+   100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27,
+    35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217,
+    27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,
+   217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,
+   200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54,
+    70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178,
+    54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,141,145,
+   178, 54, 70,200,217, 27, 35,100,108,141,145,178, 54, 70,193, 60, 39,132,240,158, 19,194,120, 79,120, 47,  5,224,188, 23,130,240,
+    94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,
+   240, 94,  8, 79,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  8, 39,132,240,158, 19,222, 27,195,120,143, 17,226, 60, 71,
+   136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60,
+    71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226,
+    60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,
+   226, 60, 71,136,241, 30, 32, 79,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 20, 39,132,240,158, 19,194,120, 79,120,207,
+    25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,227, 60,103,140,241,158, 51,198,120,
+   207, 25,227, 60,103,140,241,130,120, 79,120,239, 29,227,188,119,142,242,  2,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,
+   201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94,
+    75,201,121, 79, 41,229, 60,167,148,242,158, 83,203,121,111, 49,230,188,215,156,243,158,115,206,121,239, 61,231,188,247,150,243,
+   130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 15, 64, 39,189, 23,162,
+   244, 94,139,209,122, 47, 68, 39,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,
+   146,242, 94, 75,201,  9,225, 60, 39,132,240,158,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,
+   151,146,242, 94, 75,201,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,122, 79, 73,233, 61, 39,164,244,
+   158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,
+   244,158,147,210,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,
+   166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61,
+    71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,213,122,207, 93,235,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,
+   216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,
+   195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246,
+    30,195,216,123, 15, 97,236,  4,240,158, 19,194,123,217,123, 15,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,
+   246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,
+   180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,  9,225, 60, 39,132,
+   240,158, 19,194,123,217,123, 47,101,236,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,123,143,117,239, 32, 87,190, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,124, 15,128, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,
+   225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95,
+    11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248,
+    95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,
+   248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,
+   194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190,
+    23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,
+   190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,
+   240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,
+   133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,124,
+    47,133,240,190, 23,194,248, 95, 11,225,124, 47,133,240,190, 23,194,248, 95, 11,225,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,
+   226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159,
+    19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,
+   159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,
+   248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,
+   196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62,
+    39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241,
+    62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,
+   241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,
+   137,241, 62, 39,196,248,130,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   124, 47,133,240,190, 23,194,248, 95, 11,225,124, 33, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,124,111,141,241,190, 48,158,248,223, 27,227,124,111,141,241,190, 48,158,248,223, 24, 79,
+    66,232, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146,
+    18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,
+   146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,
+   144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,
+   132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33,
+    36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9,
+    33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,
+     9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72,
+    73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,
+    72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 36,132,144,146,
+    18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,232, 93, 11,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 61,  8,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 66, 40, 69,  8,132,240,158,133,130,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,244, 44,133,144,178, 22,  9,225, 60, 39,132,240,158, 19,194,120, 79,124,143,145,242, 62, 71,
+   200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62,
+    71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242,
+    62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,
+   242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,
+   145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,
+   143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,
+   124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,
+   228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31,
+    35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249,
+    31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,
+   249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,200,249, 31, 35,228,124,143,145,242, 62, 71,
+   200,249, 31, 35,228,124,143,145,242, 62, 64,158, 19,194,120, 79,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190,
+    87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,
+   190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,
+   242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,
+   149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202,249, 95, 43,229,124,
+   175,149,242,132,240,158, 19,194,120, 79,124,175,149,242,190, 87,202,249, 95, 43,229,124,175,149,242,190, 87,202, 19,194,120, 79,
+   124,175,149,242,190, 87,202,249, 95, 43,229,124,161, 60, 39,132,240,158, 19,194,120, 79,124,175,149,242,190, 87,202,249, 95, 43,
+   229,124,175,148, 39,132,247,204,249,223, 59,232, 55, 38,228,220,155,144,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,
+   224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,
+     5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,120, 79, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120,
+    47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,
+   228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7,
+    32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,112,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,
+   114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,
+   144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,
+   228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7,
+    32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,
+   114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,
+   144,114, 14, 65,200, 56, 79,  9,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228,
+    28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,250, 76, 24, 94, 11,
+   193,120,131,144,114, 14, 96,223, 75,233,125, 47,165,244,155,147,114,110, 77,201,185, 55, 38,228,220,133,224,188, 23,130,240, 94,
+    11,193,120, 47, 16,114, 14, 23,130,240, 94, 11,193,120, 47,  5,226, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,
+     7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28, 47,  5,224,188, 23,136,
+    57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14,
+    65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,231,  0,224,  4,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,
+   213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,
+   170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181,
+    86,170,213, 90,171, 85,106,173, 85,170,181,245, 62,167,212,171, 66,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 72, 41,  5, 32,164, 20,130,144,
+    82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 16,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 16,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,
+     0,224, 28,  3,128,112, 14,  0, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72,
+    41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 33, 60, 39,132,240,158, 19,194,120, 79,
+    56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 51,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 65,152, 51,  6, 96,204, 25,131, 48,102, 19,193,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,130, 19,206,  9,193,  9,225, 60,224,
+   132,240,158,112, 78,  8, 79,  9,231,  4,224,156, 19,130, 19,206,  9,193, 56, 39,  4,224,156, 19,130,112, 65,152, 51,  6, 96,204,
+    39,131, 48,158, 12,193,152, 51,  6, 96,204, 25,131, 48,158, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,
+     4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 51,130,112, 66,121,193, 56, 39,  4,224,132,240,158,112, 78,  9,193, 56, 39,  4,224,156, 19,130, 19,206,  9,
+   193, 56, 39,  4,224,156, 19,130, 19,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,  4, 39,156, 19,130,112, 78,  8, 79, 56, 39,  4,224,156, 19,130, 19,
+   206,  8, 79,  9,225, 60,224,156, 19,130,112, 78,  9,193, 56, 33, 60, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,130,112, 78,  9,193, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 65,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 51,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 65,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,
+   193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 51,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112,
+    78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 65,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 56, 39,  4,224,156, 19,
+   130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,
+   131, 48,102, 12,194,120, 79, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,
+   224,156, 19,130,112, 78,  9,193, 56, 47,172, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,155, 16,102, 12,193,152, 51,  6, 96,204,224,156, 19,130,112, 78,  9,193, 56,
+    39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,190,176,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,108, 65,152,
+    51,  6, 96,204, 25,131, 51,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,
+     9,193, 56, 39,  4,224,156, 19,130,250,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,
+   193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,153,177,  6, 96,204, 25,131, 48,102, 12,206,  9,193, 56, 39,  4,224,156, 19,130,
+   112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78, 11,235,  6, 96,204, 25,131, 48,
+   102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6,102,196, 25,131,
+    48,102, 12,193,152, 51, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,
+   156, 19,130,112, 78,  9,193, 56, 47,172, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,155, 16,102, 12,193,152, 51,  6, 96,204,224,131, 48,158, 19,223, 99,236,125,143,
+   177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,
+   143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,
+   125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,
+   237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,
+   107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251,
+    95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,
+   251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,
+   218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,
+   231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247,
+    62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,237,125,175,181,
+   246,190,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,
+   185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,115,238,125,
+   207,185,247, 62,231,220,251, 95,107,237,125,175,181,246,190,215,218,251,159,107,237,125,175,181,246,190,215,218,251, 95,107,237,
+   125,175,181,246,190,215,220,251, 95,107,239,126, 15,189,247,191, 16,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,190,231,220,251,159,115,238,  9,239,185,247, 62,231,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,
+   115,238,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 30,  3,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 79,  9,225, 60, 39,
+   132,240,158, 14,193,216, 59,  7, 96,236, 29,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   126, 79,201,249, 63, 39,228,252,159,144, 79,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,
+   242,126, 65, 60, 39,191, 39,228,252,159,147,242,126, 79,200, 39,191, 39,228, 19,223,147,242,126, 79,201,249,  4,240,158, 19,194,
+   120, 79, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97,
+    76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10,
+    97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 66,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 93,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230,252,223,155,
+   243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230, 19,194,
+   120, 79,126,143,209,250, 63, 71,232,253, 31,163,245,126,175,213,250,191, 87,234,253, 66,120, 79,126,207,217,251, 63,103,236,253,
+   159,179,246,126,207,216, 39,132,240,158, 19,223,155,247,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,200, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,127, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127, 79,
+   233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127,
+    79,233,253, 63,167,246,254,223,219,251,127,143,241,254, 63,199,248,255, 31,227,252,127,143,240, 39,132,240,158, 19,194,123,253,
+     9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,
+   120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,
+   255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,248,  1,  0, 32,  4,  0,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  4, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79, 34,228, 92,139,145,114, 46, 69,200,184, 79, 34,
+   228, 92,139,145,112,158, 69,200,184, 79, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,184, 79,
+   128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,
+     2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160,
+    20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,
+   160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,
+     0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,
+     5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64,
+    40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1,
+    64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,
+     1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  4, 19,194,124,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,144,
+    18,  2, 64, 72,  9,  1, 32, 32, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+   128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  2,192, 88, 11,  1, 96, 44,
+     5,128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128,176, 22,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160,
+    52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160, 52,  6,128,208, 26,  3, 64,104, 15,  1,
+   224, 60,  7,128,240, 30,  3,192,128,158, 19,194,120, 79,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 36, 39,132,240,158,
+    19,224, 84, 10,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,
+   240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,
+   132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60,
+    39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,240, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,
+   129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92,
+    11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 25,  2,224,
+    92, 11,129,176, 46,  5,192,184, 22, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,
+   194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158,
+    19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,
+   158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,240, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,
+   184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,
+   192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224,116, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,
+     5,192,184, 23,  2,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    15,225,252, 63,135,240,158, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,
+   127, 15,225,252, 63,135,240,254, 31,195,248,127,  9,225,252, 63,132,240,254, 19,194,120,127,  9,225,252, 63,135,240,254, 31,195,
+   248,127, 15,225,252, 63,132,240,254, 31,195,248,127,  9,225,252, 39,135,240,158, 19,194,120, 79,  9,225, 60, 63,132,240,158, 19,
+   194,120,127,  9,225,252, 39,135,240,158, 31,195,248,127,  9,225,252, 63,132,240,254, 19,194,120,127,  9,225,252, 39,135,240,158,
+    31,194,120,127,  9,225,252, 63,132,240,254, 19,194,120,127, 15,225,252, 63,132,240,254, 31,195,248,127, 15,225,252, 63,132,240,
+   254, 31,195,248,127,  9,225,252, 63,135,240,254, 19,195,248, 79, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 39,135,
+   240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,158, 19,194,120, 79,  9,225,252, 63,
+   135,240,158, 31,195,248,127, 15,225,252, 39,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79, 14, 97,204, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,
+    59,103,108,237,157,179,174,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,
+   219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,184, 31,  3,224,
+   124, 15, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,
+   206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,
+   118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,
+   182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,
+   179,182,118,206,217,219, 59,103,108,237,157,184, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15, 59,103,108,237,
+   157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,220, 15,129,231,108,237,157,179,182,118,206,217,219, 59,103,108,
+   237,157,179,182,118,206,217,219,129,231,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,215,129,231,
+   108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+     6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,156,195,152,118,206,217,219, 59,135,112,238, 29,195,184,119, 14,225,
+   220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119,  8,
+    56, 42, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119,
+    78,233,221, 59,167,116,238, 29,195,184,119, 14,225,220, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,
+   119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,224, 28,  0, 84,118,206,217,219, 59,199,120,238,157,211,
+   186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,241,222, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238, 29,
+   195,184,119, 32,129,220, 59,144, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 29,195,184,119, 14,225,220, 59,135,112,238,
+    29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,118,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,
+     7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,140, 17,130,
+    48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,
+   130, 72,141, 17,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15, 67,168,117, 14,161,212, 58,135, 80,234,
+    29, 67,168,117, 17,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,
+   234, 35, 67,168,117, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,161,216, 31,  3,224,124, 15, 67,168,117, 14,161,212, 58,135,
+    80,234, 29, 67,176, 62,  7,192,248, 31,  3,224,124, 15, 68,104,142,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15, 58,231, 92,235,157,115,174,117,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,
+   248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,
+   192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,
+     7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,
+   240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+    58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,
+   215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,117,206,
+   185,215, 58,231, 92,235,157,115,174,117,206,217,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,
+   206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,
+   117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,
+   174,117,206,185,215, 58,231, 92,235,157,115,174,118,206,185,215, 58,231, 92,235,157,115,174,122, 14,185,215, 58,231, 92,235,157,
+   115,174,117,206,185,215, 58,231, 92,235,157,115,182,118,206,217,219, 59,103,108,237,157,176, 84, 10,142,217,219, 58,231, 92,235,
+   157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,118,142,209,215, 58,231, 92,
+   235,157,115,180,117,206,185,215, 58,231, 92,244, 30,131,208,117,206,185,232, 58,231, 92,244, 30, 83,202,118,206,217,215, 58,231,
+    92,235,157,115,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 58,231, 92,235,157,115,174,117,206,185,215, 58,
+   231, 92,235,157,115,174,117,206,185,215, 58,231,108,237,157,179,174,118,206,217,219, 58,231, 92,235,193, 56, 39,  4,224,156, 19,
+    58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,
+   215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,
+   185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,219, 58,231,108,244, 30,131,174,117,
+   207, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,
+   117,206,185,215, 58,231, 92,235,157,115,174,117,207, 65,232, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,
+   208,122, 15, 65,232, 61,  7, 92,235,157,115,208,117,206,185,215, 58,231,160,244, 30,131,174,122, 15, 65,232, 58,231, 92,235,157,
+   115,174,117,206,185,232, 58,231,160,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 59, 71, 92,237,
+    29,115,180,117,206,185,215, 58,231, 92,244, 29,115,174,117,206,185,218, 58,231,104,237, 29,115,174,117,206,185,215, 58,231, 92,
+   235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231,
+    92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,
+   231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,118,206,217,215,
+    59, 71,104,237, 29,163,180,118,142,209,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,
+   218, 59, 71,104,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,163,180,117,206,185,215, 58,231, 92,235,157,115,174,117,206,
+   185,215, 58,231, 92,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,163,180,118,142,  1,192, 56,  7,  0,224, 28,  3,128,112,
+     1, 80, 42,  5, 64,168,237,157,115,174,117,206,185,219, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,
+   117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,
+   202,121, 78,217,219, 59,103,108,244, 29,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,
+   179,182,118,206,217,219, 60,167,108,237,157,179,182,122, 15, 65,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,
+   157,179,174,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,
+   237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,
+   108,237,157,176, 84, 10,129, 80, 42,  5, 64,168, 21,  2,163,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,176, 84, 10,129, 80, 42,  5, 64,168,237,157,115,174,117,206,185,215,
+    58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,
+   215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,
+   185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,122,
+    15, 65,232, 58,231, 92,235,158,131,208,122, 15, 65,232, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,
+   112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,
+   128,112, 15, 81,234, 61, 80, 82, 10, 65, 67,128,112, 14,  1,192, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,
+   115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,
+   158,131,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,208,122, 15, 65,215, 58,231, 92,
+   235,157,115,174,117,206,185,215, 61,  7, 92,235,157,115,174,117,206,217,219, 59,103,108,237,157,179,208,118,206,217,219, 58,231,
+    92,235,157,179,182,117,206,185,215,129,240, 62,  7,192,243,174,117,206,185,215, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,115,175,  3,224,124, 15, 59,103,108,237,157,179,174,117,206,185,215, 58,231, 92,235,157,115,175,  3,224,124, 15,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,
+     1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112,
+    14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,
+   112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,
+   182,118,206,220, 15,129,240, 62,  7,157,179,182,118,206,217,219, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,
+     0,224, 28,  3,128,118,206,217,219, 59,103,110,  7,192,248, 31,  3,224,124, 15, 58,231, 92,235,157,115,174,117,206,185,215, 58,
+   231, 92,235,157,120, 31,  3,224,124, 15, 58,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  8, 31,  3,224,124, 15, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,
+     1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112,
+    14,  1,192,129,240, 62,  7,192,248, 31,  3,224,124, 15, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  2,  7,192,248, 31,
+     3,224,124, 15, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,
+   128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192,129,240, 62,  7,192,
+   248, 31,  3,224,124, 15, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 32,124, 15, 59,103,110,  7,192,248, 31,  3,224,124, 15,129,240, 62,
+     7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,
+   240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,208,117,206,185,232, 58,231, 92,235,157,115,174,117,206,185,
+   215, 61,  7,160,244, 30,131,208,122, 15, 65,232, 58,231, 92,235,157,115,174,117,207, 65,215, 58,231, 92,235,157,115,174,117,206,
+   185,215, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61,  7,160,235,161,  3,208,122, 15, 65,215, 58,231, 92,235,157,115,174,117,
+   208,129,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,
+   117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,
+   174,117,206,185,232, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,
+   115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,
+   157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,122, 15, 65,215, 61,  7,160,
+   235,158,131,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,122, 15, 65,232, 58,231,
+   160,244, 30,131,208,122, 15, 65,232, 61,  7,160,244, 30,131,208,122, 14,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,
+   231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215,
+     5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,
+   129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,168, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,224,124, 15, 58,231, 92,235,157,115,
+   174,117,206,185,215, 58,231, 92,235,157,115,175,  3,224,124, 15, 58,231, 92,235,157,115,174,117,206,185,215, 58,240, 62,  7,192,
+   248, 31,  3,224,124, 15, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,
+   157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,
+   235,157,115,174,117,224,121,215, 58,231, 92,235,158,131,208,122, 32,124, 15,129,240, 62,  7,192,248, 31,  3,206,185,215, 58,231,
+    92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,120, 31,  3,224,124, 15, 58,231, 92,235,157,115,174,117,206,185,215, 58,
+   240, 62,  7,192,248, 31,  3,224,124, 15, 61,  7,160,244, 30,131,208,122, 15, 65,232, 61, 16, 62,  7,192,248, 31,  3,224,124, 15,
+    56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,
+   192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,
+     1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112,
+    14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,
+   112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,
+   128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224,  4,243,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,
+    28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,
+   224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224,  4,240,158, 19,194,120, 79,  9,225,
+    60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,
+   225, 60, 39,132,240,158, 19,194,120, 79,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,176, 39,132,240,158, 19,194,120, 79,
+   129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,
+   124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,194,120, 79, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 77,233,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 55,166,244,222,155,211,122,111, 68,168,149, 18,162, 84, 74,137,
+    81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84,
+    74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 83,122,111, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,
+   168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137,
+    81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84,
+    74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,169,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,
+    77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,
+   111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 83,122,111, 77,233,189, 55,
+   166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189,
+    55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,
+   189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,
+    77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,
+   111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,
+   122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,194,120, 79, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,166,244,222,155,211,122,111, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,
+   168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,
+   211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,
+   155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,
+   222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 54,134,228,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27,
+    67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 49,134, 48,198,
+    24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,
+   198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134,
+    48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,
+   134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140,
+    54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,
+   180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,
+   161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109,
+    13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,
+   109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,
+   104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,
+   160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,
+     4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40,
+    37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65,
+    40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9,
+    65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,
+     9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80,
+    74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130,
+    80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,
+   130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148,
+    18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74, 54,134,208,218, 27, 67,
+   104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,
+   228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55,
+    38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185,
+    55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,
+   185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,
+   201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,130,120, 79,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint64_t ucd_text_properties_records[1045] = {
+    0x3e218000221, 0x3e220800421, 0x3e229040641, 0x3e220880821, 0x3e230880821, 0x3e2298c0a61, 0x3e228000221, 0x3e220000221,
+    0x3e230908c1d, 0x3e202008e15, 0x3e202949015, 0x3e238009215, 0x3e238009417, 0x3e238009615, 0x3e200009215, 0x3e202989015,
+    0x3e202809816, 0x3e202809a12, 0x3e240009419, 0x3e24b1c9c15, 0x3e243009e11, 0x3e24ba09c15, 0x3e24800a015, 0x3e25424a20d,
+    0x3e24b289c15, 0x3e2001c9c15, 0x3e200009219, 0x0d70cac9209, 0x3e200009415, 0x3e200009218, 0x3e200309210, 0x0d70d2c9205,
+    0x3e200008419, 0x3e20280a412, 0x3e22d882621, 0x3e24880281d, 0x3e200011815, 0x3e238009617, 0x3e238011417, 0x3e20000921a,
+    0x3e200012a15, 0x3e200012a18, 0x3e20000129a, 0x0d70d2d2a07, 0x3e202801014, 0x3e21e350422, 0x3e20001129a, 0x3e23801161a,
+    0x3e238011419, 0x3e250012a0f, 0x3e200012c18, 0x3e20d2c1205, 0x3e200292a15, 0x3e202801013, 0x3e200012a0f, 0x0d70cac1209,
+    0x0d70cad1209, 0x3e200012a19, 0x0d70d2d1205, 0x0d70d2c1205, 0x0d70eac1207, 0x0d70cac1208, 0x0d70d2c1206, 0x3e206ac1206,
+    0x3e20eac1206, 0x3e20d2c1206, 0x3e2002c1218, 0x3e2002d1218, 0x3e206ad2a06, 0x3e206ac2c06, 0x3e20ead2a06, 0x3e200001218,
+    0x3e2002d2c18, 0x11d002c1218, 0x3e25f3902ac, 0x3e25f3928ac, 0x0c80cac1209, 0x0c80d2c1205, 0x0c800001218, 0x00000000000,
+    0x0c80d2c1206, 0x3e2001c1c15, 0x3e200281215, 0x0c80cad1209, 0x0c80d2d1205, 0x0cc0cac1209, 0x0cc0d2c1205, 0x0c800001219,
+    0x0dc0cac1209, 0x0dc0cad1209, 0x0dc0d2d1205, 0x0dc0d2c1205, 0x0dc0800121a, 0x0dc5f3802ac, 0x3e25f3802ac, 0x0dc5f3802ab,
+    0x0e60cac1209, 0x0e60eac1206, 0x0e6082c1215, 0x0e60b001215, 0x0e608281215, 0x0e60d2c1205, 0x0e60a1c1c15, 0x0e6002c0411,
+    0x0e60000121a, 0x0e638001417, 0x07d5f3802ac, 0x07d10000411, 0x07d10001215, 0x07d10000e15, 0x07d16bc2e07, 0x07d16ac1215,
+    0x07d10281215, 0x0a0663412c2, 0x3e2663412c2, 0x0a000001219, 0x0a068001219, 0x0a038001615, 0x0a068001617, 0x3e24b1c1c15,
+    0x0a06b1c1c15, 0x0a00000121a, 0x0a05f3802ac, 0x3e268000e15, 0x0a06e340222, 0x0a06a000e15, 0x3e26a000e15, 0x0a06eac1207,
+    0x3e26eac1206, 0x0a06424220d, 0x0a064242215, 0x0a0641c2215, 0x0a068001215, 0x0a06eac1206, 0x0a05424220d, 0x0a06800121a,
+    0x0876a001215, 0x08768001215, 0x0876e3412c2, 0x0876eac1207, 0x0875f3802ac, 0x0aa6eac1207, 0x0aa5f3802ac, 0x0a51424220d,
+    0x0a516ac1207, 0x0a55f3802ac, 0x0a516ac1206, 0x0a50000121a, 0x0a500001215, 0x0a5031c1c15, 0x0a502000e15, 0x0a510001417,
+    0x07b16ac1207, 0x07b5f3802ac, 0x07b16ac1206, 0x07b10001215, 0x07b12001215, 0x08c16ac1207, 0x08c5f3802ac, 0x08c10001215,
+    0x0a068001218, 0x13b5f3802ac, 0x13b0f3802ea, 0x13b0eac1207, 0x3e20a000415, 0x13b0c24220d, 0x13b08001215, 0x13b0eac1206,
+    0x1450eac1207, 0x1455f3802ac, 0x1450f3802ea, 0x1450f3802aa, 0x1450c24220d, 0x14538001617, 0x1450800120f, 0x1450800160f,
+    0x1450800121a, 0x14538001417, 0x14508001215, 0x1365f3802ac, 0x1360f3802ea, 0x1360eac1207, 0x1360c24220d, 0x13608001215,
+    0x1405f3802ac, 0x1400f3802ea, 0x1400eac1207, 0x1400c24220d, 0x14008001215, 0x14038001417, 0x1475f3802ac, 0x1470f3802ea,
+    0x1470eac1207, 0x1470f3802aa, 0x1470c24220d, 0x1470800121a, 0x1470800120f, 0x15a5f3802ac, 0x15a0eac1207, 0x15a0f3802aa,
+    0x15a0f3802ea, 0x15a0c24220d, 0x15a0800120f, 0x15a0000121a, 0x15a38001417, 0x1545f3802ac, 0x1540f3802ea, 0x1540eac1207,
+    0x1540c24220d, 0x15408002c15, 0x1540000120f, 0x1540800121a, 0x1590eac1207, 0x1595f3802ac, 0x1590f3802ea, 0x15908002c15,
+    0x1590f3802ac, 0x1590f3802aa, 0x1590c24220d, 0x15b5f3802ac, 0x15b0f3802ea, 0x15b0eac1207, 0x15b0f3802aa, 0x15b0eac12c7,
+    0x15b0800121a, 0x15b0800120f, 0x15b0c24220d, 0x15b0800161a, 0x15c5f3802ac, 0x15c0f3802ea, 0x15c0eac1207, 0x15c0f3802aa,
+    0x15c0c24220d, 0x15c08001215, 0x1600e803007, 0x1605f3830ac, 0x1600e8030e7, 0x3e238001417, 0x1600e803006, 0x16008001215,
+    0x1600c24220d, 0x16008000415, 0x1640e803007, 0x1645f3830ac, 0x1640e8030e7, 0x1640e803006, 0x1640c24220d, 0x14a0eac1207,
+    0x14a08002c1a, 0x14a08002c15, 0x14a08001215, 0x14a08002815, 0x14a08000415, 0x14a08000e15, 0x14a0800121a, 0x14a5f3802ac,
+    0x14a0c24220d, 0x14a0800120f, 0x14a0800041a, 0x14a02801816, 0x14a02802412, 0x14a0f3802ea, 0x14a0f3804ea, 0x3e20800121a,
+    0x15e0e803007, 0x15e0f38300a, 0x15e5f3830ac, 0x15e0f3830ea, 0x15e0c24220d, 0x15e0a000415, 0x15e08001215, 0x15e0800301a,
+    0x0f00cac1209, 0x0f00eac1205, 0x3e208001215, 0x0f00d2c1206, 0x11e0eadb307, 0x11e0eac3527, 0x11e0eac3747, 0x1ae0eac1207,
+    0x1ae5f3802ac, 0x1ae08001215, 0x1ae08000415, 0x1ae0a001215, 0x1ae0800120f, 0x1ae0000121a, 0x1bd0cac1209, 0x1bd0d2c1205,
+    0x1b800000411, 0x1b80eac1207, 0x1b80800121a, 0x1b80a001215, 0x0d43090041d, 0x0d40eac1207, 0x0d402801816, 0x0d402802412,
+    0x0d30eac1207, 0x3e208000415, 0x0d30eac120e, 0x1720eac1207, 0x1725f3802ac, 0x1720f3802ea, 0x1730eac1207, 0x1735f3802ac,
+    0x1730f3802ea, 0x1740eac1207, 0x1745f3802ac, 0x1750eac1207, 0x1755f3802ac, 0x1630e803007, 0x1635f3830ac, 0x1630f3830ea,
+    0x16308000415, 0x16308003815, 0x1630e803006, 0x16308001215, 0x16338001417, 0x1630c24220d, 0x1630000120f, 0x09100001215,
+    0x3e203000e15, 0x3e202000e15, 0x09100000415, 0x3e200000415, 0x09100002c11, 0x09103000e15, 0x09102000e15, 0x0915f3802ac,
+    0x0911e342822, 0x0910c24220d, 0x0910eac1207, 0x0910eac1206, 0x1500eac1207, 0x1505f3802ac, 0x1500f3802ea, 0x1500000121a,
+    0x15002000e15, 0x1500c24220d, 0x1610e803007, 0x1620e803007, 0x1620c24220d, 0x1620800300f, 0x1620000301a, 0x1630000121a,
+    0x16f0eac1207, 0x16f5f3802ac, 0x16f0f3802ea, 0x16f08001215, 0x15f0e803007, 0x15f0f3830ea, 0x15f5f3830ac, 0x15f0f38300a,
+    0x15f5f3802ac, 0x15f0c24220d, 0x15f08003015, 0x15f0e803006, 0x15f0a003015, 0x3e25f3802ab, 0x1685f3802ac, 0x1680f3802ea,
+    0x1680eac1207, 0x1680f3802aa, 0x1680c24220d, 0x1680a000415, 0x16808001215, 0x16808000415, 0x1680800121a, 0x16a5f3802ac,
+    0x16a0f3802ea, 0x16a0eac1207, 0x16a0c24220d, 0x16d0eac1207, 0x16d5f3802ac, 0x16d0f3802ea, 0x16d08001215, 0x14f0eac1207,
+    0x14f0f3802ea, 0x14f5f3802ac, 0x14f0a000415, 0x14f08000415, 0x14f0c24220d, 0x1050c24220d, 0x1050eac1207, 0x1050eac1206,
+    0x1050a000415, 0x0f00eac1209, 0x16a08001215, 0x3e20f3802ea, 0x3e20eac1207, 0x0dc0d2c1206, 0x3e25f3828ac, 0x0c80cac1208,
+    0x0c800002c18, 0x3e23090041d, 0x3e23080281d, 0x3e21e003a22, 0x3e21f3802a2, 0x3e21f403d62, 0x3e20e340222, 0x3e216340222,
+    0x3e200010411, 0x3e200002811, 0x3e200000411, 0x3e203010411, 0x3e203013e11, 0x3e200012a11, 0x3e200001215, 0x3e202a11014,
+    0x3e202a11013, 0x3e202801816, 0x3e202811014, 0x3e202811013, 0x3e200011215, 0x3e203a14015, 0x3e200014015, 0x3e200290415,
+    0x3e23588083b, 0x3e22d88083c, 0x3e276340222, 0x3e27e340222, 0x3e286340222, 0x3e28e340222, 0x3e296340222, 0x3e248b0281d,
+    0x3e238011615, 0x3e238001615, 0x3e200011615, 0x3e200001615, 0x3e202003895, 0x3e202003815, 0x3e200301210, 0x3e2481c1c19,
+    0x3e202802412, 0x3e200001219, 0x3e21e344222, 0x3e21e341222, 0x00000000020, 0x3e29e340222, 0x3e2a6340222, 0x3e2ae340222,
+    0x3e2b6340222, 0x3e21e340222, 0x3e25000120f, 0x3e240001219, 0x0d70d2d2a06, 0x3e238001617, 0x3e238021417, 0x00000001400,
+    0x3e20000121a, 0x3e20cac1209, 0x3e20001161a, 0x3e200012a1a, 0x3e20d2d2a05, 0x3e20001141a, 0x3e200012a9a, 0x0d70cad2a09,
+    0x3e23800121a, 0x3e20d2c1285, 0x3e20000120f, 0x3e20001120f, 0x3e200002a0f, 0x0d70cad2a0e, 0x0d70cac120e, 0x0d70d2d2a0e,
+    0x0d70d2c120e, 0x0d70eac120e, 0x3e200012a99, 0x3e20001121a, 0x3e240001419, 0x3e238001419, 0x3e200004019, 0x3e20001c49a,
+    0x3e202819816, 0x3e20281a412, 0x3e20001929a, 0x3e20000449a, 0x3e208012a1a, 0x3e20cad2a1a, 0x3e20cad2a9a, 0x3e20d2d2a1a,
+    0x3e200002a1a, 0x3e200001299, 0x3e200019299, 0x3e200002a9a, 0x3e20001449a, 0x3e20000469a, 0x3e20800129a, 0x3e20001469a,
+    0x3e20001c69a, 0x3e20001aa9a, 0x3e20280101a, 0x3e200000e1a, 0x3e200000e9a, 0x23a0800121a, 0x0e10cac1209, 0x0e10d2c1205,
+    0x0cc0000121a, 0x0cc5f3802ac, 0x0cc00000e15, 0x0cc00000415, 0x0cc0000120f, 0x0f00d2c1205, 0x0780eac1207, 0x0780eac1206,
+    0x07808000415, 0x0785f3802ac, 0x3e202801015, 0x3e200001815, 0x3e200001211, 0x3e200003e11, 0x3e202000415, 0x1f40001c41a,
+    0x3e20001c41a, 0x3e23092841d, 0x3e20301a415, 0x3e20201a415, 0x3e20001c415, 0x1f40eadb806, 0x3e20e81c407, 0x1f40e81c40e,
+    0x3e20001b811, 0x3e25f3982ac, 0x11e0f3982aa, 0x3e20001c491, 0x3e20ec5c406, 0x3e20ec58206, 0x3e20eadb807, 0x3e20001c495,
+    0x3e20000441a, 0x19a0e81c807, 0x19a0e81c407, 0x3e20045b818, 0x19a0e81b806, 0x3e20045b811, 0x19b0ec5c807, 0x19b0ec5c407,
+    0x3e20001b815, 0x3e20ec5c806, 0x19b0ec5b806, 0x11d0eadc407, 0x11e0eadc407, 0x3e20801c41a, 0x3e20801c40f, 0x11e0801c41a,
+    0x11e0001c41a, 0x3e208012a0f, 0x3e20001c40f, 0x3e20801c49a, 0x19b0845c41a, 0x1f40e81c407, 0x1cc0eadc407, 0x1cc0eadb806,
+    0x1cc0001c41a, 0x18f0eac1207, 0x18f0eac1206, 0x18f08000415, 0x18f0a000415, 0x1d60eac1207, 0x1d60eac1206, 0x1d600000415,
+    0x1d602000e15, 0x1d602000415, 0x1d60c24220d, 0x0dc0eac1207, 0x0dc00001215, 0x0dc06ac1206, 0x1b30eac1207, 0x1b30eac120e,
+    0x1b35f3802ac, 0x1b308001215, 0x1b30a000415, 0x1b308000415, 0x3e2082c1218, 0x13c0eac1207, 0x13c5f3802ac, 0x13c0f3802ea,
+    0x13c0000121a, 0x3e20800120f, 0x14b0eac1207, 0x14b00002c15, 0x14b02000e15, 0x1580f3802ea, 0x1580eac1207, 0x1585f3802ac,
+    0x1580a000415, 0x1580c24220d, 0x13b08002c15, 0x1650c24220d, 0x1650eac1207, 0x1655f3802ac, 0x1650a000415, 0x16b0eac1207,
+    0x16b5f3802ac, 0x16b0f3802ea, 0x16b08001215, 0x1695f3802ac, 0x1690f3802ea, 0x1690eac1207, 0x16908001215, 0x16908000415,
+    0x1690a000415, 0x1690c24220d, 0x15e0e803006, 0x1660eac1207, 0x1665f3802ac, 0x1660f3802ea, 0x1660c24220d, 0x16608001215,
+    0x1660a000415, 0x1670e803007, 0x1675f3830ac, 0x1670e803006, 0x16708003015, 0x1510eac1207, 0x1510f3802ea, 0x1515f3802ac,
+    0x1510a000415, 0x1510eac1206, 0x1510c24220d, 0x11e0eadcb87, 0x11e0eadcda7, 0x00008004e04, 0x00008010003, 0x0000001c400,
+    0x07d40001219, 0x3e2031d9c15, 0x3e20001a415, 0x3e203299c15, 0x3e2001d9c15, 0x3e200018e15, 0x3e20001c015, 0x3e20301c411,
+    0x3e20031c410, 0x3e24b1da415, 0x3e20301c415, 0x3e24ba1a415, 0x3e2001db815, 0x3e24b29b815, 0x3e202018e15, 0x3e23801c415,
+    0x3e24001c419, 0x3e24301c411, 0x3e20001c419, 0x3e238019417, 0x3e238019615, 0x3e202028e15, 0x3e20002c415, 0x3e23802c415,
+    0x3e238029417, 0x3e238029615, 0x3e20022c415, 0x3e202829816, 0x3e20282a412, 0x3e24002c419, 0x3e24b1ea415, 0x3e24302c411,
+    0x3e24ba2a415, 0x3e24802c415, 0x3e25426c40d, 0x3e24b2ab815, 0x3e2001eb815, 0x3e20002c419, 0x0d70caec409, 0x3e20002c418,
+    0x3e20032c410, 0x0d70d2ec405, 0x3e202022415, 0x3e202821816, 0x3e202822412, 0x3e203022415, 0x3e200023815, 0x19b0ec64407,
+    0x19b0ec64807, 0x3e20ec64806, 0x3e20f3a38a6, 0x11e0eae4407, 0x3e238029617, 0x3e20002c41a, 0x3e20002121a, 0x3e200021219,
+    0x3e206340222, 0x3e20000501a, 0x1910eac1207, 0x0c806ac120e, 0x0c80000120f, 0x0c80000121a, 0x0c80800121a, 0x0ca0eac1207,
+    0x0c90eac1207, 0x0d20eac1207, 0x0d20800120f, 0x0ce0eac1207, 0x0ce0eac120e, 0x0e30eac1207, 0x0e35f3802ac, 0x0280eac1207,
+    0x02808000415, 0x01e0eac1207, 0x01e08000415, 0x01e0eac120e, 0x0fa0cac1209, 0x0fa0d2c1205, 0x1190eac1207, 0x1040eac1207,
+    0x1040c24220d, 0x0db0cac1209, 0x0db0d2c1205, 0x0e20eac1207, 0x0ef0eac1207, 0x0ef08001215, 0x0e40cac1209, 0x0e40d2c1205,
+    0x1900eac1207, 0x0d70eac1206, 0x19316ac1207, 0x07c16ac1207, 0x07c10000415, 0x07c1000120f, 0x07e16ac1207, 0x07e1000121a,
+    0x07e1000120f, 0x09f16ac1207, 0x09f1000120f, 0x07f16ac1207, 0x07f1000120f, 0x07316ac1207, 0x0731000120f, 0x07300000415,
+    0x07416ac1207, 0x07410001215, 0x06416ac1207, 0x06516ac1207, 0x0651000120f, 0x13116ac1207, 0x1315f3802ac, 0x1311000120f,
+    0x13110000415, 0x13112000415, 0x13110001215, 0x06916ac1207, 0x0691000120f, 0x06910001215, 0x06a16ac1207, 0x06a1000120f,
+    0x08b16ac1207, 0x08b1000121a, 0x08b5f3802ac, 0x08b1000120f, 0x08b10000415, 0x08b10004015, 0x08616ac1207, 0x08600000415,
+    0x08216ac1207, 0x0821000120f, 0x08316ac1207, 0x0831000120f, 0x08416ac1207, 0x08410001215, 0x0841000120f, 0x0af16ac1207,
+    0x0b014ac1209, 0x0b0152c1205, 0x0b01000120f, 0x0a76eac1207, 0x0a75f3802ac, 0x0a76424220d, 0x0a06000120f, 0x0c016ac1207,
+    0x0c05f3802ac, 0x0c010000411, 0x08e16ac1207, 0x08e1000120f, 0x08d6eac1207, 0x08d5f3802ac, 0x08d6800120f, 0x08d6a001215,
+    0x08f16ac1207, 0x08f5f3802ac, 0x08f12001215, 0x06d16ac1207, 0x06d1000120f, 0x08016ac1207, 0x12c0f3802ea, 0x12c5f3802ac,
+    0x12c0eac1207, 0x12c0a000415, 0x12c08001215, 0x12c0000120f, 0x12c0c24220d, 0x13d5f3802ac, 0x13d0f3802ea, 0x13d0eac1207,
+    0x13d08001215, 0x13d0e3412c2, 0x13d0a000415, 0x18e0eac1207, 0x18e0c24220d, 0x15d5f3802ac, 0x15d0eac1207, 0x15d0f3802ea,
+    0x15d0c24220d, 0x15d08000415, 0x15d0a000415, 0x13a0eac1207, 0x13a5f3802ac, 0x13a08001215, 0x13a08002c15, 0x13f5f3802ac,
+    0x13f0f3802ea, 0x13f0eac1207, 0x13f0eac12c7, 0x13f0a000415, 0x13f08001215, 0x13f08000415, 0x13f0a001215, 0x13f0c24220d,
+    0x13f08002c15, 0x15c0800120f, 0x1420eac1207, 0x1420f3802ea, 0x1425f3802ac, 0x1420a000415, 0x14208001215, 0x1430eac1207,
+    0x1430a000415, 0x13e0eac1207, 0x13e5f3802ac, 0x13e0f3802ea, 0x13e0c24220d, 0x1575f3802ac, 0x1570f3802ea, 0x1570eac1207,
+    0x1570f3802aa, 0x14d0eac1207, 0x14d0f3802ea, 0x14d5f3802ac, 0x14d0a000415, 0x14d08000415, 0x14d08001215, 0x14d0c24220d,
+    0x1460eac1207, 0x1460f3802aa, 0x1460f3802ea, 0x1465f3802ac, 0x14608001215, 0x1460c24220d, 0x12e0eac1207, 0x12e0f3802aa,
+    0x12e0f3802ea, 0x12e5f3802ac, 0x12e08002c15, 0x12e0a000415, 0x12e08000e15, 0x12e08001215, 0x1440eac1207, 0x1440f3802ea,
+    0x1445f3802ac, 0x1440a000415, 0x14408001215, 0x1440c24220d, 0x09100002c15, 0x1410eac1207, 0x1415f3802ac, 0x1410f3802ea,
+    0x14108001215, 0x1410c24220d, 0x1520e803007, 0x1525f3830ac, 0x1520f38300a, 0x1520f3830ea, 0x1520c24220d, 0x1520800300f,
+    0x1520a000415, 0x1520800301a, 0x1480eac1207, 0x1480f3802ea, 0x1485f3802ac, 0x14808001215, 0x1060cac1209, 0x1060d2c1205,
+    0x1060c24220d, 0x1060800120f, 0x1060eac1207, 0x1560eac1207, 0x1560f3802aa, 0x1560f3802ea, 0x1565f3802ac, 0x1560eac12c7,
+    0x1560a000415, 0x15608000415, 0x1560c24220d, 0x1370eac1207, 0x1370f3802ea, 0x1375f3802ac, 0x13708002c15, 0x1530eac1207,
+    0x1535f3802ac, 0x1530f3802ac, 0x1530f3802ea, 0x1530eac12c7, 0x15308002c15, 0x15308001215, 0x15308000415, 0x1530a000415,
+    0x1490eac1207, 0x1495f3802ac, 0x1490f3802ea, 0x1490eac12c7, 0x14908000415, 0x1490a000415, 0x14908002c15, 0x1070eac1207,
+    0x14e0eac1207, 0x14e0f3802ea, 0x14e5f3802ac, 0x14e0f3802ac, 0x14e0a000415, 0x14e08000415, 0x14e0c24220d, 0x14e0800120f,
+    0x14c08002c15, 0x14c08000e15, 0x14c0eac1207, 0x14c5f3802ac, 0x14c0f3802ea, 0x1390eac1207, 0x1395f3802ac, 0x1390eac12c7,
+    0x1390c24220d, 0x1380eac1207, 0x1380f3802ea, 0x1385f3802ac, 0x1380c24220d, 0x16e0eac1207, 0x16e5f3802ac, 0x16e0f3802ea,
+    0x16e0a001215, 0x1705f3802ac, 0x1700eac12c7, 0x1700f3802ea, 0x1700eac1207, 0x1700a000415, 0x17008004415, 0x1700c24220d,
+    0x15a38001617, 0x15a08000415, 0x0140eac1207, 0x0140eac120e, 0x01408000415, 0x1920eac1207, 0x19208001215, 0x0320eac1207,
+    0x0320eac1807, 0x0320eac2407, 0x0320e342822, 0x0320e341822, 0x0320e342422, 0x0325f3802ac, 0x0500eac1207, 0x0500eac1807,
+    0x0500eac2407, 0x1080eac1207, 0x1080c24220d, 0x1080a000415, 0x2080eac1207, 0x2080c24220d, 0x1030eac1207, 0x1035f3802ac,
+    0x1030a000415, 0x1c20eac1207, 0x1c25f3802ac, 0x1c20a000415, 0x1c208000415, 0x1c208001215, 0x1c20800121a, 0x1c20eac1206,
+    0x1c20c24220d, 0x1c20800120f, 0x1090cac1209, 0x1090d2c1205, 0x1090800120f, 0x10908000415, 0x1090a000415, 0x10908001215,
+    0x11a0eac1207, 0x11a5f3802ac, 0x11a0f3802ea, 0x11a0eac1206, 0x2080eadb806, 0x1f30eadb806, 0x1f40001b815, 0x1205f39a8ac,
+    0x1f40f3982ea, 0x2080e81c407, 0x1200e819207, 0x19b0ec59206, 0x1f30e81c407, 0x2f30eac1207, 0x2f30800121a, 0x2f35f3802ac,
+    0x2f30a000415, 0x3e20f3802aa, 0x0c85f3802ac, 0x3e208001219, 0x3e25424220d, 0x05f0800121a, 0x05f5f3802ac, 0x05f08000415,
+    0x05f0a000415, 0x05f08001215, 0x0e15f3802ac, 0x1c30eac1207, 0x1c35f3802ac, 0x1c30eac1206, 0x1c30c24220d, 0x1c30800121a,
+    0x1260eac1207, 0x1265f3802ac, 0x11b0eac1207, 0x11b5f3802ac, 0x11b0c24220d, 0x11b38001417, 0x1270eac1207, 0x1270eac1206,
+    0x1275f3802ac, 0x1270c24220d, 0x1b616ac1207, 0x1b61000120f, 0x1b65f3802ac, 0x0a614ac1209, 0x0a6152c1205, 0x0a65f3802ac,
+    0x0a616ac1206, 0x0a61424220d, 0x0a610001815, 0x3e26800120f, 0x3e26800161a, 0x3e268001617, 0x3e26800121a, 0x00000004480,
+    0x3e20801aa9a, 0x3e2084853da, 0x19a0801c41a, 0x3e20039d4b8, 0x3e20000381a,
+};
+
+template<size_t Shift, size_t Width>
+[[nodiscard]] constexpr uint64_t ucd_text_properties_field(uint64_t record) noexcept
+{
+    return (record >> Shift) & ((uint64_t{1} << Width) - 1);
+}
+
+} // namespace detail
+
+/** The properties of a code-point that are used during text analysis.
+ *
+ * These are the same properties as returned by `ucd_get_general_category()`,
+ * `ucd_get_line_break_class()`, etc. but packed in a single record, so that
+ * they can be retrieved with a single lookup.
+ */
+class unicode_text_properties {
+public:
+    constexpr unicode_text_properties() noexcept = default;
+    constexpr unicode_text_properties(unicode_text_properties const&) noexcept = default;
+    constexpr unicode_text_properties(unicode_text_properties&&) noexcept = default;
+    constexpr unicode_text_properties& operator=(unicode_text_properties const&) noexcept = default;
+    constexpr unicode_text_properties& operator=(unicode_text_properties&&) noexcept = default;
+
+    constexpr explicit unicode_text_properties(uint64_t record) noexcept : _record(record) {}
+
+    [[nodiscard]] constexpr unicode_general_category general_category() const noexcept
+    {
+        return static_cast<unicode_general_category>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_general_category_shift,
+            detail::ucd_text_properties_general_category_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_grapheme_cluster_break grapheme_cluster_break() const noexcept
+    {
+        return static_cast<unicode_grapheme_cluster_break>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_grapheme_cluster_break_shift,
+            detail::ucd_text_properties_grapheme_cluster_break_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_line_break_class line_break_class() const noexcept
+    {
+        return static_cast<unicode_line_break_class>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_line_break_class_shift,
+            detail::ucd_text_properties_line_break_class_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_east_asian_width east_asian_width() const noexcept
+    {
+        return static_cast<unicode_east_asian_width>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_east_asian_width_shift,
+            detail::ucd_text_properties_east_asian_width_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_word_break_property word_break_property() const noexcept
+    {
+        return static_cast<unicode_word_break_property>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_word_break_property_shift,
+            detail::ucd_text_properties_word_break_property_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_sentence_break_property sentence_break_property() const noexcept
+    {
+        return static_cast<unicode_sentence_break_property>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_sentence_break_property_shift,
+            detail::ucd_text_properties_sentence_break_property_width>(_record));
+    }
+
+    [[nodiscard]] constexpr unicode_bidi_class bidi_class() const noexcept
+    {
+        return static_cast<unicode_bidi_class>(detail::ucd_text_properties_field<
+            detail::ucd_text_properties_bidi_class_shift,
+            detail::ucd_text_properties_bidi_class_width>(_record));
+    }
+
+    [[nodiscard]] constexpr iso_15924 script() const noexcept
+    {
+        return iso_15924{detail::ucd_text_properties_field<
+            detail::ucd_text_properties_script_shift,
+            detail::ucd_text_properties_script_width>(_record)};
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(unicode_text_properties const&, unicode_text_properties const&) noexcept = default;
+
+private:
+    uint64_t _record = 0;
+};
+
+[[nodiscard]] constexpr unicode_text_properties ucd_get_text_properties(char32_t code_point) noexcept
+{
+    constexpr auto max_code_point_hi = detail::ucd_text_properties_indices_size - 1;
+
+    auto code_point_hi = code_point / detail::ucd_text_properties_chunk_size;
+    auto const code_point_lo = code_point % detail::ucd_text_properties_chunk_size;
+
+    if (code_point_hi > max_code_point_hi) {
+        code_point_hi = max_code_point_hi;
+    }
+
+    auto const chunk_index = load_bits_be<detail::ucd_text_properties_index_width>(
+        detail::ucd_text_properties_indices_bytes,
+        code_point_hi * detail::ucd_text_properties_index_width);
+
+    // Add back in the lower-bits of the code-point.
+    auto const index = (chunk_index * detail::ucd_text_properties_chunk_size) + code_point_lo;
+
+    // Get the record from the table.
+    auto const record_index = load_bits_be<detail::ucd_text_properties_record_index_width>(
+        detail::ucd_text_properties_record_indices_bytes, index * detail::ucd_text_properties_record_index_width);
+
+    return unicode_text_properties{detail::ucd_text_properties_records[record_index]};
+}
+
+/** Get the text properties of each code-point in a text.
+ *
+ * Consecutive code-points in the same chunk of the table, which is common
+ * in text that is written in a single script, share the lookup of the chunk.
+ *
+ * @param first An iterator to the first code-point.
+ * @param last An iterator to one beyond the last code-point.
+ * @param d_first An output iterator to the first text properties.
+ * @return An output iterator to one beyond the last text properties written.
+ */
+template<std::input_iterator It, std::sentinel_for<It> ItEnd, std::output_iterator<unicode_text_properties> OutIt>
+constexpr OutIt ucd_get_text_properties(It first, ItEnd last, OutIt d_first) noexcept
+{
+    constexpr auto max_code_point_hi = detail::ucd_text_properties_indices_size - 1;
+
+    auto prev_code_point_hi = std::numeric_limits<size_t>::max();
+    auto chunk_offset = 0_uz;
+    for (; first != last; ++first, ++d_first) {
+        auto const code_point = char_cast<char32_t>(*first);
+
+        auto code_point_hi = code_point / detail::ucd_text_properties_chunk_size;
+        auto const code_point_lo = code_point % detail::ucd_text_properties_chunk_size;
+
+        if (code_point_hi > max_code_point_hi) {
+            code_point_hi = max_code_point_hi;
+        }
+
+        if (code_point_hi != prev_code_point_hi) {
+            prev_code_point_hi = code_point_hi;
+            chunk_offset = load_bits_be<detail::ucd_text_properties_index_width>(
+                detail::ucd_text_properties_indices_bytes,
+                code_point_hi * detail::ucd_text_properties_index_width) * detail::ucd_text_properties_chunk_size;
+        }
+
+        auto const record_index = load_bits_be<detail::ucd_text_properties_record_index_width>(
+            detail::ucd_text_properties_record_indices_bytes,
+            (chunk_offset + code_point_lo) * detail::ucd_text_properties_record_index_width);
+
+        *d_first = unicode_text_properties{detail::ucd_text_properties_records[record_index]};
+    }
+    return d_first;
+}
+
+}} // namespace hi::v1
+
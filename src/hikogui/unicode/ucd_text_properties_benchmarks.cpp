@@ -0,0 +1,122 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ucd_text_properties.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Sample text in different languages.
+ */
+std::vector<std::pair<std::string_view, std::u32string_view>> const corpora = {
+    {"english", U"The quick brown fox jumps over the lazy dog, while the cat sleeps on the warm windowsill. "},
+    {"french", U"Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter en canoë au delà des îles. "},
+    {"greek", U"Ξεσκεπάζω την ψυχοφθόρα βδελυγμία, ενώ η γαλήνια θάλασσα αντανακλά το φως. "},
+    {"russian", U"Съешь же ещё этих мягких французских булок, да выпей чаю в тёплой комнате. "},
+    {"hindi", U"ऋषियों को सताने वाले दुष्ट राक्षसों के राजा रावण का सर्वनाश करने वाले विष्णुवतार भगवान श्रीराम। "},
+    {"korean", U"키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. "},
+    {"japanese", U"いろはにほへと ちりぬるを わかよたれそ つねならむ うゐのおくやま けふこえて。"},
+    {"emoji", U"Party 🎉 with cake 🎂 and balloons 🎈, then sleep 😴. "},
+};
+
+/** Repeat a sample text to about 256k code-points.
+ */
+[[nodiscard]] std::u32string make_text(std::u32string_view sample)
+{
+    auto r = std::u32string{};
+    while (r.size() < 256 * 1024) {
+        r += sample;
+    }
+    return r;
+}
+
+/** Combine the properties, so that the lookups can not be optimized away.
+ */
+[[nodiscard]] size_t hash_properties(
+    unicode_general_category general_category,
+    unicode_grapheme_cluster_break grapheme_cluster_break,
+    unicode_line_break_class line_break_class,
+    unicode_east_asian_width east_asian_width,
+    unicode_word_break_property word_break_property,
+    unicode_sentence_break_property sentence_break_property,
+    unicode_bidi_class bidi_class,
+    iso_15924 script)
+{
+    return std::to_underlying(general_category) + std::to_underlying(grapheme_cluster_break) +
+        std::to_underlying(line_break_class) + std::to_underlying(east_asian_width) +
+        std::to_underlying(word_break_property) + std::to_underlying(sentence_break_property) +
+        std::to_underlying(bidi_class) + script.number();
+}
+
+[[nodiscard]] size_t hash_properties(unicode_text_properties const& x)
+{
+    return hash_properties(
+        x.general_category(),
+        x.grapheme_cluster_break(),
+        x.line_break_class(),
+        x.east_asian_width(),
+        x.word_break_property(),
+        x.sentence_break_property(),
+        x.bidi_class(),
+        x.script());
+}
+
+} // namespace
+
+TEST(ucd_text_properties_benchmarks, lookup)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = make_text(sample);
+
+        auto separate_hash = 0_uz;
+        hilet separate_rate = benchmark_rate([&] {
+            separate_hash = 0;
+            for (hilet code_point : text) {
+                separate_hash += hash_properties(
+                    ucd_get_general_category(code_point),
+                    ucd_get_grapheme_cluster_break(code_point),
+                    ucd_get_line_break_class(code_point),
+                    ucd_get_east_asian_width(code_point),
+                    ucd_get_word_break_property(code_point),
+                    ucd_get_sentence_break_property(code_point),
+                    ucd_get_bidi_class(code_point),
+                    ucd_get_script(code_point));
+            }
+        });
+
+        auto merged_hash = 0_uz;
+        hilet merged_rate = benchmark_rate([&] {
+            merged_hash = 0;
+            for (hilet code_point : text) {
+                merged_hash += hash_properties(ucd_get_text_properties(code_point));
+            }
+        });
+
+        auto properties = std::vector<unicode_text_properties>(text.size());
+        auto batch_hash = 0_uz;
+        hilet batch_rate = benchmark_rate([&] {
+            ucd_get_text_properties(text.begin(), text.end(), properties.begin());
+            batch_hash = 0;
+            for (hilet& x : properties) {
+                batch_hash += hash_properties(x);
+            }
+        });
+
+        ASSERT_EQ(merged_hash, separate_hash);
+        ASSERT_EQ(batch_hash, separate_hash);
+
+        benchmark_report(std::format("text properties {} separate", name), separate_rate * text.size() / 1'000'000, "Mcp/s");
+        benchmark_report(std::format("text properties {} merged", name), merged_rate * text.size() / 1'000'000, "Mcp/s");
+        benchmark_report(std::format("text properties {} batch", name), batch_rate * text.size() / 1'000'000, "Mcp/s");
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ucd_text_properties.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(ucd_text_properties, compare_to_separate_tables)
+{
+    for (char32_t code_point = 0; code_point != 0x11'0000; ++code_point) {
+        hilet properties = hi::ucd_get_text_properties(code_point);
+
+        ASSERT_EQ(properties.general_category(), hi::ucd_get_general_category(code_point));
+        ASSERT_EQ(properties.grapheme_cluster_break(), hi::ucd_get_grapheme_cluster_break(code_point));
+        ASSERT_EQ(properties.line_break_class(), hi::ucd_get_line_break_class(code_point));
+        ASSERT_EQ(properties.east_asian_width(), hi::ucd_get_east_asian_width(code_point));
+        ASSERT_EQ(properties.word_break_property(), hi::ucd_get_word_break_property(code_point));
+        ASSERT_EQ(properties.sentence_break_property(), hi::ucd_get_sentence_break_property(code_point));
+        ASSERT_EQ(properties.bidi_class(), hi::ucd_get_bidi_class(code_point));
+        ASSERT_EQ(properties.script(), hi::ucd_get_script(code_point));
+    }
+}
+
+TEST(ucd_text_properties, batch)
+{
+    auto code_points = std::vector<char32_t>{};
+    for (char32_t code_point = 0; code_point < 0x11'0000; code_point += 37) {
+        code_points.push_back(code_point);
+        code_points.push_back(code_point + 1);
+    }
+
+    auto properties = std::vector<hi::unicode_text_properties>(code_points.size());
+    hilet last = hi::ucd_get_text_properties(code_points.begin(), code_points.end(), properties.begin());
+    ASSERT_EQ(last, properties.end());
+
+    for (auto i = size_t{0}; i != code_points.size(); ++i) {
+        ASSERT_EQ(properties[i], hi::ucd_get_text_properties(code_points[i]));
+    }
+}
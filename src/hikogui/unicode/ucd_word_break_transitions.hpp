@@ -0,0 +1,96 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_word_break_properties.hpp"
+#include "../utility/utility.hpp"
+#include <cstdint>
+#include <utility>
+
+hi_export_module(hikogui.unicode.ucd_word_break_transitions);
+
+hi_export namespace hi {
+inline namespace v1 {
+namespace detail {
+
+// The columns of the transition table are the values of unicode_word_break_property.
+static_assert(std::to_underlying(unicode_word_break_property::Other) == 0);
+static_assert(std::to_underlying(unicode_word_break_property::LF) == 1);
+static_assert(std::to_underlying(unicode_word_break_property::Newline) == 2);
+static_assert(std::to_underlying(unicode_word_break_property::CR) == 3);
+static_assert(std::to_underlying(unicode_word_break_property::WSegSpace) == 4);
+static_assert(std::to_underlying(unicode_word_break_property::Double_Quote) == 5);
+static_assert(std::to_underlying(unicode_word_break_property::Single_Quote) == 6);
+static_assert(std::to_underlying(unicode_word_break_property::MidNum) == 7);
+static_assert(std::to_underlying(unicode_word_break_property::MidNumLet) == 8);
+static_assert(std::to_underlying(unicode_word_break_property::Numeric) == 9);
+static_assert(std::to_underlying(unicode_word_break_property::MidLetter) == 10);
+static_assert(std::to_underlying(unicode_word_break_property::ALetter) == 11);
+static_assert(std::to_underlying(unicode_word_break_property::ExtendNumLet) == 12);
+static_assert(std::to_underlying(unicode_word_break_property::Format) == 13);
+static_assert(std::to_underlying(unicode_word_break_property::Extend) == 14);
+static_assert(std::to_underlying(unicode_word_break_property::Hebrew_Letter) == 15);
+static_assert(std::to_underlying(unicode_word_break_property::ZWJ) == 16);
+static_assert(std::to_underlying(unicode_word_break_property::Katakana) == 17);
+static_assert(std::to_underlying(unicode_word_break_property::Regional_Indicator) == 18);
+
+constexpr auto ucd_word_break_action_width = 3_uz;
+
+constexpr uint8_t ucd_word_break_transitions[23][19] = {
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 49,  9,  9, 57, 65, 73, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 49,  8,  8, 57, 64, 73, 81},
+    {  9,  0,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 49,  9,  9, 57, 65, 73, 81},
+    {  9,  1,  1, 17, 24,  9,  9,  9,  9, 33,  9, 41, 49,  8,  8, 57, 64, 73, 81},
+    {  9,  1,  1, 17, 25,  9, 93, 93, 93, 32,  9, 40, 48, 32, 32, 56, 96, 73, 81},
+    {  9,  1,  1, 17, 25,  9,107,  9,107, 32,107, 40, 48, 40, 40, 56,112, 73, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 32,  9, 40, 48, 48, 48, 56,120, 72, 81},
+    {  9,  1,  1, 17, 25,132,104,  9,107, 32,107, 40, 48, 56, 56, 56,136, 73, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 42, 49,  8,  8, 57, 64, 73, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 48, 72, 72, 57,144, 72, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 49, 80, 80, 57,152, 73,  8},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 32,  9, 41, 49, 88, 88, 57,160, 73, 81},
+    { 10,  1,  1, 17, 25,  9, 93, 93, 93, 32,  9, 40, 48, 32, 32, 56, 96, 73, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 40, 49,104,104, 56,168, 73, 81},
+    { 10,  1,  1, 17, 25,  9,107,  9,107, 32,107, 40, 48, 40, 40, 56,112, 73, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 32,  9, 40, 48, 48, 48, 56,120, 72, 81},
+    {  9,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 41, 49,128,128, 56,176, 73, 81},
+    { 10,  1,  1, 17, 25,132,104,  9,107, 32,107, 40, 48, 56, 56, 56,136, 73, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 42, 48, 72, 72, 57,144, 72, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 42, 49, 80, 80, 57,152, 73,  8},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 32,  9, 42, 49, 88, 88, 57,160, 73, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 40, 49,104,104, 56,168, 73, 81},
+    { 10,  1,  1, 17, 25,  9,  9,  9,  9, 33,  9, 42, 49,128,128, 56,176, 73, 81},
+};
+
+} // namespace detail
+
+/** The action of the word break state machine before the next character.
+ *
+ * The actions other than `no` and `yes` prevent a break when their condition is true.
+ */
+enum class unicode_word_break_action : uint8_t {
+    no = 0,
+    yes = 1,
+    WB3c = 2,
+    WB6 = 3,
+    WB7b = 4,
+    WB12 = 5,
+};
+
+/** Get a transition of the word break state machine.
+ *
+ * @param state The state after the previous character; the start state is zero.
+ * @param property The word break property of the next character.
+ * @return The action before the next character, and the state after the next character.
+ */
+[[nodiscard]] constexpr std::pair<unicode_word_break_action, uint8_t>
+ucd_get_word_break_transition(uint8_t state, unicode_word_break_property property) noexcept
+{
+    auto const transition = detail::ucd_word_break_transitions[state][std::to_underlying(property)];
+    return {
+        static_cast<unicode_word_break_action>(transition & ((1 << detail::ucd_word_break_action_width) - 1)),
+        static_cast<uint8_t>(transition >> detail::ucd_word_break_action_width)};
+}
+
+}} // namespace hi::v1
+
@@ -9,6 +9,9 @@
 #include <format>
 #include <ostream>
 #include <vector>
+#include <iterator>
+#include <cstddef>
+#include <utility>
 
 hi_export_module(hikogui.unicode.unicode_break_opportunity);
 
@@ -40,6 +43,84 @@ hi_inline std::ostream &operator<<(std::ostream &lhs, unicode_break_opportunity
     return lhs << s;
 }
 
+namespace detail {
+
+/** An iterator over the break positions found by the state machine of a break algorithm.
+ *
+ * The break positions are found lazily, incrementing the iterator runs the
+ * state machine up to the next break. The first break position is the start
+ * of the text and the last is the end of the text.
+ *
+ * @tparam State The state of a break algorithm, with `position()`, `at_end()` and `next()`.
+ */
+template<typename State>
+class unicode_break_position_iterator {
+public:
+    using value_type = typename State::iterator;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr unicode_break_position_iterator(unicode_break_position_iterator const&) noexcept = default;
+    constexpr unicode_break_position_iterator(unicode_break_position_iterator&&) noexcept = default;
+    constexpr unicode_break_position_iterator& operator=(unicode_break_position_iterator const&) noexcept = default;
+    constexpr unicode_break_position_iterator& operator=(unicode_break_position_iterator&&) noexcept = default;
+
+    /** Iterate over the break positions at or after the position of the state.
+     */
+    constexpr explicit unicode_break_position_iterator(State state) noexcept : _state(std::move(state)), _position(_state.position())
+    {
+        ++*this;
+    }
+
+    /** An iterator to the character after the break, or one beyond the last character.
+     */
+    [[nodiscard]] constexpr value_type const& operator*() const noexcept
+    {
+        return _position;
+    }
+
+    constexpr unicode_break_position_iterator& operator++() noexcept
+    {
+        hi_axiom(not _end);
+
+        if (_at_end) {
+            _end = true;
+            return *this;
+        }
+
+        do {
+            _at_end = _state.at_end();
+            _position = _state.position();
+        } while (_state.next() == unicode_break_opportunity::no);
+        return *this;
+    }
+
+    constexpr unicode_break_position_iterator operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    [[nodiscard]] constexpr friend bool operator==(unicode_break_position_iterator const& lhs, std::default_sentinel_t) noexcept
+    {
+        return lhs._end;
+    }
+
+private:
+    State _state;
+    value_type _position;
+
+    /** The current break position is at the end of the text.
+     */
+    bool _at_end = false;
+
+    /** The iterator is beyond the last break position.
+     */
+    bool _end = false;
+};
+
+} // namespace detail
+
 }
 
 // XXX #617 MSVC bug does not handle partial specialization in modules.
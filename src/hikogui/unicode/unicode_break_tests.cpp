@@ -19,6 +19,8 @@
 #include <span>
 #include <format>
 #include <ranges>
+#include <random>
+#include <vector>
 
 
 
@@ -78,6 +80,91 @@ static hi::generator<test_type> parse_tests(std::filesystem::path filename)
     }
 }
 
+/** Check that the next break from each position matches the list of break opportunities.
+ */
+template<typename NextFunc>
+static void check_break_next(test_type const& test, NextFunc const& next_func)
+{
+    hilet first = test.code_points.begin();
+    hilet last = test.code_points.end();
+    for (auto it = first; it != last; ++it) {
+        auto expected = std::next(it);
+        while (expected != last and test.expected[std::distance(first, expected)] != hi::unicode_break_opportunity::yes) {
+            ++expected;
+        }
+
+        ASSERT_EQ(std::distance(first, expected), std::distance(first, next_func(first, it, last))) << test.comment;
+    }
+}
+
+/** Check that the lazily found break positions are the positions where a break is expected.
+ */
+template<typename Breaks>
+static void check_breaks(test_type const& test, Breaks const& breaks)
+{
+    auto expected = std::vector<ptrdiff_t>{};
+    for (auto i = size_t{0}; i != test.expected.size(); ++i) {
+        if (test.expected[i] == hi::unicode_break_opportunity::yes) {
+            expected.push_back(hi::narrow_cast<ptrdiff_t>(i));
+        }
+    }
+
+    auto result = std::vector<ptrdiff_t>{};
+    for (hilet it : breaks) {
+        result.push_back(std::distance(test.code_points.begin(), it));
+    }
+
+    ASSERT_EQ(expected, result) << test.comment;
+}
+
+struct random_text_type {
+    hi::unicode_break_vector opportunities;
+    std::vector<float> widths;
+};
+
+/** Make a random text with integer widths, so that widths can be compared exactly.
+ */
+static random_text_type make_random_text(std::mt19937& engine)
+{
+    auto r = random_text_type{};
+
+    hilet size = engine() % 60 + 1;
+    r.opportunities.push_back(hi::unicode_break_opportunity::no);
+    for (auto i = size_t{0}; i != size; ++i) {
+        // Negative widths are white space.
+        r.widths.push_back(static_cast<float>(static_cast<int>(engine() % 16) - 4));
+
+        hilet kind = engine() % 10;
+        if (i + 1 == size or kind == 0) {
+            r.opportunities.push_back(hi::unicode_break_opportunity::mandatory);
+        } else if (kind < 5) {
+            r.opportunities.push_back(hi::unicode_break_opportunity::yes);
+        } else {
+            r.opportunities.push_back(hi::unicode_break_opportunity::no);
+        }
+    }
+    return r;
+}
+
+/** The sum of the squared free space at the end of each line, except the last line of a paragraph.
+ */
+static double raggedness(random_text_type const& text, std::vector<size_t> const& lengths, float maximum_line_width)
+{
+    auto r = 0.0;
+    auto it = text.widths.begin();
+    for (hilet length : lengths) {
+        hilet width = hi::detail::unicode_LB_width(it, it + length);
+        it += length;
+
+        if (width > maximum_line_width) {
+            r += 1e30;
+        } else if (text.opportunities[std::distance(text.widths.begin(), it)] != hi::unicode_break_opportunity::mandatory) {
+            r += (maximum_line_width - width) * (maximum_line_width - width);
+        }
+    }
+    return r;
+}
+
 } // namespace
 
 TEST(unicode_break, grapheme_break)
@@ -101,6 +188,27 @@ TEST(unicode_break, word_break)
     }
 }
 
+TEST(unicode_break, word_break_next)
+{
+    for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "WordBreakTest.txt")) {
+        check_break_next(test, [](hilet first, hilet position, hilet last) {
+            return hi::unicode_word_break_next(first, position, last, [](hilet code_point) -> decltype(auto) {
+                return code_point;
+            });
+        });
+    }
+}
+
+TEST(unicode_break, word_breaks)
+{
+    for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "WordBreakTest.txt")) {
+        check_breaks(
+            test, hi::unicode_word_breaks(test.code_points.begin(), test.code_points.end(), [](hilet code_point) -> decltype(auto) {
+                return code_point;
+            }));
+    }
+}
+
 TEST(unicode_break, sentence_break)
 {
     for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "SentenceBreakTest.txt")) {
@@ -113,6 +221,28 @@ TEST(unicode_break, sentence_break)
     }
 }
 
+TEST(unicode_break, sentence_break_next)
+{
+    for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "SentenceBreakTest.txt")) {
+        check_break_next(test, [](hilet first, hilet position, hilet last) {
+            return hi::unicode_sentence_break_next(first, position, last, [](hilet code_point) -> decltype(auto) {
+                return code_point;
+            });
+        });
+    }
+}
+
+TEST(unicode_break, sentence_breaks)
+{
+    for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "SentenceBreakTest.txt")) {
+        check_breaks(
+            test,
+            hi::unicode_sentence_breaks(test.code_points.begin(), test.code_points.end(), [](hilet code_point) -> decltype(auto) {
+                return code_point;
+            }));
+    }
+}
+
 TEST(unicode_break, line_break)
 {
     for (hilet& test : parse_tests(hi::library_source_dir() / "tests" / "data" / "LineBreakTest.txt")) {
@@ -131,3 +261,76 @@ TEST(unicode_break, line_break)
         ASSERT_EQ(test.expected, result) << test.comment;
     }
 }
+
+TEST(unicode_break, line_fitter_fit)
+{
+    auto engine = std::mt19937{42};
+    for (auto i = 0; i != 10'000; ++i) {
+        hilet text = make_random_text(engine);
+        hilet fitter = hi::unicode_line_fitter{text.opportunities, text.widths};
+        hilet maximum_line_width = static_cast<float>(engine() % 60);
+
+        hilet expected = hi::detail::unicode_LB_fit_lines(text.opportunities, text.widths, maximum_line_width);
+        hilet result = fitter.fit(maximum_line_width);
+        ASSERT_EQ(expected, result);
+        ASSERT_EQ(hi::detail::unicode_LB_width(text.widths, expected), fitter.width(result));
+
+        ASSERT_EQ(hi::detail::unicode_LB_maximum_width(text.opportunities, text.widths), fitter.maximum_width());
+        ASSERT_EQ(hi::detail::unicode_LB_minimum_width(text.opportunities, text.widths), fitter.minimum_width());
+    }
+}
+
+TEST(unicode_break, line_fitter_fit_optimal)
+{
+    auto engine = std::mt19937{42};
+    for (auto i = 0; i != 10'000; ++i) {
+        hilet text = make_random_text(engine);
+        hilet fitter = hi::unicode_line_fitter{text.opportunities, text.widths};
+        hilet maximum_line_width = static_cast<float>(engine() % 60);
+
+        hilet greedy = fitter.fit(maximum_line_width);
+        hilet optimal = fitter.fit_optimal(maximum_line_width);
+
+        // Lines must end on a break opportunity, including every mandatory break.
+        auto last = size_t{0};
+        auto num_mandatory = size_t{0};
+        for (hilet length : optimal) {
+            last += length;
+            ASSERT_NE(text.opportunities[last], hi::unicode_break_opportunity::no);
+            if (text.opportunities[last] == hi::unicode_break_opportunity::mandatory) {
+                ++num_mandatory;
+            }
+        }
+        ASSERT_EQ(last, text.widths.size());
+        ASSERT_EQ(num_mandatory, std::ranges::count(text.opportunities, hi::unicode_break_opportunity::mandatory));
+
+        ASSERT_LE(raggedness(text, optimal, maximum_line_width), raggedness(text, greedy, maximum_line_width));
+    }
+}
+
+TEST(unicode_break, line_fitter_line_count_steps)
+{
+    auto engine = std::mt19937{42};
+    for (auto i = 0; i != 1'000; ++i) {
+        hilet text = make_random_text(engine);
+        hilet fitter = hi::unicode_line_fitter{text.opportunities, text.widths};
+        hilet steps = fitter.line_count_steps();
+
+        ASSERT_FALSE(steps.empty());
+        ASSERT_EQ(steps.front().second.size(), fitter.maximum_width().second.size());
+        for (auto j = size_t{0}; j != steps.size(); ++j) {
+            ASSERT_EQ(steps[j].first, fitter.width(steps[j].second));
+            if (j != 0) {
+                ASSERT_GT(steps[j].second.size(), steps[j - 1].second.size());
+            }
+        }
+
+        // Every number of lines of a first-fit layout is found.
+        for (auto maximum_line_width = 0; maximum_line_width != 200; ++maximum_line_width) {
+            hilet num_lines = fitter.fit(static_cast<float>(maximum_line_width)).size();
+            ASSERT_TRUE(std::ranges::any_of(steps, [&](hilet& step) {
+                return step.second.size() == num_lines;
+            }));
+        }
+    }
+}
@@ -11,13 +11,18 @@
 #include "ucd_general_categories.hpp"
 #include "ucd_grapheme_cluster_breaks.hpp"
 #include "ucd_line_break_classes.hpp"
+#include "ucd_line_break_transitions.hpp"
 #include "ucd_east_asian_widths.hpp"
+#include "ucd_text_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <cstdint>
 #include <vector>
 #include <algorithm>
 #include <numeric>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 hi_export_module(hikogui.unicode.unicode_line_break);
 
@@ -25,339 +30,136 @@ hi_export_module(hikogui.unicode.unicode_line_break);
 hi_export namespace hi::inline v1 {
 namespace detail {
 
-/** Combined unicode_line_break_class and unicode_line_break_opportunity.
+/** Get the symbol of a character for the line break state machine.
+ *
+ * This resolves the SA characters in the general categories Mn and Mc to CM (LB1),
+ * and adds the properties that are needed for LB30 and LB30b.
+ *
+ * @param code_point The code-point of the character.
+ * @return A unicode_line_break_class value, or one of the `ucd_line_break_symbol_*`.
  */
-struct unicode_line_break_info {
-    unicode_line_break_class original_class = unicode_line_break_class::XX;
-    unicode_line_break_class current_class = unicode_line_break_class::XX;
-    bool is_extended_pictographic = false;
-    bool is_Cn = false;
-    unicode_east_asian_width east_asian_width = unicode_east_asian_width::A;
-
-    constexpr unicode_line_break_info() noexcept = default;
-    constexpr unicode_line_break_info(unicode_line_break_info const&) noexcept = default;
-    constexpr unicode_line_break_info(unicode_line_break_info&&) noexcept = default;
-    constexpr unicode_line_break_info& operator=(unicode_line_break_info const&) noexcept = default;
-    constexpr unicode_line_break_info& operator=(unicode_line_break_info&&) noexcept = default;
-
-    constexpr explicit unicode_line_break_info(
-        unicode_line_break_class break_class,
-        bool is_Cn,
-        bool is_extended_pictographic,
-        unicode_east_asian_width east_asian_width) noexcept :
-        original_class(break_class),
-        current_class(break_class),
-        is_Cn(is_Cn),
-        is_extended_pictographic(is_extended_pictographic),
-        east_asian_width(east_asian_width)
-    {
-    }
+[[nodiscard]] constexpr uint8_t unicode_line_break_symbol(char32_t code_point) noexcept
+{
+    using enum unicode_line_break_class;
+    using enum unicode_east_asian_width;
 
-    constexpr explicit operator unicode_line_break_class() const noexcept
-    {
-        return current_class;
-    }
+    hilet properties = ucd_get_text_properties(code_point);
+    hilet break_class = properties.line_break_class();
 
-    constexpr unicode_line_break_info& operator|=(unicode_line_break_class rhs) noexcept
-    {
-        current_class = rhs;
-        return *this;
-    }
+    if (break_class == SA) {
+        return std::to_underlying(is_Mn_or_Mc(properties.general_category()) ? CM : AL);
 
-    [[nodiscard]] constexpr bool operator==(unicode_line_break_class rhs) const noexcept
-    {
-        return current_class == rhs;
-    }
+    } else if (break_class == OP or break_class == CP) {
+        hilet east_asian_width = properties.east_asian_width();
+        if (east_asian_width == F or east_asian_width == W or east_asian_width == H) {
+            return break_class == OP ? ucd_line_break_symbol_OP_FWH : ucd_line_break_symbol_CP_FWH;
+        }
 
-    [[nodiscard]] constexpr bool operator==(unicode_east_asian_width rhs) const noexcept
-    {
-        return east_asian_width == rhs;
+    } else if (
+        properties.grapheme_cluster_break() == unicode_grapheme_cluster_break::Extended_Pictographic and
+        properties.general_category() == unicode_general_category::Cn) {
+        return ucd_line_break_symbol_ID_ExtPict_Cn;
     }
-};
 
-using unicode_line_break_info_vector = std::vector<unicode_line_break_info>;
-using unicode_line_break_info_iterator = unicode_line_break_info_vector::iterator;
-using unicode_line_break_info_const_iterator = unicode_line_break_info_vector::const_iterator;
+    return std::to_underlying(break_class);
+}
 
+/** The state of the line break algorithm.
+ *
+ * The break opportunities are determined in a single forward pass by the
+ * state machine generated from the rules of UAX #14, see
+ * ucd_get_line_break_transition(). The numbers are tailored with the regular
+ * expression `(PR | PO)? (OP | HY)? NU (NU | SY | IS)* (CL | CP)? (PR | PO)?`,
+ * as used by LineBreakTest.txt; only `(PR | PO) (OP | HY) NU` needs to look
+ * at the next characters, which is done here.
+ */
 template<typename It, typename ItEnd, typename CodePointFunc>
-[[nodiscard]] constexpr std::vector<unicode_line_break_info>
-unicode_LB1(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
-{
-    auto r = std::vector<unicode_line_break_info>{};
-    r.reserve(std::distance(first, last));
-
-    for (auto it = first; it != last; ++it) {
-        hilet code_point = code_point_func(*it);
-        hilet east_asian_width = ucd_get_east_asian_width(code_point);
-        hilet break_class = ucd_get_line_break_class(code_point);
-        hilet general_category = ucd_get_general_category(code_point);
-        hilet grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
-
-        hilet resolved_break_class = [&]() {
-            switch (break_class) {
-                using enum unicode_line_break_class;
-            case AI:
-            case SG:
-            case XX:
-                return AL;
-            case CJ:
-                return NS;
-            case SA:
-                return is_Mn_or_Mc(general_category) ? CM : AL;
-            default:
-                return break_class;
-            }
-        }();
+class unicode_line_break_state {
+public:
+    using iterator = It;
 
-        r.emplace_back(
-            resolved_break_class,
-            general_category == unicode_general_category::Cn,
-            grapheme_cluster_break == unicode_grapheme_cluster_break::Extended_Pictographic,
-            east_asian_width);
+    constexpr unicode_line_break_state(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept :
+        _it(first), _last(last), _code_point_func(code_point_func)
+    {
     }
 
-    return r;
-}
-
-constexpr void unicode_LB2_3(unicode_break_vector& opportunities) noexcept
-{
-    hi_axiom(not opportunities.empty());
-    // LB2
-    opportunities.front() = unicode_break_opportunity::no;
-    // LB3
-    opportunities.back() = unicode_break_opportunity::mandatory;
-}
-
-template<typename MatchFunc>
-constexpr void unicode_LB_walk(
-    unicode_break_vector& opportunities,
-    std::vector<unicode_line_break_info> const& infos,
-    MatchFunc match_func) noexcept
-{
-    using enum unicode_line_break_class;
-
-    if (infos.empty()) {
-        return;
+    /** The character before which the next break opportunity is determined.
+     */
+    [[nodiscard]] constexpr It const& position() const noexcept
+    {
+        return _it;
     }
 
-    auto cur = infos.begin();
-    hilet last = infos.end() - 1;
-    hilet last2 = infos.end();
-    auto opportunity = opportunities.begin() + 1;
-
-    auto cur_sp_class = XX;
-    auto cur_nu_class = XX;
-    auto prev_class = XX;
-    auto num_ri = 0_uz;
-    while (cur != last) {
-        hilet next = cur + 1;
-        hilet cur_class = unicode_line_break_class{*cur};
-        hilet next2_class = cur + 2 == last2 ? XX : unicode_line_break_class{*(cur + 2)};
-
-        // Keep track of classes followed by zero or more SP.
-        if (cur_class != SP) {
-            cur_sp_class = cur_class;
-        }
-
-        // Keep track of a "NU (NU|SY|IS)*" and "NU (NU|SY|IS)* (CL|CP)?".
-        if (cur_nu_class == CL) {
-            // Only a single CL|CP class may be at the end, then the number is closed.
-            cur_nu_class = XX;
-        } else if (cur_nu_class == NU) {
-            if (cur_class == CL or cur_class == CP) {
-                cur_nu_class = CL;
-            } else if (cur_class != NU and cur_class != SY and cur_class != IS) {
-                cur_nu_class = XX;
-            }
-        } else if (cur_class == NU) {
-            cur_nu_class = NU;
-        }
+    /** The next break opportunity is at the end of the text.
+     */
+    [[nodiscard]] constexpr bool at_end() const noexcept
+    {
+        return _it == _last;
+    }
 
-        // Keep track of consecutive RI, but only count the actual RIs.
-        if (cur->original_class == RI) {
-            ++num_ri;
-        } else if (*cur != RI) {
-            num_ri = 0;
-        }
+    /** Determine the break opportunity before the current character, and move to the next character.
+     *
+     * @return The break opportunity before the current character, or at the end of the text.
+     */
+    [[nodiscard]] constexpr unicode_break_opportunity next() noexcept
+    {
+        using enum unicode_break_opportunity;
+        using enum unicode_line_break_class;
 
-        if (*opportunity == unicode_break_opportunity::unassigned) {
-            *opportunity = match_func(prev_class, cur, next, next2_class, cur_sp_class, cur_nu_class, num_ri);
+        if (_it == _last) {
+            return mandatory; // LB3
         }
 
-        prev_class = cur_class;
-        cur = next;
-        ++opportunity;
-    }
-}
-
-constexpr void unicode_LB4_8a(unicode_break_vector& opportunities, std::vector<unicode_line_break_info> const& infos) noexcept
-{
-    unicode_LB_walk(
-        opportunities, infos, [](hilet prev, hilet cur, hilet next, hilet next2, hilet cur_sp, hilet cur_nu, hilet num_ri) {
-            using enum unicode_break_opportunity;
-            using enum unicode_line_break_class;
-            if (*cur == BK) {
-                return mandatory; // LB4: 4.0
-            } else if (*cur == CR and *next == LF) {
-                return no; // LB5: 5.01
-            } else if (*cur == CR or *cur == LF or *cur == NL) {
-                return mandatory; // LB5: 5.02, 5.03, 5.04
-            } else if (*next == BK or *next == CR or *next == LF or *next == NL) {
-                return no; // LB6: 6.0
-            } else if (*next == SP or *next == ZW) {
-                return no; // LB7: 7.01, 7.02
-            } else if (cur_sp == ZW) {
-                return yes; // LB8: 8.0
-            } else if (*cur == ZWJ) {
-                return no; // LB8a: 8.1
-            } else {
-                return unassigned;
+        hilet [action, next_state] = ucd_get_line_break_transition(_state, get_symbol(_it));
+        _state = next_state;
+
+        hilet r = [&] {
+            switch (action) {
+            case unicode_line_break_action::no:
+                return no;
+            case unicode_line_break_action::yes:
+                return yes;
+            case unicode_line_break_action::mandatory:
+                return mandatory;
+            case unicode_line_break_action::LB25:
+                return look_ahead() == std::to_underlying(NU) ? no : yes;
+            default:
+                hi_no_default();
             }
-        });
-}
-
-constexpr void unicode_LB9(unicode_break_vector& opportunities, std::vector<unicode_line_break_info>& infos) noexcept
-{
-    using enum unicode_line_break_class;
-    using enum unicode_break_opportunity;
+        }();
 
-    if (infos.empty()) {
-        return;
+        ++_it;
+        return r;
     }
 
-    auto cur = infos.begin();
-    hilet last = infos.end() - 1;
-    auto opportunity = opportunities.begin() + 1;
-
-    auto X = XX;
-    while (cur != last) {
-        hilet next = cur + 1;
+private:
+    It _it;
+    ItEnd _last;
+    CodePointFunc _code_point_func;
+    uint8_t _state = 0;
 
-        if ((*cur == CM or *cur == ZWJ) and X != XX) {
-            // Treat all CM/ZWJ as X (if there is an X).
-            *cur |= X;
-        } else {
-            // Reset X on non-CM/ZWJ.
-            X = XX;
-        }
-
-        if ((*cur != BK and *cur != CR and *cur != LF and *cur != NL and *cur != SP and *cur != ZW) and
-            (*next == CM or *next == ZWJ)) {
-            // [^BK CR LF NL SP ZW] x [CM ZWJ]*
-            *opportunity = no;
-
-            if (X == XX) {
-                // The first character of [^BK CR LF NL SP ZW] x [CM ZWJ]* => X
-                X = static_cast<unicode_line_break_class>(*cur);
-            }
-        }
-
-        cur = next;
-        ++opportunity;
+    [[nodiscard]] constexpr uint8_t get_symbol(It const& it) const noexcept
+    {
+        return unicode_line_break_symbol(_code_point_func(*it));
     }
-}
 
-constexpr void unicode_LB10(std::vector<unicode_line_break_info>& infos) noexcept
-{
-    using enum unicode_line_break_class;
+    /** The symbol of the first character after the current character which is not skipped by LB9.
+     *
+     * The current character is an OP or HY, so all following CM and ZWJ are skipped.
+     */
+    [[nodiscard]] constexpr uint8_t look_ahead() const noexcept
+    {
+        using enum unicode_line_break_class;
 
-    for (auto& x : infos) {
-        if (x == CM or x == ZWJ) {
-            x |= AL;
+        for (auto it = std::next(_it); it != _last; ++it) {
+            hilet symbol = get_symbol(it);
+            if (symbol != std::to_underlying(CM) and symbol != std::to_underlying(ZWJ)) {
+                return symbol;
+            }
         }
+        return std::to_underlying(XX);
     }
-}
-
-constexpr void unicode_LB11_31(unicode_break_vector& opportunities, std::vector<unicode_line_break_info> const& infos) noexcept
-{
-    unicode_LB_walk(
-        opportunities, infos, [&](hilet prev, hilet cur, hilet next, hilet next2, hilet cur_sp, hilet cur_nu, hilet num_ri) {
-            using enum unicode_break_opportunity;
-            using enum unicode_line_break_class;
-            using enum unicode_east_asian_width;
-
-            if (*cur == WJ or *next == WJ) {
-                return no; // LB11: 11.01, 11.02
-            } else if (*cur == GL) {
-                return no; // LB12: 12.0
-            } else if (*cur != SP and *cur != BA and *cur != HY and *next == GL) {
-                return no; // LB12a: 12.1
-            } else if (*next == CL or *next == CP or *next == EX or *next == IS or *next == SY) {
-                return no; // LB13: 13.0
-            } else if (cur_sp == OP) {
-                return no; // LB14: 14.0
-            } else if (cur_sp == QU and *next == OP) {
-                return no; // LB15: 15.0
-            } else if ((cur_sp == CL or cur_sp == CP) and *next == NS) {
-                return no; // LB16: 16.0
-            } else if (cur_sp == B2 and *next == B2) {
-                return no; // LB17: 17.0
-            } else if (*cur == SP) {
-                return yes; // LB18: 18.0
-            } else if (*cur == QU or *next == QU) {
-                return no; // LB19: 19.01, 19.02
-            } else if (*cur == CB or *next == CB) {
-                return yes; // LB20: 20.01, 20.02
-            } else if (*cur == BB or *next == BA or *next == HY or *next == NS) {
-                return no; // LB21: 21.01, 21.02, 21.03, 21.04
-            } else if (prev == HL and (*cur == HY or *cur == BA)) {
-                return no; // LB21a: 21.1
-            } else if (*cur == SY and *next == HL) {
-                return no; // LB21b: 21.2
-            } else if (*next == IN) {
-                return no; // LB22: 22.0
-            } else if ((*cur == AL or *cur == HL) and *next == NU) {
-                return no; // LB23: 23.02
-            } else if (*cur == NU and (*next == AL or *next == HL)) {
-                return no; // LB23: 23.03
-            } else if (*cur == PR and (*next == ID or *next == EB or *next == EM)) {
-                return no; // LB23a: 23.12
-            } else if ((*cur == ID or *cur == EB or *cur == EM) and *next == PO) {
-                return no; // LB23a: 23.13
-            } else if ((*cur == PR or *cur == PO) and (*next == AL or *next == HL)) {
-                return no; // LB24: 24.02
-            } else if ((*cur == AL or *cur == HL) and (*next == PR or *next == PO)) {
-                return no; // LB24: 24.03
-            } else if (
-                (*cur == PR or *cur == PO) and ((*next == OP and next2 == NU) or (*next == HY and next2 == NU) or *next == NU)) {
-                return no; // LB25: 25.01
-            } else if ((*cur == OP or *cur == HY) and *next == NU) {
-                return no; // LB25: 25.02
-            } else if (*cur == NU and (*next == NU or *next == SY or *next == IS)) {
-                return no; // LB25: 25.03
-            } else if (cur_nu == NU and (*next == NU or *next == SY or *next == IS or *next == CL or *next == CP)) {
-                return no; // LB25: 25.04
-            } else if ((cur_nu == NU or cur_nu == CL) and (*next == PO or *next == PR)) {
-                return no; // LB25: 25.05
-            } else if (*cur == JL and (*next == JL or *next == JV or *next == H2 or *next == H3)) {
-                return no; // LB26: 26.01
-            } else if ((*cur == JV or *cur == H2) and (*next == JV or *next == JT)) {
-                return no; // LB26: 26.02
-            } else if ((*cur == JT or *cur == H3) and *next == JT) {
-                return no; // LB26: 26.03
-            } else if ((*cur == JL or *cur == JV or *cur == JT or *cur == H2 or *cur == H3) and *next == PO) {
-                return no; // LB27: 27.01
-            } else if (*cur == PR and (*next == JL or *next == JV or *next == JT or *next == H2 or *next == H3)) {
-                return no; // LB27: 27.02
-            } else if ((*cur == AL or *cur == HL) and (*next == AL or *next == HL)) {
-                return no; // LB28: 28.0
-            } else if (*cur == IS and (*next == AL or *next == HL)) {
-                return no; // LB29: 29.0
-            } else if ((*cur == AL or *cur == HL or *cur == NU) and (*next == OP and *next != F and *next != W and *next != H)) {
-                return no; // LB30: 30.01
-            } else if ((*cur == CP and *cur != F and *cur != W and *cur != H) and (*next == AL or *next == HL or *next == NU)) {
-                return no; // LB30: 30.02
-            } else if (*cur == RI and *next == RI and (num_ri % 2) == 1) {
-                return no; // LB30a: 30.11, 30.12, 30.13
-            } else if (*cur == EB and *next == EM) {
-                return no; // LB30b: 30.21
-            } else if (cur->is_extended_pictographic and cur->is_Cn and *next == EM) {
-                return no; // LB30b: 30.22
-            } else {
-                return yes; // LB31: 999.0
-            }
-        });
-}
+};
 
 /** Calculate the width of a line.
  *
@@ -632,15 +434,15 @@ template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] hi_inline unicode_break_vector
 unicode_line_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
-    auto size = narrow_cast<size_t>(std::distance(first, last));
-    auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
-
-    auto infos = detail::unicode_LB1(first, last, code_point_func);
-    detail::unicode_LB2_3(r);
-    detail::unicode_LB4_8a(r, infos);
-    detail::unicode_LB9(r, infos);
-    detail::unicode_LB10(infos);
-    detail::unicode_LB11_31(r, infos);
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+
+    auto r = unicode_break_vector{};
+    r.reserve(size + 1);
+
+    auto state = detail::unicode_line_break_state{first, last, code_point_func};
+    for (auto i = 0_uz; i != size + 1; ++i) {
+        r.push_back(state.next());
+    }
     return r;
 }
 
@@ -665,5 +467,302 @@ unicode_line_break(unicode_break_vector const& opportunities, std::vector<float>
     return r;
 }
 
+/** Fits the characters of a text into lines of a maximum width.
+ *
+ * The break opportunities and the prefix sums of the character widths are
+ * calculated once. After that the text can be fitted to any width in
+ * O(lines * log n), without scanning the text again. This makes it cheap
+ * to try many widths, for example when negotiating the size of a widget.
+ *
+ * The line width excludes trailing white space, which are the characters
+ * with a negative width.
+ */
+class unicode_line_fitter {
+public:
+    constexpr unicode_line_fitter() noexcept = default;
+    constexpr unicode_line_fitter(unicode_line_fitter const&) noexcept = default;
+    constexpr unicode_line_fitter(unicode_line_fitter&&) noexcept = default;
+    constexpr unicode_line_fitter& operator=(unicode_line_fitter const&) noexcept = default;
+    constexpr unicode_line_fitter& operator=(unicode_line_fitter&&) noexcept = default;
+
+    /** Prepare a text for fitting into lines.
+     *
+     * @param opportunities The break-opportunity per character, as returned by `unicode_line_break()`.
+     * @param widths The width of each character, negative for white space.
+     */
+    [[nodiscard]] constexpr unicode_line_fitter(unicode_break_vector const& opportunities, std::vector<float> const& widths)
+    {
+        using enum unicode_break_opportunity;
+
+        hi_axiom(opportunities.size() == widths.size() + 1);
+
+        auto prefix = 0.0;
+        auto visible_prefix = 0.0;
+        for (auto i = 0_uz; i != widths.size(); ++i) {
+            prefix += abs(widths[i]);
+            if (widths[i] >= 0.0f) {
+                visible_prefix = prefix;
+            }
+
+            // The end of the text is always a mandatory break.
+            hilet opportunity = i + 1 == widths.size() ? mandatory : opportunities[i + 1];
+            if (opportunity != no) {
+                if (opportunity == mandatory) {
+                    _mandatory_breaks.push_back(_breaks.size());
+                }
+                _breaks.emplace_back(i + 1, prefix, visible_prefix);
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _breaks.empty();
+    }
+
+    /** Fit the text into lines using the first-fit algorithm.
+     *
+     * This gives the same lines as `unicode_line_break(opportunities, widths, maximum_line_width)`.
+     * Lines are as long as possible; a line that does not fit is only
+     * created when there is no earlier break opportunity.
+     *
+     * @param maximum_line_width The maximum width of a line.
+     * @return The number of characters of each line.
+     */
+    [[nodiscard]] constexpr std::vector<size_t> fit(float maximum_line_width) const noexcept
+    {
+        auto r = std::vector<size_t>{};
+
+        auto first = 0_uz;
+        for (hilet paragraph_last : _mandatory_breaks) {
+            while (true) {
+                hilet start = first == 0 ? break_type{} : _breaks[first - 1];
+
+                // Find the first break that does not fit.
+                hilet it = std::partition_point(
+                    _breaks.begin() + first, _breaks.begin() + paragraph_last + 1, [&](break_type const& x) {
+                        return line_width(start, x) <= maximum_line_width;
+                    });
+                hilet num_fit = narrow_cast<size_t>(std::distance(_breaks.begin() + first, it));
+
+                // When nothing fits, use the first break to create a line that is too long.
+                hilet line_last = num_fit == 0 ? first : first + num_fit - 1;
+                r.push_back(_breaks[line_last].last - start.last);
+
+                first = line_last + 1;
+                if (line_last == paragraph_last) {
+                    break;
+                }
+            }
+        }
+        return r;
+    }
+
+    /** Fit the text into lines with the minimum raggedness.
+     *
+     * The lines of each paragraph are chosen together so that the sum of
+     * the squared free space at the end of each line is minimal, like the
+     * total-fit algorithm of Knuth and Plass. The free space of the last line
+     * of a paragraph is not counted.
+     *
+     * @param maximum_line_width The maximum width of a line.
+     * @return The number of characters of each line.
+     */
+    [[nodiscard]] constexpr std::vector<size_t> fit_optimal(float maximum_line_width) const noexcept
+    {
+        // A line that does not fit is only used when a single word is too long,
+        // its cost is higher than any number of lines that do fit.
+        constexpr auto overflow_cost = 1e30;
+
+        auto r = std::vector<size_t>{};
+
+        // The cost of the paragraph up to and including each break, and the break before the line.
+        auto costs = std::vector<double>{};
+        auto previous = std::vector<size_t>{};
+
+        auto first = 0_uz;
+        for (hilet paragraph_last : _mandatory_breaks) {
+            hilet num_breaks = paragraph_last + 1 - first;
+            costs.assign(num_breaks + 1, std::numeric_limits<double>::infinity());
+            previous.assign(num_breaks + 1, 0_uz);
+            costs[0] = 0.0;
+
+            for (auto j = 1_uz; j <= num_breaks; ++j) {
+                hilet& end = _breaks[first + j - 1];
+                hilet is_last_line = j == num_breaks;
+
+                // Try each start of the line, going back until the line no longer fits.
+                for (auto i = j; i != 0; --i) {
+                    hilet start = first + i == 1 ? break_type{} : _breaks[first + i - 2];
+                    hilet width = line_width(start, end);
+
+                    auto cost = costs[i - 1];
+                    if (width > maximum_line_width) {
+                        if (i != j) {
+                            break;
+                        }
+                        cost += overflow_cost;
+                    } else if (not is_last_line) {
+                        hilet free_space = static_cast<double>(maximum_line_width) - width;
+                        cost += free_space * free_space;
+                    }
+
+                    if (cost < costs[j]) {
+                        costs[j] = cost;
+                        previous[j] = i - 1;
+                    }
+                }
+            }
+
+            // Walk back from the end of the paragraph to get the line ends.
+            hilet paragraph_first_line = r.size();
+            for (auto j = num_breaks; j != 0; j = previous[j]) {
+                hilet start_last = first + previous[j] == 0 ? 0_uz : _breaks[first + previous[j] - 1].last;
+                r.push_back(_breaks[first + j - 1].last - start_last);
+            }
+            std::reverse(r.begin() + paragraph_first_line, r.end());
+
+            first = paragraph_last + 1;
+        }
+        return r;
+    }
+
+    /** Get the width of the text when broken into lines.
+     *
+     * @param lengths The number of characters of each line.
+     * @return The width of the widest line.
+     */
+    [[nodiscard]] constexpr float width(std::vector<size_t> const& lengths) const noexcept
+    {
+        return std::max(0.0f, width(lengths, std::numeric_limits<float>::infinity()));
+    }
+
+    /** Get the width and lines of the text, when only broken on mandatory breaks.
+     */
+    [[nodiscard]] constexpr std::pair<float, std::vector<size_t>> maximum_width() const noexcept
+    {
+        auto lines = fit(std::numeric_limits<float>::infinity());
+        hilet w = width(lines);
+        return {w, std::move(lines)};
+    }
+
+    /** Get the width and lines of the text, when broken on every break opportunity.
+     */
+    [[nodiscard]] constexpr std::pair<float, std::vector<size_t>> minimum_width() const noexcept
+    {
+        auto lines = std::vector<size_t>{};
+        lines.reserve(_breaks.size());
+
+        auto r = 0.0f;
+        auto start = break_type{};
+        for (hilet& x : _breaks) {
+            lines.push_back(x.last - start.last);
+            inplace_max(r, line_width(start, x));
+            start = x;
+        }
+        return {r, std::move(lines)};
+    }
+
+    /** Get each width at which the number of lines changes.
+     *
+     * The widths are found in a single sweep from the widest to the narrowest
+     * layout. The first-fit layout stays the same when the maximum line width
+     * is reduced down to its widest line that fits, so each step fits the text
+     * just below that width. This costs O(layouts * lines * log n) instead of
+     * re-scanning the text for each width.
+     *
+     * @return For each number of lines, from few to many: the width and the
+     *         length of each line of the narrowest layout with that number of lines.
+     */
+    [[nodiscard]] std::vector<std::pair<float, std::vector<size_t>>> line_count_steps() const noexcept
+    {
+        auto r = std::vector<std::pair<float, std::vector<size_t>>>{};
+        if (empty()) {
+            return r;
+        }
+
+        auto maximum_line_width = std::numeric_limits<float>::infinity();
+        auto lines = fit(maximum_line_width);
+        while (true) {
+            hilet fitted_width = width(lines, maximum_line_width);
+            if (fitted_width < 0.0f) {
+                // Every line is a single word that is too long, the text can not become narrower.
+                break;
+            }
+
+            maximum_line_width = std::nextafter(fitted_width, -std::numeric_limits<float>::infinity());
+            auto next_lines = fit(maximum_line_width);
+            if (next_lines.size() != lines.size()) {
+                r.emplace_back(width(lines), std::move(lines));
+            }
+            lines = std::move(next_lines);
+        }
+
+        r.emplace_back(width(lines), std::move(lines));
+        return r;
+    }
+
+private:
+    /** A break opportunity.
+     */
+    struct break_type {
+        /** One beyond the index of the last character of a line that ends at this break.
+         */
+        size_t last = 0;
+
+        /** The sum of the width of all characters before this break.
+         */
+        double prefix = 0.0;
+
+        /** The sum of the width of all characters up to and including the last visible character before this break.
+         */
+        double visible_prefix = 0.0;
+    };
+
+    /** All break opportunities of the text.
+     */
+    std::vector<break_type> _breaks;
+
+    /** The indices in `_breaks` of the mandatory breaks.
+     */
+    std::vector<size_t> _mandatory_breaks;
+
+    /** The width of a line, excluding trailing white space.
+     *
+     * @param start The break before the line.
+     * @param end The break at the end of the line.
+     */
+    [[nodiscard]] constexpr static float line_width(break_type const& start, break_type const& end) noexcept
+    {
+        return static_cast<float>(std::max(0.0, end.visible_prefix - start.prefix));
+    }
+
+    /** Get the width of the widest line that fits.
+     *
+     * @param lengths The number of characters of each line.
+     * @param maximum_line_width Lines wider than this are ignored.
+     * @return The width of the widest line that fits, or negative infinity if no line fits.
+     */
+    [[nodiscard]] constexpr float width(std::vector<size_t> const& lengths, float maximum_line_width) const noexcept
+    {
+        auto r = -std::numeric_limits<float>::infinity();
+        auto first = 0_uz;
+        auto start = break_type{};
+        for (hilet length : lengths) {
+            hilet last = start.last + length;
+            first = narrow_cast<size_t>(std::distance(
+                _breaks.begin(), std::lower_bound(_breaks.begin() + first, _breaks.end(), last, [](hilet& x, size_t value) {
+                    return x.last < value;
+                })));
+            hi_axiom(first < _breaks.size() and _breaks[first].last == last);
+
+            if (hilet w = line_width(start, _breaks[first]); w <= maximum_line_width) {
+                inplace_max(r, w);
+            }
+            start = _breaks[first++];
+        }
+        return r;
+    }
+};
 
 } // namespace hi::inline v1
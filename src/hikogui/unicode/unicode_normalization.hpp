@@ -7,7 +7,9 @@
 #include "ucd_decompositions.hpp"
 #include "ucd_compositions.hpp"
 #include "ucd_canonical_combining_classes.hpp"
+#include "ucd_nfc_quick_checks.hpp"
 #include "unicode_description.hpp"
+#include "../char_maps/char_maps.hpp"
 #include "../algorithm/algorithm.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
@@ -15,6 +17,8 @@
 #include <string>
 #include <string_view>
 #include <algorithm>
+#include <array>
+#include <bit>
 
 hi_export_module(hikogui.unicode.unicode_normalization);
 
@@ -129,6 +133,16 @@ struct unicode_normalize_config {
     {
         return NFKD();
     }
+
+    /** Check if only canonical decomposition is done, without any other transformations.
+     *
+     * With this configuration text that passes the NFC quick check is already normalized.
+     */
+    [[nodiscard]] constexpr bool is_canonical() const noexcept
+    {
+        return decomposition_mask == (1_uz << std::to_underlying(unicode_decomposition_type::canonical)) and not drop_C0 and
+            not drop_C1 and line_separators.empty() and paragraph_separators.empty() and drop.empty();
+    }
 };
 
 namespace detail {
@@ -282,8 +296,83 @@ constexpr void unicode_clean(std::u32string& text) noexcept
     }
 }
 
+/** Get the size of the prefix of the text which is already in NFC.
+ *
+ * The prefix ends just before a code-point which is a starter and passes
+ * the NFC quick check. Text after the prefix can be normalized independently
+ * from the prefix.
+ *
+ * @param text The text to check.
+ * @return The number of code-points in the prefix.
+ */
+[[nodiscard]] constexpr std::size_t unicode_NFC_prefix_size(std::u32string_view text) noexcept
+{
+    auto boundary = 0_uz;
+    auto previous_ccc = uint8_t{0};
+    for (auto i = 0_uz; i != text.size(); ++i) {
+        hilet c = text[i];
+
+        // All code-points below U+0300 are starters which pass the quick check.
+        if (c < 0x300) [[likely]] {
+            boundary = i;
+            previous_ccc = 0;
+            continue;
+        }
+
+        hilet ccc = ucd_get_canonical_combining_class(c);
+        if (ccc != 0 and previous_ccc > ccc) {
+            return boundary;
+        }
+
+        hilet quick_check = ucd_get_nfc_quick_check(c);
+        if (quick_check != unicode_nfc_quick_check::yes) {
+            return boundary;
+        }
+
+        if (ccc == 0) {
+            boundary = i;
+        }
+        previous_ccc = ccc;
+    }
+    return text.size();
+}
+
 } // namespace detail
 
+/** Check if text is in Unicode Normalization Form C.
+ *
+ * This is the quick check algorithm from UAX #15, it does not allocate.
+ *
+ * @param text The text to check.
+ * @return yes if the text is in NFC, no if the text is not in NFC, or maybe
+ *         if the text needs to be normalized to find out.
+ */
+[[nodiscard]] constexpr unicode_nfc_quick_check unicode_quick_check_NFC(std::u32string_view text) noexcept
+{
+    auto r = unicode_nfc_quick_check::yes;
+    auto previous_ccc = uint8_t{0};
+    for (hilet c : text) {
+        if (c < 0x300) [[likely]] {
+            previous_ccc = 0;
+            continue;
+        }
+
+        hilet ccc = ucd_get_canonical_combining_class(c);
+        if (ccc != 0 and previous_ccc > ccc) {
+            return unicode_nfc_quick_check::no;
+        }
+
+        hilet quick_check = ucd_get_nfc_quick_check(c);
+        if (quick_check == unicode_nfc_quick_check::no) {
+            return unicode_nfc_quick_check::no;
+        } else if (quick_check == unicode_nfc_quick_check::maybe) {
+            r = unicode_nfc_quick_check::maybe;
+        }
+        previous_ccc = ccc;
+    }
+    return r;
+}
+
 /** Convert text to a Unicode decomposed normal form.
  *
  * @param text to normalize, in-place.
@@ -300,6 +389,9 @@ unicode_decompose(std::u32string_view text, unicode_normalize_config config = un
 }
 
 /** Convert text to a Unicode composed normal form.
+ *
+ * For NFC the part of the text that passes the quick check is copied
+ * without decomposing and composing.
  *
  * @param text to normalize, in-place.
  * @param normalization_mask Extra features for normalization.
@@ -307,14 +399,308 @@ unicode_decompose(std::u32string_view text, unicode_normalize_config config = un
 [[nodiscard]] constexpr std::u32string
 unicode_normalize(std::u32string_view text, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
 {
+    auto prefix_size = 0_uz;
+    if (config.is_canonical()) {
+        prefix_size = detail::unicode_NFC_prefix_size(text);
+        if (prefix_size == text.size()) {
+            return std::u32string{text};
+        }
+    }
+
     auto r = std::u32string{};
-    detail::unicode_decompose(text, config, r);
+    detail::unicode_decompose(text.substr(prefix_size), config, r);
     detail::unicode_reorder(r);
     detail::unicode_compose(r);
     detail::unicode_clean(r);
+
+    if (prefix_size != 0) {
+        r.insert(0, text.substr(0, prefix_size));
+    }
     return r;
 }
 
+/** Normalize a stream of UTF-8 text to a Unicode composed normal form.
+ *
+ * The text is normalized segment by segment; a segment starts at a starter
+ * that passes the NFC quick check, which can not interact with text before it.
+ * Each segment is normalized as soon as the next segment starts and the result
+ * is passed in batches to a callback. For NFC a segment which passes the quick
+ * check is copied without decomposing and composing. The normalizer allocates
+ * its buffers once, in the constructor.
+ *
+ * To keep the segment buffer bounded a U+034F COMBINING GRAPHEME JOINER is
+ * inserted in a segment that becomes too long, like the Stream-Safe Text
+ * Format of UAX #15.
+ *
+ * The result is the same as `unicode_normalize()` on the complete text, except
+ * for the inserted COMBINING GRAPHEME JOINERs.
+ */
+class unicode_normalizer {
+public:
+    /** The maximum number of code-points in a segment.
+     */
+    constexpr static std::size_t max_segment_size = 32;
+
+    /** The number of code-points that are collected before they are passed to the callback.
+     */
+    constexpr static std::size_t output_size = 4096;
+
+    constexpr unicode_normalizer(unicode_normalizer const&) = default;
+    constexpr unicode_normalizer(unicode_normalizer&&) noexcept = default;
+    constexpr unicode_normalizer& operator=(unicode_normalizer const&) = default;
+    constexpr unicode_normalizer& operator=(unicode_normalizer&&) noexcept = default;
+
+    /** Create a normalizer.
+     *
+     * @param config The configuration of the normalization.
+     */
+    constexpr unicode_normalizer(unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept :
+        _config(std::move(config)), _canonical(_config.is_canonical())
+    {
+        _segment.reserve(max_segment_size + 1);
+        // Room for the decomposition of a segment.
+        _decomposition.reserve(max_segment_size * 4);
+        _output.reserve(output_size + max_segment_size * 4);
+    }
+
+    /** Add a chunk of UTF-8 text.
+     *
+     * A code-point may be split between chunks. The normalized text that is complete
+     * is passed to @a func, the last segment is kept until more text is added.
+     *
+     * @param text A chunk of UTF-8 text.
+     * @param func A function `void(std::u32string_view)` which is called with normalized text.
+     */
+    template<typename Func>
+    constexpr void write(std::string_view text, Func const& func) noexcept
+    {
+        if (_partial_size != 0) {
+            // Complete the code-point that was split from the previous chunk.
+            while (_partial_size != _partial_length and not text.empty()) {
+                if ((char_cast<uint8_t>(text.front()) & 0xc0) != 0x80) {
+                    // Not a continuation code-unit; the incomplete code-point is decoded as if the
+                    // text ended here, which yields U+FFFD, and the code-unit is processed with the
+                    // rest of the text. This is the same as when the code-point was not split.
+                    break;
+                }
+                _partial[_partial_size++] = text.front();
+                text.remove_prefix(1);
+            }
+
+            if (_partial_size != _partial_length and text.empty()) {
+                return;
+            }
+
+            auto partial = std::string_view{_partial.data(), _partial_size};
+            _partial_size = 0;
+            write_code_units(partial, func);
+        }
+
+        // Keep an incomplete code-point at the end of the chunk for the next call.
+        hilet partial_size = incomplete_size(text);
+        write_code_units(text.substr(0, text.size() - partial_size), func);
+
+        for (auto i = text.size() - partial_size; i != text.size(); ++i) {
+            _partial[_partial_size++] = text[i];
+        }
+
+        flush_output(func);
+    }
+
+    /** Add a code-point.
+     *
+     * @param code_point The code-point to add.
+     * @param func A function `void(std::u32string_view)` which is called with normalized text.
+     */
+    template<typename Func>
+    constexpr void write(char32_t code_point, Func const& func) noexcept
+    {
+        add(code_point, func);
+    }
+
+    /** Normalize and pass the rest of the text.
+     *
+     * After this call the normalizer can be used for a new stream of text.
+     *
+     * @param func A function `void(std::u32string_view)` which is called with normalized text.
+     */
+    template<typename Func>
+    constexpr void finish(Func const& func) noexcept
+    {
+        if (_partial_size != 0) {
+            // Let the UTF-8 decoder handle the incomplete code-point.
+            auto partial = std::string_view{_partial.data(), _partial_size};
+            _partial_size = 0;
+            write_code_units(partial, func);
+        }
+
+        normalize_segment(func);
+        flush_output(func);
+    }
+
+private:
+    unicode_normalize_config _config;
+
+    /** Only canonical decomposition is done, see `unicode_normalize_config::is_canonical()`.
+     */
+    bool _canonical;
+
+    /** The code-points of the current segment.
+     */
+    std::u32string _segment;
+
+    /** The current segment passes the NFC quick check.
+     */
+    bool _segment_is_NFC = true;
+
+    /** The combining class of the last code-point in the segment.
+     */
+    uint8_t _previous_ccc = 0;
+
+    /** Scratch buffer for decomposition.
+     */
+    std::u32string _decomposition;
+
+    /** Normalized text, which is not yet passed to the callback.
+     */
+    std::u32string _output;
+
+    /** The code-units of a code-point that is split between chunks.
+     */
+    std::array<char, 4> _partial = {};
+    std::size_t _partial_size = 0;
+    std::size_t _partial_length = 0;
+
+    /** The size of an incomplete code-point at the end of UTF-8 text.
+     */
+    [[nodiscard]] constexpr std::size_t incomplete_size(std::string_view text) noexcept
+    {
+        for (auto i = 1_uz; i <= std::min(text.size(), 3_uz); ++i) {
+            hilet cu = char_cast<uint8_t>(text[text.size() - i]);
+            if ((cu & 0xc0) == 0x80) {
+                // Continuation code-unit, search for the start.
+                continue;
+            }
+
+            hilet length = narrow_cast<std::size_t>(std::countl_one(cu));
+            if (length >= 2 and length <= 4 and length > i) {
+                _partial_length = length;
+                return i;
+            }
+            return 0;
+        }
+        return 0;
+    }
+
+    template<typename Func>
+    constexpr void write_code_units(std::string_view text, Func const& func) noexcept
+    {
+        hilet last = text.end();
+        auto it = text.begin();
+        while (it != last) {
+            if (_canonical and not to_bool(*it & 0x80)) [[likely]] {
+                // ASCII does not combine with the previous segment. An ASCII code-point
+                // followed by ASCII does not combine with the next code-point either,
+                // so only the last code-point of a run of ASCII starts a new segment.
+                normalize_segment(func);
+                auto next = it + 1;
+                while (next != last and not to_bool(*next & 0x80) and _output.size() < output_size) {
+                    _output += char_cast<char32_t>(*it);
+                    it = next++;
+                }
+                _segment += char_cast<char32_t>(*it);
+                it = next;
+
+                if (_output.size() >= output_size) [[unlikely]] {
+                    flush_output(func);
+                }
+
+            } else {
+                hilet[code_point, valid] = char_map<"utf-8">{}.read(it, last);
+                add(code_point, func);
+            }
+        }
+    }
+
+    template<typename Func>
+    constexpr void add(char32_t code_point, Func const& func) noexcept
+    {
+        auto ccc = uint8_t{0};
+        auto quick_check = unicode_nfc_quick_check::yes;
+        if (code_point >= 0x300) {
+            ccc = ucd_get_canonical_combining_class(code_point);
+            quick_check = ucd_get_nfc_quick_check(code_point);
+        }
+
+        auto is_boundary = ccc == 0 and quick_check == unicode_nfc_quick_check::yes;
+        if (not _canonical) {
+            // With other transformations the boundary depends on the start of the decomposition.
+            _decomposition.clear();
+            detail::unicode_decompose(code_point, _config, _decomposition);
+            if (_decomposition.empty()) {
+                // The code-point is dropped.
+                return;
+            }
+
+            hilet first = _decomposition.front();
+            is_boundary =
+                (first >> 24) == 0 and ucd_get_nfc_quick_check(first & 0xff'ffff) == unicode_nfc_quick_check::yes;
+        }
+
+        if (is_boundary) {
+            normalize_segment(func);
+
+        } else if (_segment.size() == max_segment_size) [[unlikely]] {
+            normalize_segment(func);
+            // U+034F COMBINING GRAPHEME JOINER is a starter which does not compose.
+            _segment += U'\u034f';
+        }
+
+        if (quick_check != unicode_nfc_quick_check::yes or (ccc != 0 and _previous_ccc > ccc)) {
+            _segment_is_NFC = false;
+        }
+        _previous_ccc = ccc;
+        _segment += code_point;
+    }
+
+    template<typename Func>
+    constexpr void normalize_segment(Func const& func) noexcept
+    {
+        if (_segment.empty()) {
+            return;
+        }
+
+        if (_canonical and _segment_is_NFC) {
+            _output += _segment;
+
+        } else {
+            _decomposition.clear();
+            detail::unicode_decompose(_segment, _config, _decomposition);
+            detail::unicode_reorder(_decomposition);
+            detail::unicode_compose(_decomposition);
+            detail::unicode_clean(_decomposition);
+            _output += _decomposition;
+        }
+
+        _segment.clear();
+        _segment_is_NFC = true;
+        _previous_ccc = 0;
+
+        if (_output.size() >= output_size) {
+            flush_output(func);
+        }
+    }
+
+    template<typename Func>
+    constexpr void flush_output(Func const& func) noexcept
+    {
+        if (not _output.empty()) {
+            func(std::u32string_view{_output});
+            _output.clear();
+        }
+    }
+};
+
 /** Check if the string of code-points is a single grapheme in NFC normal form.
  * 
  * @param it An iterator pointing to the first code-point.
@@ -342,14 +728,16 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
     // And that the CCC is ordered by numeric value.
     auto max_ccc = uint8_t{1};
     for (; it != last; ++it) {
-        hilet ccc = ucd_get_canonical_combining_class(*it);
+        hilet code_point = *it;
+        hilet ccc = ucd_get_canonical_combining_class(code_point);
         if (ccc < max_ccc) {
             return false;
         }
         max_ccc = ccc;
 
-        // XXX Needs check if code-point is allowed in NFC.
-
+        if (ucd_get_nfc_quick_check(code_point) == unicode_nfc_quick_check::no) {
+            return false;
+        }
     }
 
     // All tests pass.
@@ -0,0 +1,117 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "unicode_normalization.hpp"
+#include "../char_maps/char_maps.hpp"
+#include "../benchmark.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace hi;
+
+namespace {
+
+/** Sample text in different languages, each in NFC.
+ */
+std::vector<std::pair<std::string_view, std::u32string_view>> const corpora = {
+    {"english", U"The quick brown fox jumps over the lazy dog, while the cat sleeps on the warm windowsill. "},
+    {"french", U"Le cœur déçu mais l'âme plutôt naïve, Louÿs rêva de crapaüter en canoë au delà des îles. "},
+    {"vietnamese", U"Tiếng Việt có dấu thanh và dấu phụ trên hầu hết các âm tiết của một câu văn bình thường. "},
+    {"greek", U"Ξεσκεπάζω την ψυχοφθόρα βδελυγμία, ενώ η γαλήνια θάλασσα αντανακλά το φως. "},
+    {"russian", U"Съешь же ещё этих мягких французских булок, да выпей чаю в тёплой комнате. "},
+    {"hindi", U"ऋषियों को सताने वाले दुष्ट राक्षसों के राजा रावण का सर्वनाश करने वाले विष्णुवतार भगवान श्रीराम। "},
+    {"korean", U"키스의 고유조건은 입술끼리 만나야 하고 특별한 기술은 필요치 않다. "},
+    {"japanese", U"いろはにほへと ちりぬるを わかよたれそ つねならむ うゐのおくやま けふこえて。"},
+};
+
+/** Repeat a sample text to about 256k code-points.
+ */
+[[nodiscard]] std::u32string make_text(std::u32string_view sample)
+{
+    auto r = std::u32string{};
+    while (r.size() < 256 * 1024) {
+        r += sample;
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(unicode_normalization_benchmarks, quick_check_NFC)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = make_text(sample);
+        hilet num_bytes = hi::to_string(text).size();
+
+        auto r = unicode_nfc_quick_check::yes;
+        hilet rate = benchmark_rate([&] {
+            r = unicode_quick_check_NFC(text);
+        });
+        ASSERT_EQ(r, unicode_nfc_quick_check::yes);
+
+        benchmark_report(std::format("quick check NFC {}", name), rate * num_bytes / 1'000'000, "MB/s");
+    }
+}
+
+TEST(unicode_normalization_benchmarks, normalize_NFC)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = make_text(sample);
+        hilet decomposed_text = unicode_decompose(text);
+        hilet num_bytes = hi::to_string(text).size();
+
+        hilet rate = benchmark_rate([&] {
+            hilet r = unicode_normalize(text);
+            ASSERT_EQ(r.size(), text.size());
+        });
+
+        hilet decomposed_rate = benchmark_rate([&] {
+            hilet r = unicode_normalize(decomposed_text);
+            ASSERT_EQ(r.size(), text.size());
+        });
+
+        benchmark_report(std::format("normalize NFC {}", name), rate * num_bytes / 1'000'000, "MB/s");
+        benchmark_report(std::format("normalize NFD->NFC {}", name), decomposed_rate * num_bytes / 1'000'000, "MB/s");
+    }
+}
+
+TEST(unicode_normalization_benchmarks, normalizer_NFC)
+{
+    for (hilet& [name, sample] : corpora) {
+        hilet text = hi::to_string(make_text(sample));
+        hilet decomposed_text = hi::to_string(unicode_decompose(make_text(sample)));
+
+        auto normalizer = unicode_normalizer{};
+        auto count = 0_uz;
+        hilet count_code_points = [&count](std::u32string_view str) {
+            count += str.size();
+        };
+
+        // Write the text in chunks, like when reading from a file.
+        hilet write_chunks = [&](std::string_view str) {
+            count = 0;
+            for (auto i = 0_uz; i < str.size(); i += 4096) {
+                normalizer.write(str.substr(i, 4096), count_code_points);
+            }
+            normalizer.finish(count_code_points);
+        };
+
+        hilet rate = benchmark_rate([&] {
+            write_chunks(text);
+        });
+
+        hilet decomposed_rate = benchmark_rate([&] {
+            write_chunks(decomposed_text);
+        });
+
+        benchmark_report(std::format("normalizer NFC {}", name), rate * text.size() / 1'000'000, "MB/s");
+        benchmark_report(
+            std::format("normalizer NFD->NFC {}", name), decomposed_rate * text.size() / 1'000'000, "MB/s");
+    }
+}
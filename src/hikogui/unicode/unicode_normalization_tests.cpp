@@ -3,6 +3,7 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "unicode_normalization.hpp"
+#include "../char_maps/char_maps.hpp"
 #include "../file/file.hpp"
 #include "../path/path.hpp"
 #include "../algorithm/algorithm.hpp"
@@ -144,6 +145,103 @@ TEST(unicode_normalization, NFC)
     }
 }
 
+TEST(unicode_normalization, quick_check_NFC)
+{
+    ASSERT_EQ(unicode_quick_check_NFC(U"Audio device:"), unicode_nfc_quick_check::yes);
+    // e + COMBINING ACUTE ACCENT may compose.
+    ASSERT_EQ(unicode_quick_check_NFC(U"e\u0301"), unicode_nfc_quick_check::maybe);
+    // ANGSTROM SIGN is a singleton decomposition.
+    ASSERT_EQ(unicode_quick_check_NFC(U"\u212b"), unicode_nfc_quick_check::no);
+    // COMBINING DOT BELOW (220) must be ordered before COMBINING ACUTE ACCENT (230).
+    ASSERT_EQ(unicode_quick_check_NFC(U"a\u0301\u0323"), unicode_nfc_quick_check::no);
+
+    for (hilet& test : parseNormalizationTests()) {
+        ASSERT_NE(unicode_quick_check_NFC(test.c2), unicode_nfc_quick_check::no) << test.comment;
+        ASSERT_NE(unicode_quick_check_NFC(test.c4), unicode_nfc_quick_check::no) << test.comment;
+
+        for (hilet& c : {test.c1, test.c3, test.c5}) {
+            if (unicode_quick_check_NFC(c) == unicode_nfc_quick_check::yes) {
+                ASSERT_EQ(unicode_normalize(c), c) << test.comment;
+            }
+        }
+    }
+}
+
+TEST(unicode_normalization, normalizer_NFC)
+{
+    auto normalizer = unicode_normalizer{};
+    auto r = std::u32string{};
+    hilet append = [&r](std::u32string_view str) {
+        r += str;
+    };
+
+    for (hilet& test : parseNormalizationTests()) {
+        // Write the text in chunks of one code-unit, to split multi-byte code-points.
+        for (hilet& c : {test.c1, test.c2, test.c3}) {
+            r.clear();
+            for (hilet cu : hi::to_string(c)) {
+                normalizer.write(std::string_view{&cu, 1}, append);
+            }
+            normalizer.finish(append);
+            ASSERT_EQ(r, test.c2) << test.comment;
+        }
+
+        for (hilet& c : {test.c4, test.c5}) {
+            r.clear();
+            normalizer.write(hi::to_string(c), append);
+            normalizer.finish(append);
+            ASSERT_EQ(r, test.c4) << test.comment;
+        }
+    }
+}
+
+TEST(unicode_normalization, normalizer_malformed_split)
+{
+    auto normalizer = unicode_normalizer{};
+    auto r = std::u32string{};
+    hilet append = [&r](std::u32string_view str) {
+        r += str;
+    };
+
+    // Malformed UTF-8 gives the same result when a code-point is split between chunks.
+    for (hilet text : {"a\xe2\x82" "b", "a\xe2\x82\xe2\x82\xac", "a\xf0\x9f\x98" "b\xcc\x81", "\xf0\x9f\xe2\x82\xac"}) {
+        hilet str = std::string_view{text};
+
+        r.clear();
+        normalizer.write(str, append);
+        normalizer.finish(append);
+        hilet expected = r;
+        ASSERT_NE(expected.find(U'\ufffd'), std::u32string::npos);
+
+        for (auto i = 1_uz; i != str.size(); ++i) {
+            r.clear();
+            normalizer.write(str.substr(0, i), append);
+            normalizer.write(str.substr(i), append);
+            normalizer.finish(append);
+            ASSERT_EQ(r, expected) << "split at " << i;
+        }
+    }
+}
+
+TEST(unicode_normalization, normalizer_stream_safe)
+{
+    auto normalizer = unicode_normalizer{};
+    auto r = std::u32string{};
+    hilet append = [&r](std::u32string_view str) {
+        r += str;
+    };
+
+    // A starter followed by more combining marks than fit in a segment.
+    auto text = std::u32string{U"a"};
+    text.append(100, U'\u0301');
+    normalizer.write(hi::to_string(text), append);
+    normalizer.finish(append);
+
+    ASSERT_EQ(r.front(), U'\u00e1');
+    ASSERT_EQ(std::count(r.begin(), r.end(), U'\u0301'), 99);
+    ASSERT_NE(std::count(r.begin(), r.end(), U'\u034f'), 0);
+}
+
 TEST(unicode_normalization, NFKC)
 {
     for (hilet& test : parseNormalizationTests()) {
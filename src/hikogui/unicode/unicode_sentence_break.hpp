@@ -8,6 +8,7 @@
 #pragma once
 
 #include "ucd_sentence_break_properties.hpp"
+#include "ucd_sentence_break_transitions.hpp"
 #include "unicode_break_opportunity.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
@@ -15,6 +16,8 @@
 #include <vector>
 #include <iterator>
 #include <algorithm>
+#include <ranges>
+#include <utility>
 
 hi_export_module(hikogui.unicode.unicode_sentence_break);
 
@@ -34,15 +37,13 @@ public:
     constexpr unicode_sentence_break_info(unicode_sentence_break_property const &sentence_break_property) noexcept : _value(std::to_underlying(sentence_break_property))
     {}
 
-    constexpr unicode_sentence_break_info &make_skip() noexcept
-    {
-        _value |= 0x40;
-        return *this;
-    }
+    constexpr explicit unicode_sentence_break_info(char32_t code_point) noexcept :
+        unicode_sentence_break_info(ucd_get_sentence_break_property(code_point))
+    {}
 
-    [[nodiscard]] constexpr bool is_skip() const noexcept
+    [[nodiscard]] constexpr unicode_sentence_break_property property() const noexcept
     {
-        return to_bool(_value & 0x40);
+        return static_cast<unicode_sentence_break_property>(_value & 0x3f);
     }
 
     [[nodiscard]] constexpr friend bool operator==(unicode_sentence_break_info const &lhs, unicode_sentence_break_property const &rhs) noexcept
@@ -66,184 +67,128 @@ private:
     uint8_t _value;
 };
 
-hi_inline void unicode_sentence_break_SB1_SB4(
-    unicode_break_vector &r,
-    std::vector<unicode_sentence_break_info> &infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_sentence_break_property;
-
-    hi_axiom(r.size() == infos.size() + 1);
-
-    r.front() = yes; // SB1
-    r.back() = yes; // SB2
-
-    for (auto i = 1_uz; i < infos.size(); ++i) {
-        hilet prev = infos[i - 1];
-        hilet next = infos[i];
+/** The state of the sentence break algorithm.
+ *
+ * The break opportunities are determined in a single forward pass by the
+ * state machine generated from the rules of UAX #29, see
+ * ucd_get_sentence_break_transition(). The state machine tracks the
+ * `SATerm Close* Sp*` sequence before the current position, so that it does
+ * not need to be searched for backwards. The text is only searched forward for
+ * SB8, directly after an `ATerm Close* Sp*` sequence.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+class unicode_sentence_break_state {
+public:
+    using iterator = It;
 
-        r[i] = [&] () {
-            if (prev == CR and next == LF) {
-                return no; // SB3
-            } else if (is_ParaSep(prev)) {
-                return yes; //SB4
-            } else {
-                return unassigned;
-            }
-        }();
+    constexpr unicode_sentence_break_state(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept :
+        _it(first), _last(last), _code_point_func(code_point_func)
+    {
     }
-}
-
-hi_inline void unicode_sentence_break_SB5(
-    unicode_break_vector &r,
-    std::vector<unicode_sentence_break_info> &infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_sentence_break_property;
 
-    hi_axiom(r.size() == infos.size() + 1);
-
-    for (auto i = 1_uz; i < infos.size(); ++i) {
-        hilet prev = infos[i - 1];
-        auto &next = infos[i];
-
-        if ((not is_ParaSep(prev) and prev != CR and prev != LF) and (next == Extend or next == Format)) {
-            if (r[i] == unassigned) {
-                r[i] = no;
-            }
-            next.make_skip();
-        }
+    /** The character before which the next break opportunity is determined.
+     */
+    [[nodiscard]] constexpr It const& position() const noexcept
+    {
+        return _it;
     }
-}
 
-hi_inline void unicode_sentence_break_SB6_SB998(
-    unicode_break_vector &r,
-    std::vector<unicode_sentence_break_info> &infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_sentence_break_property;
+    /** The next break opportunity is at the end of the text.
+     */
+    [[nodiscard]] constexpr bool at_end() const noexcept
+    {
+        return _it == _last;
+    }
 
-    hi_axiom(r.size() == infos.size() + 1);
+    /** Determine the break opportunity before the current character, and move to the next character.
+     *
+     * @return The break opportunity before the current character, or at the end of the text.
+     */
+    [[nodiscard]] constexpr unicode_break_opportunity next() noexcept
+    {
+        using enum unicode_break_opportunity;
 
-    for (auto i = 0_z; i < std::ssize(infos); ++i) {
-        hilet &next = infos[i];
-        if (r[i] != unassigned) {
-            continue;
+        if (_it == _last) {
+            return yes; // SB2
         }
 
-        hi_axiom(not next.is_skip());
-
-        std::ptrdiff_t k;
-
-        hilet prev = [&] {
-            for (k = i - 1; k >= 0; --k) {
-                if (not infos[k].is_skip()) {
-                    return infos[k];
-                }
+        hilet [action, next_state] = ucd_get_sentence_break_transition(_state, get_info(_it).property());
+        _state = next_state;
+
+        hilet r = [&] {
+            switch (action) {
+            case unicode_sentence_break_action::no:
+                return no;
+            case unicode_sentence_break_action::yes:
+                return yes;
+            case unicode_sentence_break_action::SB8:
+                return ends_in_lower() ? no : yes;
+            default:
+                hi_no_default();
             }
-            return unicode_sentence_break_info{};
         }();
 
-        hilet prev_prev = [&] {
-            for (--k; k >= 0; --k) {
-                if (not infos[k].is_skip()) {
-                    return infos[k];
-                }
-            }
-            return unicode_sentence_break_info{};
-        }();
+        ++_it;
+        return r;
+    }
 
-        // close_sp
-        // 0 - no suffix
-        // 1 - ends in ParSep
-        // 2 - includes SP
-        // 4 - includes Close
-        hilet [prefix, close_sp_par_found] = [&]() {
-            using enum unicode_break_opportunity;
-
-            auto found = 0;
-            auto state = ' ';
-            for (auto j = i - 1; j >= 0; --j) {
-                if (not infos[j].is_skip()) {
-                    switch (state) {
-                    case ' ':
-                        if (is_ParaSep(infos[j])) {
-                            found |= 1;
-                            state = 'p';
-                        } else if (infos[j] == Sp) {
-                            found |= 2;
-                            state = 's';
-                        } else if (infos[j] == Close) {
-                            found |= 4;
-                            state = 'c';
-                        } else {
-                            return std::make_pair(infos[j], found);
-                        }
-                        break;
-                    case 'p': // We can only be in the state 'p' once.
-                    case 's':
-                        if (infos[j] == Sp) {
-                            found |= 2;
-                            state = 's';
-                        } else if (infos[j] == Close) {
-                            found |= 4;
-                            state = 'c';
-                        } else {
-                            return std::make_pair(infos[j], found);
-                        }
-                        break;
-                    case 'c':
-                        if (infos[j] == Close) {
-                            found |= 4;
-                            state = 'c';
-                        } else {
-                            return std::make_pair(infos[j], found);
-                        }
-                        break;
-                    }
-                }
-            }
-            return std::make_pair(unicode_sentence_break_info{}, 0);
-        }();
-        hilet optional_close = (close_sp_par_found & 3) == 0;
-        hilet optional_close_sp = (close_sp_par_found & 1) == 0;
-        hilet optional_close_sp_par = true;
-
-        hilet end_in_lower = [&]{
-            for (auto j = i; j < std::ssize(infos); ++j) {
-                if (not infos[j].is_skip()) {
-                    if (infos[j] == Lower) {
-                        return true;
-                    } else if (infos[j] == OLetter or infos[j] == Upper or is_ParaSep(infos[j]) or is_SATerm(infos[j])) {
-                        return false;
-                    }
-                }
-            }
-            return false;
-        }();
+private:
+    It _it;
+    ItEnd _last;
+    CodePointFunc _code_point_func;
+    uint8_t _state = 0;
 
-        r[i] = [&] () {
-            if (prev == ATerm and next == Numeric) {
-                return no; // SB6
-            } else if ((prev_prev == Upper or prev_prev == Lower) and prev == ATerm and next == Upper) {
-                return no; // SB7
-            } else if (prefix == ATerm and optional_close_sp and end_in_lower) {
-                return no; // SB8
-            } else if (is_SATerm(prefix) and optional_close_sp and (next == SContinue or is_SATerm(next))) {
-                return no; // SB8a
-            } else if (is_SATerm(prefix) and optional_close and (next == Close or next == Sp or is_ParaSep(next))) {
-                return no; // SB9
-            } else if (is_SATerm(prefix) and optional_close_sp and (next == Sp or is_ParaSep(next))) {
-                return no; // SB10
-            } else if (is_SATerm(prefix) and optional_close_sp_par) {
-                return yes; // SB11
-            } else {
-                return no; // SB998
+    [[nodiscard]] constexpr unicode_sentence_break_info get_info(It const& it) const noexcept
+    {
+        return unicode_sentence_break_info{_code_point_func(*it)};
+    }
+
+    /** Check if the text from the current character is: `( ¬(OLetter | Upper | Lower | ParaSep | SATerm) )* Lower`.
+     */
+    [[nodiscard]] constexpr bool ends_in_lower() const noexcept
+    {
+        using enum unicode_sentence_break_property;
+
+        // Extend and Format are neither of the characters searched for, so they do not need to be skipped.
+        for (auto it = _it; it != _last; ++it) {
+            hilet info = get_info(it);
+            if (info == Lower) {
+                return true;
+            } else if (info == OLetter or info == Upper or is_ParaSep(info) or is_SATerm(info)) {
+                return false;
             }
-        }();
+        }
+        return false;
     }
+};
+
 }
 
+/** An iterator over the sentence break positions.
+ *
+ * @see unicode_sentence_breaks()
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+using unicode_sentence_break_iterator =
+    detail::unicode_break_position_iterator<detail::unicode_sentence_break_state<It, ItEnd, CodePointFunc>>;
+
+/** The sentence break positions of a text.
+ *
+ * The break positions are found lazily while iterating, without scanning the
+ * rest of the text.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to one beyond the last character.
+ * @param code_point_func A function to get a code-point from an dereferenced iterator.
+ * @return A range of iterators to the character after each sentence break, starting with @a first and ending with @a last.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] constexpr std::ranges::subrange<unicode_sentence_break_iterator<It, ItEnd, CodePointFunc>, std::default_sentinel_t>
+unicode_sentence_breaks(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    return {
+        unicode_sentence_break_iterator<It, ItEnd, CodePointFunc>{detail::unicode_sentence_break_state{first, last, code_point_func}},
+        std::default_sentinel};
 }
 
 /** The unicode word break algorithm UAX#29
@@ -257,21 +202,58 @@ template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] hi_inline unicode_break_vector
 unicode_sentence_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
-    auto size = narrow_cast<size_t>(std::distance(first, last));
-    auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
-
-    auto infos = std::vector<detail::unicode_sentence_break_info>{};
-    infos.reserve(size);
-    std::transform(first, last, std::back_inserter(infos), [&] (hilet &item) {
-        hilet code_point = code_point_func(item);
-        return detail::unicode_sentence_break_info{ucd_get_sentence_break_property(code_point)};
-        });
-
-    detail::unicode_sentence_break_SB1_SB4(r, infos);
-    detail::unicode_sentence_break_SB5(r, infos);
-    detail::unicode_sentence_break_SB6_SB998(r, infos);
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+
+    auto r = unicode_break_vector{};
+    r.reserve(size + 1);
+
+    auto state = detail::unicode_sentence_break_state{first, last, code_point_func};
+    for (auto i = 0_uz; i != size + 1; ++i) {
+        r.push_back(state.next());
+    }
     return r;
 }
 
+/** Find the next sentence break after a position.
+ *
+ * The search starts at the beginning of the paragraph containing @a position,
+ * since there is always a sentence break after a paragraph separator (SB4).
+ *
+ * @param first An iterator to the first character of the text.
+ * @param position An iterator to the character after which to search.
+ * @param last An iterator to one beyond the last character of the text.
+ * @param code_point_func A function to get a code-point from an dereferenced iterator.
+ * @return An iterator to the character after the next sentence break, or @a last.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] constexpr It
+unicode_sentence_break_next(It first, It position, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    using enum unicode_sentence_break_property;
+    using info_type = detail::unicode_sentence_break_info;
+
+    if (position == last) {
+        return position;
+    }
+
+    auto start = position;
+    while (start != first) {
+        hilet prev = info_type{code_point_func(*std::prev(start))};
+        if (is_ParaSep(prev) and not(prev == CR and info_type{code_point_func(*start)} == LF)) {
+            break;
+        }
+        --start;
+    }
+
+    // Run the state machine up to and including the break opportunity before @a position.
+    auto state = detail::unicode_sentence_break_state{start, last, code_point_func};
+    while (state.position() != position) {
+        std::ignore = state.next();
+    }
+    std::ignore = state.next();
+
+    return *unicode_sentence_break_iterator<It, ItEnd, CodePointFunc>{std::move(state)};
+}
+
 
 }
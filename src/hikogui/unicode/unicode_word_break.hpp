@@ -11,11 +11,16 @@
 #include "ucd_general_categories.hpp"
 #include "ucd_grapheme_cluster_breaks.hpp"
 #include "ucd_word_break_properties.hpp"
+#include "ucd_word_break_transitions.hpp"
+#include "ucd_text_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <algorithm>
 #include <vector>
 #include <iterator>
+#include <ranges>
+#include <tuple>
+#include <utility>
 
 hi_export_module(hikogui.unicode.unicode_word_break);
 
@@ -37,15 +42,21 @@ public:
     {
     }
 
-    constexpr unicode_word_break_info& make_skip() noexcept
+    constexpr explicit unicode_word_break_info(unicode_text_properties const& properties) noexcept :
+        unicode_word_break_info(
+            properties.word_break_property(),
+            properties.grapheme_cluster_break() == unicode_grapheme_cluster_break::Extended_Pictographic)
     {
-        _value |= 0x40;
-        return *this;
     }
 
-    [[nodiscard]] constexpr bool is_skip() const noexcept
+    constexpr explicit unicode_word_break_info(char32_t code_point) noexcept :
+        unicode_word_break_info(ucd_get_text_properties(code_point))
     {
-        return to_bool(_value & 0x40);
+    }
+
+    [[nodiscard]] constexpr unicode_word_break_property property() const noexcept
+    {
+        return static_cast<unicode_word_break_property>(_value & 0x3f);
     }
 
     [[nodiscard]] constexpr bool is_pictographic() const noexcept
@@ -67,168 +78,147 @@ public:
         return rhs == unicode_word_break_property::ALetter or rhs == unicode_word_break_property::Hebrew_Letter;
     }
 
-    [[nodiscard]] constexpr friend bool is_MidNumLetQ(unicode_word_break_info const& rhs) noexcept
+    [[nodiscard]] constexpr friend bool is_newline(unicode_word_break_info const& rhs) noexcept
     {
-        return rhs == unicode_word_break_property::MidNumLet or rhs == unicode_word_break_property::Single_Quote;
+        return rhs == unicode_word_break_property::Newline or rhs == unicode_word_break_property::CR or
+            rhs == unicode_word_break_property::LF;
     }
 
 private:
     uint8_t _value;
 };
 
-hi_inline void
-unicode_word_break_WB1_WB3d(unicode_break_vector& r, std::vector<unicode_word_break_info>& infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_word_break_property;
+/** The state of the word break algorithm.
+ *
+ * The break opportunities are determined in a single forward pass by the
+ * state machine generated from the rules of UAX #29, see
+ * ucd_get_word_break_transition(). The state machine remembers what the rules
+ * need to know about the characters before the current position, such as the
+ * parity of the regional indicators (WB15, WB16). Only WB3c, WB6, WB7b and WB12
+ * look at the next characters, which is done here.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+class unicode_word_break_state {
+public:
+    using iterator = It;
 
-    hi_axiom(r.size() == infos.size() + 1);
-
-    r.front() = yes; // WB1
-    r.back() = yes; // WB2
-
-    for (auto i = 1_uz; i < infos.size(); ++i) {
-        hilet prev = infos[i - 1];
-        hilet next = infos[i];
-
-        r[i] = [&]() {
-            if (prev == CR and next == LF) {
-                return no; // WB3
-            } else if (prev == Newline or prev == CR or prev == LF) {
-                return yes; // WB3a
-            } else if (next == Newline or next == CR or next == LF) {
-                return yes; // WB3b
-            } else if (prev == ZWJ and next.is_pictographic()) {
-                return no; // WB3c
-            } else if (prev == WSegSpace and next == WSegSpace) {
-                return no; // WB3d
-            } else {
-                return unassigned;
-            }
-        }();
+    constexpr unicode_word_break_state(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept :
+        _it(first), _last(last), _code_point_func(code_point_func)
+    {
     }
-}
-
-hi_inline void unicode_word_break_WB4(unicode_break_vector& r, std::vector<unicode_word_break_info>& infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_word_break_property;
-
-    hi_axiom(r.size() == infos.size() + 1);
-
-    for (auto i = 1_uz; i < infos.size(); ++i) {
-        hilet prev = infos[i - 1];
-        auto& next = infos[i];
 
-        if ((prev != Newline and prev != CR and prev != LF) and (next == Extend or next == Format or next == ZWJ)) {
-            if (r[i] == unassigned) {
-                r[i] = no;
-            }
-            next.make_skip();
-        }
+    /** The character before which the next break opportunity is determined.
+     */
+    [[nodiscard]] constexpr It const& position() const noexcept
+    {
+        return _it;
     }
-}
 
-hi_inline void
-unicode_word_break_WB5_WB999(unicode_break_vector& r, std::vector<unicode_word_break_info>& infos) noexcept
-{
-    using enum unicode_break_opportunity;
-    using enum unicode_word_break_property;
+    /** The next break opportunity is at the end of the text.
+     */
+    [[nodiscard]] constexpr bool at_end() const noexcept
+    {
+        return _it == _last;
+    }
 
-    hi_axiom(r.size() == infos.size() + 1);
+    /** Determine the break opportunity before the current character, and move to the next character.
+     *
+     * @return The break opportunity before the current character, or at the end of the text.
+     */
+    [[nodiscard]] constexpr unicode_break_opportunity next() noexcept
+    {
+        using enum unicode_break_opportunity;
+        using enum unicode_word_break_property;
 
-    for (auto i = 0_uz; i != infos.size(); ++i) {
-        if (r[i] != unassigned) {
-            continue;
+        if (_it == _last) {
+            return yes; // WB2
         }
 
-        hilet& next = infos[i];
+        hilet info = get_info(_it);
+        hilet [action, next_state] = ucd_get_word_break_transition(_state, info.property());
+        _state = next_state;
+
+        hilet r = [&] {
+            switch (action) {
+            case unicode_word_break_action::no:
+                return no;
+            case unicode_word_break_action::yes:
+                return yes;
+            case unicode_word_break_action::WB3c:
+                return info.is_pictographic() ? no : yes;
+            case unicode_word_break_action::WB6:
+                return is_AHLetter(look_ahead()) ? no : yes;
+            case unicode_word_break_action::WB7b:
+                return look_ahead() == Hebrew_Letter ? no : yes;
+            case unicode_word_break_action::WB12:
+                return look_ahead() == Numeric ? no : yes;
+            default:
+                hi_no_default();
+            }
+        }();
 
-        // WB4: (Extend | Format | ZWJ)* is assigned to no-break.
-        hi_axiom(not next.is_skip());
+        ++_it;
+        return r;
+    }
 
-        auto prev_i = narrow_cast<ptrdiff_t>(i) - 1;
-        auto prev = unicode_word_break_info{};
-        for (; prev_i >= 0 ; --prev_i) {
-            if (not infos[prev_i].is_skip()) {
-                prev = infos[prev_i];
-                break;
-            }
-        }
+private:
+    It _it;
+    ItEnd _last;
+    CodePointFunc _code_point_func;
+    uint8_t _state = 0;
 
-        auto prev_prev_i = prev_i - 1;
-        auto prev_prev = unicode_word_break_info{};
-        for (; prev_prev_i >= 0; --prev_prev_i) {
-            if (not infos[prev_prev_i].is_skip()) {
-                prev_prev = infos[prev_prev_i];
-                break;
-            }
-        }
+    [[nodiscard]] constexpr unicode_word_break_info get_info(It const& it) const noexcept
+    {
+        return unicode_word_break_info{_code_point_func(*it)};
+    }
 
-        auto next_next_i = i + 1;
-        auto next_next = unicode_word_break_info{};
-        for (; next_next_i != infos.size(); ++next_next_i) {
-            if (not infos[next_next_i].is_skip()) {
-                next_next = infos[next_next_i];
-                break;
-            }
-        }
+    /** The first character after the current character which is not skipped by WB4.
+     *
+     * The current character is not a newline, so all following Extend, Format and ZWJ are skipped.
+     */
+    [[nodiscard]] constexpr unicode_word_break_info look_ahead() const noexcept
+    {
+        using enum unicode_word_break_property;
 
-        auto RI_i = prev_i - 1;
-        auto RI_is_pair = true;
-        if (prev == Regional_Indicator and next == Regional_Indicator) {
-            // Track back before prev, and count consecutive RI.
-            for (; RI_i >= 0; --RI_i) {
-                if (infos[RI_i].is_skip()) {
-                    continue;
-                } else if (infos[RI_i] != Regional_Indicator) {
-                    break;
-                }
-                RI_is_pair = not RI_is_pair;
+        for (auto it = std::next(_it); it != _last; ++it) {
+            hilet info = get_info(it);
+            if (info != Extend and info != Format and info != ZWJ) {
+                return info;
             }
         }
-
-        r[i] = [&] {
-            if (is_AHLetter(prev) and is_AHLetter(next)) {
-                return no; // WB5
-            } else if (is_AHLetter(prev) and (next == MidLetter or is_MidNumLetQ(next)) and is_AHLetter(next_next)) {
-                return no; // WB6
-            } else if (is_AHLetter(prev_prev) and (prev == MidLetter or is_MidNumLetQ(prev)) and is_AHLetter(next)) {
-                return no; // WB7
-            } else if (prev == Hebrew_Letter and next == Single_Quote) {
-                return no; // WB7a
-            } else if (prev == Hebrew_Letter and next == Double_Quote and next_next == Hebrew_Letter) {
-                return no; // WB7b
-            } else if (prev_prev == Hebrew_Letter and prev == Double_Quote and next == Hebrew_Letter) {
-                return no; // WB7c
-            } else if (prev == Numeric and next == Numeric) {
-                return no; // WB8
-            } else if (is_AHLetter(prev) and next == Numeric) {
-                return no; // WB9
-            } else if (prev == Numeric and is_AHLetter(next)) {
-                return no; // WB10
-            } else if (prev_prev == Numeric and (prev == MidNum or is_MidNumLetQ(prev)) and next == Numeric) {
-                return no; // WB11
-            } else if (prev == Numeric and (next == MidNum or is_MidNumLetQ(next)) and next_next == Numeric) {
-                return no; // WB12
-            } else if (prev == Katakana and next == Katakana) {
-                return no; // WB13
-            } else if (
-                (is_AHLetter(prev) or prev == Numeric or prev == Katakana or prev == ExtendNumLet) and next == ExtendNumLet) {
-                return no; // WB13a
-            } else if (prev == ExtendNumLet and (is_AHLetter(next) or next == Numeric or next == Katakana)) {
-                return no; // WB13b
-            } else if (prev == Regional_Indicator and next == Regional_Indicator and RI_is_pair) {
-                return no; // WB15 WB16
-            } else {
-                return yes; // WB999
-            }
-        }();
+        return unicode_word_break_info{};
     }
-}
+};
 
 } // namespace detail
 
+/** An iterator over the word break positions.
+ *
+ * @see unicode_word_breaks()
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+using unicode_word_break_iterator =
+    detail::unicode_break_position_iterator<detail::unicode_word_break_state<It, ItEnd, CodePointFunc>>;
+
+/** The word break positions of a text.
+ *
+ * The break positions are found lazily while iterating, without scanning the
+ * rest of the text.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to one beyond the last character.
+ * @param code_point_func A function to code-point from a character.
+ * @return A range of iterators to the character after each word break, starting with @a first and ending with @a last.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] constexpr std::ranges::subrange<unicode_word_break_iterator<It, ItEnd, CodePointFunc>, std::default_sentinel_t>
+unicode_word_breaks(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    return {
+        unicode_word_break_iterator<It, ItEnd, CodePointFunc>{detail::unicode_word_break_state{first, last, code_point_func}},
+        std::default_sentinel};
+}
+
 /** The unicode word break algorithm UAX#29
  *
  * @param first An iterator to the first character.
@@ -239,25 +229,58 @@ unicode_word_break_WB5_WB999(unicode_break_vector& r, std::vector<unicode_word_b
 template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] hi_inline unicode_break_vector unicode_word_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
-    auto size = narrow_cast<size_t>(std::distance(first, last));
-    auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
-
-    auto infos = std::vector<detail::unicode_word_break_info>{};
-    infos.reserve(size);
-    std::transform(first, last, std::back_inserter(infos), [&](hilet& item) {
-        hilet code_point = code_point_func(item);
-        hilet word_break_property = ucd_get_word_break_property(code_point);
-        hilet grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
-        return detail::unicode_word_break_info{
-            word_break_property, grapheme_cluster_break == unicode_grapheme_cluster_break::Extended_Pictographic};
-    });
-
-    detail::unicode_word_break_WB1_WB3d(r, infos);
-    detail::unicode_word_break_WB4(r, infos);
-    detail::unicode_word_break_WB5_WB999(r, infos);
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+
+    auto r = unicode_break_vector{};
+    r.reserve(size + 1);
+
+    auto state = detail::unicode_word_break_state{first, last, code_point_func};
+    for (auto i = 0_uz; i != size + 1; ++i) {
+        r.push_back(state.next());
+    }
     return r;
 }
 
+/** Find the next word break after a position.
+ *
+ * The search starts at the beginning of the line containing @a position,
+ * since there is always a word break after a newline (WB3a).
+ *
+ * @param first An iterator to the first character of the text.
+ * @param position An iterator to the character after which to search.
+ * @param last An iterator to one beyond the last character of the text.
+ * @param code_point_func A function to code-point from a character.
+ * @return An iterator to the character after the next word break, or @a last.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] constexpr It unicode_word_break_next(It first, It position, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    using enum unicode_word_break_property;
+    using info_type = detail::unicode_word_break_info;
+
+    if (position == last) {
+        return position;
+    }
+
+    auto start = position;
+    while (start != first) {
+        hilet prev = info_type{code_point_func(*std::prev(start))};
+        if (is_newline(prev) and not(prev == CR and info_type{code_point_func(*start)} == LF)) {
+            break;
+        }
+        --start;
+    }
+
+    // Run the state machine up to and including the break opportunity before @a position.
+    auto state = detail::unicode_word_break_state{start, last, code_point_func};
+    while (state.position() != position) {
+        std::ignore = state.next();
+    }
+    std::ignore = state.next();
+
+    return *unicode_word_break_iterator<It, ItEnd, CodePointFunc>{std::move(state)};
+}
+
 /** Wrap lines in text that are too wide.
  * This algorithm may modify white-space in text and change them into line separators.
  * Lines are separated using the U+2028 code-point, and paragraphs are separated by
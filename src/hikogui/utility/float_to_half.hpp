@@ -196,5 +196,39 @@ hi_target("sse,sse2,sse4.1")
     return r;
 }
 
+#if HI_HAS_X86
+hi_target("sse,sse2,avx,f16c")
+hi_inline void float_to_half_f16c(float const *src, uint16_t *dst, std::size_t size) noexcept
+{
+    auto i = 0_uz;
+    for (; i + 8 <= size; i += 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_ZERO));
+    }
+    for (; i != size; ++i) {
+        dst[i] = float_to_half_generic(src[i]);
+    }
+}
+#endif
+
+/** Convert an array of floats to halfs.
+ *
+ * @param src The floats to convert.
+ * @param dst The converted halfs, as bit-patterns.
+ * @param size The number of floats to convert.
+ */
+hi_inline void float_to_half(float const *src, uint16_t *dst, std::size_t size) noexcept
+{
+#if HI_HAS_X86
+    if (has_f16c()) {
+        return float_to_half_f16c(src, dst, size);
+    }
+#endif
+
+    for (auto i = 0_uz; i != size; ++i) {
+        dst[i] = float_to_half_generic(src[i]);
+    }
+}
+
 }}
 
+
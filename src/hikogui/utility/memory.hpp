@@ -365,7 +365,7 @@ constexpr void unaligned_store(T src, B *dst) noexcept
 {
     using unsigned_type = std::make_unsigned_t<T>;
 
-    hilet src_ = static_cast<unsigned_type>(src);
+    auto src_ = static_cast<unsigned_type>(src);
 
     if (not std::is_constant_evaluated()) {
         std::memcpy(dst, &src, sizeof(T));
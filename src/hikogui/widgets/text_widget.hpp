@@ -22,6 +22,8 @@
 #include <string>
 #include <array>
 #include <optional>
+#include <tuple>
+#include <algorithm>
 #include <future>
 #include <limits>
 #include <chrono>
@@ -166,17 +168,40 @@ public:
 
         // Read the latest text from the delegate.
         hi_assert_not_null(delegate);
-        _text_cache = delegate->read(*this);
+        auto new_text = delegate->read(*this);
 
         // Make sure that the current selection fits the new text.
-        _selection.resize(_text_cache.size());
+        _selection.resize(new_text.size());
 
         hilet actual_text_style = theme().text_style(*text_style);
-
-        // Create a new text_shaper with the new text.
         auto alignment_ = os_settings::left_to_right() ? *alignment : mirror(*alignment);
+        auto shaped_text_parameters =
+            shaped_text_parameters_type{actual_text_style, theme().scale, alignment_, os_settings::left_to_right()};
+
+        if (_shaped_text_parameters == shaped_text_parameters) {
+            // Only re-shape the part of the text that was edited, so that typing in
+            // a large document does not re-shape the whole document.
+            hilet prefix =
+                narrow_cast<size_t>(std::distance(_text_cache.cbegin(), std::ranges::mismatch(_text_cache, new_text).in1));
+            hilet max_suffix = std::min(_text_cache.size(), new_text.size()) - prefix;
+            hilet suffix = narrow_cast<size_t>(std::distance(
+                _text_cache.crbegin(),
+                std::mismatch(_text_cache.crbegin(), _text_cache.crbegin() + max_suffix, new_text.crbegin()).first));
+
+            if (prefix != _text_cache.size() or prefix != new_text.size()) {
+                _shaped_text.replace(
+                    prefix,
+                    _text_cache.size() - suffix,
+                    gstring_view{new_text}.substr(prefix, new_text.size() - suffix - prefix),
+                    actual_text_style);
+            }
 
-        _shaped_text = text_shaper{_text_cache, actual_text_style, theme().scale, alignment_, os_settings::left_to_right()};
+        } else {
+            // Create a new text_shaper with the new text.
+            _shaped_text = text_shaper{new_text, actual_text_style, theme().scale, alignment_, os_settings::left_to_right()};
+            _shaped_text_parameters = std::move(shaped_text_parameters);
+        }
+        _text_cache = std::move(new_text);
 
         hilet shaped_text_rectangle = ceil(_shaped_text.bounding_rectangle(std::numeric_limits<float>::infinity()));
         hilet shaped_text_size = shaped_text_rectangle.size();
@@ -769,8 +794,13 @@ private:
 
     enum class cursor_state_type { off, on, busy, none };
 
+    /** The style, scale, alignment and direction used to create `_shaped_text`.
+     */
+    using shaped_text_parameters_type = std::tuple<hi::text_style, float, hi::alignment, bool>;
+
     gstring _text_cache;
     text_shaper _shaped_text;
+    std::optional<shaped_text_parameters_type> _shaped_text_parameters;
 
     mutable box_constraints _constraints_cache;
 
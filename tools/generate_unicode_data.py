@@ -38,6 +38,10 @@ def parse_options():
     parser.add_argument("--line-break", dest="line_break_class_path", action="store", required=True)
     parser.add_argument("--line-break-classes-output", dest="line_break_classes_output_path", action="store", required=True)
     parser.add_argument("--line-break-classes-template", dest="line_break_classes_template_path", action="store", required=True)
+    parser.add_argument("--line-break-transitions-output", dest="line_break_transitions_output_path", action="store", required=True)
+    parser.add_argument("--line-break-transitions-template", dest="line_break_transitions_template_path", action="store", required=True)
+    parser.add_argument("--nfc-quick-checks-output", dest="nfc_quick_checks_output_path", action="store", required=True)
+    parser.add_argument("--nfc-quick-checks-template", dest="nfc_quick_checks_template_path", action="store", required=True)
     parser.add_argument("--prop-list", dest="prop_list_path", action="store", required=True)
     parser.add_argument("--scripts", dest="scripts_path", action="store", required=True)
     parser.add_argument("--scripts-output", dest="scripts_output_path", action="store", required=True)
@@ -45,10 +49,16 @@ def parse_options():
     parser.add_argument("--sentence-break-properties-output", dest="sentence_break_properties_output_path", action="store", required=True)
     parser.add_argument("--sentence-break-properties-template", dest="sentence_break_properties_template_path", action="store", required=True)
     parser.add_argument("--sentence-break-property", dest="sentence_break_property_path", action="store", required=True)
+    parser.add_argument("--sentence-break-transitions-output", dest="sentence_break_transitions_output_path", action="store", required=True)
+    parser.add_argument("--sentence-break-transitions-template", dest="sentence_break_transitions_template_path", action="store", required=True)
+    parser.add_argument("--text-properties-output", dest="text_properties_output_path", action="store", required=True)
+    parser.add_argument("--text-properties-template", dest="text_properties_template_path", action="store", required=True)
     parser.add_argument("--unicode-data", dest="unicode_data_path", action="store", required=True)
     parser.add_argument("--word-break-properties-output", dest="word_break_properties_output_path", action="store", required=True)
     parser.add_argument("--word-break-properties-template", dest="word_break_properties_template_path", action="store", required=True)
     parser.add_argument("--word-break-property", dest="word_break_property_path", action="store", required=True)
+    parser.add_argument("--word-break-transitions-output", dest="word_break_transitions_output_path", action="store", required=True)
+    parser.add_argument("--word-break-transitions-template", dest="word_break_transitions_template_path", action="store", required=True)
     return parser.parse_args()
 
 def main():
@@ -80,9 +90,14 @@ def main():
     ucd.generate_grapheme_cluster_breaks(options.grapheme_cluster_breaks_template_path, options.grapheme_cluster_breaks_output_path, descriptions)
     ucd.generate_lexical_classes(options.lexical_classes_template_path, options.lexical_classes_output_path, descriptions)
     ucd.generate_line_break_classes(options.line_break_classes_template_path, options.line_break_classes_output_path, descriptions)
+    ucd.generate_line_break_transitions(options.line_break_transitions_template_path, options.line_break_transitions_output_path, descriptions)
+    ucd.generate_nfc_quick_checks(options.nfc_quick_checks_template_path, options.nfc_quick_checks_output_path, descriptions)
     ucd.generate_scripts(options.scripts_template_path, options.scripts_output_path, descriptions)
     ucd.generate_sentence_break_properties(options.sentence_break_properties_template_path, options.sentence_break_properties_output_path, descriptions)
+    ucd.generate_sentence_break_transitions(options.sentence_break_transitions_template_path, options.sentence_break_transitions_output_path, descriptions)
     ucd.generate_word_break_properties(options.word_break_properties_template_path, options.word_break_properties_output_path, descriptions)
+    ucd.generate_word_break_transitions(options.word_break_transitions_template_path, options.word_break_transitions_output_path, descriptions)
+    ucd.generate_text_properties(options.text_properties_template_path, options.text_properties_output_path, descriptions)
 
 
 if __name__ == "__main__":
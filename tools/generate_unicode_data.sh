@@ -24,6 +24,8 @@ $PYTHON3 tools/generate_unicode_data.py \
     --general-categories-output=src/hikogui/unicode/ucd_general_categories.hpp \
     --lexical-classes-template=tools/ucd/ucd_lexical_classes.hpp.psp \
     --lexical-classes-output=src/hikogui/unicode/ucd_lexical_classes.hpp \
+    --nfc-quick-checks-template=tools/ucd/ucd_nfc_quick_checks.hpp.psp \
+    --nfc-quick-checks-output=src/hikogui/unicode/ucd_nfc_quick_checks.hpp \
     --scripts-template=tools/ucd/ucd_scripts.hpp.psp \
     --scripts-output=src/hikogui/unicode/ucd_scripts.hpp \
     --east-asian-widths-template=tools/ucd/ucd_east_asian_widths.hpp.psp \
@@ -38,10 +40,18 @@ $PYTHON3 tools/generate_unicode_data.py \
     --grapheme-cluster-breaks-output=src/hikogui/unicode/ucd_grapheme_cluster_breaks.hpp \
     --line-break-classes-template=tools/ucd/ucd_line_break_classes.hpp.psp \
     --line-break-classes-output=src/hikogui/unicode/ucd_line_break_classes.hpp \
+    --line-break-transitions-template=tools/ucd/ucd_line_break_transitions.hpp.psp \
+    --line-break-transitions-output=src/hikogui/unicode/ucd_line_break_transitions.hpp \
     --word-break-properties-template=tools/ucd/ucd_word_break_properties.hpp.psp \
     --word-break-properties-output=src/hikogui/unicode/ucd_word_break_properties.hpp \
+    --word-break-transitions-template=tools/ucd/ucd_word_break_transitions.hpp.psp \
+    --word-break-transitions-output=src/hikogui/unicode/ucd_word_break_transitions.hpp \
     --sentence-break-properties-template=tools/ucd/ucd_sentence_break_properties.hpp.psp \
     --sentence-break-properties-output=src/hikogui/unicode/ucd_sentence_break_properties.hpp \
+    --sentence-break-transitions-template=tools/ucd/ucd_sentence_break_transitions.hpp.psp \
+    --sentence-break-transitions-output=src/hikogui/unicode/ucd_sentence_break_transitions.hpp \
+    --text-properties-template=tools/ucd/ucd_text_properties.hpp.psp \
+    --text-properties-output=src/hikogui/unicode/ucd_text_properties.hpp \
     --canonical-combining-classes-template=tools/ucd/ucd_canonical_combining_classes.hpp.psp \
     --canonical-combining-classes-output=src/hikogui/unicode/ucd_canonical_combining_classes.hpp \
     --index-template=tools/ucd/ucd_index.hpp.psp \
@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
+def make_bidi_class_enum(descriptions):
+    """
+    The values of unicode_bidi_class, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"ON": 0, "L": 1, "R": 2}
+    for x in descriptions:
+        r.setdefault(x.bidi_class, len(r))
+    return r
+
 def generate_bidi_classes(template_path, output_path, descriptions):
     print("Processing bidi_classes:", file=sys.stderr, flush=True)
 
-    bidi_class_enum = {"ON": 0, "L": 1, "R": 2}
-    bidi_classes = []
-    for x in descriptions:
-        value = bidi_class_enum.setdefault(x.bidi_class, len(bidi_class_enum))
-        bidi_classes.append(value)
+    bidi_class_enum = make_bidi_class_enum(descriptions)
+    bidi_classes = [bidi_class_enum[x.bidi_class] for x in descriptions]
 
     bidi_classes, indices, chunk_size = deduplicate(bidi_classes)
     bidi_classes_bytes, bidi_class_width = bits_as_bytes(bidi_classes)
@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
+def make_east_asian_width_enum(descriptions):
+    """
+    The values of unicode_east_asian_width, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"N": 0}
+    for x in descriptions:
+        r.setdefault(x.east_asian_width, len(r))
+    return r
+
 def generate_east_asian_widths(template_path, output_path, descriptions):
     print("Processing east_asian_widths:", file=sys.stderr, flush=True)
 
-    east_asian_width_enum = {"N": 0}
-    east_asian_widths = []
-    for x in descriptions:
-        value = east_asian_width_enum.setdefault(x.east_asian_width, len(east_asian_width_enum))
-        east_asian_widths.append(value)
+    east_asian_width_enum = make_east_asian_width_enum(descriptions)
+    east_asian_widths = [east_asian_width_enum[x.east_asian_width] for x in descriptions]
 
     east_asian_widths, indices, chunk_size = deduplicate(east_asian_widths)
     east_asian_widths_bytes, east_asian_width_width = bits_as_bytes(east_asian_widths)
@@ -4,9 +4,12 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_general_categories(template_path, output_path, descriptions):
-    print("Processing general_categories:", file=sys.stderr, flush=True)
+def make_general_category_enum(descriptions):
+    """
+    The values of unicode_general_category.
 
+    This is also used by the generators of other tables that store this property.
+    """
     # For performance improvement of the is_* functions the enum values should be
     # sorted by grouped by their first letter. "Cn" is used most, move it to first person
     # so that the table will mostly contain zeros.
@@ -14,9 +17,12 @@ def generate_general_categories(template_path, output_path, descriptions):
     general_category_enum_names.remove("Cn")
     general_category_enum_names.insert(0, "Cn")
 
-    general_category_enum = {}
-    for i, name in enumerate(general_category_enum_names):
-        general_category_enum[name] = i
+    return {name: i for i, name in enumerate(general_category_enum_names)}
+
+def generate_general_categories(template_path, output_path, descriptions):
+    print("Processing general_categories:", file=sys.stderr, flush=True)
+
+    general_category_enum = make_general_category_enum(descriptions)
 
     general_categories = [general_category_enum[x.general_category] for x in descriptions]
 
@@ -5,15 +5,28 @@ from .bits_as_bytes import bits_as_bytes
 import sys
 
 
+def grapheme_cluster_break_name(description):
+    """
+    The grapheme cluster break of a code-point, Extended_Pictographic is merged into this property.
+    """
+    return "Extended_Pictographic" if description.extended_pictographic else description.grapheme_cluster_break
+
+def make_grapheme_cluster_break_enum(descriptions):
+    """
+    The values of unicode_grapheme_cluster_break, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"Other": 0}
+    for x in descriptions:
+        r.setdefault(grapheme_cluster_break_name(x), len(r))
+    return r
+
 def generate_grapheme_cluster_breaks(template_path, output_path, descriptions):
     print("Processing grapheme_cluster_break:", file=sys.stderr, flush=True)
 
-    grapheme_cluster_break_enum = {"Other": 0}
-    grapheme_cluster_breaks = []
-    for x in descriptions:
-        name = "Extended_Pictographic" if x.extended_pictographic else x.grapheme_cluster_break
-        value = grapheme_cluster_break_enum.setdefault(name, len(grapheme_cluster_break_enum))
-        grapheme_cluster_breaks.append(value)
+    grapheme_cluster_break_enum = make_grapheme_cluster_break_enum(descriptions)
+    grapheme_cluster_breaks = [grapheme_cluster_break_enum[grapheme_cluster_break_name(x)] for x in descriptions]
 
     grapheme_cluster_breaks, indices, chunk_size = deduplicate(grapheme_cluster_breaks)
     grapheme_cluster_breaks_bytes, grapheme_cluster_break_width = bits_as_bytes(grapheme_cluster_breaks)
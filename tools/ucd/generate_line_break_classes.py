@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
+def make_line_break_class_enum(descriptions):
+    """
+    The values of unicode_line_break_class, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"XX": 0}
+    for x in descriptions:
+        r.setdefault(x.line_break, len(r))
+    return r
+
 def generate_line_break_classes(template_path, output_path, descriptions):
     print("Processing line_break_class:", file=sys.stderr, flush=True)
 
-    line_break_class_enum = {"XX": 0}
-    line_break_classes = []
-    for x in descriptions:
-        value = line_break_class_enum.setdefault(x.line_break, len(line_break_class_enum))
-        line_break_classes.append(value)
+    line_break_class_enum = make_line_break_class_enum(descriptions)
+    line_break_classes = [line_break_class_enum[x.line_break] for x in descriptions]
 
     line_break_classes, indices, chunk_size = deduplicate(line_break_classes)
     line_break_classes_bytes, line_break_class_width = bits_as_bytes(line_break_classes)
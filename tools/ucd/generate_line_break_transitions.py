@@ -0,0 +1,182 @@
+from .psp import psp_execute
+from .generate_line_break_classes import make_line_break_class_enum
+from .state_machine import build_state_machine, encode_state_machine, first_action
+import sys
+
+# The actions of the line break state machine. The first three are the break opportunity
+# before the next character, the others are a condition which prevents the break when true.
+line_break_actions = [
+    "no",
+    "yes",
+    "mandatory",
+    "LB25", # The character after the next, ignoring CM and ZWJ, is a NU.
+]
+
+# The symbols that are added to the line break classes, for the rules that need
+# other properties of a character.
+line_break_extra_symbols = [
+    "OP_FWH", # OP with East_Asian_Width F, W or H.
+    "CP_FWH", # CP with East_Asian_Width F, W or H.
+    "ID_ExtPict_Cn", # Unassigned Extended_Pictographic; which all have the ID line break class.
+]
+
+def base_class(x):
+    """
+    The line break class of a symbol.
+    """
+    if x == "OP_FWH":
+        return "OP"
+    elif x == "CP_FWH":
+        return "CP"
+    elif x == "ID_ExtPict_Cn":
+        return "ID"
+    else:
+        return x
+
+def resolve_class(x):
+    """
+    LB1: Resolve the line break classes that only depend on the line break class.
+
+    SA is resolved to AL here; the characters with SA in the general categories Mn and Mc
+    must be resolved to CM before they are passed to the state machine.
+    """
+    if x in ("AI", "SG", "XX", "SA"):
+        return "AL"
+    elif x == "CJ":
+        return "NS"
+    else:
+        return x
+
+def line_break_rules(state, next):
+    """
+    The actions of the line break rules of UAX #14 that apply before the next character.
+
+    The numbers are tailored with the regular expression of example 7 in section 8.2 of UAX #14,
+    as used by LineBreakTest.txt: `(PR | PO)? (OP | HY)? NU (NU | SY | IS)* (CL | CP)? (PR | PO)?`
+
+    @param state The state after the previous character: (sot, ZWJ, prev, before_sp, HL_HY_BA, number, RI_odd)
+                 where `prev` is the previous character after LB9 and LB10, `before_sp` the class before the
+                 SP* that end at the previous character, `HL_HY_BA` is true after `HL (HY | BA)`,
+                 `number` is the part of the number regular expression that ends at the previous
+                 character and `RI_odd` is true after an odd number of RI.
+    @param next The resolved symbol of the next character.
+    @return The actions of the rules that apply, in order.
+    """
+    sot, ZWJ, prev, before_sp, HL_HY_BA, number, RI_odd = state
+
+    p = base_class(prev)
+    n = base_class(next)
+
+    # LB10: Treat any remaining CM or ZWJ as AL.
+    next10 = "AL" if n in ("CM", "ZWJ") else next
+    n10 = base_class(next10)
+
+    return [action for applies, action in (
+        (sot, "no"), # LB2
+        (p == "BK", "mandatory"), # LB4
+        (p == "CR" and n == "LF", "no"), # LB5
+        (p in ("CR", "LF", "NL"), "mandatory"), # LB5
+        (n in ("BK", "CR", "LF", "NL"), "no"), # LB6
+        (n in ("SP", "ZW"), "no"), # LB7
+        (before_sp == "ZW", "yes"), # LB8
+        (ZWJ, "no"), # LB8a
+        (n in ("CM", "ZWJ") and p not in ("BK", "CR", "LF", "NL", "SP", "ZW"), "no"), # LB9
+        (p == "WJ" or n10 == "WJ", "no"), # LB11
+        (p == "GL", "no"), # LB12
+        (p not in ("SP", "BA", "HY") and n10 == "GL", "no"), # LB12a
+        (n10 in ("CL", "CP", "EX", "IS", "SY"), "no"), # LB13
+        (before_sp == "OP", "no"), # LB14
+        (before_sp == "QU" and n10 == "OP", "no"), # LB15
+        (before_sp in ("CL", "CP") and n10 == "NS", "no"), # LB16
+        (before_sp == "B2" and n10 == "B2", "no"), # LB17
+        (p == "SP", "yes"), # LB18
+        (p == "QU" or n10 == "QU", "no"), # LB19
+        (p == "CB" or n10 == "CB", "yes"), # LB20
+        (p == "BB" or n10 in ("BA", "HY", "NS"), "no"), # LB21
+        (HL_HY_BA, "no"), # LB21a
+        (p == "SY" and n10 == "HL", "no"), # LB21b
+        (n10 == "IN", "no"), # LB22
+        (p in ("AL", "HL") and n10 == "NU", "no"), # LB23
+        (p == "NU" and n10 in ("AL", "HL"), "no"), # LB23
+        (p == "PR" and n10 in ("ID", "EB", "EM"), "no"), # LB23a
+        (p in ("ID", "EB", "EM") and n10 == "PO", "no"), # LB23a
+        (p in ("PR", "PO") and n10 in ("AL", "HL"), "no"), # LB24
+        (p in ("AL", "HL") and n10 in ("PR", "PO"), "no"), # LB24
+        (p in ("PR", "PO") and n10 == "NU", "no"), # LB25
+        (p in ("PR", "PO") and n10 in ("OP", "HY"), "LB25"),
+        (p in ("OP", "HY") and n10 == "NU", "no"), # LB25
+        (number == "NU" and n10 in ("NU", "SY", "IS", "CL", "CP"), "no"), # LB25
+        (number in ("NU", "CL") and n10 in ("PO", "PR"), "no"), # LB25
+        (p == "JL" and n10 in ("JL", "JV", "H2", "H3"), "no"), # LB26
+        (p in ("JV", "H2") and n10 in ("JV", "JT"), "no"), # LB26
+        (p in ("JT", "H3") and n10 == "JT", "no"), # LB26
+        (p in ("JL", "JV", "JT", "H2", "H3") and n10 == "PO", "no"), # LB27
+        (p == "PR" and n10 in ("JL", "JV", "JT", "H2", "H3"), "no"), # LB27
+        (p in ("AL", "HL") and n10 in ("AL", "HL"), "no"), # LB28
+        (p == "IS" and n10 in ("AL", "HL"), "no"), # LB29
+        (p in ("AL", "HL", "NU") and next10 == "OP", "no"), # LB30
+        (prev == "CP" and n10 in ("AL", "HL", "NU"), "no"), # LB30
+        (p == "RI" and n10 == "RI" and RI_odd, "no"), # LB30a
+        (p == "EB" and n10 == "EM", "no"), # LB30b
+        (prev == "ID_ExtPict_Cn" and n10 == "EM", "no"), # LB30b
+        (True, "yes"), # LB31
+    ) if applies]
+
+def line_break_step(state, next):
+    sot, ZWJ, prev, before_sp, HL_HY_BA, number, RI_odd = state
+
+    next = resolve_class(next)
+    action = first_action(line_break_rules(state, next))
+
+    p = base_class(prev)
+    n = base_class(next)
+    ZWJ = n == "ZWJ"
+
+    if not sot and n in ("CM", "ZWJ") and p not in ("BK", "CR", "LF", "NL", "SP", "ZW"):
+        # LB9: Treat X (CM | ZWJ)* as X.
+        return action, (False, ZWJ, prev, before_sp, HL_HY_BA, number, RI_odd)
+
+    if n in ("CM", "ZWJ"):
+        # LB10: Treat any remaining CM or ZWJ as AL.
+        next = n = "AL"
+
+    if n != "SP":
+        before_sp = n if n in ("OP", "QU", "CL", "CP", "B2", "ZW") else None
+
+    HL_HY_BA = p == "HL" and n in ("HY", "BA")
+
+    if n == "NU" or (number == "NU" and n in ("SY", "IS")):
+        number = "NU"
+    elif number == "NU" and n in ("CL", "CP"):
+        number = "CL"
+    else:
+        number = None
+
+    RI_odd = n == "RI" and not (p == "RI" and RI_odd)
+    return action, (False, ZWJ, next, before_sp, HL_HY_BA, number, RI_odd)
+
+def generate_line_break_transitions(template_path, output_path, descriptions):
+    print("Processing line_break_transitions:", file=sys.stderr, flush=True)
+
+    line_break_class_enum = make_line_break_class_enum(descriptions)
+    for x in descriptions:
+        if x.extended_pictographic and x.general_category == "Cn" and x.line_break != "ID":
+            raise RuntimeError("Unassigned Extended_Pictographic without the ID line break class")
+
+    symbols = [name for name, value in sorted(line_break_class_enum.items(), key=lambda x: x[1])]
+    symbols += line_break_extra_symbols
+    start = (True, False, None, None, False, None, False)
+    transitions = build_state_machine(start, symbols, line_break_step)
+
+    transitions, action_width, transition_type = encode_state_machine(transitions, line_break_actions)
+
+    psp_execute(
+        template_path,
+        output_path,
+        line_break_class_enum=line_break_class_enum,
+        extra_symbols=[(name, len(line_break_class_enum) + i) for i, name in enumerate(line_break_extra_symbols)],
+        actions=line_break_actions,
+        action_width=action_width,
+        transition_type=transition_type,
+        transitions=transitions
+    )
@@ -0,0 +1,57 @@
+
+from .psp import psp_execute
+from .deduplicate import deduplicate
+from .bits_as_bytes import bits_as_bytes
+import sys
+
+def generate_nfc_quick_checks(template_path, output_path, descriptions):
+    print("Processing nfc_quick_checks:", file=sys.stderr, flush=True)
+
+    # Unicode standard annex #15, section 9 "Detecting Normalization Forms".
+    # The NFC_QC property is derived from the canonical decompositions, so
+    # that DerivedNormalizationProps.txt is not needed.
+    yes, maybe, no = 0, 1, 2
+    nfc_quick_checks = [yes] * len(descriptions)
+
+    for code_point, d in enumerate(descriptions):
+        if d.decomposition_type is not None or len(d.decomposition_mapping) == 0:
+            continue
+
+        first_cp = d.decomposition_mapping[0]
+        full_composition_exclusion = \
+            d.composition_exclusion or \
+            len(d.decomposition_mapping) == 1 or \
+            d.canonical_combining_class != 0 or \
+            descriptions[first_cp].canonical_combining_class != 0
+
+        if full_composition_exclusion:
+            # This code-point never appears in NFC.
+            nfc_quick_checks[code_point] = no
+
+        elif len(d.decomposition_mapping) == 2:
+            # The second code-point may compose with a previous code-point.
+            second_cp = d.decomposition_mapping[1]
+            if nfc_quick_checks[second_cp] == yes:
+                nfc_quick_checks[second_cp] = maybe
+
+    nfc_quick_checks, indices, chunk_size = deduplicate(nfc_quick_checks)
+    nfc_quick_checks_bytes, nfc_quick_check_width = bits_as_bytes(nfc_quick_checks)
+    indices_bytes, index_width = bits_as_bytes(indices)
+
+    print("    chunk-size={} #indices={}:{} #nfc_quick_checks={}:{} total={} bytes".format(
+        chunk_size,
+        len(indices), index_width,
+        len(nfc_quick_checks), nfc_quick_check_width,
+        len(indices_bytes) + len(nfc_quick_checks_bytes)),
+        file=sys.stderr)
+
+    psp_execute(
+        template_path,
+        output_path,
+        chunk_size=chunk_size,
+        indices_size=len(indices),
+        index_width=index_width,
+        indices_bytes=indices_bytes,
+        nfc_quick_check_width=nfc_quick_check_width,
+        nfc_quick_checks_bytes=nfc_quick_checks_bytes
+    )
@@ -5,14 +5,22 @@ from .bits_as_bytes import bits_as_bytes
 import sys
 
 
+def make_sentence_break_property_enum(descriptions):
+    """
+    The values of unicode_sentence_break_property, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"Other": 0}
+    for x in descriptions:
+        r.setdefault(x.sentence_break, len(r))
+    return r
+
 def generate_sentence_break_properties(template_path, output_path, descriptions):
     print("Processing sentence_break_property:", file=sys.stderr, flush=True)
 
-    sentence_break_property_enum = {"Other": 0}
-    sentence_break_properties = []
-    for x in descriptions:
-        value = sentence_break_property_enum.setdefault(x.sentence_break, len(sentence_break_property_enum))
-        sentence_break_properties.append(value)
+    sentence_break_property_enum = make_sentence_break_property_enum(descriptions)
+    sentence_break_properties = [sentence_break_property_enum[x.sentence_break] for x in descriptions]
 
     sentence_break_properties, indices, chunk_size = deduplicate(sentence_break_properties)
     sentence_break_properties_bytes, sentence_break_property_width = bits_as_bytes(sentence_break_properties)
@@ -0,0 +1,93 @@
+from .psp import psp_execute
+from .generate_sentence_break_properties import make_sentence_break_property_enum
+from .state_machine import build_state_machine, encode_state_machine, first_action
+import sys
+
+# The actions of the sentence break state machine. The first two are the break opportunity
+# before the next character, the others are a condition which prevents the break when true.
+sentence_break_actions = [
+    "no",
+    "yes",
+    "SB8", # The text from the next character is: [^OLetter Upper Lower ParaSep SATerm]* Lower
+]
+
+def is_ParaSep(x):
+    return x == "Sep" or x == "CR" or x == "LF"
+
+def is_SATerm(x):
+    return x == "STerm" or x == "ATerm"
+
+def sentence_break_rules(state, next):
+    """
+    The actions of the sentence break rules of UAX #29 that apply before the next character.
+
+    @param state The state after the previous character: (sot, raw, prev, letter_before_prev, term, term_sp)
+                 where `term` is the SATerm of a `SATerm Close* Sp*` sequence that ends at the previous
+                 character, and `term_sp` is true when this sequence includes a Sp.
+    @param next The sentence break property of the next character.
+    @return The actions of the rules that apply, in order.
+    """
+    sot, raw, prev, letter_before_prev, term, term_sp = state
+
+    # SB8 checks the text from the next character, it is only needed when the next character
+    # itself may start the `[^OLetter Upper Lower ParaSep SATerm]* Lower` sequence.
+    SB8 = "no" if next == "Lower" else "SB8"
+
+    return [action for applies, action in (
+        (sot, "yes"), # SB1
+        (raw == "CR" and next == "LF", "no"), # SB3
+        (is_ParaSep(raw), "yes"), # SB4
+        (next == "Extend" or next == "Format", "no"), # SB5
+        (prev == "ATerm" and next == "Numeric", "no"), # SB6
+        (letter_before_prev and prev == "ATerm" and next == "Upper", "no"), # SB7
+        (term == "ATerm" and not (next in ("OLetter", "Upper") or is_ParaSep(next) or is_SATerm(next)), SB8),
+        (term is not None and (next == "SContinue" or is_SATerm(next)), "no"), # SB8a
+        (term is not None and not term_sp and (next == "Close" or next == "Sp" or is_ParaSep(next)), "no"), # SB9
+        (term is not None and (next == "Sp" or is_ParaSep(next)), "no"), # SB10
+        (term is not None, "yes"), # SB11
+        (True, "no"), # SB998
+    ) if applies]
+
+def sentence_break_step(state, next):
+    sot, raw, prev, letter_before_prev, term, term_sp = state
+
+    action = first_action(sentence_break_rules(state, next))
+
+    if not sot and not is_ParaSep(raw) and (next == "Extend" or next == "Format"):
+        # SB5: Extend and Format are ignored, only the character directly before the next changes.
+        return action, (False, None, prev, letter_before_prev, term, term_sp)
+
+    if is_SATerm(next):
+        term, term_sp = next, False
+    elif next == "Close" and term is not None and not term_sp:
+        pass
+    elif next == "Sp" and term is not None:
+        term_sp = True
+    else:
+        term, term_sp = None, False
+
+    # Only remember the properties that are used by the rules.
+    raw = next if is_ParaSep(next) else None
+    letter_before_prev = prev == "Upper" or prev == "Lower"
+    return action, (False, raw, next, letter_before_prev, term, term_sp)
+
+def generate_sentence_break_transitions(template_path, output_path, descriptions):
+    print("Processing sentence_break_transitions:", file=sys.stderr, flush=True)
+
+    sentence_break_property_enum = make_sentence_break_property_enum(descriptions)
+
+    symbols = [name for name, value in sorted(sentence_break_property_enum.items(), key=lambda x: x[1])]
+    start = (True, None, None, False, None, False)
+    transitions = build_state_machine(start, symbols, sentence_break_step)
+
+    transitions, action_width, transition_type = encode_state_machine(transitions, sentence_break_actions)
+
+    psp_execute(
+        template_path,
+        output_path,
+        sentence_break_property_enum=sentence_break_property_enum,
+        actions=sentence_break_actions,
+        action_width=action_width,
+        transition_type=transition_type,
+        transitions=transitions
+    )
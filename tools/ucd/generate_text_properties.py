@@ -0,0 +1,81 @@
+from .psp import psp_execute
+from .deduplicate import deduplicate
+from .bits_as_bytes import bits_as_bytes
+from .generate_general_categories import make_general_category_enum
+from .generate_grapheme_cluster_breaks import make_grapheme_cluster_break_enum, grapheme_cluster_break_name
+from .generate_line_break_classes import make_line_break_class_enum
+from .generate_east_asian_widths import make_east_asian_width_enum
+from .generate_word_break_properties import make_word_break_property_enum
+from .generate_sentence_break_properties import make_sentence_break_property_enum
+from .generate_bidi_classes import make_bidi_class_enum
+from .generate_scripts import script_enum
+import sys
+
+def generate_text_properties(template_path, output_path, descriptions):
+    print("Processing text_properties:", file=sys.stderr, flush=True)
+
+    # The properties that are looked up for each character during text analysis
+    # are packed in a single record, so that a single lookup touches one cache-line.
+    # The values are the same as the values of the enums in the separate tables.
+    general_category_enum = make_general_category_enum(descriptions)
+    grapheme_cluster_break_enum = make_grapheme_cluster_break_enum(descriptions)
+    line_break_class_enum = make_line_break_class_enum(descriptions)
+    east_asian_width_enum = make_east_asian_width_enum(descriptions)
+    word_break_property_enum = make_word_break_property_enum(descriptions)
+    sentence_break_property_enum = make_sentence_break_property_enum(descriptions)
+    bidi_class_enum = make_bidi_class_enum(descriptions)
+
+    fields = {
+        "general_category": [general_category_enum[x.general_category] for x in descriptions],
+        "grapheme_cluster_break": [grapheme_cluster_break_enum[grapheme_cluster_break_name(x)] for x in descriptions],
+        "line_break_class": [line_break_class_enum[x.line_break] for x in descriptions],
+        "east_asian_width": [east_asian_width_enum[x.east_asian_width] for x in descriptions],
+        "word_break_property": [word_break_property_enum[x.word_break] for x in descriptions],
+        "sentence_break_property": [sentence_break_property_enum[x.sentence_break] for x in descriptions],
+        "bidi_class": [bidi_class_enum[x.bidi_class] for x in descriptions],
+        "script": [script_enum[x.script] for x in descriptions],
+    }
+
+    # Pack the fields from the least significant bit.
+    field_layout = []
+    shift = 0
+    for name, values in fields.items():
+        width = max(values).bit_length()
+        field_layout.append((name, shift, width))
+        shift += width
+    assert(shift <= 64)
+
+    # Deduplicate the records, so that the trie only needs to hold an index to a record.
+    record_enum = {}
+    record_indices = []
+    for i in range(len(descriptions)):
+        record = 0
+        for name, shift, width in field_layout:
+            record |= fields[name][i] << shift
+        record_indices.append(record_enum.setdefault(record, len(record_enum)))
+    records = list(record_enum.keys())
+
+    record_indices, indices, chunk_size = deduplicate(record_indices)
+    record_indices_bytes, record_index_width = bits_as_bytes(record_indices)
+    indices_bytes, index_width = bits_as_bytes(indices)
+
+    print("    chunk-size={} #indices={}:{} #record_indices={}:{} #records={}:64 total={} bytes".format(
+        chunk_size,
+        len(indices), index_width,
+        len(record_indices), record_index_width,
+        len(records),
+        len(indices_bytes) + len(record_indices_bytes) + len(records) * 8),
+        file=sys.stderr)
+
+    psp_execute(
+        template_path,
+        output_path,
+        chunk_size=chunk_size,
+        indices_size=len(indices),
+        index_width=index_width,
+        indices_bytes=indices_bytes,
+        record_index_width=record_index_width,
+        record_indices_bytes=record_indices_bytes,
+        records=records,
+        field_layout=field_layout
+    )
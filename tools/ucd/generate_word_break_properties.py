@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
+def make_word_break_property_enum(descriptions):
+    """
+    The values of unicode_word_break_property, in the order that they are first used by the code-points.
+
+    This is also used by the generators of other tables that store this property.
+    """
+    r = {"Other": 0}
+    for x in descriptions:
+        r.setdefault(x.word_break, len(r))
+    return r
+
 def generate_word_break_properties(template_path, output_path, descriptions):
     print("Processing word_break_property:", file=sys.stderr, flush=True)
 
-    word_break_property_enum = {"Other": 0}
-    word_break_properties = []
-    for x in descriptions:
-        value = word_break_property_enum.setdefault(x.word_break, len(word_break_property_enum))
-        word_break_properties.append(value)
+    word_break_property_enum = make_word_break_property_enum(descriptions)
+    word_break_properties = [word_break_property_enum[x.word_break] for x in descriptions]
 
     word_break_properties, indices, chunk_size = deduplicate(word_break_properties)
     word_break_properties_bytes, word_break_property_width = bits_as_bytes(word_break_properties)
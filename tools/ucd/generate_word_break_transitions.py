@@ -0,0 +1,101 @@
+from .psp import psp_execute
+from .generate_word_break_properties import make_word_break_property_enum
+from .state_machine import build_state_machine, encode_state_machine, first_action
+import sys
+
+# The actions of the word break state machine. The first two are the break opportunity
+# before the next character, the others are a condition which prevents the break when true.
+word_break_actions = [
+    "no",
+    "yes",
+    "WB3c", # The next character is Extended_Pictographic.
+    "WB6", # The character after the next, ignoring Extend, Format and ZWJ, is an AHLetter.
+    "WB7b", # The character after the next, ignoring Extend, Format and ZWJ, is a Hebrew_Letter.
+    "WB12", # The character after the next, ignoring Extend, Format and ZWJ, is a Numeric.
+]
+
+def is_AHLetter(x):
+    return x == "ALetter" or x == "Hebrew_Letter"
+
+def is_MidNumLetQ(x):
+    return x == "MidNumLet" or x == "Single_Quote"
+
+def is_newline(x):
+    return x == "Newline" or x == "CR" or x == "LF"
+
+def word_break_rules(state, next, pictographic_properties):
+    """
+    The actions of the word break rules of UAX #29 that apply before the next character.
+
+    @param state The state after the previous character: (sot, raw, prev, prev_prev, RI_odd)
+    @param next The word break property of the next character.
+    @param pictographic_properties The word break properties of Extended_Pictographic characters.
+    @return The actions of the rules that apply, in order.
+    """
+    sot, raw, prev, prev_prev, RI_odd = state
+
+    return [action for applies, action in (
+        (sot, "yes"), # WB1
+        (raw == "CR" and next == "LF", "no"), # WB3
+        (is_newline(raw) or is_newline(next), "yes"), # WB3a, WB3b
+        (raw == "ZWJ" and next in pictographic_properties, "WB3c"),
+        (raw == "WSegSpace" and next == "WSegSpace", "no"), # WB3d
+        (next in ("Extend", "Format", "ZWJ"), "no"), # WB4
+        (is_AHLetter(prev) and is_AHLetter(next), "no"), # WB5
+        (is_AHLetter(prev) and (next == "MidLetter" or is_MidNumLetQ(next)), "WB6"),
+        (is_AHLetter(prev_prev) and (prev == "MidLetter" or is_MidNumLetQ(prev)) and is_AHLetter(next), "no"), # WB7
+        (prev == "Hebrew_Letter" and next == "Single_Quote", "no"), # WB7a
+        (prev == "Hebrew_Letter" and next == "Double_Quote", "WB7b"),
+        (prev_prev == "Hebrew_Letter" and prev == "Double_Quote" and next == "Hebrew_Letter", "no"), # WB7c
+        (prev == "Numeric" and next == "Numeric", "no"), # WB8
+        (is_AHLetter(prev) and next == "Numeric", "no"), # WB9
+        (prev == "Numeric" and is_AHLetter(next), "no"), # WB10
+        (prev_prev == "Numeric" and (prev == "MidNum" or is_MidNumLetQ(prev)) and next == "Numeric", "no"), # WB11
+        (prev == "Numeric" and (next == "MidNum" or is_MidNumLetQ(next)), "WB12"),
+        (prev == "Katakana" and next == "Katakana", "no"), # WB13
+        ((is_AHLetter(prev) or prev in ("Numeric", "Katakana", "ExtendNumLet")) and next == "ExtendNumLet", "no"), # WB13a
+        (prev == "ExtendNumLet" and (is_AHLetter(next) or next in ("Numeric", "Katakana")), "no"), # WB13b
+        (prev == "Regional_Indicator" and next == "Regional_Indicator" and RI_odd, "no"), # WB15, WB16
+        (True, "yes"), # WB999
+    ) if applies]
+
+def make_word_break_step(pictographic_properties):
+    def step(state, next):
+        sot, raw, prev, prev_prev, RI_odd = state
+
+        action = first_action(word_break_rules(state, next, pictographic_properties))
+
+        if not sot and not is_newline(raw) and next in ("Extend", "Format", "ZWJ"):
+            # WB4: Extend, Format and ZWJ are ignored, only the character directly before the next changes.
+            raw = next if next == "ZWJ" else None
+            return action, (False, raw, prev, prev_prev, RI_odd)
+
+        # Only remember the properties that are used by the rules.
+        raw = next if next in ("CR", "LF", "Newline", "ZWJ", "WSegSpace") else None
+        prev_prev = prev if prev in ("ALetter", "Hebrew_Letter", "Numeric") else None
+        RI_odd = next == "Regional_Indicator" and not (prev == "Regional_Indicator" and RI_odd)
+        return action, (False, raw, next, prev_prev, RI_odd)
+
+    return step
+
+def generate_word_break_transitions(template_path, output_path, descriptions):
+    print("Processing word_break_transitions:", file=sys.stderr, flush=True)
+
+    word_break_property_enum = make_word_break_property_enum(descriptions)
+    pictographic_properties = set(x.word_break for x in descriptions if x.extended_pictographic)
+
+    symbols = [name for name, value in sorted(word_break_property_enum.items(), key=lambda x: x[1])]
+    start = (True, None, None, None, False)
+    transitions = build_state_machine(start, symbols, make_word_break_step(pictographic_properties))
+
+    transitions, action_width, transition_type = encode_state_machine(transitions, word_break_actions)
+
+    psp_execute(
+        template_path,
+        output_path,
+        word_break_property_enum=word_break_property_enum,
+        actions=word_break_actions,
+        action_width=action_width,
+        transition_type=transition_type,
+        transitions=transitions
+    )
@@ -0,0 +1,115 @@
+import sys
+
+def minimize_state_machine(rows):
+    """
+    Merge the states that can not be distinguished from each other.
+
+    Two states are merged when they have the same action for each symbol,
+    and their transitions go to states that are merged as well (Moore's algorithm).
+
+    @param rows A list of rows, one for each state. Each row has an (action, next-state) tuple for each symbol.
+    @return A list of rows of the merged states, the first state stays first.
+    """
+
+    # Start with the states grouped by their actions.
+    classes = [tuple(action for action, _ in row) for row in rows]
+    num_classes = 0
+    while True:
+        keys = [(classes[i], tuple(classes[next_state] for _, next_state in row)) for i, row in enumerate(rows)]
+
+        # Number the classes in order of the first state in each class.
+        numbers = {}
+        for key in keys:
+            numbers.setdefault(key, len(numbers))
+        classes = [numbers[key] for key in keys]
+
+        if len(numbers) == num_classes:
+            break
+        num_classes = len(numbers)
+
+    r = [None] * num_classes
+    for i, row in enumerate(rows):
+        if r[classes[i]] is None:
+            r[classes[i]] = [(action, classes[next_state]) for action, next_state in row]
+    return r
+
+
+def build_state_machine(start, symbols, step):
+    """
+    Build the transition table of a state machine.
+
+    The states are found by following all transitions from the start state,
+    after which the states that can not be distinguished are merged.
+
+    @param start The start state, a hashable value.
+    @param symbols A list of the input symbols.
+    @param step A function `(state, symbol) -> (action, next-state)`.
+    @return A list of rows, one for each state with the start state first.
+            Each row has an (action, next-state-index) tuple for each symbol.
+    """
+
+    states = [start]
+    state_indices = {start: 0}
+    rows = []
+
+    i = 0
+    while i < len(states):
+        row = []
+        for symbol in symbols:
+            action, next_state = step(states[i], symbol)
+            next_index = state_indices.setdefault(next_state, len(states))
+            if next_index == len(states):
+                states.append(next_state)
+            row.append((action, next_index))
+
+        rows.append(row)
+        i += 1
+
+    r = minimize_state_machine(rows)
+    print("    #states={} #minimized-states={} #symbols={}".format(len(rows), len(r), len(symbols)), file=sys.stderr)
+    return r
+
+
+def first_action(actions):
+    """
+    The action of the first rule that applies.
+
+    Some rules only apply when a condition is true that is checked at run-time,
+    such as looking ahead in the text. The rules that need a condition all
+    prevent a break, so the condition only needs to be checked when the first
+    unconditional rule after it would break.
+
+    @param actions The actions of the rules that apply, in order of the rules.
+    @return The action.
+    """
+    for i, action in enumerate(actions):
+        if action in ("no", "yes", "mandatory"):
+            for condition in reversed(actions[:i]):
+                if action == "yes":
+                    action = condition
+                elif action != "no":
+                    raise RuntimeError("Conditional rule {} is followed by conditional rule {}".format(condition, action))
+            return action
+
+    raise RuntimeError("No unconditional rule applies")
+
+
+def encode_state_machine(transitions, actions):
+    """
+    Encode each transition of a state machine as an integer: `next-state << action-width | action`.
+
+    @param transitions The rows of the state machine, as returned by build_state_machine().
+    @param actions The names of the actions, a transition's action is the index in this list.
+    @return The encoded rows, the action-width and the C++ integer type of a transition.
+    """
+    action_width = max(1, (len(actions) - 1).bit_length())
+    state_width = max(1, (len(transitions) - 1).bit_length())
+    if action_width + state_width <= 8:
+        transition_type = "uint8_t"
+    elif action_width + state_width <= 16:
+        transition_type = "uint16_t"
+    else:
+        raise RuntimeError("Too many states in the state machine")
+
+    rows = [[(next_state << action_width) | actions.index(action) for action, next_state in row] for row in transitions]
+    return rows, action_width, transition_type